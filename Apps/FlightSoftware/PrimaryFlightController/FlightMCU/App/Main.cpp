@@ -17,10 +17,9 @@ extern "C" {
     void vApplicationIdleHook( void );
 }
 
+// The rate groups are driven by the block driver tick task, so the idle
+// task has nothing to do
 void vApplicationIdleHook( void ){
-    run1cycle();
-    //gioToggleBit(gioPORTB, 1);
-    for(uint32_t i=0; i<2000000; i++) asm("  NOP");
 }
 
 void main(void)
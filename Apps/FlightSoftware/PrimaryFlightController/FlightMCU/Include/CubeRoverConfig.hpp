@@ -43,6 +43,12 @@
 #define BLK_DRV_AFF                 32
 #define BLK_DRV_QUEUE_DEPTH         1
 
+// Block driver tick, the base rate of the rate groups. Runs above every
+// component so the ticks stay on time.
+#define BLK_DRV_TICK_PERIOD_USEC    10000
+#define BLK_DRV_TICK_PRIORITY       31
+#define BLK_DRV_TICK_STACK_SIZE     MIN_STACK_SIZE_BYTES
+
 #define ACTIVE_LOGGER_ID            0
 #define ACTIVE_LOGGER_AFF           26
 #define ACTIVE_LOGGER_QUEUE_DEPTH   1
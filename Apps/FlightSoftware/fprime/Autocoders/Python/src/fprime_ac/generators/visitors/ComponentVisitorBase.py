@@ -483,11 +483,25 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
             elif not self.isAsync(sync):
                 # Only async input ports
                 return None
+            elif instance in c.by_reference_ports:
+                # Only the slot pointer is serialized
+                return None
             else:
                 return type
         l = self.mapPartial(f, c.ports_sync)
         c.port_input_types = self.__model_parser.uniqueList(l)
 
+    def initByReferencePorts(self, obj, c):
+        '''
+        Construct the list of async input ports that queue their arguments
+        in pooled message slots instead of serializing them
+        '''
+        c.by_reference_ports = [
+            port.get_name() for port in obj.get_ports()
+            if port.get_by_reference()
+        ]
+        c.has_by_reference_ports = len(c.by_reference_ports) > 0
+
     def initPortLists(self, obj, c):
         '''
         Construct port lists
@@ -500,6 +514,8 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
         c.ports_sync = self.__model_parser.getPortsListSync(obj)
         # Construct (instance, type, direction, max num, role) list
         c.ports_max_num = self.__model_parser.getPortsListMaxNum(obj)
+        # Construct by-reference port list
+        self.initByReferencePorts(obj, c)
         # Construct port input type list
         self.initPortInputTypes(obj, c)
         # Construct port type list
@@ -26,6 +26,8 @@ from optparse import OptionParser
 #from Cheetah import Template
 #from fprime_ac.utils import version
 from fprime_ac.utils import ConfigManager
+from fprime_ac.utils import TlmChanHash
+from fprime_ac.utils import CmdDispatchTable
 from fprime_ac.models import ModelParser
 #from fprime_ac.utils import DiffAndRename
 from fprime_ac.generators.visitors import AbstractVisitor
@@ -157,6 +159,10 @@ class InstanceTopologyCppVisitor(AbstractVisitor.AbstractVisitor):
 
         c = includes1TopologyCpp.includes1TopologyCpp()
         temp = obj.get_comp_list()
+        # Include the TlmChan perfect hash table type if the table is emitted
+        c.tlm_chan_hash = TlmChanHash.has_tlm_chan(obj)
+        # Include the CommandDispatcher table sizes if they are checked
+        c.cmd_disp_check = len(CmdDispatchTable.dispatcher_names(obj)) > 0
         c.name = obj.get_name()
 
         # Only generate port connections
@@ -328,6 +334,28 @@ class InstanceTopologyCppVisitor(AbstractVisitor.AbstractVisitor):
             c.component_reference_ids.append(declaration_template)
         #
 
+        #
+        # Generate the TlmChan perfect hash table over the channel IDs
+        c.tlm_chan_hash = False
+        table = TlmChanHash.topology_table(obj)
+        if table != None:
+            (ids, seeds) = table
+            c.tlm_chan_hash = True
+            c.tlm_chan_num_ids = len(ids)
+            c.tlm_chan_num_seeds = len(seeds)
+            c.tlm_chan_ids = TlmChanHash.format_rows([hex(id) for id in ids])
+            c.tlm_chan_seeds = TlmChanHash.format_rows([str(seed) for seed in seeds])
+        #
+
+        #
+        # Count the opcodes and command sources for the CommandDispatcher table size checks
+        c.cmd_disp_check = False
+        sizes = CmdDispatchTable.topology_sizes(obj)
+        if sizes != None:
+            c.cmd_disp_check = True
+            (c.cmd_disp_num_opcodes, c.cmd_disp_num_sources) = sizes
+        #
+
         #
         # Generate Component Initalizations
         for component in component_list:
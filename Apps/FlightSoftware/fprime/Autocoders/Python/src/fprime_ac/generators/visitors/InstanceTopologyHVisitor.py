@@ -26,6 +26,7 @@ from optparse import OptionParser
 #from Cheetah import Template
 #from fprime_ac.utils import version
 from fprime_ac.utils import ConfigManager
+from fprime_ac.utils import TlmChanHash
 from fprime_ac.models import ModelParser
 #from fprime_ac.utils import DiffAndRename
 from fprime_ac.generators.visitors import AbstractVisitor
@@ -153,6 +154,8 @@ class InstanceTopologyHVisitor(AbstractVisitor.AbstractVisitor):
         #
         c = includes1TopologyH.includes1TopologyH()
         temp = obj.get_comp_list()
+        # Include the TlmChan perfect hash table type if the table is emitted
+        c.tlm_chan_hash = TlmChanHash.has_tlm_chan(obj)
 
         # Only generate port connections
         c.connect_only = False
@@ -264,6 +267,7 @@ class InstanceTopologyHVisitor(AbstractVisitor.AbstractVisitor):
         @parms args: the instance of the concrete element to operation on.
         """
         c = publicInstanceTopologyH.publicInstanceTopologyH()
+        c.tlm_chan_hash = TlmChanHash.has_tlm_chan(obj)
         # Added hack for ARINC demo...
         part = self.partition
         #
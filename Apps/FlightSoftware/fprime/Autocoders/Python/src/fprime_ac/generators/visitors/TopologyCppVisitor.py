@@ -154,6 +154,10 @@ class TopologyCppVisitor(AbstractVisitor.AbstractVisitor):
 
         c = includes1TopologyCpp.includes1TopologyCpp()
         temp = obj.get_comp_list()
+        # Only instanced topologies emit the TlmChan perfect hash table
+        c.tlm_chan_hash = False
+        # or check the CommandDispatcher table sizes
+        c.cmd_disp_check = False
         c.name = obj.get_name()
 
         # Only generate port connections
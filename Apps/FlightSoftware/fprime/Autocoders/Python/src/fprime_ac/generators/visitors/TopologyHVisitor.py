@@ -153,6 +153,8 @@ class TopologyHVisitor(AbstractVisitor.AbstractVisitor):
         #
         c = includes1TopologyH.includes1TopologyH()
         temp = obj.get_comp_list()
+        # Only instanced topologies emit the TlmChan perfect hash table
+        c.tlm_chan_hash = False
 
         # Only generate port connections
         c.connect_only = False
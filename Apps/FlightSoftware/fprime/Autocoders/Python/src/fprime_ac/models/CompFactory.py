@@ -132,7 +132,8 @@ class CompFactory:
             c=port_obj.get_comment()
             m=port_obj.get_max_number()
             f=port_obj.get_full()
-            port_obj_list.append(Port.Port(n, t, d, s, p, f, c, max_number=m, role=r ))
+            b=port_obj.get_by_reference()
+            port_obj_list.append(Port.Port(n, t, d, s, p, f, c, max_number=m, role=r, by_reference=b ))
         command_obj_list = []
         for command_obj in comp_command_obj_list:
             m=command_obj.get_mnemonic()
@@ -41,7 +41,7 @@ class Port(object):
     This is a very simple component meta-model class.
     Note: associations to Arg instances as needed.
     """
-    def __init__(self, pname, ptype, direction, sync=None, priority=None, full=None, comment=None, xml_filename=None, max_number=None, role=None):
+    def __init__(self, pname, ptype, direction, sync=None, priority=None, full=None, comment=None, xml_filename=None, max_number=None, role=None, by_reference=False):
         """
         Constructor
         @param pname:  Name of port instance (each instance must be unique)
@@ -49,6 +49,7 @@ class Port(object):
         @param direction: Direction of data flow (must be input or output)
         @param sync:  Kind of port (must be one of: async, sync, or guarded)
         @param comment:  A single or multi-line comment describing the port
+        @param by_reference:  Queue async arguments in a message slot instead of serializing them
         """
         self.__pname = pname
         self.__ptype = ptype
@@ -56,6 +57,7 @@ class Port(object):
         self.__sync = sync
         self.__priority = priority
         self.__full = full
+        self.__by_reference = by_reference
         self.__comment = comment
         self.__role = role
         self.__namespace = ""
@@ -167,6 +169,12 @@ class Port(object):
         """
         return self.__full
 
+    def get_by_reference(self):
+        """
+        Return True if async arguments are queued in a message slot.
+        """
+        return self.__by_reference
+
     def get_sync(self):
         """
         Returns type of port.
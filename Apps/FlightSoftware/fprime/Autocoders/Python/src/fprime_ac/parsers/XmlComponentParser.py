@@ -231,7 +231,20 @@ class XmlComponentParser(object):
                             sys.exit(-1)
                     else:
                         f = 'assert'
-                    port_obj = Port(n,d,t,s,p,f,None,m,role=r)
+                    b = False
+                    if "by_reference" in list(port.attrib.keys()):
+                        if port.attrib["by_reference"] not in ['true','false','1','0']:
+                            err = "%s: Invalid attribute value \"%s\" for \"by_reference\" in port \"%s\" definition. Should be \"true\" or \"false\""
+                            PRINT.info(err%(xml_file,port.attrib["by_reference"],n))
+                            sys.exit(-1)
+                        b = port.attrib["by_reference"] in ['true','1']
+                        if b and (s != 'async' or t == 'Serial'):
+                            PRINT.info("%s: Port %s must be a typed async_input port to be by_reference"%(xml_file,n))
+                            sys.exit(-1)
+                        if b and f == 'block':
+                            PRINT.info("%s: Port %s cannot block when full and be by_reference"%(xml_file,n))
+                            sys.exit(-1)
+                    port_obj = Port(n,d,t,s,p,f,None,m,role=r,by_reference=b)
                     for comment in port:
                         # only valid tag in ports is comment
                         if comment.tag != 'comment':
@@ -1074,7 +1087,7 @@ class Port(object):
     """
     Data container for all the port name, type, etc. associated with component.
     """
-    def __init__(self, name, direction, type, sync=None, priority = None, full = None, comment=None, max=None, role=None):
+    def __init__(self, name, direction, type, sync=None, priority = None, full = None, comment=None, max=None, role=None, by_reference=False):
         """
         Constructor
         @param name:  Name of port (each instance must be unique).
@@ -1093,6 +1106,7 @@ class Port(object):
         self.__comment = comment
         self.__max_number = max
         self.__role = role
+        self.__by_reference = by_reference
 
     def get_role(self):
         return self.__role
@@ -1112,6 +1126,8 @@ class Port(object):
         return self.__priority
     def get_full(self):
         return self.__full
+    def get_by_reference(self):
+        return self.__by_reference
     def get_comment(self):
         return self.__comment
     def set_comment(self, comment):
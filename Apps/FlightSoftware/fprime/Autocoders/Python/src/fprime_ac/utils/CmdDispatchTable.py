@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+#===============================================================================
+# NAME: CmdDispatchTable.py
+#
+# DESCRIPTION: Counts the command opcodes and command sources of a topology so
+#              the generated topology code can check the CommandDispatcher
+#              table sizes in Svc/CmdDispatcher/CommandDispatcherImplCfg.hpp
+#              at compile time. A topology with more opcodes than
+#              CMD_DISPATCHER_DISPATCH_TABLE_SIZE then fails to build instead
+#              of asserting when commands are registered.
+#
+# Copyright 2019, California Institute of Technology.
+# ALL RIGHTS RESERVED. U.S. Government Sponsorship acknowledged.
+#===============================================================================
+
+
+def topology_opcodes(topology):
+    """
+    Return the command opcodes registered with the dispatcher, computed the
+    same way as the dictionary: instance base ID plus component opcode.
+    Parameters register a set and a save opcode each.
+    """
+    opcodes = []
+    for id_tuple in topology.get_base_id_list():
+        base_id = int(id_tuple[1])
+        comp_xml = id_tuple[3].get_comp_xml()
+        if comp_xml == None:
+            continue
+        if comp_xml.get_commands() != None:
+            for command in comp_xml.get_commands():
+                opcodes.append(base_id + int(command.get_opcodes()[0], 0))
+        if comp_xml.get_parameters() != None:
+            for parameter in comp_xml.get_parameters():
+                opcodes.append(base_id + int(parameter.get_set_opcodes()[0], 0))
+                opcodes.append(base_id + int(parameter.get_save_opcodes()[0], 0))
+    return opcodes
+
+
+def dispatcher_names(topology):
+    """
+    Return the names of the CommandDispatcher instances in the topology.
+    """
+    names = []
+    for component in topology.get_comp_list():
+        if component.get_kind() == "CommandDispatcher":
+            names.append(component.get_name())
+    return names
+
+
+def command_sources(topology, dispatcher):
+    """
+    Return the number of connections to the seqCmdBuff ports of a dispatcher.
+    Each one can have a command in the sequence tracker.
+    """
+    sources = 0
+    for component in topology.get_comp_list():
+        for port in component.get_ports():
+            if port.get_target_comp() == dispatcher and port.get_target_port() == "seqCmdBuff":
+                sources += 1
+    return sources
+
+
+def topology_sizes(topology):
+    """
+    Return (opcodes, sources) for the dispatcher table checks, or None if the
+    topology has no CommandDispatcher instance.
+    """
+    names = dispatcher_names(topology)
+    if len(names) == 0:
+        return None
+    opcodes = topology_opcodes(topology)
+    if len(set(opcodes)) != len(opcodes):
+        raise Exception("Duplicate command opcodes in topology")
+    sources = max([command_sources(topology, name) for name in names])
+    return (len(opcodes), sources)
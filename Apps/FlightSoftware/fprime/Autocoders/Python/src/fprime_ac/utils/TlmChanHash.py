@@ -0,0 +1,165 @@
+#!/usr/bin/env python
+#===============================================================================
+# NAME: TlmChanHash.py
+#
+# DESCRIPTION: Builds the minimal perfect hash table used by TlmChan to look
+#              up the telemetry channels of a topology. The hash below must
+#              match tlmChanHashMix() in Svc/TlmChan/TlmChanHashTable.hpp.
+#
+#              The table is built with hash-and-displace: every channel ID is
+#              hashed into a bucket, and each bucket gets a seed that moves its
+#              IDs into free slots. A lookup hashes the ID to its bucket, hashes
+#              it again with the bucket seed, and checks the ID in that slot.
+#
+# Copyright 2019, California Institute of Technology.
+# ALL RIGHTS RESERVED. U.S. Government Sponsorship acknowledged.
+#===============================================================================
+
+import sys
+
+# Average number of IDs in a bucket. Larger values give a smaller seed table
+# but take longer to build.
+IDS_PER_BUCKET = 4
+
+# Seeds are stored as U16
+MAX_SEED = 0xFFFF
+
+
+def mix(id, seed):
+    """
+    Hash a channel ID with a seed. Same as tlmChanHashMix().
+    """
+    h = (id ^ ((seed * 0x9E3779B9) & 0xFFFFFFFF)) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def lookup(ids, seeds, id):
+    """
+    Return the slot of a channel ID, or -1 if the ID is not in the table.
+    Same as tlmChanHashLookup().
+    """
+    if len(ids) == 0:
+        return -1
+    seed = seeds[mix(id, 0) % len(seeds)]
+    slot = mix(id, seed) % len(ids)
+    if ids[slot] == id:
+        return slot
+    return -1
+
+
+def build(channel_ids):
+    """
+    Build the table for a list of channel IDs.
+    Returns (ids, seeds) where ids lists the channel ID in each slot.
+    """
+    keys = sorted(set(channel_ids))
+    if len(keys) != len(channel_ids):
+        raise Exception("Duplicate telemetry channel IDs in topology")
+    n = len(keys)
+    if n == 0:
+        return ([], [])
+
+    num_seeds = (n + IDS_PER_BUCKET - 1) // IDS_PER_BUCKET
+    while True:
+        table = _try_build(keys, num_seeds)
+        if table != None:
+            return table
+        # ran out of seeds for a bucket; spread the IDs over more buckets
+        num_seeds += 1
+
+
+def _try_build(keys, num_seeds):
+    n = len(keys)
+    buckets = [[] for b in range(num_seeds)]
+    for id in keys:
+        buckets[mix(id, 0) % num_seeds].append(id)
+
+    ids = [None] * n
+    seeds = [0] * num_seeds
+    # place the largest buckets first while most slots are free
+    order = sorted(range(num_seeds), key=lambda b: (-len(buckets[b]), b))
+    for b in order:
+        if len(buckets[b]) == 0:
+            break
+        for seed in range(1, MAX_SEED + 1):
+            slots = [mix(id, seed) % n for id in buckets[b]]
+            if len(set(slots)) == len(slots) and all(ids[s] == None for s in slots):
+                for id, s in zip(buckets[b], slots):
+                    ids[s] = id
+                seeds[b] = seed
+                break
+        else:
+            return None
+    return (ids, seeds)
+
+
+def verify(ids, seeds, channel_ids):
+    """
+    Check that every channel ID resolves to its own slot.
+    """
+    for id in channel_ids:
+        if lookup(ids, seeds, id) < 0:
+            raise Exception("Telemetry channel ID %s is missing from the TlmChan hash table" % hex(id))
+
+
+def topology_channel_ids(topology):
+    """
+    Return the telemetry channel IDs of a topology model, computed the same
+    way as the dictionary: instance base ID plus component channel ID.
+    """
+    channel_ids = []
+    for id_tuple in topology.get_base_id_list():
+        base_id = int(id_tuple[1])
+        comp_xml = id_tuple[3].get_comp_xml()
+        if comp_xml == None or comp_xml.get_channels() == None:
+            continue
+        for chan in comp_xml.get_channels():
+            channel_ids.append(base_id + int(chan.get_ids()[0], 0))
+    return channel_ids
+
+
+def has_tlm_chan(topology):
+    """
+    Return True if the topology has a TlmChan instance to use the table.
+    """
+    for component in topology.get_comp_list():
+        if component.get_kind() == "TlmChan":
+            return True
+    return False
+
+
+def topology_table(topology):
+    """
+    Build and check the table for a topology.
+    Returns (ids, seeds), or None if the topology has no TlmChan instance.
+    """
+    if not has_tlm_chan(topology):
+        return None
+    channel_ids = topology_channel_ids(topology)
+    (ids, seeds) = build(channel_ids)
+    verify(ids, seeds, channel_ids)
+    return (ids, seeds)
+
+
+def format_rows(values, per_row=8):
+    """
+    Format table values as rows of C initializers.
+    """
+    rows = []
+    for start in range(0, len(values), per_row):
+        rows.append(", ".join(values[start:start + per_row]) + ",")
+    return rows
+
+
+if __name__ == '__main__':
+    # Print a table for a list of IDs, e.g. for unit test fixtures
+    chans = [int(arg, 0) for arg in sys.argv[1:]]
+    (ids, seeds) = build(chans)
+    verify(ids, seeds, chans)
+    print("ids: " + ", ".join([hex(id) for id in ids]))
+    print("seeds: " + ", ".join([str(seed) for seed in seeds]))
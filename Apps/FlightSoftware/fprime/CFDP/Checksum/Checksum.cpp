@@ -12,6 +12,21 @@
 
 #include "CFDP/Checksum/Checksum.hpp"
 #include "Fw/Types/Assert.hpp"
+#include <string.h>
+
+// Select a word summing kernel at build time. The checksum is the sum,
+// modulo 2^32, of the big-endian words of the file, so any kernel that
+// adds the same words in any order gives the same value.
+#if defined(__AVX2__)
+#define CFDP_CHECKSUM_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define CFDP_CHECKSUM_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#define CFDP_CHECKSUM_NEON 1
+#include <arm_neon.h>
+#endif
 
 static U32 min(const U32 a, const U32 b) {
   return (a < b) ? a : b;
@@ -19,6 +34,165 @@ static U32 min(const U32 a, const U32 b) {
 
 namespace CFDP {
 
+  namespace {
+
+    // ----------------------------------------------------------------------
+    // Portable kernel
+    // ----------------------------------------------------------------------
+
+    // A word is loaded whole when the compiler reports the byte order: as
+    // is on a big-endian target such as the TMS570 (the TI compiler
+    // defines __big_endian__), byte swapped on a little-endian one.
+    // Otherwise it is assembled a byte at a time.
+    inline U32 loadBe32(const U8* const p) {
+#if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)) || defined(__big_endian__)
+      U32 word;
+      (void) memcpy(&word, p, sizeof(word));
+      return word;
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && \
+    (defined(__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)))
+      U32 word;
+      (void) memcpy(&word, p, sizeof(word));
+      return __builtin_bswap32(word);
+#else
+      return (static_cast<U32>(p[0]) << 24)
+          | (static_cast<U32>(p[1]) << 16)
+          | (static_cast<U32>(p[2]) << 8)
+          | static_cast<U32>(p[3]);
+#endif
+    }
+
+    //! Sum the big-endian words starting at p, modulo 2^32. Four
+    //! accumulators keep the adds independent.
+    U32 sumWordsPortable(const U8* p, U32 words) {
+      U32 sum0 = 0;
+      U32 sum1 = 0;
+      U32 sum2 = 0;
+      U32 sum3 = 0;
+      for ( ; words >= 4; words -= 4, p += 16) {
+        sum0 += loadBe32(p);
+        sum1 += loadBe32(p + 4);
+        sum2 += loadBe32(p + 8);
+        sum3 += loadBe32(p + 12);
+      }
+      for ( ; words > 0; words--, p += 4) {
+        sum0 += loadBe32(p);
+      }
+      return sum0 + sum1 + sum2 + sum3;
+    }
+
+#if CFDP_CHECKSUM_AVX2
+    // ----------------------------------------------------------------------
+    // AVX2 kernel: byte swap each word in place and add in eight lanes
+    // ----------------------------------------------------------------------
+
+    U32 sumWords(const U8* p, U32 words) {
+      const __m256i swap = _mm256_setr_epi8(
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+          3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      __m256i sum0 = _mm256_setzero_si256();
+      __m256i sum1 = _mm256_setzero_si256();
+      for ( ; words >= 16; words -= 16, p += 64) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+        sum0 = _mm256_add_epi32(sum0, _mm256_shuffle_epi8(a, swap));
+        sum1 = _mm256_add_epi32(sum1, _mm256_shuffle_epi8(b, swap));
+      }
+      sum0 = _mm256_add_epi32(sum0, sum1);
+      const __m128i half = _mm_add_epi32(
+          _mm256_castsi256_si128(sum0), _mm256_extracti128_si256(sum0, 1));
+      U32 lanes[4];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), half);
+      return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumWordsPortable(p, words);
+    }
+
+    const char* const IMPLEMENTATION = "avx2";
+
+#elif CFDP_CHECKSUM_SSE2
+    // ----------------------------------------------------------------------
+    // SSE2 kernel
+    // ----------------------------------------------------------------------
+
+    // SSE2 has no byte shuffle, so the bytes are summed by their position
+    // in the word instead. In each little-endian 32-bit lane, masking
+    // with 0x00FF00FF leaves bytes 0 and 2 in separate 16-bit fields and
+    // shifting first leaves bytes 1 and 3. A field holds the sum of up to
+    // 257 bytes, so the lanes are folded into the total every 256 blocks.
+    enum {
+      SSE2_BLOCKS_PER_FOLD = 256
+    };
+
+    //! Add the position sums held in the lanes to a big-endian word sum
+    U32 foldSse2(const __m128i even, const __m128i odd) {
+      U32 evenLanes[4];
+      U32 oddLanes[4];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(evenLanes), even);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(oddLanes), odd);
+      U32 sum = 0;
+      for (U32 i = 0; i < 4; i++) {
+        sum += ((evenLanes[i] & 0xFFFF) << 24) // byte 0
+            + ((oddLanes[i] & 0xFFFF) << 16) // byte 1
+            + ((evenLanes[i] >> 16) << 8) // byte 2
+            + (oddLanes[i] >> 16); // byte 3
+      }
+      return sum;
+    }
+
+    U32 sumWords(const U8* p, U32 words) {
+      const __m128i mask = _mm_set1_epi32(0x00FF00FF);
+      U32 sum = 0;
+      while (words >= 4) {
+        U32 blocks = words / 4;
+        if (blocks > SSE2_BLOCKS_PER_FOLD) {
+          blocks = SSE2_BLOCKS_PER_FOLD;
+        }
+        words -= blocks * 4;
+        __m128i even = _mm_setzero_si128();
+        __m128i odd = _mm_setzero_si128();
+        for ( ; blocks > 0; blocks--, p += 16) {
+          const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+          even = _mm_add_epi32(even, _mm_and_si128(v, mask));
+          odd = _mm_add_epi32(odd, _mm_and_si128(_mm_srli_epi32(v, 8), mask));
+        }
+        sum += foldSse2(even, odd);
+      }
+      return sum + sumWordsPortable(p, words);
+    }
+
+    const char* const IMPLEMENTATION = "sse2";
+
+#elif CFDP_CHECKSUM_NEON
+    // ----------------------------------------------------------------------
+    // NEON kernel: byte swap each word in place and add in four lanes
+    // ----------------------------------------------------------------------
+
+    U32 sumWords(const U8* p, U32 words) {
+      uint32x4_t sum0 = vdupq_n_u32(0);
+      uint32x4_t sum1 = vdupq_n_u32(0);
+      for ( ; words >= 8; words -= 8, p += 32) {
+        sum0 = vaddq_u32(sum0, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p))));
+        sum1 = vaddq_u32(sum1, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 16))));
+      }
+      sum0 = vaddq_u32(sum0, sum1);
+      U32 lanes[4];
+      vst1q_u32(lanes, sum0);
+      return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumWordsPortable(p, words);
+    }
+
+    const char* const IMPLEMENTATION = "neon";
+
+#else
+
+    U32 sumWords(const U8* p, U32 words) {
+      return sumWordsPortable(p, words);
+    }
+
+    const char* const IMPLEMENTATION = "portable";
+
+#endif
+
+  }
+
   Checksum ::
     Checksum() : value(0)
   {
@@ -61,6 +235,12 @@ namespace CFDP {
   {
     return this->value;
   }
+
+  const char* Checksum ::
+    getImplementationString(void)
+  {
+    return IMPLEMENTATION;
+  }
   
   void Checksum ::
     update(
@@ -84,8 +264,9 @@ namespace CFDP {
     }
 
     // Add the middle words aligned
-    for ( ; index + 4 <= length; index += 4)
-      addWordAligned(&data[index]);
+    const U32 words = (length - index) / 4;
+    this->value += sumWords(&data[index], words);
+    index += 4 * words;
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -99,13 +280,6 @@ namespace CFDP {
 
   }
 
-  void Checksum ::
-    addWordAligned(const U8 *const word)
-  {
-    for (U32 i = 0; i < 4; ++i)
-      addByteAtOffset(word[i], i);
-  }
-  
   void Checksum :: 
     addWordUnaligned(
         const U8 *word,
@@ -68,17 +68,15 @@ namespace CFDP {
       //! Get the checksum value
       U32 getValue(void) const;
 
+      //! Get a string naming the word summing kernel selected at build time
+      static const char* getImplementationString(void);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
       // Private instance methods 
       // ----------------------------------------------------------------------
 
-      //! Add a four-byte aligned word to the checksum value
-      void addWordAligned(
-          const U8 *const word //! The word
-      );
-
       //! Add a four-byte unaligned word to the checksum value
       void addWordUnaligned(
           const U8 *const word, //! The word
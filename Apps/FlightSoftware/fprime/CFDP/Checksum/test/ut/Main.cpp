@@ -5,6 +5,9 @@
 #include "gtest/gtest.h"
 
 #include "CFDP/Checksum/Checksum.hpp"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 using namespace CFDP;
 
@@ -49,6 +52,116 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+namespace {
+
+  //! The checksum a byte at a time, as the original implementation did
+  U32 referenceChecksum(const U8 *const data, const U32 offset, const U32 length) {
+    U32 value = 0;
+    for (U32 i = 0; i < length; ++i) {
+      value += static_cast<U32>(data[i]) << (8 * (3 - (offset + i) % 4));
+    }
+    return value;
+  }
+
+  //! xorshift32, so runs are repeatable
+  U32 nextRandom(U32& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  F64 nowNsec(void) {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return static_cast<F64>(t.tv_sec) * 1.0e9 + t.tv_nsec;
+  }
+
+  const U32 FILE_SIZE = 64 * 1024;
+  U8 fileData[FILE_SIZE + 1];
+
+}
+
+// Random files cut into random packets at random offsets, with every
+// alignment of the data in memory, against the byte-at-a-time reference
+TEST(Checksum, RandomEquivalence) {
+  U32 state = 0x12345678;
+  for (U32 round = 0; round < 200; round++) {
+    // All ones fills the kernels' lane fields fastest
+    const bool ones = (round % 10 == 0);
+    for (U32 i = 0; i < FILE_SIZE + 1; i++) {
+      fileData[i] = ones ? 0xFF : static_cast<U8>(nextRandom(state));
+    }
+    const U32 shift = round % 2;
+    const U8 *const file = &fileData[shift];
+    const U32 size = nextRandom(state) % (FILE_SIZE - shift);
+
+    Checksum checksum;
+    U32 offset = 0;
+    while (offset < size) {
+      U32 length = nextRandom(state) % ((round % 3 == 0) ? 17 : 9000);
+      if (length > size - offset) {
+        length = size - offset;
+      }
+      checksum.update(&file[offset], offset, length);
+      offset += length;
+    }
+    ASSERT_EQ(referenceChecksum(file, 0, size), checksum.getValue()) << "round " << round;
+  }
+}
+
+TEST(Checksum, EveryOffsetAndLength) {
+  U32 state = 99;
+  for (U32 i = 0; i < 300; i++) {
+    fileData[i] = static_cast<U8>(nextRandom(state));
+  }
+  for (U32 offset = 0; offset < 8; offset++) {
+    for (U32 length = 0; length <= 200; length++) {
+      Checksum checksum(0xDEAD0000);
+      checksum.update(&fileData[offset], offset, length);
+      ASSERT_EQ(0xDEAD0000 + referenceChecksum(&fileData[offset], offset, length), checksum.getValue())
+          << "offset " << offset << " length " << length;
+    }
+  }
+}
+
+// Checksum rate for FileUplink-sized packets and for whole buffers
+TEST(Performance, ChecksumRate) {
+  U32 state = 7;
+  for (U32 i = 0; i < FILE_SIZE; i++) {
+    fileData[i] = static_cast<U8>(nextRandom(state));
+  }
+  const U32 rounds = 2000;
+  const U32 packetSizes[] = { 256, 1024, FILE_SIZE };
+
+  for (U32 s = 0; s < 3; s++) {
+    const U32 packetSize = packetSizes[s];
+
+    Checksum checksum;
+    F64 start = nowNsec();
+    for (U32 round = 0; round < rounds; round++) {
+      for (U32 offset = 0; offset + packetSize <= FILE_SIZE; offset += packetSize) {
+        checksum.update(&fileData[offset], offset, packetSize);
+      }
+    }
+    const F64 fast = nowNsec() - start;
+
+    U32 reference = 0;
+    start = nowNsec();
+    for (U32 round = 0; round < rounds / 20; round++) {
+      for (U32 offset = 0; offset + packetSize <= FILE_SIZE; offset += packetSize) {
+        reference += referenceChecksum(&fileData[offset], offset, packetSize);
+      }
+    }
+    const F64 slow = (nowNsec() - start) * 20;
+    ASSERT_EQ(reference * 20, checksum.getValue());
+
+    const F64 bytes = static_cast<F64>(rounds) * FILE_SIZE;
+    printf("%-8s %6u byte packets: %6.2f GB/s, byte at a time %5.2f GB/s\n",
+        Checksum::getImplementationString(), packetSize, bytes / fast, bytes / slow);
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,107 @@
+// ======================================================================
+// \title  SimSerialDriverComponentImpl.cpp
+// \brief  cpp file for SimSerialDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <CubeRover/SimSerialDriver/SimSerialDriverComponentImpl.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <string.h>
+
+namespace CubeRover {
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction
+  // ----------------------------------------------------------------------
+
+  SimSerialDriverComponentImpl ::
+#if FW_OBJECT_NAMES == 1
+    SimSerialDriverComponentImpl(
+        const char *const compName
+    ) :
+      SimSerialDriverComponentBase(compName)
+#else
+    SimSerialDriverComponentImpl(void)
+#endif
+  {
+      for (NATIVE_UINT_TYPE entry = 0; entry < SIM_SERIAL_MAX_NUM_BUFFERS; entry++) {
+          this->m_buffSet[entry].available = false;
+      }
+  }
+
+  void SimSerialDriverComponentImpl ::
+    init(
+        const NATIVE_INT_TYPE instance
+    )
+  {
+    SimSerialDriverComponentBase::init(instance);
+  }
+
+  SimSerialDriverComponentImpl ::
+    ~SimSerialDriverComponentImpl(void)
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  void SimSerialDriverComponentImpl :: serialSend_handler(const NATIVE_INT_TYPE portNum,
+                                                           Fw::Buffer &serBuffer){
+      Fw::Buffer buff;
+      Drv::SerialReadStatus serReadStat = Drv::SER_OK;
+
+      this->m_readBuffMutex.lock();
+      NATIVE_INT_TYPE entryFound = false;
+      for (NATIVE_INT_TYPE entry = 0; entry < SIM_SERIAL_MAX_NUM_BUFFERS; entry++) {
+          if (this->m_buffSet[entry].available) {
+              this->m_buffSet[entry].available = false;
+              buff = this->m_buffSet[entry].readBuffer;
+              entryFound = true;
+              break;
+          }
+      }
+      this->m_readBuffMutex.unLock();
+
+      if (not entryFound) {
+          serReadStat = Drv::SER_NO_BUFFERS;
+      } else if (buff.getsize() < serBuffer.getsize()) {
+          serReadStat = Drv::SER_BUFFER_TOO_SMALL;
+      } else {
+          (void) memcpy(reinterpret_cast<U8*>(buff.getdata()),
+                        reinterpret_cast<const U8*>(serBuffer.getdata()),
+                        serBuffer.getsize());
+          buff.setsize(serBuffer.getsize());
+      }
+
+      if (this->isConnected_serialRecv_OutputPort(0)) {
+          this->serialRecv_out(0, buff, serReadStat);
+      }
+  }
+
+  void SimSerialDriverComponentImpl :: readBufferSend_handler(const NATIVE_INT_TYPE portNum,
+                                                               Fw::Buffer& Buffer){
+        this->m_readBuffMutex.lock();
+        bool found = false;
+
+        // search for open entry
+        for (NATIVE_UINT_TYPE entry = 0; entry < SIM_SERIAL_MAX_NUM_BUFFERS; entry++) {
+            if (not this->m_buffSet[entry].available) {
+                this->m_buffSet[entry].readBuffer = Buffer;
+                this->m_buffSet[entry].available = true;
+                found = true;
+                break;
+            }
+        }
+        this->m_readBuffMutex.unLock();
+        FW_ASSERT(found,Buffer.getbufferID(),Buffer.getmanagerID());
+  }
+
+} // end namespace CubeRover
@@ -0,0 +1,93 @@
+// ======================================================================
+// \title  SimSerialDriverComponentImpl.hpp
+// \brief  hpp file for SimSerialDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SimSerialDriver_HPP
+#define SimSerialDriver_HPP
+
+#include <Os/Mutex.hpp>
+
+#include "CubeRover/SimSerialDriver/SimSerialDriverComponentAc.hpp"
+
+namespace CubeRover {
+
+  enum {
+    SIM_SERIAL_MAX_NUM_BUFFERS = 20,
+  };
+
+  //! \class SimSerialDriverComponentImpl
+  //! \brief Host stand-in for the radio serial driver
+  //!
+  //! Has the ports of Drv::FreeRtosSerialDriver so the flight topology
+  //! connects to it unchanged. Data sent on serialSend is copied into the
+  //! next buffer from readBufferSend and returned on serialRecv, as if the
+  //! radio link were looped back.
+  class SimSerialDriverComponentImpl :
+    public SimSerialDriverComponentBase
+  {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction, initialization, and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct object SimSerialDriver
+      //!
+      SimSerialDriverComponentImpl(
+#if FW_OBJECT_NAMES == 1
+          const char *const compName /*!< The component name*/
+#else
+          void
+#endif
+      );
+
+      //! Initialize object SimSerialDriver
+      //!
+      void init(
+          const NATIVE_INT_TYPE instance = 0 /*!< The instance number*/
+      );
+
+      //! Destroy object SimSerialDriver
+      //!
+      ~SimSerialDriverComponentImpl(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for user-defined typed input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for readBufferSend
+      //!
+      void readBufferSend_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+      //! Handler implementation for serialSend
+      //!
+      void serialSend_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &serBuffer
+      );
+
+      struct BufferSet {
+          Fw::Buffer readBuffer; //!< buffers for port reads
+          bool available; //!< is buffer available?
+      } m_buffSet[SIM_SERIAL_MAX_NUM_BUFFERS];
+
+      Os::Mutex m_readBuffMutex;
+
+    };
+
+} // end namespace CubeRover
+
+#endif
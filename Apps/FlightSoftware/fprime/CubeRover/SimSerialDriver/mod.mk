@@ -0,0 +1,3 @@
+SRC = SimSerialDriverComponentAi.xml SimSerialDriverComponentImpl.cpp
+
+HDR = SimSerialDriverComponentImpl.hpp
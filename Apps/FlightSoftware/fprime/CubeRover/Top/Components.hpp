@@ -10,7 +10,11 @@
 
 // Include drivers
 #include <Drv/BlockDriver/BlockDriverImpl.hpp>
+#ifdef TGT_OS_TYPE_LINUX
+#include <CubeRover/SimSerialDriver/SimSerialDriverComponentImpl.hpp>
+#else
 #include <Drv/FreeRtosSerialDriver/FreeRtosSerialDriverComponentImpl.hpp>
+#endif
 
 // Include services
 #include <Svc/RateGroupDriver/RateGroupDriverImpl.hpp>
@@ -38,8 +42,13 @@ extern Svc::TlmChanImpl tlmChan;
 // Service that handle active logging
 extern Svc::ActiveLoggerImpl activeLogger;
 
+#ifdef TGT_OS_TYPE_LINUX
+// Simulated radio serial interface for host builds
+extern CubeRover::SimSerialDriverComponentImpl radioSerialInterface;
+#else
 // FreeRTOS Serial driver to interface radio module
 extern Drv::FreeRtosSerialDriverComponentImpl radioSerialInterface;
+#endif
 
 // command dispatcher
 extern Svc::CommandDispatcherImpl cmdDispatcher;
@@ -0,0 +1,191 @@
+/*
+ * Main.cpp
+ *
+ * Linux entry point for the CubeRover topology. The flight entry point is
+ * in PrimaryFlightController/FlightMCU/App/Main.cpp.
+ *
+ * The topology runs as on the rover, with the block driver ticking from
+ * Os::TickTimer and the radio replaced by a loopback stand-in. With -c the
+ * application runs that many cycles and prints a performance report: CPU
+ * time of each task, cycle slips and queue high water marks. With -m or -s
+ * the program also exits with status 1 when missed ticks or the cycle slips
+ * of any rate group are above the given limit.
+ */
+
+#include <getopt.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <signal.h>
+
+#include <Os/Task.hpp>
+#include <Os/CycleCounter.hpp>
+#include <Os/SimpleQueueRegistry.hpp>
+
+#include "CubeRoverConfig.hpp"
+#include "Topology.hpp"
+#include "Components.hpp"
+
+// ---------------------------------------------------------------------------
+// Radio serial interface stand-in, loops sent data back
+CubeRover::SimSerialDriverComponentImpl radioSerialInterface(
+#if FW_OBJECT_NAMES == 1
+  "RadioSerialInterface"
+#endif
+);
+
+namespace {
+
+  enum {
+    MAX_REPORT_TASKS = 32 //!< tasks recorded for the CPU time report
+  };
+
+  //! Records the tasks started, for the CPU time report
+  class TaskList : public Os::TaskRegistry {
+    public:
+      TaskList() : m_numTasks(0) {
+        Os::Task::registerTaskRegistry(this);
+      }
+
+      void addTask(Os::Task* task) {
+        if (this->m_numTasks < MAX_REPORT_TASKS) {
+          this->m_tasks[this->m_numTasks++] = task;
+        }
+      }
+
+      void removeTask(Os::Task* task) {
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numTasks; entry++) {
+          if (this->m_tasks[entry] == task) {
+            this->m_tasks[entry] = this->m_tasks[--this->m_numTasks];
+            break;
+          }
+        }
+      }
+
+      void dump(U32 cycles) {
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numTasks; entry++) {
+          Os::Task* task = this->m_tasks[entry];
+          const U64 cpu = task->getCpuTimeUsec();
+          (void) printf("Task: %s CPU: %llu us (%.1f us/cycle)\n",
+                        task->getName().toChar(),
+                        static_cast<unsigned long long>(cpu),
+                        (cycles != 0) ? static_cast<double>(cpu)/cycles : 0.0);
+        }
+      }
+
+    private:
+      Os::Task* m_tasks[MAX_REPORT_TASKS];
+      NATIVE_INT_TYPE m_numTasks;
+  };
+
+  volatile sig_atomic_t terminate = 0;
+
+  void sighandler(int signum) {
+    terminate = 1;
+  }
+
+  enum {
+    NO_LIMIT = -1 //!< limit option not given
+  };
+
+  void print_usage() {
+    (void) printf("Usage: ./CubeRover [options]\n-c\tcycles to run, then print a performance report and exit\n"
+                  "-m\tmissed ticks allowed, exit with status 1 above it\n"
+                  "-s\tcycle slips allowed per rate group, exit with status 1 above it\n");
+  }
+
+  //! Checks the run against the limits, printing each one exceeded
+  bool withinLimits(I32 maxMissedTicks, I32 maxSlips) {
+    bool pass = true;
+    const U32 missedTicks = blockDriver.getMissedTicks();
+    if ((maxMissedTicks != NO_LIMIT) && (missedTicks > static_cast<U32>(maxMissedTicks))) {
+      (void) printf("FAIL: %u missed ticks, limit %d\n", missedTicks, maxMissedTicks);
+      pass = false;
+    }
+    const U32 slips[] = {
+      rateGroupLowFreq.getCycleSlips(),
+      rateGroupMedFreq.getCycleSlips(),
+      rateGroupHiFreq.getCycleSlips()
+    };
+    const char* names[] = {"low", "medium", "high"};
+    for (U32 group = 0; group < FW_NUM_ARRAY_ELEMENTS(slips); group++) {
+      if ((maxSlips != NO_LIMIT) && (slips[group] > static_cast<U32>(maxSlips))) {
+        (void) printf("FAIL: %u %s rate group cycle slips, limit %d\n", slips[group], names[group], maxSlips);
+        pass = false;
+      }
+    }
+    return pass;
+  }
+
+  void report(U32 cycles, U64 elapsedUsec, TaskList& tasks, Os::SimpleQueueRegistry& queues) {
+    (void) printf("Cycles: %u in %.3f s, %u us tick\n", cycles,
+                  static_cast<double>(elapsedUsec)/1000000, BLK_DRV_TICK_PERIOD_USEC);
+    (void) printf("Missed ticks: %u\n", blockDriver.getMissedTicks());
+    (void) printf("Cycle slips: low %u medium %u high %u\n",
+                  rateGroupLowFreq.getCycleSlips(),
+                  rateGroupMedFreq.getCycleSlips(),
+                  rateGroupHiFreq.getCycleSlips());
+    tasks.dump(cycles);
+    queues.dump();
+  }
+
+}
+
+int main(int argc, char* argv[]) {
+  U32 cycles = 0;
+  I32 maxMissedTicks = NO_LIMIT;
+  I32 maxSlips = NO_LIMIT;
+  I32 option = 0;
+
+  while ((option = getopt(argc, argv, "hc:m:s:")) != -1){
+    switch(option) {
+      case 'h':
+        print_usage();
+        return 0;
+      case 'c':
+        cycles = strtoul(optarg, NULL, 0);
+        break;
+      case 'm':
+        maxMissedTicks = atoi(optarg);
+        break;
+      case 's':
+        maxSlips = atoi(optarg);
+        break;
+      case '?':
+        return 1;
+      default:
+        print_usage();
+        return 1;
+    }
+  }
+
+  // Registries must exist before the components create their queues and
+  // tasks. The task list is never deleted: tasks remove themselves from it
+  // when the component globals are destroyed after main returns.
+  TaskList* tasks = new TaskList();
+  Os::SimpleQueueRegistry queues;
+
+  if (cycles == 0) {
+    (void) printf("Hit Ctrl-C to quit\n");
+  }
+
+  radioSerialInterface.init(0);
+  constructApp();
+
+  signal(SIGINT,sighandler);
+  signal(SIGTERM,sighandler);
+
+  const U64 start = Os::CycleCounter::read();
+  while (!terminate && (cycles == 0 || blockDriver.getCycles() < cycles)) {
+    Os::Task::delay(10);
+  }
+  const U64 elapsed = Os::CycleCounter::read() - start;
+
+  report(blockDriver.getCycles(), Os::CycleCounter::toUsec(elapsed), *tasks, queues);
+  const bool pass = withinLimits(maxMissedTicks, maxSlips);
+
+  exitTasks();
+  // Give time for threads to exit
+  Os::Task::delay(1000);
+
+  return pass ? 0 : 1;
+}
@@ -1,6 +1,6 @@
 #include <Os/Task.hpp>
 #include <Os/Log.hpp>
-#include <HAL/include/FreeRTOS.h>
+#include <Os/CycleCounter.hpp>
 
 #include "CubeRoverConfig.hpp"
 #include "Topology.hpp"
@@ -89,6 +89,9 @@ void run1cycle(void) {
  * @brief      Construct the F-prime application
  */
 void constructApp(void){
+  // Start the cycle counter behind IntervalTimer and time stamps
+  Os::CycleCounter::init();
+
   //Initialize the block driver
   blockDriver.init(BLK_DRV_QUEUE_DEPTH);
 
@@ -106,9 +109,21 @@ void constructApp(void){
   // Initialize the telemetric channel component (active)
   tlmChan.init(TLM_CHAN_QUEUE_DEPTH, TLM_CHAN_ID);
 
+  // Initialize the command dispatcher (active)
+  cmdDispatcher.init(CMD_DISP_QUEUE_DEPTH, CMD_DISP_ID);
+
+  // Look up the topology channels with the generated perfect hash table
+  tlmChan.setHashTable(CubeRoverTlmChanHash);
+
   // Construct the application and make all connections between components
   constructCubeRoverArchitecture();
 
+  // Register the commands of each component with the dispatcher
+  cmdDispatcher.regCommands();
+  rateGroupLowFreq.regCommands();
+  rateGroupMedFreq.regCommands();
+  rateGroupHiFreq.regCommands();
+
   rateGroupLowFreq.start(0, /* identifier */
                        RG_LOW_FREQ_AFF, /* Thread affinity */
                        RG_LOW_FREQ_QUEUE_DEPTH*MIN_STACK_SIZE_BYTES); /* stack size */
@@ -125,7 +140,28 @@ void constructApp(void){
                    BLK_DRV_AFF, /* Thread affinity */
                    BLK_DRV_QUEUE_DEPTH*MIN_STACK_SIZE_BYTES); /* stack size */
 
+  blockDriver.startTick(BLK_DRV_TICK_PERIOD_USEC, /* tick period */
+                        BLK_DRV_TICK_PRIORITY, /* priority */
+                        BLK_DRV_TICK_STACK_SIZE); /* stack size */
+
   tlmChan.start(0, /* identifier */
                 TLM_CHAN_AFF, /* thread affinity */
                 TLM_CHAN_QUEUE_DEPTH*MIN_STACK_SIZE_BYTES); /* stack size */
+
+  cmdDispatcher.start(0, /* identifier */
+                      CMD_DISP_AFF, /* thread affinity */
+                      CMD_DISP_QUEUE_DEPTH*MIN_STACK_SIZE_BYTES); /* stack size */
+}
+
+/**
+ * @brief      Stop the tick and the active component tasks
+ */
+void exitTasks(void){
+  blockDriver.quitTick();
+  rateGroupLowFreq.exit();
+  rateGroupMedFreq.exit();
+  rateGroupHiFreq.exit();
+  blockDriver.exit();
+  tlmChan.exit();
+  cmdDispatcher.exit();
 }
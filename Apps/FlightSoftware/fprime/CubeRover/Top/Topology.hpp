@@ -16,6 +16,11 @@
 void constructApp(void);
 void run1cycle(void);
 
+/**
+ * @brief      Stop the tick and the active component tasks
+ */
+void exitTasks(void);
+
 
 
 #endif /* F_PRIME_CUBEROVER_TOP_TOPOLOGY_HPP_ */
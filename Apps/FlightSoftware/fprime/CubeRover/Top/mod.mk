@@ -1,4 +1,9 @@
 SRC = 				Topology.cpp \
                     CubeRoverTopologyAppAi.xml
 
-HDR = 				Topology.hpp
\ No newline at end of file
+SRC_LINUX = 		Main.cpp
+
+HDR = 				Topology.hpp
+
+# Host builds take the rover configuration from the flight project
+COMPARGS_LINUX = 	-I$(BUILD_ROOT)/../PrimaryFlightController/FlightMCU/Include
@@ -1,9 +1,16 @@
 #include <Drv/BlockDriver/BlockDriverImpl.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Fw/Types/EightyCharString.hpp>
+#include <Os/CycleCounter.hpp>
 
 namespace Drv {
 
+    namespace {
+        //! Period of the tick jitter telemetry, in microseconds
+        const U32 TICK_TLM_PERIOD_USEC = 1000000;
+    }
+
 #if FW_OBJECT_NAMES == 1
     BlockDriverImpl::BlockDriverImpl(const char* compName) :
         BlockDriverComponentBase(compName)
@@ -11,6 +18,13 @@ namespace Drv {
     BlockDriverImpl::BlockDriverImpl()
 #endif
     ,m_cycles(0)
+    ,m_tickPeriodUsec(0)
+    ,m_quitTick(false)
+    ,m_missedTicks(0)
+    ,m_lastCycleTime(0)
+    ,m_lastMissedTicks(0)
+    ,m_tickJitterMax(0)
+    ,m_tlmCycles(0)
     {
 
     }
@@ -31,6 +45,33 @@ namespace Drv {
         // increment cycles and write channel
         this->tlmWrite_BD_Cycles(this->m_cycles);
         this->m_cycles++;
+
+        if (this->m_tickPeriodUsec == 0) {
+            return;
+        }
+
+        // Jitter is how far the time since the last cycle is from the
+        // ticks it covers, one plus any the tick task missed
+        const U64 now = Os::CycleCounter::read();
+        const U32 missedTicks = this->m_missedTicks;
+        if (this->m_lastCycleTime != 0) {
+            const U32 interval = Os::CycleCounter::toUsec(now - this->m_lastCycleTime);
+            const U32 nominal = (missedTicks - this->m_lastMissedTicks + 1) * this->m_tickPeriodUsec;
+            const U32 jitter = (interval > nominal) ? interval - nominal : nominal - interval;
+            if (jitter > this->m_tickJitterMax) {
+                this->m_tickJitterMax = jitter;
+            }
+        }
+        this->m_lastCycleTime = now;
+
+        this->m_tlmCycles++;
+        if (this->m_tlmCycles * this->m_tickPeriodUsec >= TICK_TLM_PERIOD_USEC) {
+            this->tlmWrite_BD_TickJitterMax(this->m_tickJitterMax);
+            this->tlmWrite_BD_TickOverruns(missedTicks);
+            this->m_tickJitterMax = 0;
+            this->m_tlmCycles = 0;
+        }
+        this->m_lastMissedTicks = missedTicks;
     }
 
     void BlockDriverImpl::BufferIn_handler(NATIVE_INT_TYPE portNum, Drv::DataBuffer& buffer) {
@@ -45,6 +86,50 @@ namespace Drv {
         s_driverISR(this);
     }
     
+    void BlockDriverImpl::startTick(U32 periodUsec,
+                                    NATIVE_INT_TYPE priority,
+                                    NATIVE_INT_TYPE stackSize,
+                                    NATIVE_INT_TYPE cpuAffinity) {
+        FW_ASSERT(periodUsec > 0);
+        this->m_tickPeriodUsec = periodUsec;
+        this->m_quitTick = false;
+        Fw::EightyCharString task("BlkDrvTick");
+        Os::Task::TaskStatus stat = this->m_tickTask.start(task, 0, priority, stackSize,
+                                                           s_tickTask, this, cpuAffinity);
+        FW_ASSERT(stat == Os::Task::TASK_OK, stat);
+    }
+
+    void BlockDriverImpl::quitTick(void) {
+        this->m_quitTick = true;
+    }
+
+    U32 BlockDriverImpl::getCycles(void) const {
+        return this->m_cycles;
+    }
+
+    U32 BlockDriverImpl::getMissedTicks(void) const {
+        return this->m_missedTicks;
+    }
+
+    void BlockDriverImpl::s_tickTask(void* arg) {
+        FW_ASSERT(arg);
+        BlockDriverImpl* compPtr = static_cast<BlockDriverImpl*>(arg);
+
+        // The timer is started here rather than in startTick() as the
+        // target timer can only be set up once the scheduler runs
+        Os::TickTimer::Status stat = compPtr->m_tickTimer.start(compPtr->m_tickPeriodUsec);
+        FW_ASSERT(stat == Os::TickTimer::OP_OK, stat);
+
+        while (not compPtr->m_quitTick) {
+            const U32 ticks = compPtr->m_tickTimer.wait();
+            // A late wakeup runs one cycle, not one per missed tick, so the
+            // rate groups are not hit by a burst
+            compPtr->m_missedTicks += ticks - 1;
+            s_driverISR(compPtr);
+        }
+        compPtr->m_tickTimer.stop();
+    }
+
     void BlockDriverImpl::s_driverISR(void* arg) {
         FW_ASSERT(arg);
         // cast argument to component instance
@@ -2,6 +2,8 @@
 #define DRV_BLOCK_DRIVER_IMPL_HPP
 
 #include <Drv/BlockDriver/BlockDriverComponentAc.hpp>
+#include <Os/Task.hpp>
+#include <Os/TickTimer.hpp>
 
 namespace Drv {
 
@@ -19,6 +21,20 @@ namespace Drv {
 		~BlockDriverImpl(void);
 		// a little hack to get the reference running
 		void callIsr(void);
+
+		//! Start a task that calls the ISR on every tick of an Os::TickTimer,
+		//! in place of calling callIsr() by hand. Os::CycleCounter must be
+		//! running; it times the ticks for the jitter telemetry.
+		void startTick(U32 periodUsec,
+		               NATIVE_INT_TYPE priority,
+		               NATIVE_INT_TYPE stackSize,
+		               NATIVE_INT_TYPE cpuAffinity = -1);
+
+		//! Stop the tick task after its next tick
+		void quitTick(void);
+
+		U32 getCycles(void) const; //!< cycles run
+		U32 getMissedTicks(void) const; //!< ticks missed by the tick task
 		
 	private:
 
@@ -36,9 +52,25 @@ namespace Drv {
         // static ISR callback
         static void s_driverISR(void* arg);
 
+        // tick task entry point
+        static void s_tickTask(void* arg);
+
         // cycle count
         U32 m_cycles;
 
+        // tick source
+        Os::Task m_tickTask; //!< waits on the tick timer and calls the ISR
+        Os::TickTimer m_tickTimer; //!< periodic tick source
+        U32 m_tickPeriodUsec; //!< tick period, zero when cycles are called by hand
+        volatile bool m_quitTick; //!< set to stop the tick task
+        U32 m_missedTicks; //!< ticks missed by the tick task
+
+        // tick timing, updated by the ISR
+        U64 m_lastCycleTime; //!< cycle counter at the last cycle, zero before the first
+        U32 m_lastMissedTicks; //!< m_missedTicks at the last cycle
+        U32 m_tickJitterMax; //!< largest jitter since the last telemetry update, in microseconds
+        U32 m_tlmCycles; //!< cycles since the last jitter telemetry update
+
 	};
 	
 }
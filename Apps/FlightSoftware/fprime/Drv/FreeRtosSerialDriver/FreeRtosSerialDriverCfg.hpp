@@ -0,0 +1,35 @@
+/*
+* \file:
+* \brief
+*
+* This file has configuration settings for the FreeRtosSerialDriver component.
+*
+*/
+
+#ifndef FREERTOSSERIALDRIVER_FREERTOSSERIALDRIVERCFG_HPP_
+#define FREERTOSSERIALDRIVER_FREERTOSSERIALDRIVERCFG_HPP_
+
+namespace Drv {
+
+    enum {
+        //! Size in bytes of each of the receive and transmit rings. Must be a power of two.
+        FREERTOS_SERIAL_RING_SIZE = 1024,
+        //! Received bytes in the ring that wake the read task early. At 921600 baud
+        //! 64 bytes take about 0.7 ms.
+        FREERTOS_SERIAL_RX_NOTIFY_THRESHOLD = 64,
+        //! Time the line has to stay quiet before the read task delivers a partial
+        //! ring, in milliseconds. Stands in for idle-line detection.
+        FREERTOS_SERIAL_RX_IDLE_MSEC = 2,
+        //! Longest a send waits for room in the transmit ring, in milliseconds
+        FREERTOS_SERIAL_TX_WAIT_MSEC = 100,
+        //! Period of the rate, overrun and high-water telemetry, in milliseconds
+        FREERTOS_SERIAL_TLM_PERIOD_MSEC = 1000,
+        //! VIM channel of the level 0 interrupt of the standalone SCI (sciREG)
+        FREERTOS_SERIAL_SCI_VIM_CHANNEL = 64,
+        //! VIM channel of the level 0 interrupt of the LIN module in SCI mode (scilinREG)
+        FREERTOS_SERIAL_SCILIN_VIM_CHANNEL = 13,
+    };
+
+}
+
+#endif /* FREERTOSSERIALDRIVER_FREERTOSSERIALDRIVERCFG_HPP_ */
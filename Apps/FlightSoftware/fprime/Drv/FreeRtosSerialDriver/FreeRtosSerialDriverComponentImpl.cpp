@@ -13,10 +13,59 @@
 #include <Drv/FreeRtosSerialDriver/FreeRtosSerialDriverComponentImpl.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/EightyCharString.hpp>
-
+#include <HAL/include/sys_vim.h>
+#include <string.h>
+
+// VIM handlers, one per SCI module. Each forwards to the driver open on it.
+extern "C" {
+  void freeRtosSerialSciIsr(void);
+  void freeRtosSerialSciLinIsr(void);
+}
+
+#pragma CODE_STATE(32)
+#pragma INTERRUPT(IRQ)
+void freeRtosSerialSciIsr(void) {
+  Drv::FreeRtosSerialDriverComponentImpl::isr(sciREG);
+}
+
+#pragma CODE_STATE(32)
+#pragma INTERRUPT(IRQ)
+void freeRtosSerialSciLinIsr(void) {
+  Drv::FreeRtosSerialDriverComponentImpl::isr(scilinREG);
+}
 
 namespace Drv {
 
+  namespace {
+    //! Drivers open on sciREG and scilinREG, for the interrupt handlers
+    FreeRtosSerialDriverComponentImpl* volatile s_sciDriver = NULL;
+    FreeRtosSerialDriverComponentImpl* volatile s_sciLinDriver = NULL;
+
+    U32 baudToRate(FreeRtosSerialDriverComponentImpl::UartBaudRate baud) {
+      switch (baud) {
+        case FreeRtosSerialDriverComponentImpl::BAUD_9600:
+          return 9600;
+        case FreeRtosSerialDriverComponentImpl::BAUD_19200:
+          return 19200;
+        case FreeRtosSerialDriverComponentImpl::BAUD_38400:
+          return 38400;
+        case FreeRtosSerialDriverComponentImpl::BAUD_57600:
+          return 57600;
+        case FreeRtosSerialDriverComponentImpl::BAUD_115K:
+          return 115200;
+        case FreeRtosSerialDriverComponentImpl::BAUD_230K:
+          return 230400;
+        case FreeRtosSerialDriverComponentImpl::BAUD_460K:
+          return 460800;
+        case FreeRtosSerialDriverComponentImpl::BAUD_921K:
+          return 921600;
+        default:
+          FW_ASSERT(0, baud);
+          return 0;
+      }
+    }
+  }
+
   // ----------------------------------------------------------------------
   // Construction, initialization, and destruction
   // ----------------------------------------------------------------------
@@ -26,12 +75,15 @@ namespace Drv {
     FreeRtosSerialDriverComponentImpl(
         const char *const compName
     ) :
-      FreeRtosSerialDriverComponentBase(compName)
+      FreeRtosSerialDriverComponentBase(compName),
 #else
-    FreeRtosSerialDriverComponentImpl(void)
+    FreeRtosSerialDriverComponentImpl(void) :
 #endif
+      m_sci(NULL),
+      m_readTaskHandle(NULL),
+      m_quitReadThread(false)
   {
-
+    memset(&this->m_lastStats, 0, sizeof(this->m_lastStats));
   }
 
   void FreeRtosSerialDriverComponentImpl :: init(
@@ -41,24 +93,37 @@ namespace Drv {
     FreeRtosSerialDriverComponentBase::init(instance);
   }
 
-  bool FreeRtosSerialDriverComponentImpl :: open( sciBASE_t *sci, 
-                                                  UartBaudRate baud, 
-                                                  UartFlowControl fc, 
-                                                  UartParity parity, 
+  bool FreeRtosSerialDriverComponentImpl :: open( sciBASE_t *sci,
+                                                  UartBaudRate baud,
+                                                  UartFlowControl fc,
+                                                  UartParity parity,
                                                   bool block){
     if(sci == NULL) return false;
 
     m_sci = sci;
-    
+
     sciInit();
 
     sciEnterResetState(m_sci);
-    sciSetBaudrate(m_sci, baud);
-
-    sciEnableNotification(m_sci, SCI_RX_INT);
-
+    sciSetBaudrate(m_sci, baudToRate(baud));
     sciExitResetState(m_sci);
 
+    // Rings and receive interrupt first, then route the interrupt here
+    this->m_channel.open(m_sci);
+
+    U32 channel;
+    if (m_sci == sciREG) {
+      s_sciDriver = this;
+      channel = FREERTOS_SERIAL_SCI_VIM_CHANNEL;
+      vimChannelMap(channel, channel, &freeRtosSerialSciIsr);
+    } else {
+      FW_ASSERT(m_sci == scilinREG);
+      s_sciLinDriver = this;
+      channel = FREERTOS_SERIAL_SCILIN_VIM_CHANNEL;
+      vimChannelMap(channel, channel, &freeRtosSerialSciLinIsr);
+    }
+    vimEnableInterrupt(channel, SYS_IRQ);
+
     return true;
   }
 
@@ -68,6 +133,21 @@ namespace Drv {
 
   }
 
+  void FreeRtosSerialDriverComponentImpl :: isr(sciBASE_t *sci) {
+    FreeRtosSerialDriverComponentImpl* comp = (sci == sciREG) ? s_sciDriver : s_sciLinDriver;
+    if (comp == NULL) {
+      return;
+    }
+
+    // Wake the read task when the ring reaches its threshold. Partial
+    // fills are picked up by the read task's idle timeout.
+    if (comp->m_channel.serviceIsr() && comp->m_readTaskHandle != NULL) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(comp->m_readTaskHandle, &woken);
+      portYIELD_FROM_ISR(woken);
+    }
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations for user-defined typed input ports
   // ----------------------------------------------------------------------
@@ -76,108 +156,112 @@ namespace Drv {
     Drv::SerialReadStatus serReadStat;
     FreeRtosSerialDriverComponentImpl* comp = static_cast<FreeRtosSerialDriverComponentImpl*>(ptr);
     Fw::Buffer buff;
-    uint32_t tries = 10;
 
-    while (1) {
-        // wait for data
-        int sizeRead = 0;
+    comp->m_readTaskHandle = xTaskGetCurrentTaskHandle();
+    TickType_t tlmTick = xTaskGetTickCount();
 
-        // find open buffer
-        comp->m_readBuffMutex.lock();
+    while (1) {
+        // Sleep until the ring reaches the threshold or the line has been
+        // quiet for the idle time
+        (void) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FREERTOS_SERIAL_RX_IDLE_MSEC));
 
-        // search for open entry
-        NATIVE_INT_TYPE entryFound = false;
-        for(NATIVE_INT_TYPE entry = 0; entry < DR_MAX_NUM_BUFFERS; entry++){
-            if (comp->m_buffSet[entry].available) {
-                comp->m_buffSet[entry].available = false;
-                buff = comp->m_buffSet[entry].readBuffer;
-                entryFound = true;
-                break;
-            }
+        if (comp->m_quitReadThread) {
+            return;
         }
 
-        comp->m_readBuffMutex.unLock();
-
-        if (not entryFound) {
-            Fw::LogStringArg _arg = "FreeRtosSerialDriver";
-            comp->log_WARNING_HI_DR_NoBuffers(_arg);
-            serReadStat = Drv::SER_NO_BUFFERS;
-            comp->serialRecv_out(0,buff,serReadStat);
-            // to avoid spinning, wait 50 ms
-            Os::Task::delay(50);
-            continue;
-        }
+        while (comp->m_channel.getRxUsed() > 0) {
+            // find open buffer
+            comp->m_readBuffMutex.lock();
+
+            // search for open entry
+            NATIVE_INT_TYPE entryFound = false;
+            for(NATIVE_INT_TYPE entry = 0; entry < DR_MAX_NUM_BUFFERS; entry++){
+                if (comp->m_buffSet[entry].available) {
+                    comp->m_buffSet[entry].available = false;
+                    buff = comp->m_buffSet[entry].readBuffer;
+                    entryFound = true;
+                    break;
+                }
+            }
 
-        bool waiting = true;
-        int stat = 0;
+            comp->m_readBuffMutex.unLock();
 
-        while (waiting){
-          if(comp->m_quitReadThread) {
-            return;
-          }
-
-          // Block here if a rx is already underway
-          while(--tries && !sciIsRxReady(comp->m_sci));
-
-          //Blocking until timeout or data available
-          stat = sciReceiveWithTimeout(comp->m_sci, 
-                                      buff.getsize(),
-                                      reinterpret_cast<unsigned char*>(buff.getdata()),
-                                      0xffffffff); /*Max timeout */
-
-          // Good read:
-          if (stat > 0) {
-            sizeRead = stat;
-          }
-
-          // check for timeout
-          if (stat == 0) {
-            if (comp->m_quitReadThread) {
-              return;
-            }
-          } else { // quit if other error or data
-              waiting = false;
+            if (not entryFound) {
+                Fw::LogStringArg _arg = "FreeRtosSerialDriver";
+                comp->log_WARNING_HI_DR_NoBuffers(_arg);
+                serReadStat = Drv::SER_NO_BUFFERS;
+                comp->serialRecv_out(0,buff,serReadStat);
+                // to avoid spinning, wait 50 ms. The ring keeps filling meanwhile.
+                Os::Task::delay(50);
+                break;
             }
-        } // end of while waiting
-
-        if (comp->m_quitReadThread) {
-            return;
-        }
 
-        // check stat, maybe output event
-        if (stat == -1) {
-            Fw::LogStringArg _arg = "FreeRtosSerialDriver";
-            comp->log_WARNING_HI_DR_ReadError(_arg,stat);
-            serReadStat = Drv::SER_OTHER_ERR;
-        } else {
+            const NATIVE_UINT_TYPE sizeRead =
+                comp->m_channel.read(reinterpret_cast<U8*>(buff.getdata()), buff.getsize());
             buff.setsize(sizeRead);
             serReadStat = Drv::SER_OK;
+            comp->serialRecv_out(0,buff,serReadStat);
+        }
+
+        const TickType_t now = xTaskGetTickCount();
+        if (now - tlmTick >= pdMS_TO_TICKS(FREERTOS_SERIAL_TLM_PERIOD_MSEC)) {
+            comp->writeTlm((now - tlmTick) * portTICK_PERIOD_MS);
+            tlmTick = now;
         }
-        comp->serialRecv_out(0,buff,serReadStat);
       }
   }
 
+  void FreeRtosSerialDriverComponentImpl :: writeTlm(U32 elapsedMsec) {
+    SciChannel::Stats stats;
+    this->m_channel.getStats(stats);
+    this->m_channel.resetRxHighWater();
+
+    // Counters wrap, so the differences stay valid across a wrap
+    const U32 recvRate = static_cast<U32>((static_cast<U64>(stats.rxBytes - this->m_lastStats.rxBytes) * 1000) / elapsedMsec);
+    const U32 sendRate = static_cast<U32>((static_cast<U64>(stats.txBytes - this->m_lastStats.txBytes) * 1000) / elapsedMsec);
+
+    this->tlmWrite_DR_BytesRecv(stats.rxBytes);
+    this->tlmWrite_DR_BytesSent(stats.txBytes);
+    this->tlmWrite_DR_RecvRate(recvRate);
+    this->tlmWrite_DR_SendRate(sendRate);
+    if (stats.rxOverruns != this->m_lastStats.rxOverruns) {
+      this->tlmWrite_DR_RxOverruns(stats.rxOverruns);
+    }
+    if (stats.rxErrors != this->m_lastStats.rxErrors) {
+      this->tlmWrite_DR_RxErrors(stats.rxErrors);
+    }
+    this->tlmWrite_DR_RxRingHighWater(stats.rxHighWater);
+
+    this->m_lastStats = stats;
+  }
+
   void FreeRtosSerialDriverComponentImpl :: serialSend_handler(const NATIVE_INT_TYPE portNum,
                                                                 Fw::Buffer &serBuffer){
-    uint32_t tries = 10;
-    unsigned char* data = reinterpret_cast<unsigned char*>(serBuffer.getdata());
-    NATIVE_INT_TYPE xferSize = serBuffer.getsize();
-
-    // Block here if a tx is already underway
-    while(--tries && !sciIsTxReady(m_sci));
+    const U8* data = reinterpret_cast<const U8*>(serBuffer.getdata());
+    const NATIVE_UINT_TYPE xferSize = serBuffer.getsize();
+    NATIVE_UINT_TYPE sent = 0;
+    NATIVE_UINT_TYPE waitMsec = 0;
+
+    // Queue the buffer on the transmit ring and return; the interrupt
+    // handler sends it. Only a full ring makes the caller wait.
+    this->m_sendMutex.lock();
+    while (true) {
+      sent += this->m_channel.write(data + sent, xferSize - sent);
+      if (sent == xferSize || waitMsec >= FREERTOS_SERIAL_TX_WAIT_MSEC) {
+        break;
+      }
+      Os::Task::delay(1);
+      waitMsec++;
+    }
+    this->m_sendMutex.unLock();
 
-    if(!tries){
+    if (sent < xferSize) {
       Fw::LogStringArg _arg = "FreeRtosSerialDriver";
       this->log_WARNING_HI_DR_WriteError(_arg, -1);
-      return;
-    } 
-
-    //Send data using interrupt, do not call sciSend again until data is fully sent
-    sciSend(m_sci, xferSize, data);
-
+    }
   }
 
-  void FreeRtosSerialDriverComponentImpl :: startReadThread(NATIVE_INT_TYPE priority, 
+  void FreeRtosSerialDriverComponentImpl :: startReadThread(NATIVE_INT_TYPE priority,
                                                             NATIVE_INT_TYPE stackSize,
                                                             NATIVE_INT_TYPE cpuAffinity) {
 
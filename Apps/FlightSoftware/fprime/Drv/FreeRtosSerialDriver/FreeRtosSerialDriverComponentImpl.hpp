@@ -15,6 +15,9 @@
 
 #include <sci.h>
 #include <Os/Mutex.hpp>
+#include <HAL/include/FreeRTOS.h>
+#include <HAL/include/os_task.h>
+#include <Drv/FreeRtosSerialDriver/SciChannel.hpp>
 
 #include "Drv/FreeRtosSerialDriver/FreeRtosSerialDriverComponentAc.hpp"
 
@@ -94,10 +97,26 @@ namespace Drv {
       //!
       ~FreeRtosSerialDriverComponentImpl(void);
 
+      //! SCI interrupt handler body for the driver open on sci, if any.
+      //! Called from the VIM handlers.
+      static void isr(sciBASE_t *sci);
+
     PRIVATE:
       
       sciBASE_t * m_sci;
 
+      SciChannel m_channel; //!< interrupt-fed receive and transmit rings
+
+      //! Read task to notify from the interrupt handler. NULL until the task runs.
+      TaskHandle_t volatile m_readTaskHandle;
+
+      Os::Mutex m_sendMutex; //!< serializes senders on the transmit ring
+
+      //! Write the rate, overrun and high-water telemetry
+      void writeTlm(U32 elapsedMsec);
+
+      SciChannel::Stats m_lastStats; //!< statistics at the last telemetry update
+
       // ----------------------------------------------------------------------
       // Handler implementations for user-defined typed input ports
       // ----------------------------------------------------------------------
@@ -0,0 +1,213 @@
+// ======================================================================
+// \title  SciChannel.cpp
+// \brief  Interrupt-driven receive and transmit rings for one SCI port
+//
+// ======================================================================
+
+#include <Drv/FreeRtosSerialDriver/SciChannel.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Drv {
+
+  // The data store and the index store are both volatile, so the compiler
+  // keeps the byte write ahead of the index update that publishes it. That
+  // is all the ordering needed between a task and an interrupt handler on
+  // one in-order core.
+
+  static const U32 RING_MASK = FREERTOS_SERIAL_RING_SIZE - 1;
+
+  ByteRing ::
+    ByteRing() :
+      m_head(0),
+      m_tail(0)
+  {
+    FW_ASSERT((FREERTOS_SERIAL_RING_SIZE & RING_MASK) == 0, FREERTOS_SERIAL_RING_SIZE);
+  }
+
+  void ByteRing ::
+    reset(void)
+  {
+    this->m_head = 0;
+    this->m_tail = 0;
+  }
+
+  bool ByteRing ::
+    push(U8 byte)
+  {
+    const U32 head = this->m_head;
+    if (head - this->m_tail == FREERTOS_SERIAL_RING_SIZE) {
+      return false;
+    }
+    this->m_data[head & RING_MASK] = byte;
+    this->m_head = head + 1;
+    return true;
+  }
+
+  NATIVE_UINT_TYPE ByteRing ::
+    write(const U8* src, NATIVE_UINT_TYPE length)
+  {
+    FW_ASSERT(src);
+    const U32 head = this->m_head;
+    const U32 room = FREERTOS_SERIAL_RING_SIZE - (head - this->m_tail);
+    const U32 count = (length < room) ? length : room;
+    for (U32 i = 0; i < count; i++) {
+      this->m_data[(head + i) & RING_MASK] = src[i];
+    }
+    this->m_head = head + count;
+    return count;
+  }
+
+  bool ByteRing ::
+    pop(U8& byte)
+  {
+    const U32 tail = this->m_tail;
+    if (this->m_head == tail) {
+      return false;
+    }
+    byte = this->m_data[tail & RING_MASK];
+    this->m_tail = tail + 1;
+    return true;
+  }
+
+  NATIVE_UINT_TYPE ByteRing ::
+    read(U8* dest, NATIVE_UINT_TYPE length)
+  {
+    FW_ASSERT(dest);
+    const U32 tail = this->m_tail;
+    const U32 used = this->m_head - tail;
+    const U32 count = (length < used) ? length : used;
+    for (U32 i = 0; i < count; i++) {
+      dest[i] = this->m_data[(tail + i) & RING_MASK];
+    }
+    this->m_tail = tail + count;
+    return count;
+  }
+
+  NATIVE_UINT_TYPE ByteRing ::
+    getUsed(void) const
+  {
+    return this->m_head - this->m_tail;
+  }
+
+  SciChannel ::
+    SciChannel() :
+      m_sci(NULL),
+      m_rxBytes(0),
+      m_txBytes(0),
+      m_rxOverruns(0),
+      m_rxErrors(0),
+      m_rxHighWater(0)
+  {
+  }
+
+  void SciChannel ::
+    open(sciBASE_t* sci)
+  {
+    FW_ASSERT(sci);
+    this->m_sci = sci;
+    this->m_rx.reset();
+    this->m_tx.reset();
+    this->m_rxBytes = 0;
+    this->m_txBytes = 0;
+    this->m_rxOverruns = 0;
+    this->m_rxErrors = 0;
+    this->m_rxHighWater = 0;
+
+    // Transmit interrupts only run while the transmit ring has data
+    this->m_sci->CLEARINT = SCI_TX_INT;
+    this->m_sci->FLR = SCI_FE_INT | SCI_OE_INT | SCI_PE_INT;
+    this->m_sci->SETINT = SCI_RX_INT;
+  }
+
+  bool SciChannel ::
+    serviceIsr(void)
+  {
+    const U32 flags = this->m_sci->FLR;
+    bool wake = false;
+
+    // Error flags are write one to clear. An SCI overrun is a byte lost
+    // before the handler ran, so it counts with the ring overruns.
+    const U32 errors = flags & (SCI_FE_INT | SCI_OE_INT | SCI_PE_INT);
+    if (errors != 0) {
+      this->m_sci->FLR = errors;
+      if (errors & SCI_OE_INT) {
+        this->m_rxOverruns++;
+      }
+      if (errors & (SCI_FE_INT | SCI_PE_INT)) {
+        this->m_rxErrors++;
+      }
+    }
+
+    // Reading RD clears the receive ready flag
+    if (flags & SCI_RX_INT) {
+      const U8 byte = static_cast<U8>(this->m_sci->RD & 0xFF);
+      if (this->m_rx.push(byte)) {
+        this->m_rxBytes++;
+        const U32 used = this->m_rx.getUsed();
+        if (used > this->m_rxHighWater) {
+          this->m_rxHighWater = used;
+        }
+        wake = (used == FREERTOS_SERIAL_RX_NOTIFY_THRESHOLD);
+      } else {
+        this->m_rxOverruns++;
+      }
+    }
+
+    // The transmit ready flag stays up while the transmitter is idle, so it
+    // only means work while the transmit interrupt is enabled
+    if ((flags & SCI_TX_INT) && (this->m_sci->SETINT & SCI_TX_INT)) {
+      U8 byte;
+      if (this->m_tx.pop(byte)) {
+        this->m_sci->TD = byte;
+      } else {
+        this->m_sci->CLEARINT = SCI_TX_INT;
+      }
+    }
+
+    return wake;
+  }
+
+  NATIVE_UINT_TYPE SciChannel ::
+    read(U8* dest, NATIVE_UINT_TYPE length)
+  {
+    return this->m_rx.read(dest, length);
+  }
+
+  NATIVE_UINT_TYPE SciChannel ::
+    write(const U8* src, NATIVE_UINT_TYPE length)
+  {
+    FW_ASSERT(this->m_sci);
+    const NATIVE_UINT_TYPE count = this->m_tx.write(src, length);
+    if (count > 0) {
+      // Enabling the interrupt with the transmitter idle raises it at once.
+      // If the handler had just found the ring empty and disabled it, this
+      // turns it back on after the new bytes are visible.
+      this->m_txBytes += count;
+      this->m_sci->SETINT = SCI_TX_INT;
+    }
+    return count;
+  }
+
+  NATIVE_UINT_TYPE SciChannel ::
+    getRxUsed(void) const
+  {
+    return this->m_rx.getUsed();
+  }
+
+  void SciChannel ::
+    getStats(Stats& stats) const
+  {
+    stats.rxBytes = this->m_rxBytes;
+    stats.txBytes = this->m_txBytes;
+    stats.rxOverruns = this->m_rxOverruns;
+    stats.rxErrors = this->m_rxErrors;
+    stats.rxHighWater = this->m_rxHighWater;
+  }
+
+  void SciChannel ::
+    resetRxHighWater(void)
+  {
+    this->m_rxHighWater = this->m_rx.getUsed();
+  }
+
+} // end namespace Drv
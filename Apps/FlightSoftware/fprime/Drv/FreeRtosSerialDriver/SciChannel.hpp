@@ -0,0 +1,106 @@
+// ======================================================================
+// \title  SciChannel.hpp
+// \brief  Interrupt-driven receive and transmit rings for one SCI port
+//
+//         The SCI interrupt handler moves received bytes into the
+//         receive ring and feeds the transmitter from the transmit
+//         ring, so no task ever waits on the SCI flag register. Each
+//         ring has one producer and one consumer: an interrupt handler
+//         on one side and a task on the other. The producer only
+//         writes the head index and the consumer only writes the tail
+//         index, so the rings need no lock on the single core target.
+//
+// ======================================================================
+
+#ifndef FreeRtosSerialDriver_SciChannel_HPP
+#define FreeRtosSerialDriver_SciChannel_HPP
+
+#include <sci.h>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Drv/FreeRtosSerialDriver/FreeRtosSerialDriverCfg.hpp>
+
+namespace Drv {
+
+  //! Single producer, single consumer byte ring
+  class ByteRing {
+
+    public:
+
+      ByteRing();
+
+      void reset(void); //!< empty the ring. Neither side may be running.
+
+      bool push(U8 byte); //!< producer: add one byte. False when full.
+      NATIVE_UINT_TYPE write(const U8* src, NATIVE_UINT_TYPE length); //!< producer: add up to length bytes, returns the number added
+
+      bool pop(U8& byte); //!< consumer: remove one byte. False when empty.
+      NATIVE_UINT_TYPE read(U8* dest, NATIVE_UINT_TYPE length); //!< consumer: remove up to length bytes, returns the number removed
+
+      NATIVE_UINT_TYPE getUsed(void) const; //!< bytes in the ring
+
+    PRIVATE:
+
+      // The indices run freely and are masked on access, so head - tail is
+      // the fill level even across wraps
+      volatile U8 m_data[FREERTOS_SERIAL_RING_SIZE]; //!< ring storage
+      volatile U32 m_head; //!< next byte to write, written by the producer only
+      volatile U32 m_tail; //!< next byte to read, written by the consumer only
+
+  };
+
+  //! Receive and transmit rings of one SCI port, with link statistics
+  class SciChannel {
+
+    public:
+
+      //! Link statistics. Counters are running totals.
+      struct Stats {
+          U32 rxBytes; //!< bytes received into the ring
+          U32 txBytes; //!< bytes queued for transmission
+          U32 rxOverruns; //!< bytes lost because the ring or the SCI receive buffer was full
+          U32 rxErrors; //!< framing and parity errors
+          U32 rxHighWater; //!< highest receive ring fill level since the last reset
+      };
+
+      SciChannel();
+
+      //! Reset the rings and statistics and enable the receive interrupt.
+      //! Called with the SCI interrupt not yet routed to the handler.
+      void open(sciBASE_t* sci);
+
+      //! Interrupt handler body. Takes at most one received byte and sends at
+      //! most one byte, as the SCI has a single byte buffer each way.
+      //! Returns true when the receive ring has just reached the notification
+      //! threshold and the reader should be woken.
+      bool serviceIsr(void);
+
+      //! Reader task: take up to length received bytes
+      NATIVE_UINT_TYPE read(U8* dest, NATIVE_UINT_TYPE length);
+
+      //! Sender task: queue up to length bytes and make sure the transmit
+      //! interrupt is running. Returns the number queued. Concurrent senders
+      //! must hold a lock around the call.
+      NATIVE_UINT_TYPE write(const U8* src, NATIVE_UINT_TYPE length);
+
+      NATIVE_UINT_TYPE getRxUsed(void) const; //!< bytes waiting in the receive ring
+
+      void getStats(Stats& stats) const; //!< copy the statistics
+      void resetRxHighWater(void); //!< restart the high-water mark from the current fill level
+
+    PRIVATE:
+
+      sciBASE_t* m_sci; //!< SCI register frame
+      ByteRing m_rx; //!< filled by the interrupt handler, drained by the reader task
+      ByteRing m_tx; //!< filled by senders, drained by the interrupt handler
+
+      volatile U32 m_rxBytes; //!< see Stats
+      volatile U32 m_txBytes; //!< see Stats
+      volatile U32 m_rxOverruns; //!< see Stats
+      volatile U32 m_rxErrors; //!< see Stats
+      volatile U32 m_rxHighWater; //!< see Stats
+
+  };
+
+} // end namespace Drv
+
+#endif
@@ -1,7 +1,16 @@
 
-SRC = FreeRtosSerialDriverComponentAi.xml FreeRtosSerialDriverComponentImpl.cpp
+SRC = FreeRtosSerialDriverComponentAi.xml SciChannel.cpp
 
-HDR = FreeRtosSerialDriverComponentImpl.hpp
+# The implementation needs the HAL; host builds of the CubeRover topology
+# use CubeRover/SimSerialDriver instead
+SRC_TIR4 = FreeRtosSerialDriverComponentImpl.cpp
 
-#SUBDIRS = test
+HDR = SciChannel.hpp FreeRtosSerialDriverCfg.hpp
+
+HDR_TIR4 = FreeRtosSerialDriverComponentImpl.hpp
+
+# Host builds compile SciChannel against the SCI register model
+COMPARGS_LINUX = -I$(BUILD_ROOT)/Drv/FreeRtosSerialDriver/test/ut
+
+SUBDIRS = test
 
@@ -0,0 +1 @@
+SUBDIRS = ut
\ No newline at end of file
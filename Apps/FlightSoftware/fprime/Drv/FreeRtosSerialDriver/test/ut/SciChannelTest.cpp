@@ -0,0 +1,266 @@
+// ----------------------------------------------------------------------
+// SciChannelTest.cpp
+// ----------------------------------------------------------------------
+//
+// Runs the SciChannel interrupt handler and task side against the SCI
+// register model in sci.h.
+
+#include <Drv/FreeRtosSerialDriver/SciChannel.hpp>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+namespace {
+
+  //! Bytes per second on a 921600 baud 8N1 line
+  const U32 LINE_BYTES_PER_SEC = 921600 / 10;
+
+  //! Run the handler for as long as the model holds the interrupt line up.
+  //! Returns true if the handler asked for the reader to be woken.
+  bool runIsr(SciModel& sci, Drv::SciChannel& channel) {
+    bool wake = false;
+    while (sci.interrupt()) {
+      wake = channel.serviceIsr() || wake;
+    }
+    return wake;
+  }
+
+  U8 pattern(U32 index) {
+    return static_cast<U8>(index * 7 + (index >> 8));
+  }
+
+  F64 nowNsec(void) {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return static_cast<F64>(t.tv_sec) * 1.0e9 + t.tv_nsec;
+  }
+
+}
+
+TEST(SciChannel, ReceiveInOrder) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+  ASSERT_EQ(static_cast<U32>(SCI_RX_INT), sci.enables);
+
+  const U32 count = 300;
+  for (U32 i = 0; i < count; i++) {
+    sci.receive(pattern(i));
+    runIsr(sci, channel);
+  }
+  ASSERT_EQ(count, channel.getRxUsed());
+
+  U8 data[128];
+  U32 index = 0;
+  while (channel.getRxUsed() > 0) {
+    const NATIVE_UINT_TYPE size = channel.read(data, sizeof(data));
+    for (U32 i = 0; i < size; i++, index++) {
+      ASSERT_EQ(pattern(index), data[i]);
+    }
+  }
+  ASSERT_EQ(count, index);
+
+  Drv::SciChannel::Stats stats;
+  channel.getStats(stats);
+  ASSERT_EQ(count, stats.rxBytes);
+  ASSERT_EQ(0U, stats.rxOverruns);
+  ASSERT_EQ(count, stats.rxHighWater);
+
+  // High water restarts from the current fill level
+  channel.resetRxHighWater();
+  channel.getStats(stats);
+  ASSERT_EQ(0U, stats.rxHighWater);
+}
+
+TEST(SciChannel, RingOverrun) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+
+  const U32 extra = 10;
+  for (U32 i = 0; i < Drv::FREERTOS_SERIAL_RING_SIZE + extra; i++) {
+    sci.receive(pattern(i));
+    runIsr(sci, channel);
+  }
+
+  Drv::SciChannel::Stats stats;
+  channel.getStats(stats);
+  ASSERT_EQ(static_cast<U32>(Drv::FREERTOS_SERIAL_RING_SIZE), stats.rxBytes);
+  ASSERT_EQ(extra, stats.rxOverruns);
+  ASSERT_EQ(static_cast<U32>(Drv::FREERTOS_SERIAL_RING_SIZE), stats.rxHighWater);
+
+  // The oldest bytes are kept
+  static U8 data[Drv::FREERTOS_SERIAL_RING_SIZE];
+  ASSERT_EQ(static_cast<NATIVE_UINT_TYPE>(Drv::FREERTOS_SERIAL_RING_SIZE), channel.read(data, sizeof(data)));
+  for (U32 i = 0; i < Drv::FREERTOS_SERIAL_RING_SIZE; i++) {
+    ASSERT_EQ(pattern(i), data[i]);
+  }
+}
+
+TEST(SciChannel, HardwareErrors) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+
+  // Second byte arrives before the handler ran: the SCI overruns
+  sci.receive(1);
+  sci.receive(2);
+  runIsr(sci, channel);
+
+  // Framing error with the byte
+  sci.flags |= SCI_FE_INT;
+  sci.receive(3);
+  runIsr(sci, channel);
+  ASSERT_EQ(0U, sci.flags & (SCI_FE_INT | SCI_OE_INT | SCI_PE_INT));
+
+  Drv::SciChannel::Stats stats;
+  channel.getStats(stats);
+  ASSERT_EQ(1U, stats.rxOverruns);
+  ASSERT_EQ(1U, stats.rxErrors);
+
+  U8 data[4];
+  ASSERT_EQ(2U, channel.read(data, sizeof(data)));
+  ASSERT_EQ(2, data[0]);
+  ASSERT_EQ(3, data[1]);
+}
+
+TEST(SciChannel, NotifyThreshold) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+
+  U8 data[Drv::FREERTOS_SERIAL_RX_NOTIFY_THRESHOLD];
+  for (U32 round = 0; round < 3; round++) {
+    U32 wakes = 0;
+    U32 wakeAt = 0;
+    for (U32 i = 1; i <= 2 * Drv::FREERTOS_SERIAL_RX_NOTIFY_THRESHOLD; i++) {
+      sci.receive(pattern(i));
+      if (runIsr(sci, channel)) {
+        wakes++;
+        wakeAt = i;
+      }
+    }
+    // One wake, when the threshold is reached, and none above it
+    ASSERT_EQ(1U, wakes);
+    ASSERT_EQ(static_cast<U32>(Drv::FREERTOS_SERIAL_RX_NOTIFY_THRESHOLD), wakeAt);
+    while (channel.read(data, sizeof(data)) > 0) {
+    }
+  }
+}
+
+TEST(SciChannel, Transmit) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+
+  const U32 count = 3 * Drv::FREERTOS_SERIAL_RING_SIZE + 17;
+  static U8 source[count];
+  static U8 sent[count];
+  for (U32 i = 0; i < count; i++) {
+    source[i] = pattern(i);
+  }
+  sci.recordSent(sent, count);
+
+  // Fill the ring, then top it up as the transmitter drains it
+  U32 queued = channel.write(source, count);
+  ASSERT_EQ(static_cast<U32>(Drv::FREERTOS_SERIAL_RING_SIZE), queued);
+  while (sci.sentCount < count) {
+    runIsr(sci, channel);
+    ASSERT_TRUE(sci.shiftOut());
+    queued += channel.write(source + queued, count - queued);
+  }
+  runIsr(sci, channel);
+
+  ASSERT_EQ(0, memcmp(source, sent, count));
+  // Drained: transmit interrupt off, receive interrupt still on
+  ASSERT_EQ(static_cast<U32>(SCI_RX_INT), sci.enables);
+
+  Drv::SciChannel::Stats stats;
+  channel.getStats(stats);
+  ASSERT_EQ(count, stats.txBytes);
+
+  // Writing again restarts the transmitter
+  ASSERT_EQ(1U, channel.write(source, 1));
+  runIsr(sci, channel);
+  ASSERT_TRUE(sci.txBusy);
+}
+
+// Full duplex 921600 baud for one second of line time, in virtual time. Each
+// step is one byte time: a byte arrives, one shifts out, and the handler runs.
+// The reader task runs a latency after being woken, or at its idle timeout,
+// and the sender tops up the transmit ring every few milliseconds. Checks
+// nothing is lost and reports the host time the driver spends per byte.
+TEST(Performance, Throughput921600) {
+  SciModel sci;
+  Drv::SciChannel channel;
+  channel.open(&sci);
+
+  const U32 steps = LINE_BYTES_PER_SEC;
+  const U32 bytesPerMsec = LINE_BYTES_PER_SEC / 1000;
+  const U32 readerLatency = bytesPerMsec / 2;
+  const U32 idleTimeout = Drv::FREERTOS_SERIAL_RX_IDLE_MSEC * bytesPerMsec;
+  const U32 sendPeriod = 4 * bytesPerMsec;
+  const U32 sendChunk = 512;
+
+  static U8 sent[LINE_BYTES_PER_SEC];
+  sci.recordSent(sent, steps);
+
+  U8 chunk[sendChunk];
+  U8 readBuffer[256];
+  U32 received = 0;
+  U32 queued = 0;
+  U32 readerRunAt = idleTimeout;
+  bool readerWoken = false;
+
+  const F64 start = nowNsec();
+  for (U32 t = 0; t < steps; t++) {
+    sci.receive(pattern(t));
+    sci.shiftOut();
+    if (runIsr(sci, channel) && not readerWoken) {
+      readerWoken = true;
+      readerRunAt = t + readerLatency;
+    }
+
+    if (t == readerRunAt) {
+      NATIVE_UINT_TYPE size;
+      while ((size = channel.read(readBuffer, sizeof(readBuffer))) > 0) {
+        for (U32 i = 0; i < size; i++, received++) {
+          ASSERT_EQ(pattern(received), readBuffer[i]);
+        }
+      }
+      readerWoken = false;
+      readerRunAt = t + idleTimeout;
+    }
+
+    if (t % sendPeriod == 0) {
+      for (U32 i = 0; i < sendChunk; i++) {
+        chunk[i] = pattern(queued + i);
+      }
+      queued += channel.write(chunk, sendChunk);
+    }
+  }
+  const F64 elapsed = nowNsec() - start;
+
+  received += channel.read(readBuffer, sizeof(readBuffer));
+
+  Drv::SciChannel::Stats stats;
+  channel.getStats(stats);
+  ASSERT_EQ(0U, stats.rxOverruns);
+  ASSERT_EQ(steps, stats.rxBytes);
+  // The transmitter never went idle for want of data
+  ASSERT_GE(sci.sentCount, steps - 2);
+  for (U32 i = 0; i < sci.sentCount && i < steps; i++) {
+    ASSERT_EQ(pattern(i), sent[i]);
+  }
+
+  printf("921600 baud full duplex: %u bytes each way, rx high water %u of %u\n",
+      steps, stats.rxHighWater, static_cast<U32>(Drv::FREERTOS_SERIAL_RING_SIZE));
+  printf("Host driver time: %.1f ns per byte pair, %.2f%% of the line time\n",
+      elapsed / steps, 100.0 * elapsed / 1.0e9);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,15 @@
+#
+#   Copyright 2004-2008, by the California Institute of Technology.
+#   ALL RIGHTS RESERVED. United States Government Sponsorship
+#   acknowledged.
+#
+#
+
+# SciChannel runs on the host against the SCI register model in sci.h,
+# which shadows the HAL header through COMPARGS.
+
+TEST_SRC = SciChannelTest.cpp
+
+TEST_MODS = Drv/FreeRtosSerialDriver Fw/Types Os gtest
+
+COMPARGS = -I$(CURDIR)/test/ut
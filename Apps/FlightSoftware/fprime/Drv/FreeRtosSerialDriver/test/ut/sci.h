@@ -0,0 +1,165 @@
+// ======================================================================
+// \title  sci.h
+// \brief  Host model of the SCI register frame for the SciChannel tests
+//
+//         Stands in for the HAL sci.h. The registers SciChannel touches
+//         are objects with the side effects of the hardware:
+//         - reading RD clears the receive ready flag
+//         - writing TD clears the transmit ready flag
+//         - the error flags in FLR are cleared by writing ones
+//         - SETINT and CLEARINT set and clear the interrupt enables
+//         The test drives the line side through receive() and
+//         shiftOut(), and calls the handler while interrupt() is true.
+//
+// ======================================================================
+
+#ifndef FreeRtosSerialDriver_SciModel_H
+#define FreeRtosSerialDriver_SciModel_H
+
+#include <Fw/Types/BasicTypes.hpp>
+
+enum sciIntFlags
+{
+    SCI_FE_INT    = 0x04000000U,  /* framing error */
+    SCI_OE_INT    = 0x02000000U,  /* overrun error */
+    SCI_PE_INT    = 0x01000000U,  /* parity error */
+    SCI_RX_INT    = 0x00000200U,  /* receive buffer ready */
+    SCI_TX_INT    = 0x00000100U,  /* transmit buffer ready */
+    SCI_WAKE_INT  = 0x00000002U,  /* wakeup */
+    SCI_BREAK_INT = 0x00000001U   /* break detect */
+};
+
+class SciModel;
+
+//! Flag register: reads the flags, writing ones clears error flags
+class SciFlrReg {
+    public:
+        explicit SciFlrReg(SciModel& sci) : m_sci(sci) {}
+        operator U32() const;
+        SciFlrReg& operator=(U32 clear);
+    private:
+        SciModel& m_sci;
+};
+
+//! Receive data register: reading takes the byte
+class SciRdReg {
+    public:
+        explicit SciRdReg(SciModel& sci) : m_sci(sci) {}
+        operator U32() const;
+    private:
+        SciModel& m_sci;
+};
+
+//! Transmit data register: writing starts the byte
+class SciTdReg {
+    public:
+        explicit SciTdReg(SciModel& sci) : m_sci(sci) {}
+        SciTdReg& operator=(U32 byte);
+    private:
+        SciModel& m_sci;
+};
+
+//! SETINT reads the enables and sets the bits written; CLEARINT clears them
+class SciIntReg {
+    public:
+        SciIntReg(SciModel& sci, bool set) : m_sci(sci), m_set(set) {}
+        operator U32() const;
+        SciIntReg& operator=(U32 bits);
+    private:
+        SciModel& m_sci;
+        bool m_set;
+};
+
+class SciModel {
+    public:
+        SciModel() :
+            FLR(*this), RD(*this), TD(*this), SETINT(*this, true), CLEARINT(*this, false),
+            flags(SCI_TX_INT), enables(0), rxData(0), txShift(0), txBusy(false),
+            sent(0), sentCount(0), sentCapacity(0) {}
+
+        // Register frame, as seen by SciChannel
+        SciFlrReg FLR;
+        SciRdReg RD;
+        SciTdReg TD;
+        SciIntReg SETINT;
+        SciIntReg CLEARINT;
+
+        //! A byte arrives off the line. Sets overrun if the last one was not read.
+        void receive(U8 byte) {
+            if (this->flags & SCI_RX_INT) {
+                this->flags |= SCI_OE_INT;
+            }
+            this->rxData = byte;
+            this->flags |= SCI_RX_INT;
+        }
+
+        //! The shift register finishes a byte. Returns true if one went out.
+        bool shiftOut(void) {
+            if (not this->txBusy) {
+                return false;
+            }
+            if (this->sentCount < this->sentCapacity) {
+                this->sent[this->sentCount] = this->txShift;
+            }
+            this->sentCount++;
+            this->txBusy = false;
+            this->flags |= SCI_TX_INT;
+            return true;
+        }
+
+        //! Level 0 interrupt line
+        bool interrupt(void) const {
+            return ((this->flags & this->enables & (SCI_RX_INT | SCI_TX_INT)) != 0) ||
+                ((this->flags & (SCI_OE_INT | SCI_FE_INT | SCI_PE_INT)) != 0);
+        }
+
+        //! Where transmitted bytes are recorded
+        void recordSent(U8* buffer, U32 capacity) {
+            this->sent = buffer;
+            this->sentCapacity = capacity;
+            this->sentCount = 0;
+        }
+
+        U32 flags; //!< FLR contents
+        U32 enables; //!< interrupt enables
+        U8 rxData; //!< RD contents
+        U8 txShift; //!< byte in the transmit shift register
+        bool txBusy; //!< shift register busy
+        U8* sent; //!< transmitted bytes
+        U32 sentCount; //!< number of transmitted bytes
+        U32 sentCapacity; //!< size of sent
+};
+
+inline SciFlrReg::operator U32() const { return this->m_sci.flags; }
+inline SciFlrReg& SciFlrReg::operator=(U32 clear) {
+    this->m_sci.flags &= ~(clear & (SCI_OE_INT | SCI_FE_INT | SCI_PE_INT));
+    return *this;
+}
+
+inline SciRdReg::operator U32() const {
+    this->m_sci.flags &= ~SCI_RX_INT;
+    return this->m_sci.rxData;
+}
+
+// Single buffered in the model: transmit ready comes back once the byte
+// has shifted out
+inline SciTdReg& SciTdReg::operator=(U32 byte) {
+    this->m_sci.txShift = static_cast<U8>(byte);
+    this->m_sci.txBusy = true;
+    this->m_sci.flags &= ~SCI_TX_INT;
+    return *this;
+}
+
+inline SciIntReg::operator U32() const { return this->m_sci.enables; }
+inline SciIntReg& SciIntReg::operator=(U32 bits) {
+    if (this->m_set) {
+        this->m_sci.enables |= bits;
+    } else {
+        this->m_sci.enables &= ~bits;
+    }
+    return *this;
+}
+
+typedef SciModel sciBASE_t;
+
+#endif
@@ -11,6 +11,99 @@
 
 // Some macros/functions to optimize for architectures
 
+// Values are serialized most significant byte first. When the compiler
+// reports the byte order, a value is stored as one word: as is on a big
+// endian target, byte swapped on a little endian one. Otherwise it is
+// stored a byte at a time. The serialized bytes are the same either way.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FW_SERIALIZE_WORD_ACCESS 1
+#define FW_SERIALIZE_SWAP_16(val) (val)
+#define FW_SERIALIZE_SWAP_32(val) (val)
+#define FW_SERIALIZE_SWAP_64(val) (val)
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) && \
+    (defined(__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)))
+#define FW_SERIALIZE_WORD_ACCESS 1
+#define FW_SERIALIZE_SWAP_16(val) __builtin_bswap16(val)
+#define FW_SERIALIZE_SWAP_32(val) __builtin_bswap32(val)
+#define FW_SERIALIZE_SWAP_64(val) __builtin_bswap64(val)
+#else
+#define FW_SERIALIZE_WORD_ACCESS 0
+#endif
+
+#if FW_HAS_16_BIT==1
+static inline void storeU16(U8* dest, U16 val) {
+#if FW_SERIALIZE_WORD_ACCESS
+    val = FW_SERIALIZE_SWAP_16(val);
+    (void) memcpy(dest, &val, sizeof(val));
+#else
+    dest[0] = (U8) (val >> 8);
+    dest[1] = (U8) (val >> 0);
+#endif
+}
+
+static inline U16 loadU16(const U8* src) {
+#if FW_SERIALIZE_WORD_ACCESS
+    U16 val;
+    (void) memcpy(&val, src, sizeof(val));
+    return FW_SERIALIZE_SWAP_16(val);
+#else
+    return ((U16) src[0] << 8) | ((U16) src[1] << 0);
+#endif
+}
+#endif
+
+#if FW_HAS_32_BIT==1
+static inline void storeU32(U8* dest, U32 val) {
+#if FW_SERIALIZE_WORD_ACCESS
+    val = FW_SERIALIZE_SWAP_32(val);
+    (void) memcpy(dest, &val, sizeof(val));
+#else
+    dest[0] = (U8) (val >> 24);
+    dest[1] = (U8) (val >> 16);
+    dest[2] = (U8) (val >> 8);
+    dest[3] = (U8) (val >> 0);
+#endif
+}
+
+static inline U32 loadU32(const U8* src) {
+#if FW_SERIALIZE_WORD_ACCESS
+    U32 val;
+    (void) memcpy(&val, src, sizeof(val));
+    return FW_SERIALIZE_SWAP_32(val);
+#else
+    return ((U32) src[0] << 24) | ((U32) src[1] << 16)
+            | ((U32) src[2] << 8) | ((U32) src[3] << 0);
+#endif
+}
+#endif
+
+#if FW_HAS_64_BIT==1
+static inline void storeU64(U8* dest, U64 val) {
+#if FW_SERIALIZE_WORD_ACCESS
+    val = FW_SERIALIZE_SWAP_64(val);
+    (void) memcpy(dest, &val, sizeof(val));
+#else
+    for (NATIVE_UINT_TYPE byte = 0; byte < sizeof(val); byte++) {
+        dest[byte] = (U8) (val >> (56 - 8 * byte));
+    }
+#endif
+}
+
+static inline U64 loadU64(const U8* src) {
+#if FW_SERIALIZE_WORD_ACCESS
+    U64 val;
+    (void) memcpy(&val, src, sizeof(val));
+    return FW_SERIALIZE_SWAP_64(val);
+#else
+    U64 val = 0;
+    for (NATIVE_UINT_TYPE byte = 0; byte < sizeof(val); byte++) {
+        val = (val << 8) | src[byte];
+    }
+    return val;
+#endif
+}
+#endif
+
 namespace Fw {
 
     Serializable::Serializable() {
@@ -94,10 +187,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        this->getBuffAddr()[this->m_serLoc + 0] = (U8) ((val & 0xFF00) >> 8);
-        this->getBuffAddr()[this->m_serLoc + 1] = (U8) ((val & 0x00FF) >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU16(&buff[this->m_serLoc], val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -107,10 +199,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        this->getBuffAddr()[this->m_serLoc + 0] = (U8) ((val & 0xFF00) >> 8);
-        this->getBuffAddr()[this->m_serLoc + 1] = (U8) ((val & 0x00FF) >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU16(&buff[this->m_serLoc], (U16) val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -121,16 +212,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        this->getBuffAddr()[this->m_serLoc + 0] =
-                (U8) ((val & 0xFF000000) >> 24);
-        this->getBuffAddr()[this->m_serLoc + 1] =
-                (U8) ((val & 0x00FF0000) >> 16);
-        this->getBuffAddr()[this->m_serLoc + 2] =
-                (U8) ((val & 0x0000FF00) >> 8);
-        this->getBuffAddr()[this->m_serLoc + 3] =
-                (U8) ((val & 0x000000FF) >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU32(&buff[this->m_serLoc], val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -140,16 +224,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        this->getBuffAddr()[this->m_serLoc + 0] =
-                (U8) ((val & 0xFF000000) >> 24);
-        this->getBuffAddr()[this->m_serLoc + 1] =
-                (U8) ((val & 0x00FF0000) >> 16);
-        this->getBuffAddr()[this->m_serLoc + 2] =
-                (U8) ((val & 0x0000FF00) >> 8);
-        this->getBuffAddr()[this->m_serLoc + 3] =
-                (U8) ((val & 0x000000FF) >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU32(&buff[this->m_serLoc], (U32) val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -161,25 +238,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        const U64 mask = 0xFF;
-        this->getBuffAddr()[this->m_serLoc + 0] = (U8) ((val & (mask << 56))
-                >> 56);
-        this->getBuffAddr()[this->m_serLoc + 1] = (U8) ((val & (mask << 48))
-                >> 48);
-        this->getBuffAddr()[this->m_serLoc + 2] = (U8) ((val & (mask << 40))
-                >> 40);
-        this->getBuffAddr()[this->m_serLoc + 3] = (U8) ((val & (mask << 32))
-                >> 32);
-        this->getBuffAddr()[this->m_serLoc + 4] = (U8) ((val & (mask << 24))
-                >> 24);
-        this->getBuffAddr()[this->m_serLoc + 5] = (U8) ((val & (mask << 16))
-                >> 16);
-        this->getBuffAddr()[this->m_serLoc + 6] = (U8) ((val & (mask << 8))
-                >> 8);
-        this->getBuffAddr()[this->m_serLoc + 7] = (U8) ((val & (mask << 0))
-                >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU64(&buff[this->m_serLoc], val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -189,25 +250,9 @@ namespace Fw {
         if (this->m_serLoc + (NATIVE_UINT_TYPE) sizeof(val) - 1 >= this->getBuffCapacity()) {
             return FW_SERIALIZE_NO_ROOM_LEFT;
         }
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        const U64 mask = 0xFF;
-        this->getBuffAddr()[this->m_serLoc + 0] = (U8) ((val & (mask << 56))
-                >> 56);
-        this->getBuffAddr()[this->m_serLoc + 1] = (U8) ((val & (mask << 48))
-                >> 48);
-        this->getBuffAddr()[this->m_serLoc + 2] = (U8) ((val & (mask << 40))
-                >> 40);
-        this->getBuffAddr()[this->m_serLoc + 3] = (U8) ((val & (mask << 32))
-                >> 32);
-        this->getBuffAddr()[this->m_serLoc + 4] = (U8) ((val & (mask << 24))
-                >> 24);
-        this->getBuffAddr()[this->m_serLoc + 5] = (U8) ((val & (mask << 16))
-                >> 16);
-        this->getBuffAddr()[this->m_serLoc + 6] =
-                (U8) ((val & (mask << 8)) >> 8);
-        this->getBuffAddr()[this->m_serLoc + 7] =
-                (U8) ((val & (mask << 0)) >> 0);
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        storeU64(&buff[this->m_serLoc], (U64) val);
         this->m_serLoc += sizeof(val);
         this->m_deserLoc = 0;
         return FW_SERIALIZE_OK;
@@ -313,6 +358,142 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    // array serialization routines
+
+    U8* SerializeBufferBase::reserveSer(NATIVE_UINT_TYPE size) {
+        if (size > this->getBuffCapacity() - this->m_serLoc) {
+            return NULL;
+        }
+        U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        U8* const dest = &buff[this->m_serLoc];
+        this->m_serLoc += size;
+        this->m_deserLoc = 0;
+        return dest;
+    }
+
+    SerializeStatus SerializeBufferBase::serialize(const I8* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(I8));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            dest[index] = (U8) vals[index];
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::serialize(const U16* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(U16));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU16(&dest[index * sizeof(U16)], vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::serialize(const I16* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(I16));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU16(&dest[index * sizeof(I16)], (U16) vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::serialize(const U32* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(U32));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU32(&dest[index * sizeof(U32)], vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::serialize(const I32* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(I32));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU32(&dest[index * sizeof(I32)], (U32) vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::serialize(const U64* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(U64));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU64(&dest[index * sizeof(U64)], vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::serialize(const I64* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(I64));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            storeU64(&dest[index * sizeof(I64)], (U64) vals[index]);
+        }
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::serialize(const F32* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(F32));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            U32 word;
+            (void) memcpy(&word, &vals[index], sizeof(word));
+            storeU32(&dest[index * sizeof(F32)], word);
+        }
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::serialize(const F64* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(F64));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            U64 word;
+            (void) memcpy(&word, &vals[index], sizeof(word));
+            storeU64(&dest[index * sizeof(F64)], word);
+        }
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::serialize(const bool* vals, NATIVE_UINT_TYPE count) {
+        U8* const dest = this->reserveSer(count * sizeof(U8));
+        if (NULL == dest) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            dest[index] = vals[index] ? FW_SERIALIZE_TRUE_VALUE : FW_SERIALIZE_FALSE_VALUE;
+        }
+        return FW_SERIALIZE_OK;
+    }
+
     // deserialization routines
 
     SerializeStatus SerializeBufferBase::deserialize(U8 &val) {
@@ -352,10 +533,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((U16) this->getBuffAddr()[this->m_deserLoc + 1] << 0)
-                | ((U16) this->getBuffAddr()[this->m_deserLoc + 0] << 8);
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = loadU16(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -368,10 +548,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((I16) this->getBuffAddr()[this->m_deserLoc + 1] << 0)
-                | ((I16) this->getBuffAddr()[this->m_deserLoc + 0] << 8);
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = (I16) loadU16(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -385,12 +564,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((U32) this->getBuffAddr()[this->m_deserLoc + 3] << 0)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 2] << 8)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 1] << 16)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 0] << 24);
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = loadU32(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -403,12 +579,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((U32) this->getBuffAddr()[this->m_deserLoc + 3] << 0)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 2] << 8)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 1] << 16)
-                | ((U32) this->getBuffAddr()[this->m_deserLoc + 0] << 24);
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = (I32) loadU32(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -424,17 +597,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((U64) this->getBuffAddr()[this->m_deserLoc + 7] << 0)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 6] << 8)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 5] << 16)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 4] << 24)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 3] << 32)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 2] << 40)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 1] << 48)
-                | ((U64) this->getBuffAddr()[this->m_deserLoc + 0] << 56);
-
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = loadU64(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -447,16 +612,9 @@ namespace Fw {
             return FW_DESERIALIZE_SIZE_MISMATCH;
         }
         // read from current location
-        FW_ASSERT(this->getBuffAddr());
-        // MSB first
-        val = ((I64) this->getBuffAddr()[this->m_deserLoc + 7] << 0)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 6] << 8)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 5] << 16)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 4] << 24)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 3] << 32)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 2] << 40)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 1] << 48)
-                | ((I64) this->getBuffAddr()[this->m_deserLoc + 0] << 56);
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        val = (I64) loadU64(&buff[this->m_deserLoc]);
         this->m_deserLoc += sizeof(val);
         return FW_SERIALIZE_OK;
     }
@@ -590,6 +748,186 @@ namespace Fw {
         return FW_SERIALIZE_OK;
     }
 
+    // array deserialization routines
+
+    SerializeStatus SerializeBufferBase::checkDeser(NATIVE_UINT_TYPE elementSize, NATIVE_UINT_TYPE count) const {
+        const NATIVE_UINT_TYPE left = this->getBuffLength() - this->m_deserLoc;
+        if (elementSize * count <= left) {
+            return FW_SERIALIZE_OK;
+        }
+        // same status as deserializing one element at a time
+        if ((left % elementSize) == 0) {
+            return FW_DESERIALIZE_BUFFER_EMPTY;
+        }
+        return FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+
+    SerializeStatus SerializeBufferBase::deserialize(I8* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(I8), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = (I8) src[index];
+        }
+        this->m_deserLoc += count * sizeof(I8);
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_16_BIT==1
+    SerializeStatus SerializeBufferBase::deserialize(U16* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(U16), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = loadU16(&src[index * sizeof(U16)]);
+        }
+        this->m_deserLoc += count * sizeof(U16);
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::deserialize(I16* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(I16), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = (I16) loadU16(&src[index * sizeof(I16)]);
+        }
+        this->m_deserLoc += count * sizeof(I16);
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+#if FW_HAS_32_BIT==1
+    SerializeStatus SerializeBufferBase::deserialize(U32* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(U32), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = loadU32(&src[index * sizeof(U32)]);
+        }
+        this->m_deserLoc += count * sizeof(U32);
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::deserialize(I32* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(I32), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = (I32) loadU32(&src[index * sizeof(I32)]);
+        }
+        this->m_deserLoc += count * sizeof(I32);
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+#if FW_HAS_64_BIT==1
+    SerializeStatus SerializeBufferBase::deserialize(U64* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(U64), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = loadU64(&src[index * sizeof(U64)]);
+        }
+        this->m_deserLoc += count * sizeof(U64);
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus SerializeBufferBase::deserialize(I64* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(I64), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            vals[index] = (I64) loadU64(&src[index * sizeof(I64)]);
+        }
+        this->m_deserLoc += count * sizeof(I64);
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::deserialize(F32* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(F32), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            const U32 word = loadU32(&src[index * sizeof(F32)]);
+            (void) memcpy(&vals[index], &word, sizeof(word));
+        }
+        this->m_deserLoc += count * sizeof(F32);
+        return FW_SERIALIZE_OK;
+    }
+
+#if FW_HAS_F64
+    SerializeStatus SerializeBufferBase::deserialize(F64* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(F64), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            const U64 word = loadU64(&src[index * sizeof(F64)]);
+            (void) memcpy(&vals[index], &word, sizeof(word));
+        }
+        this->m_deserLoc += count * sizeof(F64);
+        return FW_SERIALIZE_OK;
+    }
+#endif
+
+    SerializeStatus SerializeBufferBase::deserialize(bool* vals, NATIVE_UINT_TYPE count) {
+        SerializeStatus stat = this->checkDeser(sizeof(U8), count);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        const U8* const buff = this->getBuffAddr();
+        FW_ASSERT(buff);
+        const U8* const src = &buff[this->m_deserLoc];
+        for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+            if (FW_SERIALIZE_TRUE_VALUE == src[index]) {
+                vals[index] = true;
+            } else if (FW_SERIALIZE_FALSE_VALUE == src[index]) {
+                vals[index] = false;
+            } else {
+                return FW_DESERIALIZE_FORMAT_ERROR;
+            }
+        }
+        this->m_deserLoc += count * sizeof(U8);
+        return FW_SERIALIZE_OK;
+    }
+
     void SerializeBufferBase::resetSer(void) {
         this->m_deserLoc = 0;
         this->m_serLoc = 0;
@@ -79,6 +79,29 @@ namespace Fw {
 
             SerializeStatus serialize(const Serializable &val); //!< serialize an object derived from serializable base class
 
+            // Serialization for arrays of built-in types. No length is serialized, and the
+            // data is the same as serializing each element in turn, but there is one check
+            // for room for the whole array. Serialize a U8 array as a data buffer with noLength set.
+
+            SerializeStatus serialize(const I8* vals, NATIVE_UINT_TYPE count); //!< serialize array of 8-bit signed ints
+#if FW_HAS_16_BIT==1
+            SerializeStatus serialize(const U16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit unsigned ints
+            SerializeStatus serialize(const I16* vals, NATIVE_UINT_TYPE count); //!< serialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus serialize(const U32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit unsigned ints
+            SerializeStatus serialize(const I32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus serialize(const U64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit unsigned ints
+            SerializeStatus serialize(const I64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit signed ints
+#endif
+            SerializeStatus serialize(const F32* vals, NATIVE_UINT_TYPE count); //!< serialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus serialize(const F64* vals, NATIVE_UINT_TYPE count); //!< serialize array of 64-bit floating point
+#endif
+            SerializeStatus serialize(const bool* vals, NATIVE_UINT_TYPE count); //!< serialize array of booleans
+
             // Deserialization for built-in types
 
             SerializeStatus deserialize(U8 &val); //!< deserialize 8-bit unsigned int
@@ -115,6 +138,28 @@ namespace Fw {
 
             SerializeStatus deserialize(SerializeBufferBase& val);  //!< serialize a serialized buffer
 
+            // Deserialization for arrays of built-in types, the counterparts of the array
+            // serialization above. Nothing is deserialized if the whole array isn't there.
+
+            SerializeStatus deserialize(I8* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 8-bit signed ints
+#if FW_HAS_16_BIT==1
+            SerializeStatus deserialize(U16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit unsigned ints
+            SerializeStatus deserialize(I16* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 16-bit signed ints
+#endif
+#if FW_HAS_32_BIT==1
+            SerializeStatus deserialize(U32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit unsigned ints
+            SerializeStatus deserialize(I32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit signed ints
+#endif
+#if FW_HAS_64_BIT==1
+            SerializeStatus deserialize(U64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit unsigned ints
+            SerializeStatus deserialize(I64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit signed ints
+#endif
+            SerializeStatus deserialize(F32* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 32-bit floating point
+#if FW_HAS_F64
+            SerializeStatus deserialize(F64* vals, NATIVE_UINT_TYPE count); //!< deserialize array of 64-bit floating point
+#endif
+            SerializeStatus deserialize(bool* vals, NATIVE_UINT_TYPE count); //!< deserialize array of booleans
+
             void resetSer(void); //!< reset to beginning of buffer to reuse for serialization
             void resetDeser(void); //!< reset deserialization to beginning
 
@@ -145,6 +190,8 @@ namespace Fw {
 
         PRIVATE:
             void copyFrom(const SerializeBufferBase& src); //!< copy data from source buffer
+            U8* reserveSer(NATIVE_UINT_TYPE size); //!< claim room at the end of serialized data. NULL if there isn't room
+            SerializeStatus checkDeser(NATIVE_UINT_TYPE elementSize, NATIVE_UINT_TYPE count) const; //!< check that an array is left to deserialize
             NATIVE_UINT_TYPE m_serLoc; //!< current offset in buffer of serialized data
             NATIVE_UINT_TYPE m_deserLoc; //!< current offset for deserialization
     };
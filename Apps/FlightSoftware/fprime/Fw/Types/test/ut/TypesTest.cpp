@@ -444,6 +444,121 @@ TEST(SerializationTest,Serialization1) {
 
 }
 
+TEST(SerializationTest,WireFormat) {
+
+    // Values are serialized most significant byte first on every target
+    SerializeTestBuffer buff;
+    const U8 expected[] = {
+        0x12, 0x34, // U16
+        0xFF, 0xFE, // I16 -2
+        0x12, 0x34, 0x56, 0x78, // U32
+        0x80, 0x00, 0x00, 0x00, // I32 min
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, // U64
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, // I64 -3
+        0x3F, 0x80, 0x00, 0x00, // F32 1.0
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 // F64 -2.0
+    };
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((U16)0x1234));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((I16)-2));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((U32)0x12345678));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((I32)0x80000000));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((U64)0x0123456789ABCDEFULL));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((I64)-3));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((F32)1.0));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize((F64)-2.0));
+    ASSERT_EQ(sizeof(expected),buff.getBuffLength());
+    ASSERT_EQ(0,memcmp(expected,buff.getBuffAddr(),sizeof(expected)));
+
+    U16 u16; I16 i16; U32 u32; I32 i32; U64 u64; I64 i64; F32 f32; F64 f64;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(u16));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(i16));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(u32));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(i32));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(u64));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(i64));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(f32));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(f64));
+    ASSERT_EQ(0x1234,u16);
+    ASSERT_EQ(-2,i16);
+    ASSERT_EQ(0x12345678U,u32);
+    ASSERT_EQ((I32)0x80000000,i32);
+    ASSERT_EQ(0x0123456789ABCDEFULL,u64);
+    ASSERT_EQ(-3,i64);
+    ASSERT_FLOAT_EQ(1.0,f32);
+    ASSERT_DOUBLE_EQ(-2.0,f64);
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY,buff.deserialize(u16));
+}
+
+// Serialize an array with the array call and one element at a time, and
+// check that the bytes, the round trip and the error statuses all match
+template <typename T> void checkArray(const T* in, NATIVE_UINT_TYPE count) {
+    SerializeTestBuffer arrayBuff;
+    SerializeTestBuffer loopBuff;
+
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,arrayBuff.serialize(in,count));
+    for (NATIVE_UINT_TYPE index = 0; index < count; index++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,loopBuff.serialize(in[index]));
+    }
+    ASSERT_EQ(loopBuff.getBuffLength(),arrayBuff.getBuffLength());
+    ASSERT_EQ(0,memcmp(loopBuff.getBuffAddr(),arrayBuff.getBuffAddr(),loopBuff.getBuffLength()));
+
+    T out[16];
+    ASSERT_LE(count,FW_NUM_ARRAY_ELEMENTS(out));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,arrayBuff.deserialize(out,count));
+    ASSERT_EQ(0,memcmp(in,out,count * sizeof(T)));
+    ASSERT_EQ(0U,arrayBuff.getBuffLeft());
+
+    // Short of a whole element, or short by whole elements
+    arrayBuff.resetDeser();
+    ASSERT_EQ(Fw::FW_DESERIALIZE_BUFFER_EMPTY,arrayBuff.deserialize(out,count + 1));
+    if (sizeof(T) > 1) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,arrayBuff.setBuffLen(arrayBuff.getBuffLength() - 1));
+        ASSERT_EQ(Fw::FW_DESERIALIZE_SIZE_MISMATCH,arrayBuff.deserialize(out,count));
+    }
+    // Nothing is read when the array isn't all there
+    ASSERT_EQ(0U,arrayBuff.getBuffLength() - arrayBuff.getBuffLeft());
+
+    // No partial array is written when there isn't room
+    arrayBuff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,arrayBuff.setBuffLen(arrayBuff.getBuffCapacity() - (count * sizeof(T)) + 1));
+    NATIVE_UINT_TYPE length = arrayBuff.getBuffLength();
+    ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,arrayBuff.serialize(in,count));
+    ASSERT_EQ(length,arrayBuff.getBuffLength());
+}
+
+TEST(SerializationTest,Arrays) {
+
+    const I8 i8s[] = {-128, -1, 0, 1, 127};
+    const U16 u16s[] = {0, 1, 0x1234, 0xFFFF};
+    const I16 i16s[] = {-32768, -1, 0, 32767};
+    const U32 u32s[] = {0, 0xDEADBEEF, 0x12345678, 0xFFFFFFFF, 7};
+    const I32 i32s[] = {-100000, 0, 100000};
+    const U64 u64s[] = {0, 0x0123456789ABCDEFULL, 0xFFFFFFFFFFFFFFFFULL};
+    const I64 i64s[] = {-1, 0x7FFFFFFFFFFFFFFFLL, -0x7FFFFFFFFFFFFFFFLL};
+    const F32 f32s[] = {0.0, -1.5, 3.25e10, 1e-20};
+    const F64 f64s[] = {0.0, -1.5, 3.25e100, 1e-200};
+    const bool bools[] = {true, false, false, true};
+
+    checkArray(i8s,FW_NUM_ARRAY_ELEMENTS(i8s));
+    checkArray(u16s,FW_NUM_ARRAY_ELEMENTS(u16s));
+    checkArray(i16s,FW_NUM_ARRAY_ELEMENTS(i16s));
+    checkArray(u32s,FW_NUM_ARRAY_ELEMENTS(u32s));
+    checkArray(i32s,FW_NUM_ARRAY_ELEMENTS(i32s));
+    checkArray(u64s,FW_NUM_ARRAY_ELEMENTS(u64s));
+    checkArray(i64s,FW_NUM_ARRAY_ELEMENTS(i64s));
+    checkArray(f32s,FW_NUM_ARRAY_ELEMENTS(f32s));
+    checkArray(f64s,FW_NUM_ARRAY_ELEMENTS(f64s));
+    checkArray(bools,FW_NUM_ARRAY_ELEMENTS(bools));
+
+    // An invalid boolean fails the array like it fails a single value
+    SerializeTestBuffer buff;
+    const U8 bad[] = {FW_SERIALIZE_TRUE_VALUE, 0x55};
+    bool out[2];
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(bad,sizeof(bad),true));
+    ASSERT_EQ(Fw::FW_DESERIALIZE_FORMAT_ERROR,buff.deserialize(out,2));
+}
+
 struct TestStruct {
         U32 m_u32;
         U16 m_u16;
@@ -806,6 +921,142 @@ TEST(TypesTest,StringFormatTest) {
     printf("Formatted: %s\n",str.toChar());
 }
 
+// Telemetry-like record, serialized the way the autocoder used to generate
+// it (one element at a time) and the way it does now (one room check, then
+// array calls)
+struct BenchRecord {
+    U32 m_seconds;
+    U32 m_useconds;
+    F32 m_temps[16];
+    I16 m_raw[8];
+    U8 m_flags[4];
+    U64 m_counter;
+    bool m_valid;
+    enum {
+        SERIALIZED_SIZE = 2 * sizeof(U32) + 16 * sizeof(F32) + 8 * sizeof(I16) + 4 * sizeof(U8) + sizeof(U64) + sizeof(U8)
+    };
+
+    Fw::SerializeStatus serializeElements(Fw::SerializeBufferBase& buffer) const {
+        Fw::SerializeStatus stat = buffer.serialize(this->m_seconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_useconds);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 16); i++) stat = buffer.serialize(this->m_temps[i]);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 8); i++) stat = buffer.serialize(this->m_raw[i]);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 4); i++) stat = buffer.serialize(this->m_flags[i]);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_counter);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_valid);
+        return stat;
+    }
+
+    Fw::SerializeStatus serializeArrays(Fw::SerializeBufferBase& buffer) const {
+        if (buffer.getBuffCapacity() - buffer.getBuffLength() < SERIALIZED_SIZE) {
+            return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        Fw::SerializeStatus stat = buffer.serialize(this->m_seconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_useconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_temps, 16);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_raw, 8);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_flags, 4, true);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_counter);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.serialize(this->m_valid);
+        return stat;
+    }
+
+    Fw::SerializeStatus deserializeElements(Fw::SerializeBufferBase& buffer) {
+        Fw::SerializeStatus stat = buffer.deserialize(this->m_seconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_useconds);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 16); i++) stat = buffer.deserialize(this->m_temps[i]);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 8); i++) stat = buffer.deserialize(this->m_raw[i]);
+        for (NATIVE_UINT_TYPE i = 0; (stat == Fw::FW_SERIALIZE_OK) && (i < 4); i++) stat = buffer.deserialize(this->m_flags[i]);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_counter);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_valid);
+        return stat;
+    }
+
+    Fw::SerializeStatus deserializeArrays(Fw::SerializeBufferBase& buffer) {
+        NATIVE_UINT_TYPE flagsSize = 4;
+        Fw::SerializeStatus stat = buffer.deserialize(this->m_seconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_useconds);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_temps, 16);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_raw, 8);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_flags, flagsSize, true);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_counter);
+        if (stat == Fw::FW_SERIALIZE_OK) stat = buffer.deserialize(this->m_valid);
+        return stat;
+    }
+};
+
+TEST(Performance,SerializationBenchmark) {
+    const NATIVE_UINT_TYPE iterations = 1000000;
+    BenchRecord in;
+    BenchRecord out;
+    in.m_seconds = 1234;
+    in.m_useconds = 567890;
+    for (NATIVE_UINT_TYPE i = 0; i < 16; i++) {
+        in.m_temps[i] = 20.0 + i * 0.25;
+    }
+    for (NATIVE_UINT_TYPE i = 0; i < 8; i++) {
+        in.m_raw[i] = (I16) (i * 1000 - 4000);
+    }
+    memcpy(in.m_flags, "\x01\x02\x03\x04", sizeof(in.m_flags));
+    in.m_counter = 0x0123456789ABCDEFULL;
+    in.m_valid = true;
+
+    SerializeTestBuffer elementBuff;
+    SerializeTestBuffer arrayBuff;
+
+    // The two ways give the same bytes
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,in.serializeElements(elementBuff));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,in.serializeArrays(arrayBuff));
+    ASSERT_EQ((NATIVE_UINT_TYPE)BenchRecord::SERIALIZED_SIZE,arrayBuff.getBuffLength());
+    ASSERT_EQ(elementBuff.getBuffLength(),arrayBuff.getBuffLength());
+    ASSERT_EQ(0,memcmp(elementBuff.getBuffAddr(),arrayBuff.getBuffAddr(),arrayBuff.getBuffLength()));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,out.deserializeArrays(elementBuff));
+    ASSERT_EQ(0,memcmp(in.m_temps,out.m_temps,sizeof(in.m_temps)));
+    ASSERT_EQ(0,memcmp(in.m_raw,out.m_raw,sizeof(in.m_raw)));
+    ASSERT_EQ(in.m_counter,out.m_counter);
+
+    Os::IntervalTimer timer;
+    U32 elementSer, arraySer, elementDeser, arrayDeser;
+
+    timer.start();
+    for (NATIVE_UINT_TYPE iter = 0; iter < iterations; iter++) {
+        elementBuff.resetSer();
+        (void) in.serializeElements(elementBuff);
+    }
+    timer.stop();
+    elementSer = timer.getDiffUsec();
+
+    timer.start();
+    for (NATIVE_UINT_TYPE iter = 0; iter < iterations; iter++) {
+        arrayBuff.resetSer();
+        (void) in.serializeArrays(arrayBuff);
+    }
+    timer.stop();
+    arraySer = timer.getDiffUsec();
+
+    timer.start();
+    for (NATIVE_UINT_TYPE iter = 0; iter < iterations; iter++) {
+        elementBuff.resetDeser();
+        (void) out.deserializeElements(elementBuff);
+    }
+    timer.stop();
+    elementDeser = timer.getDiffUsec();
+
+    timer.start();
+    for (NATIVE_UINT_TYPE iter = 0; iter < iterations; iter++) {
+        arrayBuff.resetDeser();
+        (void) out.deserializeArrays(arrayBuff);
+    }
+    timer.stop();
+    arrayDeser = timer.getDiffUsec();
+
+    printf("%u records of %u bytes:\n", iterations, arrayBuff.getBuffLength());
+    printf("  serialize by element:   %u us (%.1f ns each)\n", elementSer, 1000.0 * elementSer / iterations);
+    printf("  serialize by array:     %u us (%.1f ns each)\n", arraySer, 1000.0 * arraySer / iterations);
+    printf("  deserialize by element: %u us (%.1f ns each)\n", elementDeser, 1000.0 * elementDeser / iterations);
+    printf("  deserialize by array:   %u us (%.1f ns each)\n", arrayDeser, 1000.0 * arrayDeser / iterations);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,66 @@
+#ifndef _CycleCounter_hpp_
+#define _CycleCounter_hpp_
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Os {
+
+    //! \class CycleCounter
+    //! \brief Free-running high-resolution hardware counter
+    //!
+    //! Wraps the fastest free-running counter of the platform: the Cortex-R4
+    //! PMU cycle counter on the FreeRTOS target and CLOCK_MONOTONIC_RAW on
+    //! hosts. IntervalTimer on FreeRTOS and the CubeRover time component are
+    //! built on it. The count is extended to 64 bits in software on targets
+    //! with a 32-bit counter, which needs read() to be called at least once per
+    //! counter wrap (19.5 s at 220 MHz); a rate group taking a TimerVal every
+    //! cycle is enough.
+
+    class CycleCounter {
+        public:
+
+            static void init(void); //!< start the counter. Call once before the scheduler starts.
+
+            //! Read the 64-bit count. Task context only on targets that extend the
+            //! count in software; interrupt handlers should use readRaw().
+            static U64 read(void);
+
+            //! Read the low 32 bits of the hardware counter. Safe anywhere;
+            //! differences are valid modulo 2^32.
+            static U32 readRaw(void);
+
+            static U32 getFrequency(void); //!< counts per second, nominal or as last calibrated
+
+            //! Measure the counter frequency against the platform reference clock
+            //! over roughly durationMsec and use the result for all conversions.
+            //! Blocks the calling task for the duration. Returns the new frequency.
+            static U32 calibrate(U32 durationMsec);
+
+            //! Convert a count difference to microseconds. Saturates at 0xFFFFFFFF.
+            static U32 toUsec(U64 counts);
+
+            //! Convert a count difference to nanoseconds. Saturates at 0xFFFFFFFF.
+            static U32 toNsec(U64 counts);
+
+            //! Split a count into whole seconds and the microseconds of the
+            //! remainder, without a 64-bit division. Seconds wrap past a U32.
+            static void toTime(U64 counts, U32& seconds, U32& useconds);
+
+        PRIVATE:
+
+            static void setFrequency(U32 frequency); //!< store frequency and precompute conversion factors
+            static U32 scale(U64 counts, U64 mult, U64 limit); //!< fixed-point conversion with saturation
+            static U64 mulHigh(U64 a, U64 b); //!< high 64 bits of a 64x64 bit product
+
+            static U32 s_frequency; //!< counts per second
+            static U64 s_usecMult; //!< microseconds per count, 32.32 fixed point
+            static U64 s_nsecMult; //!< nanoseconds per count, 32.32 fixed point
+            static U64 s_usecLimit; //!< largest count that converts to a U32 of microseconds
+            static U64 s_nsecLimit; //!< largest count that converts to a U32 of nanoseconds
+            static U64 s_secRecip; //!< seconds per count, 0.64 fixed point
+
+            CycleCounter(); //!< static only
+    };
+}
+
+#endif
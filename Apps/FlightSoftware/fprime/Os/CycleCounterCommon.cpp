@@ -0,0 +1,69 @@
+#include <Os/CycleCounter.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Os {
+
+    U32 CycleCounter::s_frequency = 0;
+    U64 CycleCounter::s_usecMult = 0;
+    U64 CycleCounter::s_nsecMult = 0;
+    U64 CycleCounter::s_usecLimit = 0;
+    U64 CycleCounter::s_nsecLimit = 0;
+    U64 CycleCounter::s_secRecip = 0;
+
+    U32 CycleCounter::getFrequency(void) {
+        return s_frequency;
+    }
+
+    void CycleCounter::setFrequency(U32 frequency) {
+        FW_ASSERT(frequency > 0);
+
+        // The conversions multiply by a 32.32 fixed point factor rather than divide
+        // by the frequency, since 64-bit division is a library call on the target.
+        // The limits are the largest counts whose product doesn't overflow, which is
+        // also where the converted value stops fitting in a U32.
+        s_usecMult = (static_cast<U64>(1000000) << 32) / frequency;
+        s_nsecMult = (static_cast<U64>(1000000000) << 32) / frequency;
+        s_usecLimit = static_cast<U64>(-1) / s_usecMult;
+        s_nsecLimit = static_cast<U64>(-1) / s_nsecMult;
+        s_secRecip = static_cast<U64>(-1) / frequency;
+        s_frequency = frequency;
+    }
+
+    U32 CycleCounter::scale(U64 counts, U64 mult, U64 limit) {
+        if (counts > limit) {
+            return 0xFFFFFFFF;
+        }
+        return static_cast<U32>((counts * mult) >> 32);
+    }
+
+    U32 CycleCounter::toUsec(U64 counts) {
+        return scale(counts, s_usecMult, s_usecLimit);
+    }
+
+    U32 CycleCounter::toNsec(U64 counts) {
+        return scale(counts, s_nsecMult, s_nsecLimit);
+    }
+
+    U64 CycleCounter::mulHigh(U64 a, U64 b) {
+        const U64 aLo = a & 0xFFFFFFFF;
+        const U64 aHi = a >> 32;
+        const U64 bLo = b & 0xFFFFFFFF;
+        const U64 bHi = b >> 32;
+        const U64 hiLo = aHi * bLo;
+        const U64 cross = ((aLo * bLo) >> 32) + (hiLo & 0xFFFFFFFF) + aLo * bHi;
+        return aHi * bHi + (hiLo >> 32) + (cross >> 32);
+    }
+
+    void CycleCounter::toTime(U64 counts, U32& seconds, U32& useconds) {
+        // The reciprocal rounds down, so the quotient is exact or one short
+        U64 wholeSeconds = mulHigh(counts, s_secRecip);
+        U64 remainder = counts - wholeSeconds * s_frequency;
+        if (remainder >= s_frequency) {
+            wholeSeconds++;
+            remainder -= s_frequency;
+        }
+        seconds = static_cast<U32>(wholeSeconds);
+        useconds = toUsec(remainder);
+    }
+
+}
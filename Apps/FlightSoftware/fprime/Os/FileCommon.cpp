@@ -3,15 +3,7 @@
 #include <Os/File.hpp>
 #include <Fw/Types/Assert.hpp>
 
-#ifdef __cplusplus
-extern "C" {
-#endif // __cplusplus
-
-#include <Utils/Hash/libcrc/lib_crc.h> // borrow CRC
-
-#ifdef __cplusplus
-}
-#endif // __cplusplus
+#include <Utils/Hash/crc32/CRC32Engine.hpp> // borrow CRC
 
 namespace Os {
     File::Status File::niceCRC32(U32 &crc, const char* fileName)
@@ -48,9 +40,7 @@ namespace Os {
             //Close file, then update CRC. This reduces time file is required open
             file.close();
             if (chunk != 0 && status == OP_OK) {
-                for (U32 ci = 0; static_cast<NATIVE_INT_TYPE>(ci) < chunk; ci++) {
-                    seed = update_crc_32(seed, file_buffer[ci]);
-                }
+                seed = Utils::CRC32Engine::update(seed, file_buffer, chunk);
             } else if (chunk == 0 && status == OP_OK) {
                 eof = true;
                 break;
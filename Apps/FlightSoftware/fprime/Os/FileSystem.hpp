@@ -33,6 +33,7 @@ namespace Os {
 		Status moveFile(const char* originPath, const char* destPath); //! moves a file from origin to destination
 		Status copyFile(const char* originPath, const char* destPath); //! copies a file from origin to destination
 		Status getFileSize(const char* path, U64& size); //!< gets the size of the file (in bytes) at location path
+		Status getFileModTime(const char* path, U32& seconds, U32& useconds); //!< gets the last modification time of the file at location path
 		Status getFileCount(const char* directory, U32& fileCount); //!< counts the number of files in the given directory
 		Status changeWorkingDirectory(const char* path); //!<  move current directory to path
 
@@ -0,0 +1,91 @@
+// ======================================================================
+// \title  CycleCounter.cpp
+// \brief  Cycle counter implementation using the Cortex-R4 PMU.
+//
+//         The PMU cycle counter runs at the CPU clock and is 32 bits
+//         wide. read() extends it to 64 bits by counting wraps, so it
+//         has to be called at least once per wrap period. The nominal
+//         frequency can be refined at startup with calibrate(), which
+//         measures the counter against the RTOS tick.
+//
+// ======================================================================
+
+#include <Os/CycleCounter.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <HAL/include/FreeRTOS.h>
+#include <HAL/include/os_task.h>
+#include <HAL/include/sys_pmu.h>
+
+//! Nominal counter frequency, the CPU clock (GCLK)
+#ifndef OS_CYCLE_COUNTER_FREQUENCY
+#define OS_CYCLE_COUNTER_FREQUENCY 220000000
+#endif
+
+namespace Os {
+
+    namespace {
+        U32 s_high = 0; //!< number of counter wraps seen by read()
+        U32 s_last = 0; //!< counter value at the last read()
+
+        //! Spin until the tick count moves and return the new count, so the
+        //! caller starts on a tick edge rather than somewhere inside a tick.
+        TickType_t waitTickEdge(void) {
+            const TickType_t start = xTaskGetTickCount();
+            TickType_t now;
+            do {
+                now = xTaskGetTickCount();
+            } while (now == start);
+            return now;
+        }
+    }
+
+    void CycleCounter::init(void) {
+        _pmuInit_();
+        _pmuEnableCountersGlobal_();
+        _pmuResetCycleCounter_();
+        _pmuStartCounters_(pmuCYCLE_COUNTER);
+
+        s_high = 0;
+        s_last = 0;
+        setFrequency(OS_CYCLE_COUNTER_FREQUENCY);
+    }
+
+    U64 CycleCounter::read(void) {
+        taskENTER_CRITICAL();
+        const U32 now = _pmuGetCycleCount_();
+        if (now < s_last) {
+            s_high++;
+        }
+        s_last = now;
+        const U32 high = s_high;
+        taskEXIT_CRITICAL();
+
+        return (static_cast<U64>(high) << 32) | now;
+    }
+
+    U32 CycleCounter::readRaw(void) {
+        return _pmuGetCycleCount_();
+    }
+
+    U32 CycleCounter::calibrate(U32 durationMsec) {
+        const TickType_t ticks = pdMS_TO_TICKS(durationMsec);
+        FW_ASSERT(ticks > 1,ticks);
+
+        // Spin for the first and last tick edges and sleep in between, so only
+        // the edges cost CPU time. Tick interrupt latency is the same at both
+        // edges and cancels out.
+        const TickType_t startTick = waitTickEdge();
+        const U64 start = read();
+        vTaskDelay(ticks - 1);
+        while (xTaskGetTickCount() - startTick < ticks - 1) {
+            vTaskDelay(1);
+        }
+        const TickType_t stopTick = waitTickEdge();
+        const U64 stop = read();
+
+        const U64 counts = stop - start;
+        setFrequency(static_cast<U32>((counts * configTICK_RATE_HZ) / (stopTick - startTick)));
+        return getFrequency();
+    }
+
+}
@@ -1,9 +1,11 @@
 #include <Os/IntervalTimer.hpp>
+#include <Os/CycleCounter.hpp>
 #include <Fw/Types/Assert.hpp>
-#include <HAL/include/FreeRTOS.h>
-#include <HAL/include/os_task.h>
 #include <string.h>
 
+// RawTime is the 64-bit Os::CycleCounter count: upper is the high word and
+// lower the low word. Os::CycleCounter::init() must have been called before
+// the first time is taken.
 
 namespace Os {
 
@@ -24,10 +26,10 @@ namespace Os {
     /**
      * @brief      Gets the timer frequency.
      *
-     * @return     The timer frequency.
+     * @return     The cycle counter frequency in counts per second.
      */
     U32 IntervalTimer::getTimerFrequency(void) {
-        return 1;
+        return CycleCounter::getFrequency();
     }
 
     /**
@@ -36,13 +38,9 @@ namespace Os {
      * @param      time  The time
      */
     void IntervalTimer::getRawTime(RawTime& time) {
-
-        TickType_t xTime1;
-
-        /* Get the time the function started. */
-        xTime1 = xTaskGetTickCount();
-        time.lower = 1000*pdMS_TO_TICKS(xTime1);
-        time.upper = 0;
+        const U64 count = CycleCounter::read();
+        time.upper = static_cast<U32>(count >> 32);
+        time.lower = static_cast<U32>(count);
     }
 
     /**
@@ -54,34 +52,30 @@ namespace Os {
         return getDiffUsec(this->m_stopTime,this->m_startTime);
     }
 
-
-    // should be t1In - t2In
-
-
     /**
-     * @brief      Gets the difference usec.
+     * @brief      Gets the difference usec, t1In - t2In.
      *
      * @param[in]  t1In  The t 1 in
      * @param[in]  t2In  The t 2 in
      *
      * @return     The difference usec.
-     * @note       Adapted from:
-     *             http://www.gnu.org/software/libc/manual/html_node/Elapsed-Time.html
      */
     U32 IntervalTimer::getDiffUsec(const RawTime& t1In, const RawTime& t2In) {
-
-        RawTime result = {t1In.upper - t2In.upper,0};
-
-        if (t1In.lower < t2In.lower) {
-            result.upper -= 1; // subtract nsec carry to seconds
-            result.lower = t1In.lower + (1000000000 - t2In.lower);
-        } else {
-            result.lower = t1In.lower - t2In.lower;
-        }
-
-        return result.lower;
+        return timerToUsec(getDiffRaw(t1In,t2In));
     }
 
+    /**
+     * @brief      Gets the difference nsec, t1In - t2In.
+     *
+     * @param[in]  t1In  The t 1 in
+     * @param[in]  t2In  The t 2 in
+     *
+     * @return     The difference nsec, saturated at 0xFFFFFFFF.
+     */
+    U32 IntervalTimer::getDiffNsec(const RawTime& t1In, const RawTime& t2In) {
+        const RawTime diff = getDiffRaw(t1In,t2In);
+        return CycleCounter::toNsec((static_cast<U64>(diff.upper) << 32) | diff.lower);
+    }
 
     /**
      * @brief      Start the timer
@@ -90,7 +84,6 @@ namespace Os {
         getRawTime(this->m_startTime);
     }
 
-
     /**
      * @brief      Stop the timer
      */
@@ -98,6 +91,14 @@ namespace Os {
         getRawTime(this->m_stopTime);
     }
 
+    /**
+     * @brief      Gets the difference raw between stop and start.
+     *
+     * @return     The difference raw.
+     */
+    IntervalTimer::RawTime IntervalTimer::getDiffRaw(void) {
+        return getDiffRaw(this->m_stopTime,this->m_startTime);
+    }
 
     /**
      * @brief      Gets the difference raw.
@@ -108,19 +109,61 @@ namespace Os {
      * @return     The difference raw.
      */
     IntervalTimer::RawTime IntervalTimer::getDiffRaw(const RawTime& t1, const RawTime& t2) {
-        RawTime diff;
         const U64 al = (((U64) t1.upper << 32) + (U64) t1.lower);
         const U64 bl = (((U64) t2.upper << 32) + (U64) t2.lower);
-        if (t2.lower > t1.lower) {
-            diff.lower = 0xFFFFFFFF - (t2.lower - t1.lower - 1);
-            diff.upper = t1.upper - t2.upper - 1;
-        } else {
-            diff.lower = (U32) (al - bl);
-            diff.upper = (U32) ((U64)(al - bl) >> 32);
-        }
+        RawTime diff;
+        diff.lower = (U32) (al - bl);
+        diff.upper = (U32) ((U64)(al - bl) >> 32);
         return diff;
     }
 
+    /**
+     * @brief      Gets the sum raw.
+     *
+     * @param[in]  t1    The t 1
+     * @param[in]  t2    The t 2
+     *
+     * @return     The sum raw.
+     */
+    IntervalTimer::RawTime IntervalTimer::getSumRaw(const RawTime& t1, const RawTime& t2) {
+        const U64 al = (((U64) t1.upper << 32) + (U64) t1.lower);
+        const U64 bl = (((U64) t2.upper << 32) + (U64) t2.lower);
+        RawTime sum;
+        sum.lower = (U32) (al + bl);
+        sum.upper = (U32) ((U64)(al + bl) >> 32);
+        return sum;
+    }
+
+    /**
+     * @brief      Converts a raw time difference to usec.
+     *
+     * @param[in]  val   The raw time difference
+     *
+     * @return     The usec, saturated at 0xFFFFFFFF.
+     */
+    U32 IntervalTimer::timerToUsec(const RawTime& val) {
+        return CycleCounter::toUsec((static_cast<U64>(val.upper) << 32) | val.lower);
+    }
+
+    /**
+     * @brief      Gets the nanoseconds per clock tick, rounded down.
+     *
+     * @return     The nanoseconds per clock tick.
+     */
+    U32 IntervalTimer::nanoSecPerClockTick(void) {
+        return 1000000000/getTimerFrequency();
+    }
 
+    /**
+     * @brief      Converts a raw time to nanoseconds since the counter started.
+     *
+     * @param[in]  time  The time
+     *
+     * @return     The nanoseconds, saturated at the I32 range.
+     */
+    I32 IntervalTimer::toNanoSec(const RawTime& time) {
+        const U32 nsec = CycleCounter::toNsec((static_cast<U64>(time.upper) << 32) | time.lower);
+        return (nsec > 0x7FFFFFFF) ? 0x7FFFFFFF : static_cast<I32>(nsec);
+    }
 
 }
@@ -1,63 +1,213 @@
+// ======================================================================
+// \title  Queue.cpp
+// \brief  Queue implementation using FreeRTOS queues.
+//
+//         Messages are copied into a pool of fixed-size slots, each a
+//         size followed by the message. Slot pointers move between two
+//         FreeRTOS queues and one ring per priority: the free slot queue
+//         blocks senders when the queue is full, each ring holds the
+//         queued slots of one priority, oldest first, and an item-size-0
+//         queue counts the queued messages for receivers to block on.
+//         A message is copied once on send and once on receive, and there
+//         is no scratch buffer shared between tasks.
+//
+//         The rings are plain arrays updated in a critical section, so
+//         each Os::Queue costs two FreeRTOS queues whatever the number of
+//         priorities. From the FreeRTOS heap, a queue of depth D holding
+//         messages of M bytes takes, on a 32-bit target, about
+//         D * (M + 4) bytes of slots, D * 4 * (OS_QUEUE_PRIORITY_LEVELS + 1)
+//         bytes of slot pointers, and about 270 bytes for the handle and
+//         the two queue control blocks, heap block headers included.
+//
+// ======================================================================
+
 #include <Os/Queue.hpp>
 #include <string.h>
-#include <stdio.h>
-#include <time.h>
-#include <assert.h>
 #include <HAL/include/FreeRTOS.h>
 #include <HAL/include/os_queue.h>
-
-#include <iostream>
-using namespace std;
+#include <HAL/include/os_task.h>
 
 #ifdef USE_TRACE_FACILITY
 #include "trcKernelPort.h"
 #endif
 
+// Number of different priorities a queue can hold. Each priority used on a
+// queue claims one band the first time it is sent; a send with one priority
+// more than this returns QUEUE_INVALID_PRIORITY.
+#ifndef OS_QUEUE_PRIORITY_LEVELS
+#define OS_QUEUE_PRIORITY_LEVELS 4
+#endif
+
 namespace Os {
 
+    // Variables for the queue handle. All of it, slots included, comes from
+    // the FreeRTOS heap.
+    struct QueueHandle {
+        U8* pool; //!< band rings, then the message slots
+        NATIVE_UINT_TYPE depth;
+        NATIVE_UINT_TYPE slotSize;
+        QueueHandle_t freeSlots; //!< slots not holding a message
+        QueueHandle_t ready; //!< holds one empty item per queued message
+        struct Band {
+            bool used;
+            NATIVE_INT_TYPE priority;
+            U8** ring; //!< slots queued at this priority, oldest first
+            NATIVE_UINT_TYPE head; //!< index of the oldest slot
+            NATIVE_UINT_TYPE count; //!< number of slots queued
+        } bands[OS_QUEUE_PRIORITY_LEVELS];
+        volatile NATIVE_INT_TYPE maxMsgs; //!< high water mark
+    };
+
+    static void deleteHandle(QueueHandle* handle) {
+        if (NULL != handle->freeSlots) {
+            vQueueDelete(handle->freeSlots);
+        }
+        if (NULL != handle->ready) {
+            vQueueDelete(handle->ready);
+        }
+        if (NULL != handle->pool) {
+            vPortFree(handle->pool);
+        }
+        vPortFree(handle);
+    }
+
+    static QueueHandle* createHandle(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+        QueueHandle* handle = (QueueHandle*) pvPortMalloc(sizeof(QueueHandle));
+        if (NULL == handle) {
+            return NULL;
+        }
+        memset(handle, 0, sizeof(QueueHandle));
+
+        // One allocation for the rings and the slots. Each ring holds every
+        // slot, since all messages can have the same priority.
+        const NATIVE_UINT_TYPE ringSize = depth * sizeof(U8*);
+        handle->depth = depth;
+        handle->slotSize = sizeof(NATIVE_UINT_TYPE) + msgSize;
+        handle->pool = (U8*) pvPortMalloc(OS_QUEUE_PRIORITY_LEVELS * ringSize + depth * handle->slotSize);
+        handle->freeSlots = xQueueCreate(depth, sizeof(U8*));
+        // Item size 0: the queue is only a count, like a counting semaphore
+        handle->ready = xQueueCreate(depth, 0);
+        if ((NULL == handle->pool) || (NULL == handle->freeSlots) || (NULL == handle->ready)) {
+            deleteHandle(handle);
+            return NULL;
+        }
+
+        for (NATIVE_INT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+            handle->bands[band].ring = (U8**) &handle->pool[band * ringSize];
+        }
+        U8* slots = &handle->pool[OS_QUEUE_PRIORITY_LEVELS * ringSize];
+        for (NATIVE_INT_TYPE slot = 0; slot < depth; slot++) {
+            U8* slotPtr = &slots[slot * handle->slotSize];
+            (void) xQueueSendToBack(handle->freeSlots, &slotPtr, 0);
+        }
+        return handle;
+    }
+
+    // Find the band for a priority, claiming the next unused one for a new
+    // priority
+    static NATIVE_INT_TYPE findBand(QueueHandle* handle, NATIVE_INT_TYPE priority) {
+        NATIVE_INT_TYPE found = -1;
+        taskENTER_CRITICAL();
+        for (NATIVE_INT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+            if (not handle->bands[band].used) {
+                handle->bands[band].priority = priority;
+                handle->bands[band].used = true;
+                found = band;
+                break;
+            }
+            if (handle->bands[band].priority == priority) {
+                found = band;
+                break;
+            }
+        }
+        taskEXIT_CRITICAL();
+        return found;
+    }
+
+    // Queue a slot at the back of a band. There is always room, since the
+    // slot came from the free queue.
+    static void queueSlot(QueueHandle* handle, NATIVE_INT_TYPE band, U8* slot) {
+        QueueHandle::Band& b = handle->bands[band];
+        taskENTER_CRITICAL();
+        b.ring[(b.head + b.count) % handle->depth] = slot;
+        b.count++;
+        taskEXIT_CRITICAL();
+    }
+
+    // Take the oldest slot of the highest priority band holding one. The
+    // caller has taken a ready item, so one is there.
+    static U8* takeSlot(QueueHandle* handle, NATIVE_INT_TYPE &priority) {
+        taskENTER_CRITICAL();
+        NATIVE_INT_TYPE best = -1;
+        for (NATIVE_INT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+            const QueueHandle::Band& b = handle->bands[band];
+            if (not b.used) {
+                break;
+            }
+            if ((b.count > 0) && ((-1 == best) || (b.priority > handle->bands[best].priority))) {
+                best = band;
+            }
+        }
+        QueueHandle::Band& b = handle->bands[best];
+        U8* slot = b.ring[b.head];
+        b.head = (b.head + 1) % handle->depth;
+        b.count--;
+        priority = b.priority;
+        taskEXIT_CRITICAL();
+        return slot;
+    }
+
     Queue::Queue() :
-        m_handle(NULL) {
+        m_handle((POINTER_CAST) NULL),
+        m_depth(0),
+        m_msgSize(0) {
     }
 
     Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize){
-        m_name = "/QP_";
-        m_name += name;
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
 
-        QueueHandle_t queueHandle;
-        queueHandle = xQueueCreate(depth, msgSize + sizeof(msgSize));
+        // Queue has already been created... remove it and try again:
+        if (NULL != queueHandle) {
+            deleteHandle(queueHandle);
+            this->m_handle = (POINTER_CAST) NULL;
+        }
 
-        #ifdef USE_TRACE_FACILITY
-            vTraceSetQueueName(queueHandle, m_name.toChar());
-        #endif
+        if ((depth <= 0) || (msgSize < 0)) {
+            return QUEUE_UNINITIALIZED;
+        }
 
-        if(NULL == queueHandle) {
-          return QUEUE_UNINITIALIZED;
+        this->m_name = "/QP_";
+        this->m_name += name;
+
+        queueHandle = createHandle(depth, msgSize);
+        if (NULL == queueHandle) {
+            return QUEUE_UNINITIALIZED;
         }
 
-        m_handle = (POINTER_CAST) queueHandle;
-        m_depth = depth;
-        m_msgSize = msgSize;
+        #ifdef USE_TRACE_FACILITY
+            vTraceSetQueueName(queueHandle->ready, this->m_name.toChar());
+        #endif
 
-        Queue::s_numQueues++;
+        this->m_handle = (POINTER_CAST) queueHandle;
+        this->m_depth = depth;
+        this->m_msgSize = msgSize;
 
-        m_msgBuffer = (U8 *) pvPortMalloc(msgSize + sizeof(msgSize));
+        Queue::s_numQueues++;
 
         return QUEUE_OK;
     }
 
     Queue::~Queue(){
-        if(m_handle){
-            vQueueDelete((QueueHandle_t) m_handle);
-        }
-
-        if(m_msgBuffer){
-            vPortFree(m_msgBuffer);
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+        if (NULL != queueHandle) {
+            deleteHandle(queueHandle);
         }
+        this->m_handle = (POINTER_CAST) NULL;
     }
 
 
     Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block){
-        QueueHandle_t queueHandle = (QueueHandle_t) m_handle;
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
 
         if (NULL == queueHandle){
           return QUEUE_UNINITIALIZED;
@@ -65,22 +215,38 @@ namespace Os {
         if (NULL == buffer){
           return QUEUE_EMPTY_BUFFER;
         }
+        if ((size < 0) || (size > this->m_msgSize)){
+          return QUEUE_SIZE_MISMATCH;
+        }
 
-        m_msgBuffer[0] = size;
-        memcpy(m_msgBuffer + sizeof(size), buffer, size);
+        NATIVE_INT_TYPE band = findBand(queueHandle, priority);
+        if (-1 == band){
+          return QUEUE_INVALID_PRIORITY;
+        }
 
-        // if (size != getMsgSize()) return QUEUE_SIZE_MISMATCH
-        if (block == QUEUE_NONBLOCKING){
-            if (xQueueSendToBack(queueHandle, (void*) m_msgBuffer, (TickType_t)0) == errQUEUE_FULL){
-                // printf("QUEUE IS FULL\n");
-                return QUEUE_FULL;
-            }
+        // A free slot is the room for one message
+        U8* slot;
+        TickType_t wait = (QUEUE_BLOCKING == block) ? (TickType_t) portMAX_DELAY : (TickType_t) 0;
+        if (xQueueReceive(queueHandle->freeSlots, &slot, wait) != pdPASS){
+            return (QUEUE_BLOCKING == block) ? QUEUE_UNKNOWN_ERROR : QUEUE_FULL;
         }
-        else{
-            if (xQueueSendToBack(queueHandle, (void*) m_msgBuffer, (TickType_t) portMAX_DELAY ) != pdPASS){
-                // printf("QUEUE IS ERROR\n");
-                return QUEUE_UNKNOWN_ERROR;
+
+        NATIVE_UINT_TYPE storedSize = size;
+        memcpy(slot, &storedSize, sizeof(storedSize));
+        memcpy(slot + sizeof(storedSize), buffer, size);
+
+        queueSlot(queueHandle, band, slot);
+
+        // The ready count has room for every slot, so this never waits
+        (void) xQueueSendToBack(queueHandle->ready, NULL, 0);
+
+        NATIVE_INT_TYPE numMsgs = uxQueueMessagesWaiting(queueHandle->ready);
+        if (numMsgs > queueHandle->maxMsgs) {
+            taskENTER_CRITICAL();
+            if (numMsgs > queueHandle->maxMsgs) {
+                queueHandle->maxMsgs = numMsgs;
             }
+            taskEXIT_CRITICAL();
         }
 
         return QUEUE_OK;
@@ -89,7 +255,9 @@ namespace Os {
 
     Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block)
     {
-        QueueHandle_t queueHandle = (QueueHandle_t) this->m_handle;
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+        actualSize = 0;
 
         if (NULL == queueHandle)
         {
@@ -101,44 +269,50 @@ namespace Os {
             return QUEUE_EMPTY_BUFFER;
         }
 
-        // if (size != getMsgSize()) return QUEUE_SIZE_MISMATCH;
-
-        if (block == QUEUE_NONBLOCKING)
+        // The buffer must hold the largest message, since a message can't
+        // be put back once it is taken off a band.
+        if (capacity < this->m_msgSize)
         {
-            if (xQueueReceive(queueHandle, (void*) m_msgBuffer, (TickType_t) 0) == errQUEUE_EMPTY)
-            {
-                return QUEUE_NO_MORE_MSGS;
-            }
+            return QUEUE_SIZE_MISMATCH;
         }
-        else
+
+        // Reserve a queued message; one is then in a band
+        TickType_t wait = (QUEUE_BLOCKING == block) ? (TickType_t) portMAX_DELAY : (TickType_t) 0;
+        if (xQueueReceive(queueHandle->ready, NULL, wait) != pdPASS)
         {
-            if (xQueueReceive(queueHandle, (void*) m_msgBuffer, (TickType_t) portMAX_DELAY) == errQUEUE_EMPTY)
-            {
-                return QUEUE_NO_MORE_MSGS;
-            }
+            return QUEUE_NO_MORE_MSGS;
         }
 
+        U8* slot = takeSlot(queueHandle, priority);
 
-        actualSize = m_msgBuffer[0];
-        memcpy(buffer, m_msgBuffer + sizeof(actualSize), actualSize);
+        NATIVE_UINT_TYPE storedSize;
+        memcpy(&storedSize, slot, sizeof(storedSize));
+        memcpy(buffer, slot + sizeof(storedSize), storedSize);
+        actualSize = storedSize;
 
+        (void) xQueueSendToBack(queueHandle->freeSlots, &slot, 0);
 
         return QUEUE_OK;
     }
 
-    /**************************************************************
-     *   WE NEED TO EDIT QUEUE.HPP FOR THE STUFF BELOW TO WORK    *
-     **************************************************************/
-
     NATIVE_INT_TYPE Queue::getNumMsgs(void) const
     {
-        return uxQueueMessagesWaiting((QueueHandle_t) this->m_handle);
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+        if (NULL == queueHandle)
+        {
+            return 0;
+        }
+        return uxQueueMessagesWaiting(queueHandle->ready);
     }
 
     NATIVE_INT_TYPE Queue::getMaxMsgs(void) const
     {
-        // FW_ASSERT(0);
-        return 0;
+        QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+        if (NULL == queueHandle)
+        {
+            return 0;
+        }
+        return queueHandle->maxMsgs;
     }
 
     NATIVE_INT_TYPE Queue::getQueueSize(void) const
@@ -135,6 +135,17 @@ namespace Os {
     }
 
 
+    /**
+     * @brief      CPU time used by the task. Not reported, as the run time
+     *             statistics are disabled in FreeRTOSConfig.h.
+     *
+     * @return     Zero
+     */
+    U64 Task::getCpuTimeUsec(void)
+    {
+        return 0;
+    }
+
     /**
      * @brief      Join task thread
      *
@@ -0,0 +1,120 @@
+// ======================================================================
+// \title  TickTimer.cpp
+// \brief  Tick timer implementation using RTI compare 1.
+//
+//         The FreeRTOS port runs the kernel tick from RTI counter 0 and
+//         compare 0. Compare 1 is set up on the same counter with its
+//         own period: the hardware reloads the compare register on every
+//         match, so the ticks keep their phase whatever the interrupt
+//         latency. The interrupt handler gives the waiting task a
+//         notification per tick, and the task takes them all at once,
+//         so the count it gets back includes any ticks it missed.
+//
+//         There is one compare channel, so one TickTimer can run at a
+//         time. The port resets the RTI interrupt enables when the
+//         scheduler starts, so start() must be called from a task.
+//
+// ======================================================================
+
+#include <Os/TickTimer.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <HAL/include/FreeRTOS.h>
+#include <HAL/include/os_task.h>
+#include <HAL/include/reg_rti.h>
+#include <HAL/include/sys_vim.h>
+
+//! VIM channel of the RTI compare 1 interrupt
+#ifndef OS_TICK_TIMER_VIM_CHANNEL
+#define OS_TICK_TIMER_VIM_CHANNEL 3
+#endif
+
+//! RTI counter 0 rate. The port prescales the RTI clock by two.
+#ifndef OS_TICK_TIMER_FREQUENCY
+#define OS_TICK_TIMER_FREQUENCY (configCPU_CLOCK_HZ / 2)
+#endif
+
+extern "C" {
+    void osTickTimerIsr(void);
+}
+
+namespace {
+    const U32 COMPARE1 = 1;
+    const U32 COMPARE1_INT = 0x2; //!< compare 1 bit in SETINTENA, CLEARINTENA and INTFLAG
+    const U32 COMPSEL1 = 0x10; //!< compare 1 counter select in COMPCTRL, clear for counter 0
+
+    //! Task waiting on the running timer, NULL when none is running
+    TaskHandle_t volatile s_waiter = NULL;
+}
+
+#pragma CODE_STATE(32)
+#pragma INTERRUPT(IRQ)
+void osTickTimerIsr(void) {
+    rtiREG1->INTFLAG = COMPARE1_INT;
+    if (s_waiter != NULL) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(s_waiter, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+namespace Os {
+
+    TickTimer::TickTimer() : m_periodUsec(0), m_next(0) {
+    }
+
+    TickTimer::~TickTimer() {
+        this->stop();
+    }
+
+    TickTimer::Status TickTimer::start(U32 periodUsec) {
+        const U64 counts = static_cast<U64>(OS_TICK_TIMER_FREQUENCY) * periodUsec / 1000000;
+        if (counts == 0 || counts > 0x7FFFFFFF) {
+            return INVALID_PERIOD;
+        }
+
+        taskENTER_CRITICAL();
+        if (s_waiter != NULL) {
+            taskEXIT_CRITICAL();
+            return BUSY;
+        }
+        s_waiter = xTaskGetCurrentTaskHandle();
+        taskEXIT_CRITICAL();
+        this->m_periodUsec = periodUsec;
+
+        // Drop notifications left from before
+        (void) ulTaskNotifyTake(pdTRUE, 0);
+
+        rtiREG1->CLEARINTENA = COMPARE1_INT;
+        rtiREG1->COMPCTRL &= ~COMPSEL1;
+        rtiREG1->CMP[COMPARE1].UDCPx = static_cast<U32>(counts);
+        rtiREG1->CMP[COMPARE1].COMPx = rtiREG1->CNT[0].FRCx + static_cast<U32>(counts);
+        rtiREG1->INTFLAG = COMPARE1_INT;
+
+        vimChannelMap(OS_TICK_TIMER_VIM_CHANNEL, OS_TICK_TIMER_VIM_CHANNEL, &osTickTimerIsr);
+        vimEnableInterrupt(OS_TICK_TIMER_VIM_CHANNEL, SYS_IRQ);
+        rtiREG1->SETINTENA = COMPARE1_INT;
+        return OP_OK;
+    }
+
+    U32 TickTimer::wait(void) {
+        FW_ASSERT(this->m_periodUsec != 0);
+        FW_ASSERT(s_waiter == xTaskGetCurrentTaskHandle());
+        return ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    void TickTimer::stop(void) {
+        if (this->m_periodUsec == 0) {
+            return;
+        }
+        rtiREG1->CLEARINTENA = COMPARE1_INT;
+        vimDisableInterrupt(OS_TICK_TIMER_VIM_CHANNEL);
+        rtiREG1->INTFLAG = COMPARE1_INT;
+        s_waiter = NULL;
+        this->m_periodUsec = 0;
+    }
+
+    U32 TickTimer::getPeriodUsec(void) const {
+        return this->m_periodUsec;
+    }
+
+}
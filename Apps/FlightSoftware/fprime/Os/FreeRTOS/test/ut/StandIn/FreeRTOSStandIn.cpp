@@ -0,0 +1,140 @@
+// ======================================================================
+// \title  FreeRTOSStandIn.cpp
+// \brief  Pthread stand-in for the parts of FreeRTOS that the
+//         Os/FreeRTOS backend uses, so the backend can run the Os queue
+//         tests on the host.
+//
+//         Each queue is a ring of fixed-size items guarded by a mutex,
+//         with one condition for senders and one for receivers. A wait of
+//         portMAX_DELAY blocks until the queue has room or an item; any
+//         other wait is treated as no wait, which is all the backend
+//         uses. Critical sections take one recursive mutex shared by all
+//         tasks. Timings measured here are not the target's.
+// ======================================================================
+
+#include <HAL/include/FreeRTOS.h>
+#include <HAL/include/os_queue.h>
+#include <HAL/include/os_task.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+  struct StandInQueue {
+    pthread_mutex_t lock;
+    pthread_cond_t notFull;
+    pthread_cond_t notEmpty;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    UBaseType_t head;
+    UBaseType_t count;
+    unsigned char* items;
+  };
+
+  pthread_mutex_t s_critical;
+  pthread_once_t s_criticalOnce = PTHREAD_ONCE_INIT;
+
+  void initCritical(void) {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&s_critical, &attr);
+    pthread_mutexattr_destroy(&attr);
+  }
+
+}
+
+void* pvPortMalloc(size_t xSize) {
+  return malloc(xSize);
+}
+
+void vPortFree(void* pv) {
+  free(pv);
+}
+
+void vStandInEnterCritical(void) {
+  pthread_once(&s_criticalOnce, initCritical);
+  pthread_mutex_lock(&s_critical);
+}
+
+void vStandInExitCritical(void) {
+  pthread_mutex_unlock(&s_critical);
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize) {
+  StandInQueue* queue = static_cast<StandInQueue*>(pvPortMalloc(sizeof(StandInQueue)));
+  if (NULL == queue) {
+    return NULL;
+  }
+  queue->items = static_cast<unsigned char*>(pvPortMalloc(uxQueueLength * uxItemSize + 1));
+  if (NULL == queue->items) {
+    vPortFree(queue);
+    return NULL;
+  }
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->notFull, NULL);
+  pthread_cond_init(&queue->notEmpty, NULL);
+  queue->length = uxQueueLength;
+  queue->itemSize = uxItemSize;
+  queue->head = 0;
+  queue->count = 0;
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t xQueue) {
+  StandInQueue* queue = static_cast<StandInQueue*>(xQueue);
+  pthread_cond_destroy(&queue->notEmpty);
+  pthread_cond_destroy(&queue->notFull);
+  pthread_mutex_destroy(&queue->lock);
+  vPortFree(queue->items);
+  vPortFree(queue);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait) {
+  StandInQueue* queue = static_cast<StandInQueue*>(xQueue);
+  pthread_mutex_lock(&queue->lock);
+  while (queue->count == queue->length) {
+    if (xTicksToWait != portMAX_DELAY) {
+      pthread_mutex_unlock(&queue->lock);
+      return errQUEUE_FULL;
+    }
+    pthread_cond_wait(&queue->notFull, &queue->lock);
+  }
+  const UBaseType_t tail = (queue->head + queue->count) % queue->length;
+  if (queue->itemSize > 0) {
+    memcpy(&queue->items[tail * queue->itemSize], pvItemToQueue, queue->itemSize);
+  }
+  queue->count++;
+  pthread_cond_signal(&queue->notEmpty);
+  pthread_mutex_unlock(&queue->lock);
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait) {
+  StandInQueue* queue = static_cast<StandInQueue*>(xQueue);
+  pthread_mutex_lock(&queue->lock);
+  while (queue->count == 0) {
+    if (xTicksToWait != portMAX_DELAY) {
+      pthread_mutex_unlock(&queue->lock);
+      return errQUEUE_EMPTY;
+    }
+    pthread_cond_wait(&queue->notEmpty, &queue->lock);
+  }
+  if (queue->itemSize > 0) {
+    memcpy(pvBuffer, &queue->items[queue->head * queue->itemSize], queue->itemSize);
+  }
+  queue->head = (queue->head + 1) % queue->length;
+  queue->count--;
+  pthread_cond_signal(&queue->notFull);
+  pthread_mutex_unlock(&queue->lock);
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue) {
+  StandInQueue* queue = static_cast<StandInQueue*>(xQueue);
+  pthread_mutex_lock(&queue->lock);
+  const UBaseType_t count = queue->count;
+  pthread_mutex_unlock(&queue->lock);
+  return count;
+}
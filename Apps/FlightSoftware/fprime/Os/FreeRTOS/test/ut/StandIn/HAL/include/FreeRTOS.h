@@ -0,0 +1,28 @@
+// ======================================================================
+// \title  FreeRTOS.h
+// \brief  Host stand-in for the FreeRTOS kernel types used by the
+//         Os/FreeRTOS backend. See FreeRTOSStandIn.cpp.
+// ======================================================================
+
+#ifndef OS_FREERTOS_STANDIN_FREERTOS_H
+#define OS_FREERTOS_STANDIN_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY ((TickType_t) 0xFFFFFFFF)
+#define pdTRUE ((BaseType_t) 1)
+#define pdFALSE ((BaseType_t) 0)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define errQUEUE_FULL ((BaseType_t) 0)
+#define errQUEUE_EMPTY ((BaseType_t) 0)
+
+void* pvPortMalloc(size_t xSize);
+void vPortFree(void* pv);
+
+#endif
@@ -0,0 +1,20 @@
+// ======================================================================
+// \title  os_queue.h
+// \brief  Host stand-in for the FreeRTOS queue API. See
+//         FreeRTOSStandIn.cpp.
+// ======================================================================
+
+#ifndef OS_FREERTOS_STANDIN_OS_QUEUE_H
+#define OS_FREERTOS_STANDIN_OS_QUEUE_H
+
+#include <HAL/include/FreeRTOS.h>
+
+typedef void* QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize);
+void vQueueDelete(QueueHandle_t xQueue);
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait);
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait);
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue);
+
+#endif
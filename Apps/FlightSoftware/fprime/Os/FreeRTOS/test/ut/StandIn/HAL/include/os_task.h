@@ -0,0 +1,18 @@
+// ======================================================================
+// \title  os_task.h
+// \brief  Host stand-in for the FreeRTOS critical sections. See
+//         FreeRTOSStandIn.cpp.
+// ======================================================================
+
+#ifndef OS_FREERTOS_STANDIN_OS_TASK_H
+#define OS_FREERTOS_STANDIN_OS_TASK_H
+
+#include <HAL/include/FreeRTOS.h>
+
+void vStandInEnterCritical(void);
+void vStandInExitCritical(void);
+
+#define taskENTER_CRITICAL() vStandInEnterCritical()
+#define taskEXIT_CRITICAL() vStandInExitCritical()
+
+#endif
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+//
+// Runs the Os queue tests against the FreeRTOS backend, built on the
+// host with the pthread stand-in in StandIn.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" {
+  void qtest_block_receive(void);
+  void qtest_nonblock_receive(void);
+  void qtest_nonblock_send(void);
+  void qtest_block_send(void);
+  void qtest_performance(void);
+  void qtest_concurrent(void);
+  void qtest_round_trip(void);
+  void qtest_multi_producer(void);
+}
+
+// Numbered as in Os/test/ut/TestMain.cpp
+void run_test(int test_num)
+{
+  switch(test_num) {
+    case 1:
+      qtest_block_receive();
+      break;
+    case 2:
+      qtest_nonblock_receive();
+      break;
+    case 3:
+      qtest_nonblock_send();
+      break;
+    case 4:
+      qtest_block_send();
+      break;
+    case 5:
+      qtest_performance();
+      break;
+    case 6:
+      qtest_concurrent();
+      break;
+    case 10:
+      qtest_round_trip();
+      break;
+    case 11:
+      qtest_multi_producer();
+      break;
+    default:
+      fprintf(stderr, "Invalid test number: %d\n", test_num);
+      break;
+  }
+}
+
+int main(int argc, char* argv[]) {
+
+  if (argc != 2) {
+    const int tests[] = {1, 2, 3, 4, 5, 6, 10, 11};
+    printf("Running all queue test cases\n");
+    for (unsigned int i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+      run_test(tests[i]);
+    }
+  }
+  else {
+    run_test(atoi(argv[1]));
+  }
+
+  return 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * Linux/CycleCounter.cpp:
+ *
+ * Host stand-in for the hardware cycle counter. CLOCK_MONOTONIC_RAW is not slewed by NTP, so it
+ * behaves like a free-running counter with a nominal 1 GHz rate (one count per nanosecond), and it
+ * is already 64 bits wide so no software extension is needed.
+ */
+#include <Os/CycleCounter.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <time.h>
+#include <errno.h>
+
+#ifndef CLOCK_MONOTONIC_RAW
+#define CLOCK_MONOTONIC_RAW CLOCK_MONOTONIC
+#endif
+
+namespace Os {
+
+    namespace {
+        U64 readClock(clockid_t clock) {
+            timespec t;
+            FW_ASSERT(clock_gettime(clock,&t) == 0,errno);
+            return static_cast<U64>(t.tv_sec)*1000000000 + t.tv_nsec;
+        }
+    }
+
+    void CycleCounter::init(void) {
+        setFrequency(1000000000);
+    }
+
+    U64 CycleCounter::read(void) {
+        return readClock(CLOCK_MONOTONIC_RAW);
+    }
+
+    U32 CycleCounter::readRaw(void) {
+        return static_cast<U32>(readClock(CLOCK_MONOTONIC_RAW));
+    }
+
+    U32 CycleCounter::calibrate(U32 durationMsec) {
+        FW_ASSERT(durationMsec > 0);
+
+        // Reference is the NTP disciplined monotonic clock. The result differs from
+        // 1 GHz by the host oscillator error NTP is correcting for.
+        const U64 ref0 = readClock(CLOCK_MONOTONIC);
+        const U64 count0 = read();
+
+        timespec delay;
+        delay.tv_sec = durationMsec/1000;
+        delay.tv_nsec = (durationMsec%1000)*1000000;
+        while (nanosleep(&delay,&delay) == -1 && errno == EINTR) {
+        }
+
+        const U64 ref1 = readClock(CLOCK_MONOTONIC);
+        const U64 count1 = read();
+
+        const U64 refNsec = ref1 - ref0;
+        FW_ASSERT(refNsec > 0);
+        setFrequency(static_cast<U32>(static_cast<F64>(count1 - count0)*1.0e9/refNsec + 0.5));
+        return getFrequency();
+    }
+
+}
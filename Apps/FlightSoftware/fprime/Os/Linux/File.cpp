@@ -3,15 +3,7 @@
 #include <Os/File.hpp>
 #include <Fw/Types/Assert.hpp>
 
-#ifdef __cplusplus
-extern "C" {
-#endif // __cplusplus
-
-#include <Utils/Hash/libcrc/lib_crc.h> // borrow CRC
-
-#ifdef __cplusplus
-}
-#endif // __cplusplus
+#include <Utils/Hash/crc32/CRC32Engine.hpp> // borrow CRC
 
 #include <cerrno>
 #include <sys/types.h>
@@ -419,12 +411,7 @@ namespace Os {
                     continue;
                 }
 
-                int chunkIdx = 0;
-
-                while (chunkIdx < chunkSize) {
-                  seed = update_crc_32(seed, file_buffer[chunkIdx]);
-                  chunkIdx++;
-                }
+                seed = Utils::CRC32Engine::update(seed, file_buffer, chunkSize);
 
             } else {
                 crc = 0;
@@ -389,6 +389,42 @@ namespace Os {
 			return fileStat;
 		} // end getFileSize
 
+		Status getFileModTime(const char* path, U32& seconds, U32& useconds) {
+
+			Status fileStat = OP_OK;
+			struct stat fileStatStruct;
+
+			if(::stat(path, &fileStatStruct) == -1) {
+				switch (errno) {
+					case EACCES:
+						fileStat = NO_PERMISSION;
+						break;
+					case ELOOP:
+					case ENOENT:
+					case ENAMETOOLONG:
+						fileStat = INVALID_PATH;
+						break;
+					case ENOTDIR:
+						fileStat = NOT_DIR;
+						break;
+					default:
+						fileStat = OTHER_ERROR;
+						break;
+				}
+				return fileStat;
+			}
+
+#ifdef __APPLE__
+			const struct timespec& modTime = fileStatStruct.st_mtimespec;
+#else
+			const struct timespec& modTime = fileStatStruct.st_mtim;
+#endif
+			seconds = modTime.tv_sec;
+			useconds = modTime.tv_nsec / 1000;
+
+			return fileStat;
+		} // end getFileModTime
+
 		Status changeWorkingDirectory(const char* path) {
 
 			Status stat = OP_OK;
@@ -5,17 +5,24 @@
  * implementations. That is: the lower U32 of the RawTime is nano-seconds, and the upper U32 of
  * RawTime object is seconds. Thus only the "getRawTime" function differes from the base X86
  * version of this file.
+ *
+ * The time is taken from CLOCK_MONOTONIC_RAW, the same source as the host Os::CycleCounter, so
+ * intervals are not disturbed by wall clock steps or NTP slewing.
  */
 #include <Os/IntervalTimer.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <time.h>
 #include <errno.h>
 
+#ifndef CLOCK_MONOTONIC_RAW
+#define CLOCK_MONOTONIC_RAW CLOCK_MONOTONIC
+#endif
+
 namespace Os {
     void IntervalTimer::getRawTime(RawTime& time) {
         timespec t;
 
-        FW_ASSERT(clock_gettime(CLOCK_REALTIME,&t) == 0,errno);
+        FW_ASSERT(clock_gettime(CLOCK_MONOTONIC_RAW,&t) == 0,errno);
         time.upper = t.tv_sec;
         time.lower = t.tv_nsec;
     }
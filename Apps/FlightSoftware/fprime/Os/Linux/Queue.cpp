@@ -0,0 +1,465 @@
+// ======================================================================
+// \title  Queue.cpp
+// \brief  Queue implementation using lock-free rings and Linux futexes.
+//         This is NOT an IPC queue. It is meant to be used between
+//         threads within the same address space.
+//
+//         Messages are copied into a pool of fixed-size slots. Free
+//         slots are kept on one ring, and queued slots are kept on one
+//         ring per priority. Senders and receivers only touch the rings
+//         with atomic operations, so neither takes a lock or makes a
+//         system call unless it has to block on an empty or full queue.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Types/Assert.hpp>
+#include <Os/Queue.hpp>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+
+#define CAS(a_ptr, a_oldVal, a_newVal) __sync_bool_compare_and_swap(a_ptr, a_oldVal, a_newVal)
+
+// Number of different priorities a queue can hold. Each priority used on a
+// queue claims one ring the first time it is sent; a send with one priority
+// more than this returns QUEUE_INVALID_PRIORITY.
+#ifndef OS_QUEUE_PRIORITY_LEVELS
+#define OS_QUEUE_PRIORITY_LEVELS 8
+#endif
+
+// Size of a cache line. Indices written by different threads are kept on
+// separate lines so senders and the receiver do not contend for them.
+#ifndef OS_QUEUE_CACHE_LINE
+#define OS_QUEUE_CACHE_LINE 64
+#endif
+
+namespace Os {
+
+  static U32 loadAcquire(const volatile U32* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+  }
+
+  static void storeRelease(volatile U32* ptr, U32 value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+  }
+
+  static U64 loadAcquire(const volatile U64* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+  }
+
+  // A bounded ring of U32 values. Any number of threads may push and pop.
+  // Each cell carries a sequence number that tells a pusher when the cell is
+  // free and a popper when it is filled, so the only shared writes are the
+  // compare-and-swap on the head or tail index.
+  class IndexRing {
+    public:
+    IndexRing() : m_cells(NULL), m_mask(0), m_tail(0), m_head(0) {
+    }
+    ~IndexRing() {
+      delete[] this->m_cells;
+    }
+    // Capacity is rounded up to a power of two
+    bool create(U32 capacity) {
+      U32 size = 1;
+      while (size < capacity) {
+        size <<= 1;
+      }
+      this->m_cells = new Cell[size];
+      if (NULL == this->m_cells) {
+        return false;
+      }
+      for (U32 cell = 0; cell < size; cell++) {
+        this->m_cells[cell].seq = cell;
+        this->m_cells[cell].value = 0;
+      }
+      this->m_mask = size - 1;
+      return true;
+    }
+    // The caller must know the ring has room: the queue never holds more
+    // values than the ring capacity. A cell that is still filled from one
+    // lap ago is then being popped by another thread, so wait for it.
+    void push(U32 value) {
+      U32 pos = this->m_tail;
+      for (;;) {
+        Cell* cell = &this->m_cells[pos & this->m_mask];
+        I32 diff = static_cast<I32>(loadAcquire(&cell->seq) - pos);
+        if ((diff == 0) && CAS(&this->m_tail, pos, pos + 1)) {
+          cell->value = value;
+          storeRelease(&cell->seq, pos + 1);
+          return;
+        }
+        pos = this->m_tail;
+      }
+    }
+    bool pop(U32& value) {
+      U32 pos = this->m_head;
+      for (;;) {
+        Cell* cell = &this->m_cells[pos & this->m_mask];
+        I32 diff = static_cast<I32>(loadAcquire(&cell->seq) - (pos + 1));
+        if (diff == 0) {
+          if (CAS(&this->m_head, pos, pos + 1)) {
+            value = cell->value;
+            storeRelease(&cell->seq, pos + this->m_mask + 1);
+            return true;
+          }
+          pos = this->m_head;
+        } else if (diff < 0) {
+          // cell not filled yet; ring is empty
+          return false;
+        } else {
+          pos = this->m_head;
+        }
+      }
+    }
+    bool isEmpty() {
+      U32 pos = loadAcquire(&this->m_head);
+      return loadAcquire(&this->m_cells[pos & this->m_mask].seq) != pos + 1;
+    }
+
+    private:
+    struct Cell {
+      volatile U32 seq; // position the cell is ready for
+      U32 value;
+    };
+    Cell* m_cells;
+    U32 m_mask;
+    U8 m_pad0[OS_QUEUE_CACHE_LINE];
+    volatile U32 m_tail; // next position to push; written by senders
+    U8 m_pad1[OS_QUEUE_CACHE_LINE - sizeof(U32)];
+    volatile U32 m_head; // next position to pop; written by receivers
+    U8 m_pad2[OS_QUEUE_CACHE_LINE - sizeof(U32)];
+  };
+
+  // A futex word that threads sleep on until the queue changes
+  class WaitPoint {
+    public:
+    WaitPoint() : m_seq(0), m_waiters(0) {
+    }
+    // Register as a waiter and return the value to pass to wait()
+    U32 prepare() {
+      (void) __sync_fetch_and_add(&this->m_waiters, 1);
+      return loadAcquire(&this->m_seq);
+    }
+    // Sleep unless notify() was called since prepare()
+    void wait(U32 seq) {
+      (void) syscall(SYS_futex, &this->m_seq, FUTEX_WAIT_PRIVATE, seq, NULL, NULL, 0);
+      (void) __sync_fetch_and_sub(&this->m_waiters, 1);
+    }
+    // Leave without sleeping
+    void cancel() {
+      (void) __sync_fetch_and_sub(&this->m_waiters, 1);
+    }
+    // Wake one waiter. The fence orders the caller's ring update before the
+    // check for waiters, pairing with the increment in prepare().
+    void notify() {
+      __sync_synchronize();
+      if (loadAcquire(&this->m_waiters) != 0) {
+        (void) __sync_fetch_and_add(&this->m_seq, 1);
+        (void) syscall(SYS_futex, &this->m_seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+      }
+    }
+
+    private:
+    volatile U32 m_seq;
+    volatile U32 m_waiters;
+    U8 m_pad[OS_QUEUE_CACHE_LINE - 2*sizeof(U32)];
+  };
+
+  // A helper class which stores variables for the queue handle: the message
+  // slots, the free slot ring, one ring of queued slots per priority, and the
+  // futex words used to block.
+  class QueueHandle {
+    public:
+    QueueHandle() : m_slots(NULL), m_slotSize(0), m_msgSize(0), m_depth(0), m_count(0), m_numFree(0), m_maxCount(0) {
+      for (NATIVE_UINT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+        this->m_bands[band].key = 0;
+      }
+    }
+    ~QueueHandle() {
+      delete[] this->m_slots;
+    }
+    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+      if ((depth <= 0) || (msgSize < 0)) {
+        return false;
+      }
+      this->m_depth = depth;
+      this->m_msgSize = msgSize;
+      this->m_slotSize = sizeof(NATIVE_UINT_TYPE) + msgSize;
+      this->m_slots = new U8[depth * this->m_slotSize];
+      if (NULL == this->m_slots) {
+        return false;
+      }
+      if (not this->m_free.create(depth)) {
+        return false;
+      }
+      for (NATIVE_INT_TYPE slot = 0; slot < depth; slot++) {
+        this->m_free.push(slot);
+      }
+      this->m_numFree = depth;
+      for (NATIVE_UINT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+        if (not this->m_bands[band].ring.create(depth)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Find the ring for a priority, claiming the next unused one for a new
+    // priority. Rings are claimed in order, so two senders with the same new
+    // priority race for the same ring and the loser sees the winner's key.
+    NATIVE_INT_TYPE findBand(NATIVE_INT_TYPE priority) {
+      const U64 key = (static_cast<U64>(1) << 32) | static_cast<U32>(priority);
+      for (NATIVE_INT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+        U64 current = loadAcquire(&this->m_bands[band].key);
+        if ((0 == current) && CAS(&this->m_bands[band].key, static_cast<U64>(0), key)) {
+          return band;
+        }
+        current = loadAcquire(&this->m_bands[band].key);
+        if (current == key) {
+          return band;
+        }
+      }
+      return -1;
+    }
+
+    Queue::QueueStatus trySend(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE band) {
+      // reserve a free slot first; the ring can briefly look empty while a
+      // receiver is still returning a slot, so it is not the test for full
+      if (not takeOne(&this->m_numFree)) {
+        return Queue::QUEUE_FULL;
+      }
+      U32 slot;
+      while (not this->m_free.pop(slot)) {
+      }
+      U8* dest = &this->m_slots[slot * this->m_slotSize];
+      NATIVE_UINT_TYPE storedSize = size;
+      (void) memcpy(dest, &storedSize, sizeof(storedSize));
+      (void) memcpy(dest + sizeof(storedSize), buffer, size);
+
+      // queued messages can't outnumber the ring capacity
+      this->m_bands[band].ring.push(slot);
+      U32 count = __sync_add_and_fetch(&this->m_count, 1);
+      U32 maxCount = this->m_maxCount;
+      while ((count > maxCount) && not CAS(&this->m_maxCount, maxCount, count)) {
+        maxCount = this->m_maxCount;
+      }
+      this->m_notEmpty.notify();
+      return Queue::QUEUE_OK;
+    }
+
+    Queue::QueueStatus tryReceive(U8* buffer, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority) {
+      // reserve a queued message; one is then in a ring or about to be
+      if (not takeOne(&this->m_count)) {
+        return Queue::QUEUE_NO_MORE_MSGS;
+      }
+      for (;;) {
+        // pick the highest priority ring holding a message
+        NATIVE_INT_TYPE best = -1;
+        for (NATIVE_INT_TYPE band = 0; band < OS_QUEUE_PRIORITY_LEVELS; band++) {
+          U64 key = loadAcquire(&this->m_bands[band].key);
+          if (0 == key) {
+            break;
+          }
+          if (not this->m_bands[band].ring.isEmpty()) {
+            if ((-1 == best) || (static_cast<I32>(key) > static_cast<I32>(loadAcquire(&this->m_bands[best].key)))) {
+              best = band;
+            }
+          }
+        }
+        U32 slot;
+        if ((-1 == best) || not this->m_bands[best].ring.pop(slot)) {
+          // another receiver took it, or a sender is still publishing; look again
+          continue;
+        }
+        const U8* source = &this->m_slots[slot * this->m_slotSize];
+        NATIVE_UINT_TYPE storedSize;
+        (void) memcpy(&storedSize, source, sizeof(storedSize));
+        (void) memcpy(buffer, source + sizeof(storedSize), storedSize);
+        actualSize = storedSize;
+        priority = static_cast<I32>(loadAcquire(&this->m_bands[best].key));
+
+        this->m_free.push(slot);
+        (void) __sync_add_and_fetch(&this->m_numFree, 1);
+        this->m_notFull.notify();
+        return Queue::QUEUE_OK;
+      }
+    }
+
+    // Decrement a counter unless it is zero. Returns false if it was zero.
+    static bool takeOne(volatile U32* counter) {
+      U32 value = loadAcquire(counter);
+      while (value != 0) {
+        if (CAS(counter, value, value - 1)) {
+          return true;
+        }
+        value = loadAcquire(counter);
+      }
+      return false;
+    }
+
+    U8* m_slots; // message slots, each a size followed by the message
+    NATIVE_UINT_TYPE m_slotSize;
+    NATIVE_INT_TYPE m_msgSize;
+    NATIVE_INT_TYPE m_depth;
+    IndexRing m_free; // slots not holding a message
+    struct Band {
+      volatile U64 key; // 0 if unused, otherwise 1 << 32 | priority
+      IndexRing ring; // slots queued at this priority, oldest first
+    } m_bands[OS_QUEUE_PRIORITY_LEVELS];
+    volatile U32 m_count; // number of messages ready to receive
+    volatile U32 m_numFree; // number of free slots ready to send into
+    volatile U32 m_maxCount; // high water mark
+    WaitPoint m_notEmpty; // receivers wait here for a message
+    WaitPoint m_notFull; // senders wait here for a free slot
+  };
+
+  Queue::Queue() :
+    m_handle((POINTER_CAST) NULL) {
+  }
+
+  Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    // Queue has already been created... remove it and try again:
+    if (NULL != queueHandle) {
+        delete queueHandle;
+        queueHandle = NULL;
+        this->m_handle = (POINTER_CAST) NULL;
+    }
+
+    // Create queue handle:
+    queueHandle = new QueueHandle;
+    if (NULL == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+    if( !queueHandle->create(depth, msgSize) ) {
+      delete queueHandle;
+      return QUEUE_UNINITIALIZED;
+    }
+    this->m_handle = (POINTER_CAST) queueHandle;
+    this->m_name = name.toChar();
+
+#if FW_QUEUE_REGISTRATION
+    if (this->s_queueRegistry) {
+        this->s_queueRegistry->regQueue(this);
+    }
+#endif
+
+    return QUEUE_OK;
+  }
+
+  Queue::~Queue() {
+    // Clean up the queue handle:
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+    if (NULL != queueHandle) {
+      delete queueHandle;
+    }
+    this->m_handle = (POINTER_CAST) NULL;
+  }
+
+  Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    if (NULL == queueHandle) {
+        return QUEUE_UNINITIALIZED;
+    }
+
+    if (NULL == buffer) {
+        return QUEUE_EMPTY_BUFFER;
+    }
+
+    if (size < 0 || size > queueHandle->m_msgSize) {
+        return QUEUE_SIZE_MISMATCH;
+    }
+
+    NATIVE_INT_TYPE band = queueHandle->findBand(priority);
+    if (-1 == band) {
+        return QUEUE_INVALID_PRIORITY;
+    }
+
+    QueueStatus status = queueHandle->trySend(buffer, size, band);
+    while ((QUEUE_FULL == status) && (QUEUE_BLOCKING == block)) {
+      // wait for the receiver to free a slot, then try again
+      U32 seq = queueHandle->m_notFull.prepare();
+      status = queueHandle->trySend(buffer, size, band);
+      if (QUEUE_FULL != status) {
+        queueHandle->m_notFull.cancel();
+        break;
+      }
+      queueHandle->m_notFull.wait(seq);
+      status = queueHandle->trySend(buffer, size, band);
+    }
+    return status;
+  }
+
+  Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
+    QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+
+    if (NULL == queueHandle) {
+      return QUEUE_UNINITIALIZED;
+    }
+
+    // Like a POSIX message queue, the buffer must hold the largest message,
+    // since a message can't be put back once it is taken off a ring.
+    if (capacity < queueHandle->m_msgSize) {
+      return QUEUE_SIZE_MISMATCH;
+    }
+
+    QueueStatus status = queueHandle->tryReceive(buffer, actualSize, priority);
+    while ((QUEUE_NO_MORE_MSGS == status) && (QUEUE_BLOCKING == block)) {
+      // wait for a sender to queue a message, then try again
+      U32 seq = queueHandle->m_notEmpty.prepare();
+      status = queueHandle->tryReceive(buffer, actualSize, priority);
+      if (QUEUE_NO_MORE_MSGS != status) {
+        queueHandle->m_notEmpty.cancel();
+        break;
+      }
+      queueHandle->m_notEmpty.wait(seq);
+      status = queueHandle->tryReceive(buffer, actualSize, priority);
+    }
+    if (QUEUE_OK != status) {
+      actualSize = 0;
+    }
+    return status;
+  }
+
+  NATIVE_INT_TYPE Queue::getNumMsgs(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return loadAcquire(&queueHandle->m_count);
+  }
+
+  NATIVE_INT_TYPE Queue::getMaxMsgs(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return loadAcquire(&queueHandle->m_maxCount);
+  }
+
+  NATIVE_INT_TYPE Queue::getQueueSize(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->m_depth;
+  }
+
+  NATIVE_INT_TYPE Queue::getMsgSize(void) const {
+      QueueHandle* queueHandle = (QueueHandle*) this->m_handle;
+      if (NULL == queueHandle) {
+          return 0;
+      }
+      return queueHandle->m_msgSize;
+  }
+
+}
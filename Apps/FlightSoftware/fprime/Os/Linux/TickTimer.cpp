@@ -0,0 +1,81 @@
+/**
+ * Linux/TickTimer.cpp:
+ *
+ * Host tick source. Each wait() sleeps to the next absolute deadline on CLOCK_MONOTONIC, and the
+ * deadlines advance by whole periods from the start time, so scheduling delays show up as jitter on
+ * single ticks and never accumulate as drift. Hosts without clock_nanosleep() fall back to a
+ * relative sleep to the same deadline.
+ */
+#include <Os/TickTimer.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <time.h>
+#include <errno.h>
+
+namespace Os {
+
+    namespace {
+        const U64 NSEC_PER_SEC = 1000000000;
+
+        U64 now(void) {
+            timespec t;
+            FW_ASSERT(clock_gettime(CLOCK_MONOTONIC,&t) == 0,errno);
+            return static_cast<U64>(t.tv_sec)*NSEC_PER_SEC + t.tv_nsec;
+        }
+
+        void sleepUntil(U64 deadline) {
+            timespec t;
+#ifdef TIMER_ABSTIME
+            t.tv_sec = deadline / NSEC_PER_SEC;
+            t.tv_nsec = deadline % NSEC_PER_SEC;
+            while (clock_nanosleep(CLOCK_MONOTONIC,TIMER_ABSTIME,&t,NULL) == EINTR) {
+            }
+#else
+            U64 current;
+            while ((current = now()) < deadline) {
+                t.tv_sec = (deadline - current) / NSEC_PER_SEC;
+                t.tv_nsec = (deadline - current) % NSEC_PER_SEC;
+                (void) nanosleep(&t,NULL);
+            }
+#endif
+        }
+    }
+
+    TickTimer::TickTimer() : m_periodUsec(0), m_next(0) {
+    }
+
+    TickTimer::~TickTimer() {
+        this->stop();
+    }
+
+    TickTimer::Status TickTimer::start(U32 periodUsec) {
+        if (periodUsec == 0) {
+            return INVALID_PERIOD;
+        }
+        this->m_periodUsec = periodUsec;
+        this->m_next = now() + static_cast<U64>(periodUsec)*1000;
+        return OP_OK;
+    }
+
+    U32 TickTimer::wait(void) {
+        FW_ASSERT(this->m_periodUsec != 0);
+        const U64 period = static_cast<U64>(this->m_periodUsec)*1000;
+
+        sleepUntil(this->m_next);
+
+        // Count every deadline already passed, and aim for the first one
+        // still ahead
+        const U64 late = now() - this->m_next;
+        const U64 ticks = 1 + late/period;
+        this->m_next += ticks*period;
+        return static_cast<U32>(ticks);
+    }
+
+    void TickTimer::stop(void) {
+        this->m_periodUsec = 0;
+    }
+
+    U32 TickTimer::getPeriodUsec(void) const {
+        return this->m_periodUsec;
+    }
+
+}
@@ -183,6 +183,21 @@ namespace Os {
         return false;
     }
 
+    U64 Task::getCpuTimeUsec(void) {
+#ifdef TGT_OS_TYPE_LINUX
+        clockid_t clock;
+        timespec t;
+        if (!(this->m_handle) ||
+            pthread_getcpuclockid(*((pthread_t*) this->m_handle), &clock) != 0 ||
+            clock_gettime(clock, &t) != 0) {
+            return 0;
+        }
+        return static_cast<U64>(t.tv_sec)*1000000 + t.tv_nsec/1000;
+#else
+        return 0;
+#endif
+    }
+
     Task::TaskStatus Task::join(void **value_ptr) {
         NATIVE_INT_TYPE stat = 0;
         if (!(this->m_handle)) {
@@ -58,8 +58,7 @@ namespace Os {
 
             // Added to support FreeRTOS
             NATIVE_INT_TYPE m_depth; //!< track length of queue
-            NATIVE_INT_TYPE m_msgSize;
-            U8 * m_msgBuffer;
+            NATIVE_INT_TYPE m_msgSize; //!< maximum message size
             QueueString m_name; //!< queue name
 #if FW_QUEUE_REGISTRATION
             static QueueRegistry* s_queueRegistry; //!< pointer to registry
@@ -44,6 +44,9 @@ namespace Os {
         Queue::s_queueRegistry = reg;
     }
 
+    QueueRegistry::~QueueRegistry() {
+    }
+
 #endif
 
     NATIVE_INT_TYPE Queue::getNumQueues(void) {
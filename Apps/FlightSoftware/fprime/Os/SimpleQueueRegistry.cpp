@@ -5,16 +5,42 @@
  *      Author: tcanham
  */
 
+#include <Fw/Cfg/Config.hpp>
+
 #if FW_QUEUE_REGISTRATION
 
 #include <Os/SimpleQueueRegistry.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <stdio.h>
 
 namespace Os {
 
-    SimpleQueueRegistry::SimpleQueueRegistry() {
+    SimpleQueueRegistry::SimpleQueueRegistry() : m_numEntries(0) {
+        Queue::setQueueRegistry(this);
+        for (NATIVE_INT_TYPE entry = 0; entry < FW_QUEUE_SIMPLE_QUEUE_ENTRIES; entry++) {
+            this->m_queuePtrArray[entry] = 0;
+        }
     }
 
     SimpleQueueRegistry::~SimpleQueueRegistry() {
+        Queue::setQueueRegistry(0);
+    }
+
+    void SimpleQueueRegistry::regQueue(Queue* obj) {
+        FW_ASSERT(obj);
+        FW_ASSERT(this->m_numEntries < FW_QUEUE_SIMPLE_QUEUE_ENTRIES);
+        this->m_queuePtrArray[this->m_numEntries++] = obj;
+    }
+
+    void SimpleQueueRegistry::dump(void) {
+        for (NATIVE_INT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
+            Queue* queue = this->m_queuePtrArray[entry];
+            (void)printf("Queue: %s Depth: %d Msgs: %d High water: %d\n",
+                    queue->getName().toChar(),
+                    queue->getQueueSize(),
+                    queue->getNumMsgs(),
+                    queue->getMaxMsgs());
+        }
     }
 
 
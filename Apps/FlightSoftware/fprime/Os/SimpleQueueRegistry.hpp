@@ -20,6 +20,8 @@
 #ifndef SIMPLEQUEUEREGISTRY_HPP_
 #define SIMPLEQUEUEREGISTRY_HPP_
 
+#include <Fw/Cfg/Config.hpp>
+
 #if FW_QUEUE_REGISTRATION
 
 #include <Os/Queue.hpp>
@@ -32,6 +34,9 @@ namespace Os {
             virtual ~SimpleQueueRegistry(); //!< destructor
             void regQueue(Queue* obj); //!< method called by queue init() methods to register a new queue
             void dump(void); //!< dump list of queues and stats
+        private:
+            Queue* m_queuePtrArray[FW_QUEUE_SIMPLE_QUEUE_ENTRIES]; //!< array of queues
+            NATIVE_INT_TYPE m_numEntries; //!< number of entries in the registry
     };
 
 } /* namespace Os */
@@ -30,6 +30,8 @@ namespace Os {
             // Priority is based on Posix priorities - 0 lowest, 255 highest
             TaskStatus start(const Fw::StringBase &name, NATIVE_INT_TYPE identifier, NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize, taskRoutine routine, void* arg, NATIVE_INT_TYPE cpuAffinity = -1); //!< start the task
             I32 getIdentifier(void); //!< get the identifier for the task
+            const TaskString& getName(void); //!< get the task name
+            U64 getCpuTimeUsec(void); //!< CPU time used by the task in microseconds, zero where the OS does not report it
 
             static TaskStatus delay(NATIVE_UINT_TYPE msecs); //!< delay the task
             static NATIVE_INT_TYPE getNumTasks(void);
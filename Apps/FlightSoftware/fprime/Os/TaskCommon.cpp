@@ -15,6 +15,10 @@ namespace Os {
     I32 Task::getIdentifier() {
         return m_identifier;
     }
+
+    const TaskString& Task::getName(void) {
+        return this->m_name;
+    }
     
     bool Task::isStarted(void) {
         return this->m_started;
@@ -0,0 +1,52 @@
+#ifndef _TickTimer_hpp_
+#define _TickTimer_hpp_
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Os {
+
+    //! \class TickTimer
+    //! \brief Periodic tick source for driving rate groups
+    //!
+    //! Ticks fall on a fixed schedule set at start(), so a late wakeup does
+    //! not shift the ticks after it. On the FreeRTOS target the ticks come
+    //! from an RTI compare interrupt; on hosts the calling task sleeps to
+    //! absolute deadlines on CLOCK_MONOTONIC. A task calls start() and then
+    //! wait() in a loop.
+
+    class TickTimer {
+        public:
+
+            typedef enum {
+                OP_OK, //!< operation succeeded
+                INVALID_PERIOD, //!< period is zero or too long for the timer
+                BUSY, //!< the hardware timer is already running for another TickTimer
+            } Status;
+
+            TickTimer();
+            ~TickTimer();
+
+            //! Start ticking every periodUsec microseconds, the first tick one
+            //! period from now. Called from the task that will call wait(),
+            //! after the scheduler has started.
+            Status start(U32 periodUsec);
+
+            //! Block until the next tick. Returns the number of ticks since the
+            //! previous return: 1 when on time, more when ticks were missed.
+            U32 wait(void);
+
+            void stop(void); //!< stop ticking
+
+            U32 getPeriodUsec(void) const; //!< the period, zero when stopped
+
+        PRIVATE:
+
+            U32 m_periodUsec; //!< tick period
+            U64 m_next; //!< deadline of the next tick, host implementations only
+
+            TickTimer(const TickTimer&); //!< not copyable
+            TickTimer& operator=(const TickTimer&); //!< not copyable
+    };
+}
+
+#endif
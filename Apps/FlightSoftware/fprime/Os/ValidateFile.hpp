@@ -58,6 +58,10 @@ namespace Os {
         Status createValidation(const char* fileName, const char* hashFileName);   //!< Create a validation of the file 'fileName' and store it in
                                                                                              //!< in a file 'hashFileName'
 
+        // use a hash computed while the file was written, instead of re-reading the file
+        Status writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer); //!< Store the precomputed hash 'hashBuffer'
+                                                                                                 //!< in a file 'hashFileName'
+
     }
 }
 
@@ -225,4 +225,16 @@ namespace Os {
         return createValidation(fileName, hashFileName, hashBuffer);
     }
 
+    ValidateFile::Status ValidateFile::writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer) {
+
+        File::Status status;
+
+        status = writeHash(hashFileName, hashBuffer);
+        if( File::OP_OK != status ) {
+            return translateStatus(status, HashFileType);
+        }
+
+        return ValidateFile::VALIDATION_OK;
+    }
+
 }
@@ -51,6 +51,20 @@ namespace Os {
         return result.upper*1000000 + result.lower / 1000;
     }
 
+    U32 IntervalTimer::getDiffNsec(const RawTime& t1In, const RawTime& t2In) {
+
+        RawTime result = {t1In.upper - t2In.upper,0};
+
+        if (t1In.lower < t2In.lower) {
+            result.upper -= 1; // subtract nsec carry to seconds
+            result.lower = t1In.lower + (1000000000 - t2In.lower);
+        } else {
+            result.lower = t1In.lower - t2In.lower;
+        }
+
+        return result.upper*1000000000 + result.lower;
+    }
+
     void IntervalTimer::start() {
         getRawTime(this->m_startTime);
     }
@@ -14,7 +14,8 @@ SRC = 			TaskCommon.cpp \
 				MemCommon.cpp \
 				ValidateFileCommon.cpp \
 				ValidatedFile.cpp \
-				FileCommon.cpp
+				FileCommon.cpp \
+				CycleCounterCommon.cpp
 
 HDR = 			Queue.hpp \
 				IPCQueue.hpp \
@@ -24,6 +25,8 @@ HDR = 			Queue.hpp \
 				TaskString.hpp \
 				InterruptLock.hpp \
 				IntervalTimer.hpp \
+				CycleCounter.hpp \
+				TickTimer.hpp \
 				WatchdogTimer.hpp \
 				Mutex.hpp \
 				File.hpp \
@@ -33,7 +36,7 @@ HDR = 			Queue.hpp \
 				ValidatedFile.hpp
 
 SRC_LINUX=      Posix/IPCQueue.cpp \
-               	Pthreads/Queue.cpp \
+               	Linux/Queue.cpp \
                	Pthreads/BufferQueueCommon.cpp \
                 Pthreads/PriorityBufferQueue.cpp \
                 Pthreads/MaxHeap/MaxHeap.cpp \
@@ -44,6 +47,8 @@ SRC_LINUX=      Posix/IPCQueue.cpp \
 				Linux/WatchdogTimer.cpp \
 				X86/IntervalTimer.cpp \
 				Linux/IntervalTimer.cpp \
+				Linux/CycleCounter.cpp \
+				Linux/TickTimer.cpp \
 				Posix/Mutex.cpp \
 				Linux/FileSystem.cpp \
 				Posix/LocklessQueue.cpp
@@ -60,6 +65,8 @@ SRC_DARWIN =    MacOs/IPCQueueStub.cpp \ # NOTE(mereweth) - provide a stub that
 				Linux/InterruptLock.cpp \
 				X86/IntervalTimer.cpp \
 				MacOs/IntervalTimer.cpp \
+				Linux/CycleCounter.cpp \
+				Linux/TickTimer.cpp \
 				Posix/Mutex.cpp \
 				Linux/FileSystem.cpp  \
 				Posix/LocklessQueue.cpp
@@ -75,6 +82,8 @@ SRC_CYGWIN =    Pthreads/Queue.cpp \
 				Linux/WatchdogTimer.cpp \
 				X86/IntervalTimer.cpp \
 				Linux/IntervalTimer.cpp \
+				Linux/CycleCounter.cpp \
+				Linux/TickTimer.cpp \
 				Posix/Mutex.cpp \
 				Linux/FileSystem.cpp
 				
@@ -89,6 +98,8 @@ SRC_RASPIAN =   Pthreads/Queue.cpp \
 				Linux/WatchdogTimer.cpp \
 				X86/IntervalTimer.cpp \
 				Linux/IntervalTimer.cpp \
+				Linux/CycleCounter.cpp \
+				Linux/TickTimer.cpp \
 				Posix/Mutex.cpp \
 				Linux/FileSystem.cpp
 
@@ -96,6 +107,8 @@ SRC_RASPIAN =   Pthreads/Queue.cpp \
 				FreeRTOS/Queue.cpp		\
 				FreeRTOS/Mutex.cpp		\
 				FreeRTOS/IntervalTimer.cpp	\
+				FreeRTOS/CycleCounter.cpp	\
+				FreeRTOS/TickTimer.cpp	\
 				FreeRTOS/InterruptLock.cpp	\
 				FreeRTOS/File.cpp
 				
@@ -0,0 +1,90 @@
+#include <Os/CycleCounter.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cstdio>
+
+extern "C" {
+    void cycleCounterTest(void);
+}
+
+static const U32 NUM_READS = 1000000;
+static const U32 CALIBRATE_MSEC = 200;
+
+// Checks the counter runs forwards, the fixed-point conversions, and the
+// calibration, then reports the cost of taking a time stamp
+void cycleCounterTest(void) {
+    printf("-----------------------------\n");
+    printf("---- cycle counter test -----\n");
+    printf("-----------------------------\n");
+
+    Os::CycleCounter::init();
+    const U32 nominal = Os::CycleCounter::getFrequency();
+    printf("Nominal frequency: %u Hz\n",nominal);
+
+    // Monotonic, and a back to back read is well under a microsecond
+    U64 last = Os::CycleCounter::read();
+    U64 minStep = static_cast<U64>(-1);
+    for (U32 i = 0; i < NUM_READS; i++) {
+        const U64 now = Os::CycleCounter::read();
+        FW_ASSERT(now >= last);
+        if (now - last < minStep) {
+            minStep = now - last;
+        }
+        last = now;
+    }
+    FW_ASSERT(Os::CycleCounter::toNsec(minStep) < 1000);
+
+    // Conversions agree with exact division and saturate past a U32
+    const U64 counts[] = {0, 1, 999, nominal/1000 + 7, nominal, 3*static_cast<U64>(nominal) + 12345};
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(counts); i++) {
+        const U64 usec = (counts[i]*1000000)/nominal;
+        const U64 nsec = (counts[i]*1000000000)/nominal;
+        FW_ASSERT(usec - Os::CycleCounter::toUsec(counts[i]) <= 1);
+        FW_ASSERT(nsec - Os::CycleCounter::toNsec(counts[i]) <= 1);
+    }
+    FW_ASSERT(Os::CycleCounter::toNsec(10*static_cast<U64>(nominal)) == 0xFFFFFFFF);
+    FW_ASSERT(Os::CycleCounter::toUsec(static_cast<U64>(-1)) == 0xFFFFFFFF);
+
+    // The seconds split agrees with exact division, up to a count one short
+    // of a whole second and past a 32-bit counter wrap
+    const U64 times[] = {0, nominal - 1, nominal, 7*static_cast<U64>(nominal) + nominal/3,
+        (static_cast<U64>(1) << 32) + 5, (static_cast<U64>(1) << 52) + 12345};
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(times); i++) {
+        U32 seconds;
+        U32 useconds;
+        Os::CycleCounter::toTime(times[i], seconds, useconds);
+        FW_ASSERT(seconds == static_cast<U32>(times[i]/nominal), seconds);
+        const U64 usec = ((times[i] % nominal)*1000000)/nominal;
+        FW_ASSERT(usec - useconds <= 1, useconds);
+        FW_ASSERT(useconds < 1000000, useconds);
+    }
+
+    // Calibration lands within 1% of nominal
+    const U32 calibrated = Os::CycleCounter::calibrate(CALIBRATE_MSEC);
+    printf("Calibrated frequency: %u Hz over %u ms\n",calibrated,CALIBRATE_MSEC);
+    FW_ASSERT(calibrated > nominal - nominal/100,calibrated);
+    FW_ASSERT(calibrated < nominal + nominal/100,calibrated);
+
+    // Overhead of a counter read and of a full interval measurement
+    U64 start = Os::CycleCounter::read();
+    for (U32 i = 0; i < NUM_READS; i++) {
+        (void) Os::CycleCounter::read();
+    }
+    U64 stop = Os::CycleCounter::read();
+    printf("CycleCounter::read: %.1f ns\n",
+        static_cast<F64>(Os::CycleCounter::toNsec(stop - start))/NUM_READS);
+
+    Os::IntervalTimer::RawTime t1;
+    Os::IntervalTimer::RawTime t2;
+    U32 nsecSum = 0;
+    start = Os::CycleCounter::read();
+    for (U32 i = 0; i < NUM_READS; i++) {
+        Os::IntervalTimer::getRawTime(t1);
+        Os::IntervalTimer::getRawTime(t2);
+        nsecSum += Os::IntervalTimer::getDiffNsec(t2,t1);
+    }
+    stop = Os::CycleCounter::read();
+    printf("Interval measurement: %.1f ns, mean measured interval %.1f ns\n",
+        static_cast<F64>(Os::CycleCounter::toNsec(stop - start))/NUM_READS,
+        static_cast<F64>(nsecSum)/NUM_READS);
+}
@@ -100,6 +100,18 @@ void testTestFileSystem() {
 	}
 	FW_ASSERT(file_size == sizeof(test_string));
 
+	//Get file modification time
+	printf("Checking modification time of %s.\n", test_file_name1);
+	U32 mod_seconds = 0;
+	U32 mod_useconds = 0;
+	if ((file_sys_status = Os::FileSystem::getFileModTime(test_file_name1, mod_seconds, mod_useconds)) != Os::FileSystem::OP_OK) {
+		printf("\tFailed to get modification time of %s\n", test_file_name1);
+		printf("\tReturn status: %d\n", file_sys_status);
+		FW_ASSERT(0);
+	}
+	FW_ASSERT(mod_seconds != 0);
+	FW_ASSERT(mod_useconds < 1000000);
+
 	printf("Copying file (%s) to (%s).\n", test_file_name1, test_file_name2);
 	if ((file_sys_status = Os::FileSystem::copyFile(test_file_name1, test_file_name2)) != Os::FileSystem::OP_OK) {
 		printf("\tFailed to copy file (%s) to (%s)\n", test_file_name1, test_file_name2);
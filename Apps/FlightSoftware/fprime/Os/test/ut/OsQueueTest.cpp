@@ -6,6 +6,7 @@
 #include <unistd.h>
 #include <signal.h>
 #include <pthread.h>
+#include <algorithm>
 
 #if defined TGT_OS_TYPE_LINUX         
 #include <time.h>
@@ -124,6 +125,8 @@ extern "C" {
     void qtest_nonblock_send(void);
     void qtest_block_send(void);
     void qtest_concurrent(void);
+    void qtest_round_trip(void);
+    void qtest_multi_producer(void);
 }
 
 // Alarm signal handler for waking up a blocked queue:
@@ -595,3 +598,244 @@ void qtest_concurrent(void) {
     printf("---------------------\n");
     printf("---------------------\n");
 }
+
+// Round trip benchmark. A rate group thread sends a cycle message to the
+// queue of each member component; every member replies on one shared
+// completion queue, and the rate group waits for all replies before the
+// next cycle. This is the queue traffic of a rate group driving active
+// components, with many senders on the completion queue.
+#define NUM_MEMBERS 4
+#define NUM_CYCLES 20000
+#define STOP_CYCLE 0xFFFFFFFF
+
+struct RoundTripMember {
+    Os::Queue* inQueue;
+    Os::Queue* completionQueue;
+};
+
+static F64 now_seconds(void) {
+#if defined TGT_OS_TYPE_LINUX
+    timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC,&now);
+    return ((F64)now.tv_sec) + ((F64)now.tv_nsec)/1000000000;
+#endif
+#if defined TGT_OS_TYPE_DARWIN
+    timeval now;
+    (void)gettimeofday(&now,0);
+    return ((F64)now.tv_sec) + ((F64)now.tv_usec)/1000000;
+#endif
+}
+
+void *run_member(void *ptr)
+{
+  RoundTripMember* member = (RoundTripMember*) ptr;
+  Os::Queue::QueueStatus stat;
+  Fw::SerializeStatus serStat;
+  I32 prio; // not used
+  MyTestSerializedBuffer msg;
+  U32 cycle = 0;
+  while (cycle != STOP_CYCLE) {
+    msg.resetSer();
+    stat = member->inQueue->receive(msg, prio, Os::Queue::QUEUE_BLOCKING);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    serStat = msg.deserialize(cycle);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    if (cycle != STOP_CYCLE) {
+      stat = member->completionQueue->send(msg, 0, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    }
+  }
+  return NULL;
+}
+
+static void send_cycle(RoundTripMember* members, U32 cycle) {
+    MyTestSerializedBuffer msg;
+    Fw::SerializeStatus serStat = msg.serialize(cycle);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    for (U32 ii = 0; ii < NUM_MEMBERS; ii++) {
+      Os::Queue::QueueStatus stat = members[ii].inQueue->send(msg, 1, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+    }
+}
+
+void qtest_round_trip(void) {
+    printf("-----------------------------\n");
+    printf("----- round trip test -------\n");
+    printf("-----------------------------\n");
+    Os::Queue* completionQueue = createTestQueue((char*)"CompQ", SER_BUFFER_SIZE, QUEUE_SIZE);
+    RoundTripMember members[NUM_MEMBERS];
+    for (U32 ii = 0; ii < NUM_MEMBERS; ii++) {
+      members[ii].inQueue = createTestQueue((char*)"MemberQ", SER_BUFFER_SIZE, QUEUE_SIZE);
+      members[ii].completionQueue = completionQueue;
+    }
+
+#if defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
+    pthread_t thread[NUM_MEMBERS];
+    for(U32 ii = 0; ii < NUM_MEMBERS; ++ii) {
+      if(pthread_create(&thread[ii], NULL, run_member, &members[ii])) {
+        FW_ASSERT(0);
+      }
+    }
+
+    static F64 cycleTime[NUM_CYCLES];
+    MyTestSerializedBuffer recvBuff;
+    Os::Queue::QueueStatus stat;
+    I32 prio;
+    F64 startTime = now_seconds();
+    for (U32 cycle = 0; cycle < NUM_CYCLES; cycle++) {
+      F64 cycleStart = now_seconds();
+      send_cycle(members, cycle);
+      for (U32 ii = 0; ii < NUM_MEMBERS; ii++) {
+        recvBuff.resetSer();
+        stat = completionQueue->receive(recvBuff, prio, Os::Queue::QUEUE_BLOCKING);
+        FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+      }
+      cycleTime[cycle] = now_seconds() - cycleStart;
+    }
+    F64 elapsedTime = now_seconds() - startTime;
+
+    send_cycle(members, STOP_CYCLE);
+    for(U32 ii = 0; ii < NUM_MEMBERS; ++ii) {
+      if(pthread_join(thread[ii], NULL)) {
+        FW_ASSERT(0);
+      }
+    }
+
+    // every cycle is one send and one reply per member
+    F64 numMsgs = 2.0 * NUM_MEMBERS * NUM_CYCLES;
+    std::sort(cycleTime, cycleTime + NUM_CYCLES);
+    printf("Members: %d Cycles: %d\n", NUM_MEMBERS, NUM_CYCLES);
+    printf("Time: %0.3fs (%0.0f msgs/s)\n", elapsedTime, numMsgs / elapsedTime);
+    printf("Cycle: median %0.3fus p99 %0.3fus max %0.3fus\n",
+           1000000*cycleTime[NUM_CYCLES/2],
+           1000000*cycleTime[(NUM_CYCLES*99)/100],
+           1000000*cycleTime[NUM_CYCLES-1]);
+#endif
+
+    for (U32 ii = 0; ii < NUM_MEMBERS; ii++) {
+      delete members[ii].inQueue;
+    }
+    delete completionQueue;
+    printf("Test complete.\n");
+    printf("-----------------------------\n");
+    printf("-----------------------------\n");
+}
+
+// Multi-producer stress test. Several threads send numbered messages of
+// varying length and priority into one shallow queue with blocking sends,
+// and the main thread checks every message it receives: the contents are
+// intact, and the messages of one producer at one priority arrive in order.
+#define NUM_PRODUCERS 4
+#define NUM_PRODUCER_MSGS 50000
+#define NUM_PRODUCER_PRIOS 3
+#define MAX_PATTERN_SIZE 64
+
+struct Producer {
+    Os::Queue* queue;
+    U32 id;
+};
+
+static U8 pattern_byte(U32 id, U32 seq, U32 byte) {
+    return static_cast<U8>(id * 31 + seq * 7 + byte);
+}
+
+void *run_producer(void *ptr)
+{
+  Producer* producer = (Producer*) ptr;
+  Os::Queue::QueueStatus stat;
+  Fw::SerializeStatus serStat;
+  MyTestSerializedBuffer msg;
+  U8 pattern[MAX_PATTERN_SIZE];
+  for (U32 seq = 0; seq < NUM_PRODUCER_MSGS; seq++) {
+    NATIVE_UINT_TYPE size = seq % MAX_PATTERN_SIZE;
+    for (U32 byte = 0; byte < size; byte++) {
+      pattern[byte] = pattern_byte(producer->id, seq, byte);
+    }
+    msg.resetSer();
+    serStat = msg.serialize(producer->id);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    serStat = msg.serialize(seq);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    serStat = msg.serialize(pattern, size);
+    FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+    stat = producer->queue->send(msg, (producer->id + seq) % NUM_PRODUCER_PRIOS, Os::Queue::QUEUE_BLOCKING);
+    FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+  }
+  return NULL;
+}
+
+void qtest_multi_producer(void) {
+    printf("-----------------------------\n");
+    printf("--- multi-producer test -----\n");
+    printf("-----------------------------\n");
+    Os::Queue* testQueue = createTestQueue((char*)"TestQ", SER_BUFFER_SIZE, QUEUE_SIZE);
+
+#if defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
+    Producer producers[NUM_PRODUCERS];
+    pthread_t thread[NUM_PRODUCERS];
+    F64 startTime = now_seconds();
+    for (U32 ii = 0; ii < NUM_PRODUCERS; ++ii) {
+      producers[ii].queue = testQueue;
+      producers[ii].id = ii;
+      if(pthread_create(&thread[ii], NULL, run_producer, &producers[ii])) {
+        FW_ASSERT(0);
+      }
+    }
+
+    // next sequence number expected at or after, per producer and priority
+    U32 nextSeq[NUM_PRODUCERS][NUM_PRODUCER_PRIOS];
+    memset(nextSeq, 0, sizeof(nextSeq));
+    U32 received[NUM_PRODUCERS];
+    memset(received, 0, sizeof(received));
+    MyTestSerializedBuffer recvBuff;
+    U8 pattern[MAX_PATTERN_SIZE];
+    Os::Queue::QueueStatus stat;
+    Fw::SerializeStatus serStat;
+    I32 prio;
+    for (U32 msg = 0; msg < NUM_PRODUCERS * NUM_PRODUCER_MSGS; msg++) {
+      recvBuff.resetSer();
+      stat = testQueue->receive(recvBuff, prio, Os::Queue::QUEUE_BLOCKING);
+      FW_ASSERT(stat == Os::Queue::QUEUE_OK, stat);
+      U32 id;
+      U32 seq;
+      serStat = recvBuff.deserialize(id);
+      FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+      serStat = recvBuff.deserialize(seq);
+      FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+      FW_ASSERT(id < NUM_PRODUCERS, id);
+      FW_ASSERT(prio == (I32) ((id + seq) % NUM_PRODUCER_PRIOS), prio, id, seq);
+      FW_ASSERT(seq >= nextSeq[id][prio], seq, nextSeq[id][prio]);
+      nextSeq[id][prio] = seq + 1;
+      NATIVE_UINT_TYPE size = sizeof(pattern);
+      serStat = recvBuff.deserialize(pattern, size);
+      FW_ASSERT(serStat == Fw::FW_SERIALIZE_OK, serStat);
+      FW_ASSERT(size == seq % MAX_PATTERN_SIZE, size, seq);
+      for (U32 byte = 0; byte < size; byte++) {
+        FW_ASSERT(pattern[byte] == pattern_byte(id, seq, byte), byte, id, seq);
+      }
+      received[id]++;
+    }
+    F64 elapsedTime = now_seconds() - startTime;
+
+    for (U32 ii = 0; ii < NUM_PRODUCERS; ++ii) {
+      if(pthread_join(thread[ii], NULL)) {
+        FW_ASSERT(0);
+      }
+      FW_ASSERT(received[ii] == NUM_PRODUCER_MSGS, received[ii]);
+    }
+
+    stat = testQueue->receive(recvBuff, prio, Os::Queue::QUEUE_NONBLOCKING);
+    FW_ASSERT(stat == Os::Queue::QUEUE_NO_MORE_MSGS, stat);
+    FW_ASSERT(testQueue->getNumMsgs() == 0, testQueue->getNumMsgs());
+    NATIVE_INT_TYPE maxMsgs = testQueue->getMaxMsgs();
+    FW_ASSERT((maxMsgs > 0) && (maxMsgs <= QUEUE_SIZE), maxMsgs);
+
+    printf("Producers: %d Messages: %d High water: %d\n", NUM_PRODUCERS, NUM_PRODUCERS * NUM_PRODUCER_MSGS, maxMsgs);
+    printf("Time: %0.3fs (%0.0f msgs/s)\n", elapsedTime, (F64) (NUM_PRODUCERS * NUM_PRODUCER_MSGS) / elapsedTime);
+#endif
+
+    delete testQueue;
+    printf("Test complete.\n");
+    printf("-----------------------------\n");
+    printf("-----------------------------\n");
+}
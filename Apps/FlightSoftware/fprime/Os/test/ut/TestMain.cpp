@@ -10,7 +10,11 @@ extern "C" {
   void qtest_block_send(void);
   void qtest_performance(void);
   void qtest_concurrent(void);
+  void qtest_round_trip(void);
+  void qtest_multi_producer(void);
   void intervalTimerTest(void);
+  void cycleCounterTest(void);
+  void tickTimerTest(void);
   void fileSystemTest(void);
   void validateFileTest(void);
 }
@@ -49,6 +53,18 @@ void run_test(int test_num)
 		case 9:
 			validateFileTest();
 			break;
+    case 10:
+      qtest_round_trip();
+      break;
+    case 11:
+      qtest_multi_producer();
+      break;
+    case 12:
+      cycleCounterTest();
+      break;
+    case 13:
+      tickTimerTest();
+      break;
 		default:
 			fprintf(stderr, "Invalid test number: %d\n", test_num);
 			break;
@@ -61,7 +77,7 @@ int main(int argc, char* argv[]) {
   if( argc != 2 ) {
     printf("Running all test cases\n");
 
-    for(int i = 0; i < 10; i++)
+    for(int i = 0; i < 14; i++)
     {
       run_test(i);
     }
@@ -0,0 +1,61 @@
+#include <Os/TickTimer.hpp>
+#include <Os/CycleCounter.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+    void tickTimerTest(void);
+}
+
+static const U32 RUN_MSEC = 2000;
+
+// Runs the tick timer at 10 Hz, 100 Hz and 1 kHz and reports how late each
+// tick woke the task, measured from the ideal schedule start + n * period
+void tickTimerTest(void) {
+    printf("-----------------------------\n");
+    printf("----- tick timer test -------\n");
+    printf("-----------------------------\n");
+
+    Os::CycleCounter::init();
+    const U32 rates[] = {10, 100, 1000};
+
+    for (U32 r = 0; r < FW_NUM_ARRAY_ELEMENTS(rates); r++) {
+        const U32 periodUsec = 1000000 / rates[r];
+        const U32 count = RUN_MSEC * rates[r] / 1000;
+        std::vector<U32> lateUsec;
+        lateUsec.reserve(count);
+
+        Os::TickTimer timer;
+        FW_ASSERT(timer.start(0) == Os::TickTimer::INVALID_PERIOD);
+        const U64 start = Os::CycleCounter::read();
+        FW_ASSERT(timer.start(periodUsec) == Os::TickTimer::OP_OK);
+        FW_ASSERT(timer.getPeriodUsec() == periodUsec);
+
+        U32 tick = 0;
+        U32 missed = 0;
+        while (tick < count) {
+            const U32 ticks = timer.wait();
+            FW_ASSERT(ticks >= 1,ticks);
+            tick += ticks;
+            missed += ticks - 1;
+            const U64 now = Os::CycleCounter::read();
+            const U64 ideal = static_cast<U64>(tick) * periodUsec;
+            const U32 elapsed = Os::CycleCounter::toUsec(now - start);
+            lateUsec.push_back((elapsed > ideal) ? static_cast<U32>(elapsed - ideal) : 0);
+        }
+        timer.stop();
+        FW_ASSERT(timer.getPeriodUsec() == 0);
+
+        // The schedule does not drift: the run takes count periods
+        const U32 total = Os::CycleCounter::toUsec(Os::CycleCounter::read() - start);
+        FW_ASSERT(total >= count * periodUsec,total);
+
+        std::sort(lateUsec.begin(), lateUsec.end());
+        const U32 n = lateUsec.size();
+        printf("%5u Hz: %u ticks, %u missed, late by p50 %u us, p90 %u us, p99 %u us, max %u us\n",
+            rates[r], tick, missed,
+            lateUsec[n / 2], lateUsec[(n * 9) / 10], lateUsec[(n * 99) / 100], lateUsec[n - 1]);
+    }
+}
@@ -8,6 +8,8 @@
 TEST_SRC =      OsQueueTest.cpp \
 	        TestMain.cpp \
 	        IntervalTimerTest.cpp \
+	        CycleCounterTest.cpp \
+	        TickTimerTest.cpp \
                 OsValidateFileTest.cpp \
 	        OsTaskTest.cpp \
                 OsFileSystemTest.cpp
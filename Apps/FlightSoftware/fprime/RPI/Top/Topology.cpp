@@ -101,6 +101,7 @@ void constructApp(int port_number, char* hostname) {
     linuxTimer.init(0);
 
     chanTlm.init(10,0);
+    chanTlm.setHashTable(RPITlmChanHash);
 
     cmdDisp.init(20,0);
 
@@ -230,6 +230,7 @@ void constructApp(int port_number, char* hostname) {
     linuxTime.init(0);
 
     chanTlm.init(10,0);
+    chanTlm.setHashTable(RefTlmChanHash);
 
     cmdDisp.init(20,0);
 
@@ -271,6 +272,9 @@ void constructApp(int port_number, char* hostname) {
 	SG5.regCommands();
 	health.regCommands();
 	pingRcvr.regCommands();
+	rateGroup1Comp.regCommands();
+	rateGroup2Comp.regCommands();
+	rateGroup3Comp.regCommands();
 
     // read parameters
     prmDb.readParamFile();
@@ -8,9 +8,26 @@
 #include <Svc/ActiveLogger/ActiveLoggerImpl.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/File.hpp>
+#include <Utils/Hash/IdHash.hpp>
+#include <string.h>
 
 namespace Svc {
 
+    namespace {
+        // Home slot of an event ID in the filter table
+        inline NATIVE_UINT_TYPE hashId(FwEventIdType id) {
+            return Utils::hashId(static_cast<U32>(id)) & (TELEM_ID_FILTER_SLOTS - 1);
+        }
+
+        inline U32 loadAcquire(const volatile U32* ptr) {
+            return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+        }
+
+        inline void storeRelease(volatile U32* ptr, U32 value) {
+            __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+        }
+    }
+
 #if FW_OBJECT_NAMES == 1
     ActiveLoggerImpl::ActiveLoggerImpl(const char* name) : ActiveLoggerComponentBase(name)
 #else
@@ -24,6 +41,7 @@ namespace Svc {
     ,m_activityHiHead(0)
     ,m_activityLoHead(0)
     ,m_diagnosticHead(0)
+    ,m_numIdEntries(0)
     {
         // set input filter defaults
         this->m_inFilterState[INPUT_WARNING_HI].enabled =
@@ -52,7 +70,10 @@ namespace Svc {
         this->m_sendFilterState[SEND_DIAGNOSTIC].enabled =
                 SEND_DIAGNOSTIC_DEFAULT?SEND_ENABLED:SEND_DISABLED;
 
-        memset(m_filteredIDs,0,sizeof(m_filteredIDs));
+        // the ID table must be a power of two with room to keep probe chains short
+        COMPILE_TIME_ASSERT((TELEM_ID_FILTER_SLOTS & (TELEM_ID_FILTER_SLOTS - 1)) == 0,TELEM_ID_FILTER_SLOTS_POWER_OF_TWO);
+        COMPILE_TIME_ASSERT(TELEM_ID_FILTER_SLOTS >= 2*TELEM_ID_FILTER_SIZE,TELEM_ID_FILTER_SLOTS_TOO_SMALL);
+        memset(this->m_idFilter,0,sizeof(this->m_idFilter));
 
     }
 
@@ -109,14 +130,9 @@ namespace Svc {
                 return;
         }
 
-        // check ID filters
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (
-              (m_filteredIDs[entry] == id) &&
-              (severity != Fw::LOG_FATAL)
-              ) {
-                return;
-            }
+        // check ID filters and rate limits. FATAL always passes.
+        if ((severity != Fw::LOG_FATAL) && (not this->passIdFilter(id,timeTag))) {
+            return;
         }
 
         // send event to the logger thread
@@ -472,44 +488,102 @@ namespace Svc {
                 return;
         }
 
+        // zero is reserved for empty table slots
+        if (0 == ID) {
+            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_VALIDATION_ERROR);
+            return;
+        }
+
         if (ID_ENABLED == IdFilterEnable) { // add ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
-                    this->log_ACTIVITY_HI_ALOG_ID_FILTER_ENABLED(ID);
-                    return;
-                }
-            }
-            // if not already a match, search for an open slot
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == 0) {
-                    this->m_filteredIDs[entry] = ID;
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
-                    this->log_ACTIVITY_HI_ALOG_ID_FILTER_ENABLED(ID);
-                    return;
-                }
+            this->m_idFilterLock.lock();
+            NATIVE_INT_TYPE slot = this->addIdEntry(ID);
+            if (slot != -1) {
+                this->m_idFilter[slot].filtered = true;
             }
+            this->m_idFilterLock.unLock();
             // if an empty slot was not found, send an error event
-            this->log_WARNING_LO_ALOG_ID_FILTER_LIST_FULL(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+            if (-1 == slot) {
+                this->log_WARNING_LO_ALOG_ID_FILTER_LIST_FULL(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+            this->log_ACTIVITY_HI_ALOG_ID_FILTER_ENABLED(ID);
         } else { // remove ID
-            // search list for existing entry
-            for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-                if (this->m_filteredIDs[entry] == ID) {
-                    this->m_filteredIDs[entry] = 0; // zero entry
-                    this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
-                    this->log_ACTIVITY_HI_ALOG_ID_FILTER_REMOVED(ID);
-                    return;
+            this->m_idFilterLock.lock();
+            NATIVE_INT_TYPE slot = this->findIdEntry(ID);
+            bool found = (slot != -1) && this->m_idFilter[slot].filtered;
+            if (found) {
+                this->m_idFilter[slot].filtered = false;
+                // keep the entry if it still carries a rate limit
+                if (0 == this->m_idFilter[slot].maxEvents) {
+                    this->removeIdEntry(slot);
                 }
             }
-            // if it gets here, wasn't found
-            this->log_WARNING_LO_ALOG_ID_FILTER_NOT_FOUND(ID);
-            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+            this->m_idFilterLock.unLock();
+            if (not found) {
+                this->log_WARNING_LO_ALOG_ID_FILTER_NOT_FOUND(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+            this->log_ACTIVITY_HI_ALOG_ID_FILTER_REMOVED(ID);
         }
 
     }
 
+    void ActiveLoggerImpl::ALOG_SET_ID_RATE_LIMIT_cmdHandler(
+            FwOpcodeType opCode, //!< The opcode
+            U32 cmdSeq, //!< The command sequence number
+            U32 ID,
+            U32 MaxEvents,
+            U32 WindowSeconds
+        ) {
+
+        if ((0 == ID) or ((MaxEvents != 0) and (0 == WindowSeconds))) {
+            this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_VALIDATION_ERROR);
+            return;
+        }
+
+        if (MaxEvents != 0) { // set or replace the limit
+            this->m_idFilterLock.lock();
+            NATIVE_INT_TYPE slot = this->addIdEntry(ID);
+            if (slot != -1) {
+                t_idFilterEntry& entry = this->m_idFilter[slot];
+                entry.maxEvents = MaxEvents;
+                entry.windowSeconds = WindowSeconds;
+                entry.windowStart = 0;
+                entry.windowCount = 0;
+                entry.suppressed = 0;
+            }
+            this->m_idFilterLock.unLock();
+            if (-1 == slot) {
+                this->log_WARNING_LO_ALOG_ID_FILTER_LIST_FULL(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+        } else { // remove the limit
+            this->m_idFilterLock.lock();
+            NATIVE_INT_TYPE slot = this->findIdEntry(ID);
+            bool found = (slot != -1) && (this->m_idFilter[slot].maxEvents != 0);
+            if (found) {
+                this->m_idFilter[slot].maxEvents = 0;
+                if (not this->m_idFilter[slot].filtered) {
+                    this->removeIdEntry(slot);
+                }
+            }
+            this->m_idFilterLock.unLock();
+            if (not found) {
+                this->log_WARNING_LO_ALOG_ID_FILTER_NOT_FOUND(ID);
+                this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_EXECUTION_ERROR);
+                return;
+            }
+        }
+
+        this->log_ACTIVITY_HI_ALOG_ID_RATE_LIMIT_SET(ID,MaxEvents,WindowSeconds);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
     void ActiveLoggerImpl::ALOG_DUMP_FILTER_STATE_cmdHandler(
             FwOpcodeType opCode, //!< The opcode
             U32 cmdSeq //!< The command sequence number
@@ -524,16 +598,113 @@ namespace Svc {
                     );
         }
 
-        // iterate through ID filter
-        for (NATIVE_INT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
-            if (this->m_filteredIDs[entry] != 0) {
-                this->log_ACTIVITY_HI_ALOG_ID_FILTER_ENABLED(this->m_filteredIDs[entry]);
+        // iterate through ID filter. Entries are copied so events aren't sent under the lock.
+        for (NATIVE_UINT_TYPE slot = 0; slot < TELEM_ID_FILTER_SLOTS; slot++) {
+            this->m_idFilterLock.lock();
+            t_idFilterEntry entry = this->m_idFilter[slot];
+            this->m_idFilterLock.unLock();
+            if (0 == entry.id) {
+                continue;
+            }
+            if (entry.filtered) {
+                this->log_ACTIVITY_HI_ALOG_ID_FILTER_ENABLED(entry.id);
+            }
+            if (entry.maxEvents != 0) {
+                this->log_ACTIVITY_LO_ALOG_ID_RATE_LIMIT_STATE(entry.id,entry.maxEvents,entry.windowSeconds,entry.suppressed);
             }
         }
 
         this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
     }
 
+    NATIVE_INT_TYPE ActiveLoggerImpl::findIdEntry(FwEventIdType id) const {
+        NATIVE_UINT_TYPE slot = hashId(id);
+        while (this->m_idFilter[slot].id != 0) {
+            if (this->m_idFilter[slot].id == id) {
+                return slot;
+            }
+            slot = (slot + 1) & (TELEM_ID_FILTER_SLOTS - 1);
+        }
+        return -1;
+    }
+
+    NATIVE_INT_TYPE ActiveLoggerImpl::addIdEntry(FwEventIdType id) {
+        NATIVE_UINT_TYPE slot = hashId(id);
+        while (this->m_idFilter[slot].id != 0) {
+            if (this->m_idFilter[slot].id == id) {
+                return slot;
+            }
+            slot = (slot + 1) & (TELEM_ID_FILTER_SLOTS - 1);
+        }
+        if (this->m_numIdEntries >= TELEM_ID_FILTER_SIZE) {
+            return -1;
+        }
+        memset(&this->m_idFilter[slot],0,sizeof(this->m_idFilter[slot]));
+        this->m_idFilter[slot].id = id;
+        storeRelease(&this->m_numIdEntries, this->m_numIdEntries + 1);
+        return slot;
+    }
+
+    void ActiveLoggerImpl::removeIdEntry(NATIVE_UINT_TYPE slot) {
+        // Backward shift deletion: pull later entries of the probe chain into
+        // the hole so lookups never need tombstones
+        NATIVE_UINT_TYPE hole = slot;
+        NATIVE_UINT_TYPE next = slot;
+        while (true) {
+            next = (next + 1) & (TELEM_ID_FILTER_SLOTS - 1);
+            if (0 == this->m_idFilter[next].id) {
+                break;
+            }
+            const NATIVE_UINT_TYPE home = hashId(this->m_idFilter[next].id);
+            // entry stays if its home lies cyclically in (hole, next]
+            const bool stays = (hole <= next) ?
+                    ((hole < home) && (home <= next)) :
+                    ((hole < home) || (home <= next));
+            if (not stays) {
+                this->m_idFilter[hole] = this->m_idFilter[next];
+                hole = next;
+            }
+        }
+        memset(&this->m_idFilter[hole],0,sizeof(this->m_idFilter[hole]));
+        FW_ASSERT(this->m_numIdEntries > 0);
+        storeRelease(&this->m_numIdEntries, this->m_numIdEntries - 1);
+    }
+
+    bool ActiveLoggerImpl::passIdFilter(FwEventIdType id, const Fw::Time &timeTag) {
+        // Most of the time no IDs are filtered, so check the count without
+        // the lock first. An ID added while an event is in flight may let
+        // that one event through, as if it had been logged just before.
+        if (0 == loadAcquire(&this->m_numIdEntries)) {
+            return true;
+        }
+        bool pass = true;
+        // LogRecv runs on the caller's thread, so probe the table under
+        // the lock the command handlers take
+        this->m_idFilterLock.lock();
+        NATIVE_INT_TYPE slot = this->findIdEntry(id);
+        if (slot != -1) {
+            t_idFilterEntry& entry = this->m_idFilter[slot];
+            if (entry.filtered) {
+                pass = false;
+            } else if (entry.maxEvents != 0) {
+                const U32 seconds = timeTag.getSeconds();
+                // start a new window when the current one has elapsed or time went backwards
+                if ((seconds < entry.windowStart) or (seconds - entry.windowStart >= entry.windowSeconds)) {
+                    entry.windowStart = seconds;
+                    entry.windowCount = 0;
+                }
+                if (entry.windowCount < entry.maxEvents) {
+                    entry.windowCount++;
+                } else {
+                    entry.suppressed++;
+                    pass = false;
+                }
+            }
+        }
+        this->m_idFilterLock.unLock();
+        return pass;
+    }
+
     void ActiveLoggerImpl::pingIn_handler(
           const NATIVE_INT_TYPE portNum,
           U32 key
@@ -11,6 +11,7 @@
 #include <Svc/ActiveLogger/ActiveLoggerComponentAc.hpp>
 #include <Fw/Log/LogPacket.hpp>
 #include <Svc/ActiveLogger/ActiveLoggerImplCfg.hpp>
+#include <Os/Mutex.hpp>
 
 namespace Svc {
 
@@ -55,6 +56,14 @@ namespace Svc {
                     IdFilterEnabled IdFilterEnable //!< ID filter state
                 );
 
+            void ALOG_SET_ID_RATE_LIMIT_cmdHandler(
+                    FwOpcodeType opCode, //!< The opcode
+                    U32 cmdSeq, //!< The command sequence number
+                    U32 ID,
+                    U32 MaxEvents, //!< Events passed per window; 0 removes the limit
+                    U32 WindowSeconds //!< Window length in seconds
+                );
+
             void ALOG_DUMP_FILTER_STATE_cmdHandler(
                     FwOpcodeType opCode, //!< The opcode
                     U32 cmdSeq //!< The command sequence number
@@ -104,9 +113,25 @@ namespace Svc {
             Fw::ComBuffer m_diagnosticCb[DIAGNOSTIC_EVENT_CB_DEPTH];
             NATIVE_UINT_TYPE m_diagnosticHead;
 
-            // array of filtered event IDs.
-            // value of 0 means no entry
-            FwEventIdType m_filteredIDs[TELEM_ID_FILTER_SIZE];
+            // ID filter helpers
+            NATIVE_INT_TYPE findIdEntry(FwEventIdType id) const; //!< slot holding id, or -1
+            NATIVE_INT_TYPE addIdEntry(FwEventIdType id); //!< find or add id, or -1 if the table is full
+            void removeIdEntry(NATIVE_UINT_TYPE slot); //!< empty a slot, keeping probe chains intact
+            bool passIdFilter(FwEventIdType id, const Fw::Time &timeTag); //!< apply ID filter and rate limit
+
+            // Open-addressing table of filtered and rate limited event IDs.
+            // An ID of 0 means the slot is empty.
+            struct t_idFilterEntry {
+                FwEventIdType id; //!< event ID
+                bool filtered; //!< all events with this ID are dropped
+                U32 maxEvents; //!< events passed per window; 0 means no limit
+                U32 windowSeconds; //!< rate limit window length
+                U32 windowStart; //!< start of the current window in seconds
+                U32 windowCount; //!< events passed in the current window
+                U32 suppressed; //!< events dropped by the rate limit
+            } m_idFilter[TELEM_ID_FILTER_SLOTS];
+            volatile U32 m_numIdEntries; //!< number of occupied slots; read without the lock by LogRecv
+            Os::Mutex m_idFilterLock; //!< guards m_idFilter against the command handlers
 
     };
 
@@ -38,7 +38,16 @@ enum {
     ACTIVITY_HI_EVENT_CB_DEPTH = 20, //!< ACTIVITY HI event circular buffer depth
     ACTIVITY_LO_EVENT_CB_DEPTH = 20, //!< ACTIVITY LO circular buffer depth
     DIAGNOSTIC_EVENT_CB_DEPTH = 50, //!< DIAGNOSTIC event circular buffer depth
-    TELEM_ID_FILTER_SIZE = 25, //!< Size of telemetry ID filter
 };
 
+// set ID filter table size. A deployment can override these on the compiler command line.
+
+#ifndef TELEM_ID_FILTER_SIZE
+#define TELEM_ID_FILTER_SIZE 25 //!< Maximum number of IDs that are filtered or rate limited
+#endif
+
+#ifndef TELEM_ID_FILTER_SLOTS
+#define TELEM_ID_FILTER_SLOTS 64 //!< Slots in the ID filter table. Power of two, at least twice TELEM_ID_FILTER_SIZE
+#endif
+
 #endif /* ACTIVELOGGER_ACTIVELOGGERIMPLCFG_HPP_ */
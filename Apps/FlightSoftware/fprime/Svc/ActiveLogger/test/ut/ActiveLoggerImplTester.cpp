@@ -678,6 +678,181 @@ namespace Svc {
 
     }
 
+    void ActiveLoggerImplTester::runIdRateLimit(void) {
+
+        U32 cmdSeq = 21;
+
+        // limit ID 50 to 3 events per 10 seconds
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_ALOG_SET_ID_RATE_LIMIT(0,cmdSeq,50,3,10);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(
+                0,
+                ActiveLoggerImpl::OPCODE_ALOG_SET_ID_RATE_LIMIT,
+                cmdSeq,
+                Fw::COMMAND_OK
+                );
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_ALOG_ID_RATE_LIMIT_SET_SIZE(1);
+        ASSERT_EVENTS_ALOG_ID_RATE_LIMIT_SET(0,50,3,10);
+
+        // a storm within one window only passes the limit
+        NATIVE_UINT_TYPE passed = 0;
+        for (NATIVE_UINT_TYPE event = 0; event < 100; event++) {
+            Fw::Time timeTag(TB_NONE,100,event*1000);
+            if (this->sendIdEvent(50,Fw::LOG_WARNING_HI,timeTag)) {
+                passed++;
+            }
+        }
+        ASSERT_EQ(3U,passed);
+
+        // other IDs and FATALs are not limited
+        Fw::Time timeTag(TB_NONE,105,0);
+        ASSERT_TRUE(this->sendIdEvent(51,Fw::LOG_WARNING_HI,timeTag));
+        ASSERT_TRUE(this->sendIdEvent(50,Fw::LOG_FATAL,timeTag));
+
+        // the next window passes the limit again
+        passed = 0;
+        for (NATIVE_UINT_TYPE event = 0; event < 5; event++) {
+            Fw::Time timeTag(TB_NONE,110,event);
+            if (this->sendIdEvent(50,Fw::LOG_WARNING_HI,timeTag)) {
+                passed++;
+            }
+        }
+        ASSERT_EQ(3U,passed);
+
+        // filtering the ID overrides the limit, and removing the filter keeps the limit
+        this->sendCmd_ALOG_SET_ID_FILTER(0,cmdSeq,50,ActiveLoggerComponentBase::ID_ENABLED);
+        this->m_impl.doDispatch();
+        timeTag.set(TB_NONE,200,0);
+        ASSERT_FALSE(this->sendIdEvent(50,Fw::LOG_WARNING_HI,timeTag));
+        this->sendCmd_ALOG_SET_ID_FILTER(0,cmdSeq,50,ActiveLoggerComponentBase::ID_DISABLED);
+        this->m_impl.doDispatch();
+
+        // the dump reports the suppressed count
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_ALOG_DUMP_FILTER_STATE(0,cmdSeq);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_ALOG_ID_FILTER_ENABLED_SIZE(0);
+        ASSERT_EVENTS_ALOG_ID_RATE_LIMIT_STATE_SIZE(1);
+        ASSERT_EVENTS_ALOG_ID_RATE_LIMIT_STATE(0,50,3,10,99);
+
+        // remove the limit
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_ALOG_SET_ID_RATE_LIMIT(0,cmdSeq,50,0,0);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(
+                0,
+                ActiveLoggerImpl::OPCODE_ALOG_SET_ID_RATE_LIMIT,
+                cmdSeq,
+                Fw::COMMAND_OK
+                );
+        ASSERT_EVENTS_ALOG_ID_RATE_LIMIT_SET(0,50,0,0);
+        for (NATIVE_UINT_TYPE event = 0; event < 10; event++) {
+            ASSERT_TRUE(this->sendIdEvent(50,Fw::LOG_WARNING_HI,timeTag));
+        }
+
+        // removing it again fails
+        this->clearHistory();
+        this->clearEvents();
+        this->sendCmd_ALOG_SET_ID_RATE_LIMIT(0,cmdSeq,50,0,0);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(
+                0,
+                ActiveLoggerImpl::OPCODE_ALOG_SET_ID_RATE_LIMIT,
+                cmdSeq,
+                Fw::COMMAND_EXECUTION_ERROR
+                );
+        ASSERT_EVENTS_ALOG_ID_FILTER_NOT_FOUND(0,50);
+
+        // a zero ID or window is rejected
+        this->clearHistory();
+        this->sendCmd_ALOG_SET_ID_RATE_LIMIT(0,cmdSeq,0,3,10);
+        this->m_impl.doDispatch();
+        this->sendCmd_ALOG_SET_ID_RATE_LIMIT(0,cmdSeq,50,3,0);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(2);
+        ASSERT_CMD_RESPONSE(0,ActiveLoggerImpl::OPCODE_ALOG_SET_ID_RATE_LIMIT,cmdSeq,Fw::COMMAND_VALIDATION_ERROR);
+        ASSERT_CMD_RESPONSE(1,ActiveLoggerImpl::OPCODE_ALOG_SET_ID_RATE_LIMIT,cmdSeq,Fw::COMMAND_VALIDATION_ERROR);
+    }
+
+    void ActiveLoggerImplTester::runIdFilterStorm(void) {
+
+        U32 cmdSeq = 21;
+        static const NATIVE_UINT_TYPE STORM_EVENTS = 100000;
+
+        // fill the ID filter, spreading the IDs as component ID bases do
+        for (NATIVE_UINT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
+            this->clearHistory();
+            this->clearEvents();
+            this->sendCmd_ALOG_SET_ID_FILTER(0,cmdSeq,0x100*(entry+1),ActiveLoggerComponentBase::ID_ENABLED);
+            this->m_impl.doDispatch();
+            ASSERT_CMD_RESPONSE(
+                    0,
+                    ActiveLoggerImpl::OPCODE_ALOG_SET_ID_FILTER,
+                    cmdSeq,
+                    Fw::COMMAND_OK
+                    );
+        }
+
+        // time an event storm on the last ID added; none of it reaches the queue
+        Fw::LogBuffer buff;
+        U32 val = 10;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(val));
+        Fw::Time timeTag(TB_NONE,0,0);
+
+        Os::IntervalTimer timer;
+        timer.start();
+        for (NATIVE_UINT_TYPE event = 0; event < STORM_EVENTS; event++) {
+            this->invoke_to_LogRecv(0,0x100*TELEM_ID_FILTER_SIZE,timeTag,Fw::LOG_WARNING_HI,buff);
+        }
+        timer.stop();
+        ASSERT_EQ(0,this->m_impl.m_queue.getNumMsgs());
+        printf("Filtered event storm: %u events in %u us\n",STORM_EVENTS,timer.getDiffUsec());
+
+        // unfiltered IDs still pass
+        ASSERT_TRUE(this->sendIdEvent(0x100*TELEM_ID_FILTER_SIZE+1,Fw::LOG_WARNING_HI,timeTag));
+
+        // clear the filter; every entry must still be found after removals shift the table
+        for (NATIVE_UINT_TYPE entry = 0; entry < TELEM_ID_FILTER_SIZE; entry++) {
+            this->clearHistory();
+            this->clearEvents();
+            this->sendCmd_ALOG_SET_ID_FILTER(0,cmdSeq,0x100*(entry+1),ActiveLoggerComponentBase::ID_DISABLED);
+            this->m_impl.doDispatch();
+            ASSERT_CMD_RESPONSE(
+                    0,
+                    ActiveLoggerImpl::OPCODE_ALOG_SET_ID_FILTER,
+                    cmdSeq,
+                    Fw::COMMAND_OK
+                    );
+        }
+        ASSERT_TRUE(this->sendIdEvent(0x100,Fw::LOG_WARNING_HI,timeTag));
+    }
+
+    bool ActiveLoggerImplTester::sendIdEvent(FwEventIdType id, Fw::LogSeverity severity, const Fw::Time& timeTag) {
+
+        Fw::LogBuffer buff;
+        U32 val = 10;
+        Fw::SerializeStatus stat = buff.serialize(val);
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,stat);
+        Fw::Time time(timeTag);
+
+        this->m_receivedPacket = false;
+        this->invoke_to_LogRecv(0,id,time,severity,buff);
+
+        // events dropped at input never reach the queue
+        if (0 == this->m_impl.m_queue.getNumMsgs()) {
+            return false;
+        }
+        this->m_impl.doDispatch();
+        EXPECT_TRUE(this->m_receivedPacket);
+        return true;
+    }
+
     void ActiveLoggerImplTester::writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value) {
         Fw::LogBuffer buff;
 
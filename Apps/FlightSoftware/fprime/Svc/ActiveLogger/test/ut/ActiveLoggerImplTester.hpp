@@ -29,6 +29,8 @@ namespace Svc {
             void runEventFatal(void);
             void runFileDump(void);
             void runFileDumpErrors(void);
+            void runIdRateLimit(void);
+            void runIdFilterStorm(void);
 
         private:
 
@@ -53,6 +55,7 @@ namespace Svc {
             void runWithFilters(Fw::LogSeverity filter);
 
             void writeEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value);
+            bool sendIdEvent(FwEventIdType id, Fw::LogSeverity severity, const Fw::Time& timeTag); //!< returns true if the event was passed
             void readEvent(FwEventIdType id, Fw::LogSeverity severity, U32 value, Os::File& file);
 
             // open call modifiers
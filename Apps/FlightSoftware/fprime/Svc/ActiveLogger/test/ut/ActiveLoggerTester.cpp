@@ -188,6 +188,44 @@ TEST(ActiveLoggerTest,CircularBufferDumpWithErrors) {
 
 }
 
+TEST(ActiveLoggerTest,RateLimitIdTest) {
+
+    TEST_CASE(100.1.4,"Rate limit events by ID");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runIdRateLimit();
+
+}
+
+TEST(ActiveLoggerTest,FilterIdStormTest) {
+
+    TEST_CASE(100.3.1,"Event storm against a full ID filter");
+
+    Svc::ActiveLoggerImpl impl("ActiveLoggerImpl");
+
+    impl.init(10,0);
+
+    Svc::ActiveLoggerImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runIdFilterStorm();
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
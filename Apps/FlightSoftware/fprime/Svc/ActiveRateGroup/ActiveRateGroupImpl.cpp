@@ -20,13 +20,29 @@
 
 namespace Svc {
 
+    // histogram bucket for an execution time. Bucket n holds 2^n to 2^(n+1)-1 us,
+    // so the index is the position of the highest set bit.
+    static inline NATIVE_UINT_TYPE profileBucket(U32 time) {
+#if defined(__GNUC__)
+        NATIVE_UINT_TYPE bucket = 31 - __builtin_clz(time | 1);
+#else
+        NATIVE_UINT_TYPE bucket = 0;
+        while (time > 1) {
+            time >>= 1;
+            bucket++;
+        }
+#endif
+        return (bucket < ACTIVE_RATE_GROUP_PROFILE_BUCKETS) ? bucket : ACTIVE_RATE_GROUP_PROFILE_BUCKETS - 1;
+    }
+
 #if FW_OBJECT_NAMES == 1
     ActiveRateGroupImpl::ActiveRateGroupImpl(const char* compName, NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts) :
         ActiveRateGroupComponentBase(compName),
 #else
     ActiveRateGroupImpl::ActiveRateGroupImpl(NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts) :
 #endif
-        m_cycles(0), m_maxTime(0),m_cycleStarted(false),m_overrunThrottle(0),m_cycleSlips(0) {
+        m_cycles(0), m_maxTime(0),m_cycleStarted(false),m_overrunThrottle(0),m_cycleSlips(0),
+        m_profileTlmCountdown(ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES),m_profileTlmPort(0) {
         FW_ASSERT(contexts);
         FW_ASSERT(numContexts == static_cast<NATIVE_UINT_TYPE>(this->getNum_RateGroupMemberOut_OutputPorts()),numContexts,this->getNum_RateGroupMemberOut_OutputPorts());
         FW_ASSERT(FW_NUM_ARRAY_ELEMENTS(this->m_contexts) == this->getNum_RateGroupMemberOut_OutputPorts(),
@@ -37,6 +53,8 @@ namespace Svc {
         for (NATIVE_INT_TYPE entry = 0; entry < this->getNum_RateGroupMemberOut_OutputPorts(); entry++) {
             this->m_contexts[entry] = contexts[entry];
         }
+
+        this->resetProfiles();
     }
     
     void ActiveRateGroupImpl::init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance) {
@@ -47,6 +65,10 @@ namespace Svc {
 
     }
 
+    U32 ActiveRateGroupImpl::getCycleSlips(void) const {
+        return this->m_cycleSlips;
+    }
+
     void ActiveRateGroupImpl::preamble(void) {
         this->log_DIAGNOSTIC_RateGroupStarted();
     }
@@ -54,20 +76,23 @@ namespace Svc {
     void ActiveRateGroupImpl::CycleIn_handler(NATIVE_INT_TYPE portNum, Svc::TimerVal& cycleStart) {
 
         TimerVal end;
+        TimerVal memberEnd;
 
         this->m_cycleStarted = false;
 
-        // invoke any members of the rate group
+        // invoke any members of the rate group, timing each one. The end of
+        // one member is the start of the next, so there is one timer read per member.
+        end.take();
         for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
             if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
                 this->RateGroupMemberOut_out(port,this->m_contexts[port]);
+                memberEnd.take();
+                this->recordMember(port,memberEnd.diffUSec(end));
+                end = memberEnd;
             }
         }
 
-        // grab timer for end of cycle
-        end.take();
-
-        // get rate group execution time
+        // get rate group execution time. The end of the last member is the end of the cycle.
         U32 cycle_time = end.diffUSec(cycleStart);
 
         // check to see if the time has exceeded the previous maximum
@@ -94,11 +119,56 @@ namespace Svc {
             }
         }
 
+        // report the next member profile on a slow cadence
+        if (--this->m_profileTlmCountdown == 0) {
+            this->m_profileTlmCountdown = ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES;
+            this->writeProfileTlm();
+        }
+
         // increment cycle
         this->m_cycles++;
 
     }
 
+    void ActiveRateGroupImpl::recordMember(NATIVE_INT_TYPE port, U32 time) {
+        MemberProfile& profile = this->m_profiles[port];
+        profile.calls++;
+        profile.minTime = (time < profile.minTime) ? time : profile.minTime;
+        profile.maxTime = (time > profile.maxTime) ? time : profile.maxTime;
+        profile.totalTime += time;
+        profile.buckets[profileBucket(time)]++;
+    }
+
+    void ActiveRateGroupImpl::writeProfileTlm(void) {
+        NATIVE_INT_TYPE ports = this->getNum_RateGroupMemberOut_OutputPorts();
+        // skip members that haven't been called
+        for (NATIVE_INT_TYPE entry = 0; entry < ports; entry++) {
+            NATIVE_INT_TYPE port = this->m_profileTlmPort;
+            this->m_profileTlmPort = (port + 1) % ports;
+            const MemberProfile& profile = this->m_profiles[port];
+            if (profile.calls > 0) {
+                this->tlmWrite_RgProfilePort(port);
+                this->tlmWrite_RgProfileMinTime(profile.minTime);
+                this->tlmWrite_RgProfileMaxTime(profile.maxTime);
+                this->tlmWrite_RgProfileMeanTime(static_cast<U32>(profile.totalTime/profile.calls));
+                return;
+            }
+        }
+    }
+
+    void ActiveRateGroupImpl::resetProfiles(void) {
+        for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
+            MemberProfile& profile = this->m_profiles[port];
+            profile.calls = 0;
+            profile.minTime = 0xFFFFFFFF;
+            profile.maxTime = 0;
+            profile.totalTime = 0;
+            for (NATIVE_UINT_TYPE bucket = 0; bucket < ACTIVE_RATE_GROUP_PROFILE_BUCKETS; bucket++) {
+                profile.buckets[bucket] = 0;
+            }
+        }
+    }
+
     void ActiveRateGroupImpl::CycleIn_preMsgHook(NATIVE_INT_TYPE portNum, Svc::TimerVal& cycleStart) {
         // set flag to indicate cycle has started. Check in thread for overflow.
         this->m_cycleStarted = true;
@@ -109,5 +179,51 @@ namespace Svc {
         this->PingOut_out(0,key);
     }
 
+    void ActiveRateGroupImpl::RG_PROFILE_DUMP_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq, U32 count) {
+
+        // sort the called members by maximum time, worst first. There are only a
+        // few ports, so an insertion sort is enough.
+        NATIVE_INT_TYPE order[NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS];
+        U32 members = 0;
+        for (NATIVE_INT_TYPE port = 0; port < this->getNum_RateGroupMemberOut_OutputPorts(); port++) {
+            if (this->m_profiles[port].calls == 0) {
+                continue;
+            }
+            U32 slot = members++;
+            while (slot > 0 && this->m_profiles[order[slot-1]].maxTime < this->m_profiles[port].maxTime) {
+                order[slot] = order[slot-1];
+                slot--;
+            }
+            order[slot] = port;
+        }
+
+        if (count > members) {
+            count = members;
+        }
+
+        for (U32 entry = 0; entry < count; entry++) {
+            NATIVE_INT_TYPE port = order[entry];
+            const MemberProfile& profile = this->m_profiles[port];
+            this->log_ACTIVITY_LO_RateGroupMemberProfile(port,profile.calls,profile.minTime,profile.maxTime,
+                    static_cast<U32>(profile.totalTime/profile.calls));
+            for (NATIVE_UINT_TYPE bucket = 0; bucket < ACTIVE_RATE_GROUP_PROFILE_BUCKETS; bucket++) {
+                if (profile.buckets[bucket] == 0) {
+                    continue;
+                }
+                U32 lower = (bucket == 0) ? 0 : (1U << bucket);
+                U32 upper = (bucket == ACTIVE_RATE_GROUP_PROFILE_BUCKETS - 1) ? 0xFFFFFFFF : (1U << (bucket + 1)) - 1;
+                this->log_ACTIVITY_LO_RateGroupMemberHistogram(port,profile.buckets[bucket],lower,upper);
+            }
+        }
+
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
+    void ActiveRateGroupImpl::RG_PROFILE_RESET_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq) {
+        this->resetProfiles();
+        this->log_ACTIVITY_HI_RateGroupProfileReset();
+        this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
+    }
+
 
 }
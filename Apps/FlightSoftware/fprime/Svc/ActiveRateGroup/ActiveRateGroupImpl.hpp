@@ -16,6 +16,7 @@
 #define SVC_ACTIVERATEGROUP_IMPL_HPP
 
 #include <Svc/ActiveRateGroup/ActiveRateGroupComponentAc.hpp>
+#include <Svc/ActiveRateGroup/ActiveRateGroupImplCfg.hpp>
 
 namespace Svc {
 
@@ -25,7 +26,8 @@ namespace Svc {
     //! ActiveRateGroup takes an input cycle call to begin the rate group cycle.
     //! It calls each output port in succession and passes the value in the context
     //! array at the index corresponding to the output port number. It keeps track of the execution
-    //! time of the rate group and detects overruns.
+    //! time of the rate group and detects overruns. It also profiles the execution
+    //! time of each member so the member causing an overrun can be found.
     //!
 
     class ActiveRateGroupImpl : public ActiveRateGroupComponentBase {
@@ -64,6 +66,13 @@ namespace Svc {
 
             ~ActiveRateGroupImpl(void);
 
+            //!  \brief Number of cycles started before the previous one finished
+            //!
+            //!  The same count as the RgCycleSlips channel, for reports that do not
+            //!  go through telemetry.
+            //!
+            U32 getCycleSlips(void) const;
+
         PRIVATE:
 
             //!  \brief Input cycle port handler
@@ -96,6 +105,48 @@ namespace Svc {
 
             void PingIn_handler(NATIVE_INT_TYPE portNum, U32 key);
 
+            //!  \brief RG_PROFILE_DUMP command handler
+            //!
+            //!  Reports the profiles of the members with the longest maximum execution
+            //!  time, worst first, each followed by the non-empty buckets of its histogram.
+            //!
+            //!  \param opCode command opcode
+            //!  \param cmdSeq command sequence number
+            //!  \param count number of members to report
+
+            void RG_PROFILE_DUMP_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq, U32 count);
+
+            //!  \brief RG_PROFILE_RESET command handler
+            //!
+            //!  Clears the profiles of all members.
+            //!
+            //!  \param opCode command opcode
+            //!  \param cmdSeq command sequence number
+
+            void RG_PROFILE_RESET_cmdHandler(const FwOpcodeType opCode, const U32 cmdSeq);
+
+            //!  \brief Record a member execution time
+            //!
+            //!  Called after each member call, so it does not allocate and only branches
+            //!  to clamp the histogram bucket.
+            //!
+            //!  \param port member output port
+            //!  \param time execution time in microseconds
+
+            void recordMember(NATIVE_INT_TYPE port, U32 time);
+
+            //!  \brief Write profile telemetry
+            //!
+            //!  Writes the profile of the next member that has been called.
+            //!
+
+            void writeProfileTlm(void);
+
+            //!  \brief Clear member profiles
+            //!
+
+            void resetProfiles(void);
+
             //!  \brief Task preamble
             //!
             //!  This method is called prior to entering the message loop.
@@ -110,6 +161,23 @@ namespace Svc {
             NATIVE_UINT_TYPE m_contexts[NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS]; //!< Must match number of output ports
             NATIVE_INT_TYPE m_overrunThrottle; //!< throttle value for overrun events
             U32 m_cycleSlips; //!< tracks number of cycle slips
+
+            //! \brief Execution time profile of a rate group member
+            struct MemberProfile {
+                U32 calls; //!< number of calls recorded
+                U32 minTime; //!< minimum execution time in microseconds
+                U32 maxTime; //!< maximum execution time in microseconds
+#if FW_HAS_64_BIT
+                U64 totalTime; //!< sum of execution times in microseconds
+#else
+                U32 totalTime; //!< sum of execution times in microseconds
+#endif
+                U32 buckets[ACTIVE_RATE_GROUP_PROFILE_BUCKETS]; //!< log2 execution time histogram
+            };
+
+            MemberProfile m_profiles[NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS]; //!< profile for each output port
+            NATIVE_UINT_TYPE m_profileTlmCountdown; //!< cycles until the next profile telemetry update
+            NATIVE_INT_TYPE m_profileTlmPort; //!< next member to report in telemetry
     };
 
 }
@@ -20,6 +20,12 @@ namespace Svc {
     enum {
         //! Number of overruns allowed before overrun event is throttled
         ACTIVE_RATE_GROUP_OVERRUN_THROTTLE = 5,
+        //! Number of log2 execution time histogram buckets kept per member. Bucket n
+        //! counts calls of 2^n to 2^(n+1)-1 microseconds, and the last bucket has no upper bound.
+        ACTIVE_RATE_GROUP_PROFILE_BUCKETS = 16,
+        //! Number of cycles between profile telemetry updates. Each update
+        //! reports the next member in turn.
+        ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES = 10,
     };
 
 }
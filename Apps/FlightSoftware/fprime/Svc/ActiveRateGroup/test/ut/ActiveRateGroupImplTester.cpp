@@ -28,8 +28,8 @@ namespace Svc {
     }
 
     ActiveRateGroupImplTester::ActiveRateGroupImplTester(Svc::ActiveRateGroupImpl& inst) :
-            ActiveRateGroupGTestBase("testerbase",100),
-            m_impl(inst),m_causeOverrun(false),m_callOrder(0) {
+            ActiveRateGroupGTestBase("testerbase",200),
+            m_impl(inst),m_causeOverrun(false),m_slowPort(-1),m_slowTime(0),m_callOrder(0) {
         this->clearPortCalls();
     }
 
@@ -54,6 +54,15 @@ namespace Svc {
             this->invoke_to_CycleIn(0,zero);
             this->m_causeOverrun = false;
         }
+        // spin to make one member slow
+        if (portNum == this->m_slowPort) {
+            TimerVal start;
+            TimerVal now;
+            start.take();
+            do {
+                now.take();
+            } while (now.diffUSec(start) < this->m_slowTime);
+        }
     }
 
     void ActiveRateGroupImplTester ::
@@ -315,4 +324,122 @@ namespace Svc {
 
     }
 
+    void ActiveRateGroupImplTester::runProfile(void) {
+
+        const NATIVE_INT_TYPE ports = FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_RateGroupMemberOut_OutputPort);
+        const U32 cycles = ports*ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES;
+
+        // make one member in the middle the worst
+        this->m_slowPort = 3;
+        this->m_slowTime = 2000;
+
+        this->clearHistory();
+        Svc::TimerVal timer;
+        for (U32 cycle = 0; cycle < cycles; cycle++) {
+            timer.take();
+            this->invoke_to_CycleIn(0,timer);
+            this->m_impl.doDispatch();
+        }
+
+        // every member was recorded
+        for (NATIVE_INT_TYPE port = 0; port < ports; port++) {
+            ASSERT_EQ(cycles,this->m_impl.m_profiles[port].calls);
+            ASSERT_LE(this->m_impl.m_profiles[port].minTime,this->m_impl.m_profiles[port].maxTime);
+        }
+        ASSERT_GE(this->m_impl.m_profiles[3].minTime,this->m_slowTime);
+
+        // telemetry reports one member every ACTIVE_RATE_GROUP_PROFILE_TLM_CYCLES cycles, in turn
+        ASSERT_TLM_RgProfilePort_SIZE(ports);
+        ASSERT_TLM_RgProfileMinTime_SIZE(ports);
+        ASSERT_TLM_RgProfileMaxTime_SIZE(ports);
+        ASSERT_TLM_RgProfileMeanTime_SIZE(ports);
+        for (NATIVE_INT_TYPE port = 0; port < ports; port++) {
+            ASSERT_TLM_RgProfilePort(port,(U32)port);
+        }
+        ASSERT_GE(this->tlmHistory_RgProfileMinTime->at(3).arg,this->m_slowTime);
+        ASSERT_GE(this->tlmHistory_RgProfileMeanTime->at(3).arg,this->m_slowTime);
+
+        // dump the worst member
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_DUMP(0,10,1);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_DUMP,10,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupMemberProfile_SIZE(1);
+        const ActiveRateGroupImpl::MemberProfile& slow = this->m_impl.m_profiles[3];
+        ASSERT_EVENTS_RateGroupMemberProfile(0,3,cycles,slow.minTime,slow.maxTime,
+                static_cast<U32>(slow.totalTime/slow.calls));
+
+        // the histogram accounts for every call, in increasing buckets
+        ASSERT_GT(this->eventHistory_RateGroupMemberHistogram->size(),0U);
+        U32 histogramCalls = 0;
+        for (U32 entry = 0; entry < this->eventHistory_RateGroupMemberHistogram->size(); entry++) {
+            const EventEntry_RateGroupMemberHistogram& e = this->eventHistory_RateGroupMemberHistogram->at(entry);
+            ASSERT_EQ(3U,e.port);
+            ASSERT_LE(e.lowerTime,e.upperTime);
+            ASSERT_GE(e.upperTime,this->m_slowTime);
+            histogramCalls += e.count;
+        }
+        ASSERT_EQ(cycles,histogramCalls);
+
+        // asking for more than there are reports each member once, worst first
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_DUMP(0,11,ports+5);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_DUMP,11,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupMemberProfile_SIZE(ports);
+        ASSERT_EQ(3U,this->eventHistory_RateGroupMemberProfile->at(0).port);
+        for (NATIVE_INT_TYPE entry = 1; entry < ports; entry++) {
+            ASSERT_GE(this->eventHistory_RateGroupMemberProfile->at(entry-1).maxTime,
+                    this->eventHistory_RateGroupMemberProfile->at(entry).maxTime);
+        }
+
+        // reset clears the profiles
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_RESET(0,12);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_RESET,12,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupProfileReset_SIZE(1);
+        for (NATIVE_INT_TYPE port = 0; port < ports; port++) {
+            ASSERT_EQ(0U,this->m_impl.m_profiles[port].calls);
+        }
+        this->sendCmd_RG_PROFILE_DUMP(0,13,ports);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE(1,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_DUMP,13,Fw::COMMAND_OK);
+        ASSERT_EVENTS_RateGroupMemberProfile_SIZE(0);
+
+        this->m_slowPort = -1;
+    }
+
+    void ActiveRateGroupImplTester::runProfileOverhead(void) {
+
+        const NATIVE_INT_TYPE ports = FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_RateGroupMemberOut_OutputPort);
+        const U32 records = 1000000;
+
+        // cost of recording alone
+        Svc::TimerVal start;
+        Svc::TimerVal end;
+        start.take();
+        for (U32 record = 0; record < records; record++) {
+            this->m_impl.recordMember(record % ports,record & 0xFFF);
+        }
+        end.take();
+        U32 recordTime = end.diffUSec(start);
+
+        // cost of a whole cycle of members that do nothing, which includes a timer read per member
+        const U32 cycles = 10000;
+        Svc::TimerVal timer;
+        start.take();
+        for (U32 cycle = 0; cycle < cycles; cycle++) {
+            this->invoke_to_CycleIn(0,timer);
+            this->m_impl.doDispatch();
+            this->clearTlm();
+        }
+        end.take();
+        U32 cycleTime = end.diffUSec(start);
+
+        printf("Record member: %.1f ns, cycle of %d empty members: %.2f us\n",
+                (F64)recordTime*1000.0/records,ports,(F64)cycleTime/cycles);
+    }
+
 } /* namespace SvcTest */
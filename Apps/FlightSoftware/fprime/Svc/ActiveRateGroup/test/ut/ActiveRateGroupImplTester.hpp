@@ -31,6 +31,8 @@ namespace Svc {
             void runNominal(NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runCycleOverrun(NATIVE_UINT_TYPE contexts[], NATIVE_UINT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runPingTest(void);
+            void runProfile(void);
+            void runProfileOverhead(void);
 
         private:
 
@@ -54,6 +56,8 @@ namespace Svc {
             } m_callLog[Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS];
 
             bool m_causeOverrun; //!< flag to cause an overrun during a rate group member port call
+            NATIVE_INT_TYPE m_slowPort; //!< member port that takes m_slowTime to run
+            U32 m_slowTime; //!< time in microseconds the slow member takes
             NATIVE_UINT_TYPE m_callOrder; //!< tracks order of port call.
 
     };
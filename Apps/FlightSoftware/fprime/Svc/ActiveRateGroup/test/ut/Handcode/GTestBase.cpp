@@ -43,6 +43,75 @@ namespace Svc {
 
   }
 
+  // ----------------------------------------------------------------------
+  // Commands
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertCmdResponse_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ((unsigned long) size, this->cmdResponseHistory->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of command response history\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->cmdResponseHistory->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertCmdResponse(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CommandResponse response
+    )
+    const
+  {
+    ASSERT_LT(index, this->cmdResponseHistory->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into command response history\n"
+      << "  Expected: Less than size of command response history (" 
+      << this->cmdResponseHistory->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const CmdResponse& e = this->cmdResponseHistory->at(index);
+    ASSERT_EQ(opCode, e.opCode)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Opcode at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << opCode << "\n"
+      << "  Actual:   " << e.opCode << "\n";
+    ASSERT_EQ(cmdSeq, e.cmdSeq)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Command sequence number at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << cmdSeq << "\n"
+      << "  Actual:   " << e.cmdSeq << "\n";
+    ASSERT_EQ(response, e.response)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Command response at index "
+      << index
+      << " in command response history\n"
+      << "  Expected: " << response << "\n"
+      << "  Actual:   " << e.response << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Telemetry
   // ----------------------------------------------------------------------
@@ -163,6 +232,206 @@ namespace Svc {
       << "  Actual:   " << e.arg << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Channel: RgProfilePort
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfilePort_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_RgProfilePort->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel RgProfilePort\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_RgProfilePort->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfilePort(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_RgProfilePort->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel RgProfilePort\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_RgProfilePort->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_RgProfilePort& e =
+      this->tlmHistory_RgProfilePort->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel RgProfilePort\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: RgProfileMinTime
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMinTime_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_RgProfileMinTime->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel RgProfileMinTime\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_RgProfileMinTime->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMinTime(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_RgProfileMinTime->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel RgProfileMinTime\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_RgProfileMinTime->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_RgProfileMinTime& e =
+      this->tlmHistory_RgProfileMinTime->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel RgProfileMinTime\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: RgProfileMaxTime
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMaxTime_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_RgProfileMaxTime->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel RgProfileMaxTime\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_RgProfileMaxTime->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMaxTime(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_RgProfileMaxTime->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel RgProfileMaxTime\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_RgProfileMaxTime->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_RgProfileMaxTime& e =
+      this->tlmHistory_RgProfileMaxTime->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel RgProfileMaxTime\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: RgProfileMeanTime
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMeanTime_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_RgProfileMeanTime->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel RgProfileMeanTime\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_RgProfileMeanTime->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertTlm_RgProfileMeanTime(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_RgProfileMeanTime->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel RgProfileMeanTime\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_RgProfileMeanTime->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_RgProfileMeanTime& e =
+      this->tlmHistory_RgProfileMeanTime->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel RgProfileMeanTime\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Events
   // ----------------------------------------------------------------------
@@ -252,6 +521,194 @@ namespace Svc {
       << "  Actual:   " << e.cycle << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Event: RateGroupMemberProfile
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertEvents_RateGroupMemberProfile_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_RateGroupMemberProfile->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event RateGroupMemberProfile\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_RateGroupMemberProfile->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertEvents_RateGroupMemberProfile(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32 port,
+        const U32 calls,
+        const U32 minTime,
+        const U32 maxTime,
+        const U32 meanTime
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_RateGroupMemberProfile->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event RateGroupMemberProfile\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_RateGroupMemberProfile->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_RateGroupMemberProfile& e =
+      this->eventHistory_RateGroupMemberProfile->at(index);
+    ASSERT_EQ(port, e.port)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument port at index "
+      << index
+      << " in history of event RateGroupMemberProfile\n"
+      << "  Expected: " << port << "\n"
+      << "  Actual:   " << e.port << "\n";
+    ASSERT_EQ(calls, e.calls)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument calls at index "
+      << index
+      << " in history of event RateGroupMemberProfile\n"
+      << "  Expected: " << calls << "\n"
+      << "  Actual:   " << e.calls << "\n";
+    ASSERT_EQ(minTime, e.minTime)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument minTime at index "
+      << index
+      << " in history of event RateGroupMemberProfile\n"
+      << "  Expected: " << minTime << "\n"
+      << "  Actual:   " << e.minTime << "\n";
+    ASSERT_EQ(maxTime, e.maxTime)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument maxTime at index "
+      << index
+      << " in history of event RateGroupMemberProfile\n"
+      << "  Expected: " << maxTime << "\n"
+      << "  Actual:   " << e.maxTime << "\n";
+    ASSERT_EQ(meanTime, e.meanTime)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument meanTime at index "
+      << index
+      << " in history of event RateGroupMemberProfile\n"
+      << "  Expected: " << meanTime << "\n"
+      << "  Actual:   " << e.meanTime << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: RateGroupMemberHistogram
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertEvents_RateGroupMemberHistogram_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_RateGroupMemberHistogram->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event RateGroupMemberHistogram\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_RateGroupMemberHistogram->size() << "\n";
+  }
+
+  void ActiveRateGroupGTestBase ::
+    assertEvents_RateGroupMemberHistogram(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32 port,
+        const U32 count,
+        const U32 lowerTime,
+        const U32 upperTime
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_RateGroupMemberHistogram->size(), index)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event RateGroupMemberHistogram\n"
+      << "  Expected: Less than size of history (" 
+      << this->eventHistory_RateGroupMemberHistogram->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_RateGroupMemberHistogram& e =
+      this->eventHistory_RateGroupMemberHistogram->at(index);
+    ASSERT_EQ(port, e.port)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument port at index "
+      << index
+      << " in history of event RateGroupMemberHistogram\n"
+      << "  Expected: " << port << "\n"
+      << "  Actual:   " << e.port << "\n";
+    ASSERT_EQ(count, e.count)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument count at index "
+      << index
+      << " in history of event RateGroupMemberHistogram\n"
+      << "  Expected: " << count << "\n"
+      << "  Actual:   " << e.count << "\n";
+    ASSERT_EQ(lowerTime, e.lowerTime)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument lowerTime at index "
+      << index
+      << " in history of event RateGroupMemberHistogram\n"
+      << "  Expected: " << lowerTime << "\n"
+      << "  Actual:   " << e.lowerTime << "\n";
+    ASSERT_EQ(upperTime, e.upperTime)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value of argument upperTime at index "
+      << index
+      << " in history of event RateGroupMemberHistogram\n"
+      << "  Expected: " << upperTime << "\n"
+      << "  Actual:   " << e.upperTime << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: RateGroupProfileReset
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupGTestBase ::
+    assertEvents_RateGroupProfileReset_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventsSize_RateGroupProfileReset)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event RateGroupProfileReset\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventsSize_RateGroupProfileReset << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // From ports
   // ----------------------------------------------------------------------
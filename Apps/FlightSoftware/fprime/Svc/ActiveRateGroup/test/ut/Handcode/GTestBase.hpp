@@ -16,6 +16,16 @@
 #include "TesterBase.hpp"
 #include "gtest/gtest.h"
 
+// ----------------------------------------------------------------------
+// Macros for command history assertions
+// ----------------------------------------------------------------------
+
+#define ASSERT_CMD_RESPONSE_SIZE(size) \
+  this->assertCmdResponse_size(__FILE__, __LINE__, size)
+
+#define ASSERT_CMD_RESPONSE(index, opCode, cmdSeq, response) \
+  this->assertCmdResponse(__FILE__, __LINE__, index, opCode, cmdSeq, response)
+
 // ----------------------------------------------------------------------
 // Macros for telemetry history assertions
 // ----------------------------------------------------------------------
@@ -35,6 +45,30 @@
 #define ASSERT_TLM_RgCycleSlips(index, value) \
   this->assertTlm_RgCycleSlips(__FILE__, __LINE__, index, value)
 
+#define ASSERT_TLM_RgProfilePort_SIZE(size) \
+  this->assertTlm_RgProfilePort_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_RgProfilePort(index, value) \
+  this->assertTlm_RgProfilePort(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_RgProfileMinTime_SIZE(size) \
+  this->assertTlm_RgProfileMinTime_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_RgProfileMinTime(index, value) \
+  this->assertTlm_RgProfileMinTime(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_RgProfileMaxTime_SIZE(size) \
+  this->assertTlm_RgProfileMaxTime_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_RgProfileMaxTime(index, value) \
+  this->assertTlm_RgProfileMaxTime(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_RgProfileMeanTime_SIZE(size) \
+  this->assertTlm_RgProfileMeanTime_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_RgProfileMeanTime(index, value) \
+  this->assertTlm_RgProfileMeanTime(__FILE__, __LINE__, index, value)
+
 // ----------------------------------------------------------------------
 // Macros for event history assertions 
 // ----------------------------------------------------------------------
@@ -51,6 +85,21 @@
 #define ASSERT_EVENTS_RateGroupCycleSlip(index, _cycle) \
   this->assertEvents_RateGroupCycleSlip(__FILE__, __LINE__, index, _cycle)
 
+#define ASSERT_EVENTS_RateGroupMemberProfile_SIZE(size) \
+  this->assertEvents_RateGroupMemberProfile_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_RateGroupMemberProfile(index, _port, _calls, _minTime, _maxTime, _meanTime) \
+  this->assertEvents_RateGroupMemberProfile(__FILE__, __LINE__, index, _port, _calls, _minTime, _maxTime, _meanTime)
+
+#define ASSERT_EVENTS_RateGroupMemberHistogram_SIZE(size) \
+  this->assertEvents_RateGroupMemberHistogram_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_RateGroupMemberHistogram(index, _port, _count, _lowerTime, _upperTime) \
+  this->assertEvents_RateGroupMemberHistogram(__FILE__, __LINE__, index, _port, _count, _lowerTime, _upperTime)
+
+#define ASSERT_EVENTS_RateGroupProfileReset_SIZE(size) \
+  this->assertEvents_RateGroupProfileReset_size(__FILE__, __LINE__, size)
+
 // ----------------------------------------------------------------------
 // Macros for typed user from port history assertions
 // ----------------------------------------------------------------------
@@ -140,6 +189,31 @@ namespace Svc {
       //!
       virtual ~ActiveRateGroupGTestBase(void);
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Commands
+      // ----------------------------------------------------------------------
+
+      //! Assert size of command response history
+      //!
+      void assertCmdResponse_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      //! Assert command response in history at index
+      //!
+      void assertCmdResponse(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CommandResponse response /*!< The command response*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -196,6 +270,90 @@ namespace Svc {
           const U32& val /*!< The channel value*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfilePort
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_RgProfilePort_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_RgProfilePort(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMinTime
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_RgProfileMinTime_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_RgProfileMinTime(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMaxTime
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_RgProfileMaxTime_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_RgProfileMaxTime(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMeanTime
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_RgProfileMeanTime_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_RgProfileMeanTime(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -239,6 +397,63 @@ namespace Svc {
           const U32 cycle /*!< The cycle where the cycle occurred*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupMemberProfile
+      // ----------------------------------------------------------------------
+
+      void assertEvents_RateGroupMemberProfile_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_RateGroupMemberProfile(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 port /*!< The member output port*/,
+          const U32 calls /*!< The number of calls recorded*/,
+          const U32 minTime /*!< The minimum execution time*/,
+          const U32 maxTime /*!< The maximum execution time*/,
+          const U32 meanTime /*!< The mean execution time*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupMemberHistogram
+      // ----------------------------------------------------------------------
+
+      void assertEvents_RateGroupMemberHistogram_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_RateGroupMemberHistogram(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 port /*!< The member output port*/,
+          const U32 count /*!< The number of calls in the bucket*/,
+          const U32 lowerTime /*!< The lowest execution time in the bucket*/,
+          const U32 upperTime /*!< The highest execution time in the bucket*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupProfileReset
+      // ----------------------------------------------------------------------
+
+      void assertEvents_RateGroupProfileReset_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
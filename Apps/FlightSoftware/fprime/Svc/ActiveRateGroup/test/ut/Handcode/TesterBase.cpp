@@ -35,17 +35,31 @@ namespace Svc {
       Fw::PassiveComponentBase()
 #endif
   {
+    // Initialize command history
+    this->cmdResponseHistory = new History<CmdResponse>(maxHistorySize);
     // Initialize telemetry histories
     this->tlmHistory_RgMaxTime = 
       new History<TlmEntry_RgMaxTime>(maxHistorySize);
     this->tlmHistory_RgCycleSlips = 
       new History<TlmEntry_RgCycleSlips>(maxHistorySize);
+    this->tlmHistory_RgProfilePort = 
+      new History<TlmEntry_RgProfilePort>(maxHistorySize);
+    this->tlmHistory_RgProfileMinTime = 
+      new History<TlmEntry_RgProfileMinTime>(maxHistorySize);
+    this->tlmHistory_RgProfileMaxTime = 
+      new History<TlmEntry_RgProfileMaxTime>(maxHistorySize);
+    this->tlmHistory_RgProfileMeanTime = 
+      new History<TlmEntry_RgProfileMeanTime>(maxHistorySize);
     // Initialize event histories
 #if FW_ENABLE_TEXT_LOGGING
     this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
 #endif
     this->eventHistory_RateGroupCycleSlip =
       new History<EventEntry_RateGroupCycleSlip>(maxHistorySize);
+    this->eventHistory_RateGroupMemberProfile =
+      new History<EventEntry_RateGroupMemberProfile>(maxHistorySize);
+    this->eventHistory_RateGroupMemberHistogram =
+      new History<EventEntry_RateGroupMemberHistogram>(maxHistorySize);
     // Initialize histories for typed user output ports
     this->fromPortHistory_RateGroupMemberOut =
       new History<FromPortEntry_RateGroupMemberOut>(maxHistorySize);
@@ -58,14 +72,22 @@ namespace Svc {
   ActiveRateGroupTesterBase ::
     ~ActiveRateGroupTesterBase(void) 
   {
+    // Destroy command history
+    delete this->cmdResponseHistory;
     // Destroy telemetry histories
     delete this->tlmHistory_RgMaxTime;
     delete this->tlmHistory_RgCycleSlips;
+    delete this->tlmHistory_RgProfilePort;
+    delete this->tlmHistory_RgProfileMinTime;
+    delete this->tlmHistory_RgProfileMaxTime;
+    delete this->tlmHistory_RgProfileMeanTime;
     // Destroy event histories
 #if FW_ENABLE_TEXT_LOGGING
     delete this->textLogHistory;
 #endif
     delete this->eventHistory_RateGroupCycleSlip;
+    delete this->eventHistory_RateGroupMemberProfile;
+    delete this->eventHistory_RateGroupMemberHistogram;
   }
 
   void ActiveRateGroupTesterBase ::
@@ -136,6 +158,64 @@ namespace Svc {
 
     }
 
+    // Attach input port CmdStatus
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_CmdStatus();
+        ++_port
+    ) {
+
+      this->m_from_CmdStatus[_port].init();
+      this->m_from_CmdStatus[_port].addCallComp(
+          this,
+          from_CmdStatus_static
+      );
+      this->m_from_CmdStatus[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_CmdStatus[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_CmdStatus[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port CmdReg
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_CmdReg();
+        ++_port
+    ) {
+
+      this->m_from_CmdReg[_port].init();
+      this->m_from_CmdReg[_port].addCallComp(
+          this,
+          from_CmdReg_static
+      );
+      this->m_from_CmdReg[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_CmdReg[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_CmdReg[_port].setObjName(_portName);
+#endif
+
+    }
+
     // Attach input port Tlm
 
     for (
@@ -300,6 +380,29 @@ namespace Svc {
 
     }
 
+    // Initialize output port CmdDisp
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_to_CmdDisp();
+        ++_port
+    ) {
+      this->m_to_CmdDisp[_port].init();
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_to_CmdDisp[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_to_CmdDisp[_port].setObjName(_portName);
+#endif
+
+    }
+
   }
 
   // ----------------------------------------------------------------------
@@ -330,6 +433,24 @@ namespace Svc {
     return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_PingOut);
   }
 
+  NATIVE_INT_TYPE ActiveRateGroupTesterBase ::
+    getNum_to_CmdDisp(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_CmdDisp);
+  }
+
+  NATIVE_INT_TYPE ActiveRateGroupTesterBase ::
+    getNum_from_CmdStatus(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_CmdStatus);
+  }
+
+  NATIVE_INT_TYPE ActiveRateGroupTesterBase ::
+    getNum_from_CmdReg(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_CmdReg);
+  }
+
   NATIVE_INT_TYPE ActiveRateGroupTesterBase ::
     getNum_from_Tlm(void) const
   {
@@ -380,6 +501,16 @@ namespace Svc {
     this->m_to_PingIn[portNum].addCallPort(PingIn);
   }
 
+  void ActiveRateGroupTesterBase ::
+    connect_to_CmdDisp(
+        const NATIVE_INT_TYPE portNum,
+        Fw::InputCmdPort *const CmdDisp
+    ) 
+  {
+    FW_ASSERT(portNum < this->getNum_to_CmdDisp(),static_cast<AssertArg>(portNum));
+    this->m_to_CmdDisp[portNum].addCallPort(CmdDisp);
+  }
+
 
   // ----------------------------------------------------------------------
   // Invocation functions for to ports
@@ -429,6 +560,13 @@ namespace Svc {
     return this->m_to_PingIn[portNum].isConnected();
   }
 
+  bool ActiveRateGroupTesterBase ::
+    isConnected_to_CmdDisp(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_to_CmdDisp(), static_cast<AssertArg>(portNum));
+    return this->m_to_CmdDisp[portNum].isConnected();
+  }
+
   // ----------------------------------------------------------------------
   // Getters for from ports
   // ----------------------------------------------------------------------
@@ -447,6 +585,20 @@ namespace Svc {
     return &this->m_from_PingOut[portNum];
   }
 
+  Fw::InputCmdResponsePort *ActiveRateGroupTesterBase ::
+    get_from_CmdStatus(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_CmdStatus(),static_cast<AssertArg>(portNum));
+    return &this->m_from_CmdStatus[portNum];
+  }
+
+  Fw::InputCmdRegPort *ActiveRateGroupTesterBase ::
+    get_from_CmdReg(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_CmdReg(),static_cast<AssertArg>(portNum));
+    return &this->m_from_CmdReg[portNum];
+  }
+
   Fw::InputTlmPort *ActiveRateGroupTesterBase ::
     get_from_Tlm(const NATIVE_INT_TYPE portNum)
   {
@@ -513,6 +665,30 @@ namespace Svc {
     );
   }
 
+  void ActiveRateGroupTesterBase ::
+    from_CmdStatus_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const Fw::CommandResponse response
+    )
+  {
+    ActiveRateGroupTesterBase* _testerBase =
+      static_cast<ActiveRateGroupTesterBase*>(component);
+    _testerBase->cmdResponseIn(opCode, cmdSeq, response);
+  }
+
+  void ActiveRateGroupTesterBase ::
+    from_CmdReg_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        const FwOpcodeType opCode
+    )
+  {
+
+  }
+
   void ActiveRateGroupTesterBase ::
     from_Tlm_static(
         Fw::PassiveComponentBase *const component,
@@ -645,6 +821,112 @@ namespace Svc {
     );
   }
 
+  // ----------------------------------------------------------------------
+  // Command response handling
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupTesterBase ::
+    cmdResponseIn(
+        const FwOpcodeType opCode,
+        const U32 seq,
+        const Fw::CommandResponse response
+    )
+  {
+    CmdResponse e = { opCode, seq, response };
+    this->cmdResponseHistory->push_back(e);
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: RG_PROFILE_DUMP
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    sendCmd_RG_PROFILE_DUMP(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq,
+        U32 count
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+    Fw::SerializeStatus _status;
+    _status = buff.serialize(count);
+    FW_ASSERT(_status == Fw::FW_SERIALIZE_OK,static_cast<AssertArg>(_status));
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_DUMP + idBase;
+
+    if (this->m_to_CmdDisp[0].isConnected()) {
+      this->m_to_CmdDisp[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Command: RG_PROFILE_RESET
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    sendCmd_RG_PROFILE_RESET(
+        const NATIVE_INT_TYPE instance,
+        const U32 cmdSeq
+    )
+  {
+
+    // Serialize arguments
+
+    Fw::CmdArgBuffer buff;
+
+    // Call output command port
+    
+    FwOpcodeType _opcode;
+    const U32 idBase = this->getIdBase();
+    _opcode = ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_RESET + idBase;
+
+    if (this->m_to_CmdDisp[0].isConnected()) {
+      this->m_to_CmdDisp[0].invoke(
+          _opcode,
+          cmdSeq,
+          buff
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+
+  }
+
+  
+  void ActiveRateGroupTesterBase ::
+    sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args) {
+       
+    const U32 idBase = this->getIdBase();   
+    FwOpcodeType _opcode = opcode + idBase;
+    if (this->m_to_CmdDisp[0].isConnected()) {
+      this->m_to_CmdDisp[0].invoke(
+          _opcode,
+          cmdSeq,
+          args
+      );
+    }
+    else {
+      printf("Test Command Output port not connected!\n");
+    }
+        
+  }
+  
   // ----------------------------------------------------------------------
   // History 
   // ----------------------------------------------------------------------
@@ -652,6 +934,7 @@ namespace Svc {
   void ActiveRateGroupTesterBase ::
     clearHistory()
   {
+    this->cmdResponseHistory->clear();
     this->clearTlm();
     this->textLogHistory->clear();
     this->clearEvents();
@@ -711,6 +994,54 @@ namespace Svc {
         break;
       }
 
+      case ActiveRateGroupComponentBase::CHANNELID_RGPROFILEPORT:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing RgProfilePort: %d\n", _status);
+          return;
+        }
+        this->tlmInput_RgProfilePort(timeTag, arg);
+        break;
+      }
+
+      case ActiveRateGroupComponentBase::CHANNELID_RGPROFILEMINTIME:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing RgProfileMinTime: %d\n", _status);
+          return;
+        }
+        this->tlmInput_RgProfileMinTime(timeTag, arg);
+        break;
+      }
+
+      case ActiveRateGroupComponentBase::CHANNELID_RGPROFILEMAXTIME:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing RgProfileMaxTime: %d\n", _status);
+          return;
+        }
+        this->tlmInput_RgProfileMaxTime(timeTag, arg);
+        break;
+      }
+
+      case ActiveRateGroupComponentBase::CHANNELID_RGPROFILEMEANTIME:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing RgProfileMeanTime: %d\n", _status);
+          return;
+        }
+        this->tlmInput_RgProfileMeanTime(timeTag, arg);
+        break;
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -726,6 +1057,10 @@ namespace Svc {
     this->tlmSize = 0;
     this->tlmHistory_RgMaxTime->clear();
     this->tlmHistory_RgCycleSlips->clear();
+    this->tlmHistory_RgProfilePort->clear();
+    this->tlmHistory_RgProfileMinTime->clear();
+    this->tlmHistory_RgProfileMaxTime->clear();
+    this->tlmHistory_RgProfileMeanTime->clear();
   }
 
   // ---------------------------------------------------------------------- 
@@ -758,6 +1093,66 @@ namespace Svc {
     ++this->tlmSize;
   }
 
+  // ---------------------------------------------------------------------- 
+  // Channel: RgProfilePort
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    tlmInput_RgProfilePort(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_RgProfilePort e = { timeTag, val };
+    this->tlmHistory_RgProfilePort->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: RgProfileMinTime
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    tlmInput_RgProfileMinTime(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_RgProfileMinTime e = { timeTag, val };
+    this->tlmHistory_RgProfileMinTime->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: RgProfileMaxTime
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    tlmInput_RgProfileMaxTime(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_RgProfileMaxTime e = { timeTag, val };
+    this->tlmHistory_RgProfileMaxTime->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: RgProfileMeanTime
+  // ---------------------------------------------------------------------- 
+
+  void ActiveRateGroupTesterBase ::
+    tlmInput_RgProfileMeanTime(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_RgProfileMeanTime e = { timeTag, val };
+    this->tlmHistory_RgProfileMeanTime->push_back(e);
+    ++this->tlmSize;
+  }
+
   // ----------------------------------------------------------------------
   // Event dispatch
   // ----------------------------------------------------------------------
@@ -803,6 +1198,91 @@ namespace Svc {
 
       }
 
+      case ActiveRateGroupComponentBase::EVENTID_RATEGROUPMEMBERPROFILE: 
+      {
+
+        Fw::SerializeStatus _status;
+        U32 port;
+        _status = args.deserialize(port);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 calls;
+        _status = args.deserialize(calls);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 minTime;
+        _status = args.deserialize(minTime);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 maxTime;
+        _status = args.deserialize(maxTime);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 meanTime;
+        _status = args.deserialize(meanTime);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_LO_RateGroupMemberProfile(port, calls, minTime, maxTime, meanTime);
+
+        break;
+
+      }
+
+      case ActiveRateGroupComponentBase::EVENTID_RATEGROUPMEMBERHISTOGRAM: 
+      {
+
+        Fw::SerializeStatus _status;
+        U32 port;
+        _status = args.deserialize(port);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 count;
+        _status = args.deserialize(count);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 lowerTime;
+        _status = args.deserialize(lowerTime);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+        U32 upperTime;
+        _status = args.deserialize(upperTime);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_ACTIVITY_LO_RateGroupMemberHistogram(port, count, lowerTime, upperTime);
+
+        break;
+
+      }
+
+      case ActiveRateGroupComponentBase::EVENTID_RATEGROUPPROFILERESET: 
+      {
+
+        this->logIn_ACTIVITY_HI_RateGroupProfileReset();
+
+        break;
+
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -818,6 +1298,9 @@ namespace Svc {
     this->eventsSize = 0;
     this->eventsSize_RateGroupStarted = 0;
     this->eventHistory_RateGroupCycleSlip->clear();
+    this->eventHistory_RateGroupMemberProfile->clear();
+    this->eventHistory_RateGroupMemberHistogram->clear();
+    this->eventsSize_RateGroupProfileReset = 0;
   }
 
 #if FW_ENABLE_TEXT_LOGGING
@@ -927,4 +1410,56 @@ namespace Svc {
     ++this->eventsSize;
   }
 
+  // ----------------------------------------------------------------------
+  // Event: RateGroupMemberProfile 
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupTesterBase ::
+    logIn_ACTIVITY_LO_RateGroupMemberProfile(
+        U32 port,
+        U32 calls,
+        U32 minTime,
+        U32 maxTime,
+        U32 meanTime
+    )
+  {
+    EventEntry_RateGroupMemberProfile e = {
+      port, calls, minTime, maxTime, meanTime
+    };
+    eventHistory_RateGroupMemberProfile->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: RateGroupMemberHistogram 
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupTesterBase ::
+    logIn_ACTIVITY_LO_RateGroupMemberHistogram(
+        U32 port,
+        U32 count,
+        U32 lowerTime,
+        U32 upperTime
+    )
+  {
+    EventEntry_RateGroupMemberHistogram e = {
+      port, count, lowerTime, upperTime
+    };
+    eventHistory_RateGroupMemberHistogram->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: RateGroupProfileReset 
+  // ----------------------------------------------------------------------
+
+  void ActiveRateGroupTesterBase ::
+    logIn_ACTIVITY_HI_RateGroupProfileReset(
+        void
+    )
+  {
+    ++this->eventsSize_RateGroupProfileReset;
+    ++this->eventsSize;
+  }
+
 } // end namespace Svc
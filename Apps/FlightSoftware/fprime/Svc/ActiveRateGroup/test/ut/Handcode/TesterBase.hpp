@@ -61,6 +61,13 @@ namespace Svc {
           Svc::InputPingPort *const PingIn /*!< The port*/
       );
 
+      //! Connect CmdDisp to to_CmdDisp[portNum]
+      //!
+      void connect_to_CmdDisp(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::InputCmdPort *const CmdDisp /*!< The port*/
+      );
+
     public:
 
       // ----------------------------------------------------------------------
@@ -84,6 +91,22 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Get the port that receives input from CmdStatus
+      //!
+      //! \return from_CmdStatus[portNum]
+      //!
+      Fw::InputCmdResponsePort* get_from_CmdStatus(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from CmdReg
+      //!
+      //! \return from_CmdReg[portNum]
+      //!
+      Fw::InputCmdRegPort* get_from_CmdReg(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
       //! Get the port that receives input from Tlm
       //!
       //! \return from_Tlm[portNum]
@@ -349,6 +372,24 @@ namespace Svc {
       //!
       NATIVE_INT_TYPE getNum_from_PingOut(void) const;
 
+      //! Get the number of to_CmdDisp ports
+      //!
+      //! \return The number of to_CmdDisp ports
+      //!
+      NATIVE_INT_TYPE getNum_to_CmdDisp(void) const;
+
+      //! Get the number of from_CmdStatus ports
+      //!
+      //! \return The number of from_CmdStatus ports
+      //!
+      NATIVE_INT_TYPE getNum_from_CmdStatus(void) const;
+
+      //! Get the number of from_CmdReg ports
+      //!
+      //! \return The number of from_CmdReg ports
+      //!
+      NATIVE_INT_TYPE getNum_from_CmdReg(void) const;
+
       //! Get the number of from_Tlm ports
       //!
       //! \return The number of from_Tlm ports
@@ -397,6 +438,64 @@ namespace Svc {
           const NATIVE_INT_TYPE portNum /*!< The port number*/
       );
 
+      //! Check whether port is connected
+      //!
+      //! Whether to_CmdDisp[portNum] is connected
+      //!
+      bool isConnected_to_CmdDisp(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      // ----------------------------------------------------------------------
+      // Functions for sending commands
+      // ----------------------------------------------------------------------
+
+    protected:
+    
+      // send command buffers directly - used for intentional command encoding errors
+      void sendRawCmd(FwOpcodeType opcode, U32 cmdSeq, Fw::CmdArgBuffer& args); 
+
+      //! Send a RG_PROFILE_DUMP command
+      //!
+      void sendCmd_RG_PROFILE_DUMP(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          U32 count /*!< The number of members to report*/
+      );
+
+      //! Send a RG_PROFILE_RESET command
+      //!
+      void sendCmd_RG_PROFILE_RESET(
+          const NATIVE_INT_TYPE instance, /*!< The instance number*/
+          const U32 cmdSeq /*!< The command sequence number*/
+      );
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Command response handling
+      // ----------------------------------------------------------------------
+
+      //! Handle a command response
+      //!
+      virtual void cmdResponseIn(
+          const FwOpcodeType opCode, /*!< The opcode*/
+          const U32 cmdSeq, /*!< The command sequence number*/
+          const Fw::CommandResponse response /*!< The command response*/
+      );
+
+      //! A type representing a command response
+      //!
+      typedef struct {
+        FwOpcodeType opCode;
+        U32 cmdSeq;
+        Fw::CommandResponse response;
+      } CmdResponse;
+
+      //! The command response history
+      //!
+      History<CmdResponse> *cmdResponseHistory;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -502,6 +601,82 @@ namespace Svc {
       History<EventEntry_RateGroupCycleSlip> 
         *eventHistory_RateGroupCycleSlip;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupMemberProfile
+      // ----------------------------------------------------------------------
+
+      //! Handle event RateGroupMemberProfile
+      //!
+      virtual void logIn_ACTIVITY_LO_RateGroupMemberProfile(
+          U32 port, /*!< The member output port*/
+          U32 calls, /*!< The number of calls recorded*/
+          U32 minTime, /*!< The minimum execution time*/
+          U32 maxTime, /*!< The maximum execution time*/
+          U32 meanTime /*!< The mean execution time*/
+      );
+
+      //! A history entry for event RateGroupMemberProfile
+      //!
+      typedef struct {
+        U32 port;
+        U32 calls;
+        U32 minTime;
+        U32 maxTime;
+        U32 meanTime;
+      } EventEntry_RateGroupMemberProfile;
+
+      //! The history of RateGroupMemberProfile events
+      //!
+      History<EventEntry_RateGroupMemberProfile> 
+        *eventHistory_RateGroupMemberProfile;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupMemberHistogram
+      // ----------------------------------------------------------------------
+
+      //! Handle event RateGroupMemberHistogram
+      //!
+      virtual void logIn_ACTIVITY_LO_RateGroupMemberHistogram(
+          U32 port, /*!< The member output port*/
+          U32 count, /*!< The number of calls in the bucket*/
+          U32 lowerTime, /*!< The lowest execution time in the bucket*/
+          U32 upperTime /*!< The highest execution time in the bucket*/
+      );
+
+      //! A history entry for event RateGroupMemberHistogram
+      //!
+      typedef struct {
+        U32 port;
+        U32 count;
+        U32 lowerTime;
+        U32 upperTime;
+      } EventEntry_RateGroupMemberHistogram;
+
+      //! The history of RateGroupMemberHistogram events
+      //!
+      History<EventEntry_RateGroupMemberHistogram> 
+        *eventHistory_RateGroupMemberHistogram;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: RateGroupProfileReset
+      // ----------------------------------------------------------------------
+
+      //! Handle event RateGroupProfileReset
+      //!
+      virtual void logIn_ACTIVITY_HI_RateGroupProfileReset(
+          void
+      );
+
+      //! Size of history for event RateGroupProfileReset
+      //!
+      U32 eventsSize_RateGroupProfileReset;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -574,6 +749,106 @@ namespace Svc {
       History<TlmEntry_RgCycleSlips> 
         *tlmHistory_RgCycleSlips;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfilePort
+      // ----------------------------------------------------------------------
+
+      //! Handle channel RgProfilePort
+      //!
+      virtual void tlmInput_RgProfilePort(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel RgProfilePort
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_RgProfilePort;
+
+      //! The history of RgProfilePort values
+      //!
+      History<TlmEntry_RgProfilePort> 
+        *tlmHistory_RgProfilePort;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMinTime
+      // ----------------------------------------------------------------------
+
+      //! Handle channel RgProfileMinTime
+      //!
+      virtual void tlmInput_RgProfileMinTime(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel RgProfileMinTime
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_RgProfileMinTime;
+
+      //! The history of RgProfileMinTime values
+      //!
+      History<TlmEntry_RgProfileMinTime> 
+        *tlmHistory_RgProfileMinTime;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMaxTime
+      // ----------------------------------------------------------------------
+
+      //! Handle channel RgProfileMaxTime
+      //!
+      virtual void tlmInput_RgProfileMaxTime(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel RgProfileMaxTime
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_RgProfileMaxTime;
+
+      //! The history of RgProfileMaxTime values
+      //!
+      History<TlmEntry_RgProfileMaxTime> 
+        *tlmHistory_RgProfileMaxTime;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: RgProfileMeanTime
+      // ----------------------------------------------------------------------
+
+      //! Handle channel RgProfileMeanTime
+      //!
+      virtual void tlmInput_RgProfileMeanTime(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel RgProfileMeanTime
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_RgProfileMeanTime;
+
+      //! The history of RgProfileMeanTime values
+      //!
+      History<TlmEntry_RgProfileMeanTime> 
+        *tlmHistory_RgProfileMeanTime;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -600,6 +875,10 @@ namespace Svc {
       //!
       Svc::OutputPingPort m_to_PingIn[1];
 
+      //! To port connected to CmdDisp
+      //!
+      Fw::OutputCmdPort m_to_CmdDisp[1];
+
     private:
 
       // ----------------------------------------------------------------------
@@ -614,6 +893,14 @@ namespace Svc {
       //!
       Svc::InputPingPort m_from_PingOut[1];
 
+      //! From port connected to CmdStatus
+      //!
+      Fw::InputCmdResponsePort m_from_CmdStatus[1];
+
+      //! From port connected to CmdReg
+      //!
+      Fw::InputCmdRegPort m_from_CmdReg[1];
+
       //! From port connected to Tlm
       //!
       Fw::InputTlmPort m_from_Tlm[1];
@@ -654,6 +941,24 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Static function for port from_CmdStatus
+      //!
+      static void from_CmdStatus_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwOpcodeType opCode, /*!< Command Op Code*/
+          U32 cmdSeq, /*!< Command Sequence*/
+          Fw::CommandResponse response /*!< The command response argument*/
+      );
+
+      //! Static function for port from_CmdReg
+      //!
+      static void from_CmdReg_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwOpcodeType opCode /*!< Command Op Code*/
+      );
+
       //! Static function for port from_Tlm
       //!
       static void from_Tlm_static(
@@ -148,6 +148,9 @@ namespace Svc {
           //! The number of bytes written to the current file
           U32 bytesWritten;
 
+          //! The running hash of the bytes written to the current file
+          Utils::Hash hash;
+
       }; // class File
 
     public:
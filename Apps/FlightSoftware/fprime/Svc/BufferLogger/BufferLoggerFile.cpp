@@ -156,6 +156,8 @@ namespace Svc {
       this->fileCounter++;
       // Reset bytes written
       this->bytesWritten = 0;
+      // Start a new hash, updated as bytes are written
+      this->hash.init();
       // Set mode
       this->mode = File::Mode::OPEN;
     }
@@ -203,6 +205,10 @@ namespace Svc {
     FW_ASSERT(length > 0, length);
     NATIVE_INT_TYPE size = length;
     const Os::File::Status fileStatus = this->osFile.write(data, size);
+    // Hash whatever reached the file, so the hash file matches its contents
+    if (size > 0 && size <= static_cast<NATIVE_INT_TYPE>(length)) {
+      this->hash.update(data, size);
+    }
     bool status;
     if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
       this->bytesWritten += length;
@@ -220,9 +226,12 @@ namespace Svc {
   void BufferLogger::File ::
     writeHashFile(void)
   {
+    // Use the running hash rather than re-reading the whole file
+    Utils::HashBuffer hashBuffer;
+    this->hash.final(hashBuffer);
     Os::ValidatedFile validatedFile(this->name.toChar());
     const Os::ValidateFile::Status status =
-      validatedFile.createHashFile();
+      validatedFile.createHashFile(hashBuffer);
     if (status !=  Os::ValidateFile::VALIDATION_OK) {
       const Fw::EightyCharString &hashFileName = validatedFile.getHashFileName();
       Fw::LogStringArg logStringArg(hashFileName.toChar());
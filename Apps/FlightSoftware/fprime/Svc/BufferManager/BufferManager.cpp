@@ -191,6 +191,12 @@ namespace Svc {
   {
     return this->allocationSize;
   }
+
+  bool BufferManager::AllocationQueue ::
+    isFull(void) const
+  {
+    return this->allocationSize == this->totalSize;
+  }
   
   BufferManager::AllocationQueue::Allocate::Status 
     BufferManager::AllocationQueue ::
@@ -240,6 +246,170 @@ namespace Svc {
     return Free::SUCCESS;
   }
 
+  // ----------------------------------------------------------------------
+  // The size class store 
+  // ----------------------------------------------------------------------
+
+  BufferManager::SizeClassStore ::
+    SizeClassStore(void) :
+      memory(0),
+      indexMemory(0),
+      numClasses(0)
+  {
+
+  }
+
+  BufferManager::SizeClassStore ::
+    ~SizeClassStore(void)
+  {
+    delete[] this->memory;
+    delete[] this->indexMemory;
+  }
+
+  void BufferManager::SizeClassStore ::
+    setup(
+        const SizeClass *const sizeClasses,
+        const U32 numSizeClasses
+    )
+  {
+    FW_ASSERT(this->numClasses == 0, this->numClasses);
+    FW_ASSERT(sizeClasses != 0);
+    FW_ASSERT(
+        numSizeClasses > 0 && numSizeClasses <= MAX_SIZE_CLASSES,
+        numSizeClasses
+    );
+
+    // Lay out the classes one after the other
+    U32 memorySize = 0;
+    U32 totalBuffers = 0;
+    for (U32 c = 0; c < numSizeClasses; ++c) {
+      Class& sc = this->classes[c];
+      sc.bufferSize = sizeClasses[c].bufferSize;
+      sc.numBuffers = sizeClasses[c].numBuffers;
+      FW_ASSERT(sc.numBuffers > 0, c);
+      FW_ASSERT(sc.numBuffers < (1U << CLASS_SHIFT), c, sc.numBuffers);
+      if (c > 0) {
+        FW_ASSERT(
+            sc.bufferSize > this->classes[c-1].bufferSize,
+            c, sc.bufferSize
+        );
+      }
+      sc.stride = (sc.bufferSize + 7) & ~7U;
+      FW_ASSERT(sc.stride >= sc.bufferSize, c, sc.bufferSize);
+      memorySize += sc.stride * sc.numBuffers;
+      totalBuffers += sc.numBuffers;
+    }
+
+    this->memory = new U8[memorySize];
+    this->indexMemory = new U32[2 * totalBuffers];
+    FW_ASSERT(this->memory != 0);
+    FW_ASSERT(this->indexMemory != 0);
+
+    U8* base = this->memory;
+    U32* index = this->indexMemory;
+    for (U32 c = 0; c < numSizeClasses; ++c) {
+      Class& sc = this->classes[c];
+      sc.base = base;
+      sc.freeList = index;
+      sc.requested = index + sc.numBuffers;
+      // Push in reverse so the first buffers are handed out first
+      for (U32 b = 0; b < sc.numBuffers; ++b) {
+        sc.freeList[b] = sc.numBuffers - 1 - b;
+        sc.requested[b] = NOT_ALLOCATED;
+      }
+      sc.numFree = sc.numBuffers;
+      base += sc.stride * sc.numBuffers;
+      index += 2 * sc.numBuffers;
+    }
+    this->numClasses = numSizeClasses;
+    this->stats.numAllocated = 0;
+    this->stats.highWater = 0;
+    this->stats.failures = 0;
+    this->stats.allocatedBytes = 0;
+    this->stats.requestedBytes = 0;
+  }
+
+  bool BufferManager::SizeClassStore ::
+    isSetUp(void) const
+  {
+    return this->numClasses > 0;
+  }
+
+  const BufferManager::SizeClassStore::Stats& BufferManager::SizeClassStore ::
+    getStats(void) const
+  {
+    return this->stats;
+  }
+
+  BufferManager::SizeClassStore::Status BufferManager::SizeClassStore ::
+    allocate(
+        const U32 n,
+        U8* &address,
+        U32 &id
+    )
+  {
+    address = 0;
+    id = 0;
+
+    // Find the smallest class that fits
+    U32 first = 0;
+    while (first < this->numClasses && this->classes[first].bufferSize < n) {
+      ++first;
+    }
+    if (first == this->numClasses) {
+      ++this->stats.failures;
+      return TOO_LARGE;
+    }
+
+    // Take a buffer from it, or from a larger class if it has none free
+    for (U32 c = first; c < this->numClasses; ++c) {
+      Class& sc = this->classes[c];
+      if (sc.numFree > 0) {
+        --sc.numFree;
+        const U32 b = sc.freeList[sc.numFree];
+        FW_ASSERT(sc.requested[b] == NOT_ALLOCATED, c, b);
+        sc.requested[b] = n;
+        ++this->stats.numAllocated;
+        if (this->stats.numAllocated > this->stats.highWater) {
+          this->stats.highWater = this->stats.numAllocated;
+        }
+        this->stats.allocatedBytes += sc.bufferSize;
+        this->stats.requestedBytes += n;
+        address = &sc.base[b * sc.stride];
+        id = (c << CLASS_SHIFT) | b;
+        return SUCCESS;
+      }
+    }
+
+    ++this->stats.failures;
+    return EXHAUSTED;
+  }
+
+  void BufferManager::SizeClassStore ::
+    free(
+        const U32 id,
+        U8 *const address
+    )
+  {
+    const U32 c = id >> CLASS_SHIFT;
+    const U32 b = id & ((1U << CLASS_SHIFT) - 1);
+    FW_ASSERT(c < this->numClasses, c, id);
+    Class& sc = this->classes[c];
+    FW_ASSERT(b < sc.numBuffers, c, b);
+    FW_ASSERT(address == &sc.base[b * sc.stride], c, b);
+    // Catch a buffer returned twice
+    FW_ASSERT(sc.requested[b] != NOT_ALLOCATED, c, b);
+    FW_ASSERT(sc.numFree < sc.numBuffers, c, sc.numFree);
+
+    FW_ASSERT(this->stats.numAllocated > 0, c);
+    --this->stats.numAllocated;
+    this->stats.allocatedBytes -= sc.bufferSize;
+    this->stats.requestedBytes -= sc.requested[b];
+    sc.requested[b] = NOT_ALLOCATED;
+    sc.freeList[sc.numFree] = b;
+    ++sc.numFree;
+  }
+
   // ----------------------------------------------------------------------
   // Construction, initialization, and destruction 
   // ----------------------------------------------------------------------
@@ -255,7 +425,9 @@ namespace Svc {
       store(storeSize),
       allocationQueue(maxNumBuffers)
   {
-
+    this->sizeClassTlm.highWater = 0;
+    this->sizeClassTlm.failures = 0;
+    this->sizeClassTlm.fragmentation = 0;
   }
 
   void BufferManager ::
@@ -264,6 +436,15 @@ namespace Svc {
     BufferManagerComponentBase::init(instance);
   }
 
+  void BufferManager ::
+    setSizeClasses(
+        const SizeClass *const sizeClasses,
+        const U32 numSizeClasses
+    )
+  {
+    this->sizeClassStore.setup(sizeClasses, numSizeClasses);
+  }
+
   BufferManager ::
     ~BufferManager(void)
   {
@@ -280,6 +461,10 @@ namespace Svc {
         U32 size 
     )
   {
+    if (this->sizeClassStore.isSetUp()) {
+      return this->allocateSizeClassBuffer(size);
+    }
+
     U8 *address;
     U32 id;
     Fw::Buffer buffer;
@@ -287,7 +472,13 @@ namespace Svc {
 
     Warnings::Status::t warningStatus = Warnings::Status::SUCCESS;
 
-    {
+    // Check the buffer count first. The store can't take back an
+    // allocation once its free index has moved.
+    if (this->allocationQueue.isFull()) {
+      warningStatus = Warnings::Status::TOO_MANY_BUFFERS;
+    }
+
+    if (warningStatus == Warnings::Status::SUCCESS) {
       const Store::Status status = 
         this->store.allocate(size, address);
       if (status == BufferManager::Store::FAILURE) {
@@ -298,10 +489,7 @@ namespace Svc {
     if (warningStatus == Warnings::Status::SUCCESS) {
       const AllocationQueue::Allocate::Status status =
         this->allocationQueue.allocate(size, id);
-      if (status == AllocationQueue::Allocate::FULL) {
-        this->store.free(size, address);
-        warningStatus = Warnings::Status::TOO_MANY_BUFFERS;
-      }
+      FW_ASSERT(status == AllocationQueue::Allocate::SUCCESS, status);
     }
 
     if (warningStatus == Warnings::Status::SUCCESS) {
@@ -323,6 +511,11 @@ namespace Svc {
     const U32 instance = static_cast<U32>(this->getInstance());
     FW_ASSERT(buffer.getmanagerID() == instance);
 
+    if (this->sizeClassStore.isSetUp()) {
+      this->freeSizeClassBuffer(buffer);
+      return;
+    }
+
     const U32 expectedId = buffer.getbufferID();
     U8 *const address = reinterpret_cast<U8*>(buffer.getdata());
     U32 sawId = 0;
@@ -343,4 +536,76 @@ namespace Svc {
 
   }
 
+  // ----------------------------------------------------------------------
+  // Helper methods
+  // ----------------------------------------------------------------------
+
+  Fw::Buffer BufferManager ::
+    allocateSizeClassBuffer(const U32 size)
+  {
+    U8 *address;
+    U32 id;
+    Fw::Buffer buffer;
+    buffer.set(this->getInstance(), 0, 0, size);
+
+    Warnings::Status::t warningStatus = Warnings::Status::SUCCESS;
+    const SizeClassStore::Status status =
+      this->sizeClassStore.allocate(size, address, id);
+    switch (status) {
+      case SizeClassStore::SUCCESS:
+        buffer.setbufferID(id);
+        buffer.setdata(reinterpret_cast<U64>(address));
+        break;
+      case SizeClassStore::TOO_LARGE:
+        warningStatus = Warnings::Status::STORE_SIZE_EXCEEDED;
+        break;
+      case SizeClassStore::EXHAUSTED:
+        warningStatus = Warnings::Status::TOO_MANY_BUFFERS;
+        break;
+      default:
+        FW_ASSERT(0, status);
+        break;
+    }
+
+    this->warnings.update(warningStatus);
+    this->updateSizeClassTlm();
+    return buffer;
+  }
+
+  void BufferManager ::
+    freeSizeClassBuffer(Fw::Buffer &buffer)
+  {
+    U8 *const address = reinterpret_cast<U8*>(buffer.getdata());
+    this->sizeClassStore.free(buffer.getbufferID(), address);
+    this->updateSizeClassTlm();
+  }
+
+  void BufferManager ::
+    updateSizeClassTlm(void)
+  {
+    const SizeClassStore::Stats& stats = this->sizeClassStore.getStats();
+    SizeClassTlm& sent = this->sizeClassTlm;
+
+    // Fragmentation is the percentage of the bytes in allocated buffers
+    // that were not requested
+    U32 fragmentation = 0;
+    if (stats.allocatedBytes > 0) {
+      const U64 unused = stats.allocatedBytes - stats.requestedBytes;
+      fragmentation = static_cast<U32>((100 * unused) / stats.allocatedBytes);
+    }
+
+    if (stats.highWater != sent.highWater) {
+      sent.highWater = stats.highWater;
+      this->tlmWrite_BufferManager_SizeClassHighWater(sent.highWater);
+    }
+    if (stats.failures != sent.failures) {
+      sent.failures = stats.failures;
+      this->tlmWrite_BufferManager_SizeClassFailures(sent.failures);
+    }
+    if (fragmentation != sent.fragmentation) {
+      sent.fragmentation = fragmentation;
+      this->tlmWrite_BufferManager_SizeClassFragmentation(fragmentation);
+    }
+  }
+
 }
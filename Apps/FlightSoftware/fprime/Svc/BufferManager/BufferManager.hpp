@@ -21,6 +21,21 @@ namespace Svc {
     public BufferManagerComponentBase
   {
 
+    public:
+
+      // ----------------------------------------------------------------------
+      // Types
+      // ----------------------------------------------------------------------
+
+      //! The maximum number of size classes
+      enum { MAX_SIZE_CLASSES = 4 };
+
+      //! A size class for the size class allocation mode
+      struct SizeClass {
+        U32 bufferSize; //!< The size of each buffer in the class
+        U32 numBuffers; //!< The number of buffers in the class
+      };
+
     PRIVATE:
 
       // ---------------------------------------------------------------------- 
@@ -224,6 +239,9 @@ namespace Svc {
 
           // Get the number of buffers currently allocated
           U32 getAllocationSize(void) const;
+
+          // Whether the queue holds as many buffers as it can
+          bool isFull(void) const;
         
           // Record an allocation of size 'size' and generate a new id
           Allocate::Status allocate(
@@ -282,6 +300,127 @@ namespace Svc {
 
       };
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // The size class store
+      // ----------------------------------------------------------------------
+
+      class SizeClassStore {
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Construction and destruction 
+          // ----------------------------------------------------------------------
+
+          // Construct a SizeClassStore with no size classes
+          SizeClassStore(void);
+
+          // Destroy a SizeClassStore
+          ~SizeClassStore(void);
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Types 
+          // ----------------------------------------------------------------------
+
+          typedef enum {
+            SUCCESS, // Allocation OK
+            TOO_LARGE, // No class has buffers that large
+            EXHAUSTED // All classes that fit are in use
+          } Status;
+
+          // Statistics over all classes
+          struct Stats {
+            U32 numAllocated; // Buffers currently allocated
+            U32 highWater; // Most buffers allocated at once
+            U32 failures; // Requests no class could serve
+            U32 allocatedBytes; // Bytes in the allocated buffers
+            U32 requestedBytes; // Bytes requested for the allocated buffers
+          };
+
+        public:
+
+          // ----------------------------------------------------------------------
+          // Methods 
+          // ----------------------------------------------------------------------
+
+          // Set up the classes and allocate their memory
+          void setup(
+              const SizeClass *const sizeClasses, //!< The classes, in increasing buffer size
+              const U32 numSizeClasses //!< The number of classes
+          );
+
+          // Whether the store has been set up
+          bool isSetUp(void) const;
+
+          // Get the statistics over all classes
+          const Stats& getStats(void) const;
+
+          // Allocate a buffer from the smallest class that fits n bytes and
+          // has a free buffer
+          Status allocate(
+              const U32 n,
+              U8* &address,
+              U32 &id
+          );
+
+          // Free a buffer
+          void free(
+              const U32 id, //!< The buffer id
+              U8 *const address //!< The buffer address
+          );
+
+        PRIVATE:
+
+          // ----------------------------------------------------------------------
+          // Constants
+          // ----------------------------------------------------------------------
+
+          // Bit position of the class in a buffer id. The low bits are the
+          // index of the buffer in its class.
+          enum { CLASS_SHIFT = 24 };
+
+          // Size recorded for a buffer that is not allocated
+          enum { NOT_ALLOCATED = 0xFFFFFFFF };
+
+          // ----------------------------------------------------------------------
+          // Types
+          // ----------------------------------------------------------------------
+
+          struct Class {
+            U32 bufferSize; // Buffer size
+            U32 stride; // Distance between buffers, a multiple of 8
+            U32 numBuffers; // Number of buffers
+            U8* base; // First buffer
+            U32* freeList; // Stack of free buffer indices
+            U32 numFree; // Number of entries on the free stack
+            U32* requested; // Size requested for each buffer, or NOT_ALLOCATED
+          };
+
+          // ----------------------------------------------------------------------
+          // Variables
+          // ----------------------------------------------------------------------
+
+          //! The buffer memory of all classes
+          U8* memory;
+
+          //! The free stacks and requested sizes of all classes
+          U32* indexMemory;
+
+          //! The classes
+          Class classes[MAX_SIZE_CLASSES];
+
+          //! The number of classes; zero if the store is not set up
+          U32 numClasses;
+
+          //! The statistics over all classes
+          Stats stats;
+
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -302,6 +441,17 @@ namespace Svc {
           const NATIVE_INT_TYPE instance //!< The instance number
       );
 
+      //! Switch to the size class allocation mode. Buffers then come from
+      //! fixed-size classes, each with its own free list, and may be returned
+      //! in any order. Call this after init() and before any buffer is
+      //! requested. The store size and buffer count given to the constructor
+      //! are not used in this mode, so pass 0 for both.
+      //!
+      void setSizeClasses(
+          const SizeClass *const sizeClasses, //!< The classes, in increasing buffer size
+          const U32 numSizeClasses //!< The number of classes, at most MAX_SIZE_CLASSES
+      );
+
       //! Destroy object BufferManager
       //!
       ~BufferManager(void);
@@ -326,6 +476,28 @@ namespace Svc {
           Fw::Buffer &buffer
       );
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Allocate a buffer in the size class mode
+      //!
+      Fw::Buffer allocateSizeClassBuffer(
+          const U32 size //!< The requested size
+      );
+
+      //! Free a buffer in the size class mode
+      //!
+      void freeSizeClassBuffer(
+          Fw::Buffer &buffer //!< The buffer
+      );
+
+      //! Write the size class telemetry that has changed
+      //!
+      void updateSizeClassTlm(void);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -341,6 +513,16 @@ namespace Svc {
       //! The allocation queue
       AllocationQueue allocationQueue;
 
+      //! The size class store, used when it is set up
+      SizeClassStore sizeClassStore;
+
+      //! The size class telemetry values last written
+      struct SizeClassTlm {
+        U32 highWater;
+        U32 failures;
+        U32 fragmentation;
+      } sizeClassTlm;
+
     };
 
 }
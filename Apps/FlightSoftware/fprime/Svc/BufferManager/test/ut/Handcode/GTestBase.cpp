@@ -163,6 +163,156 @@ namespace Svc {
       << "  Actual:   " << e.arg << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_SizeClassHighWater
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassHighWater_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_SizeClassHighWater->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_SizeClassHighWater\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_SizeClassHighWater->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassHighWater(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_SizeClassHighWater->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_SizeClassHighWater\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_SizeClassHighWater->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_SizeClassHighWater& e =
+      this->tlmHistory_BufferManager_SizeClassHighWater->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_SizeClassHighWater\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_SizeClassFailures
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassFailures_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_SizeClassFailures->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_SizeClassFailures\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_SizeClassFailures->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassFailures(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_SizeClassFailures->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_SizeClassFailures\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_SizeClassFailures->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_SizeClassFailures& e =
+      this->tlmHistory_BufferManager_SizeClassFailures->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_SizeClassFailures\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: BufferManager_SizeClassFragmentation
+  // ----------------------------------------------------------------------
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassFragmentation_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_BufferManager_SizeClassFragmentation->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel BufferManager_SizeClassFragmentation\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_BufferManager_SizeClassFragmentation->size() << "\n";
+  }
+
+  void BufferManagerGTestBase ::
+    assertTlm_BufferManager_SizeClassFragmentation(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 __index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(__index, this->tlmHistory_BufferManager_SizeClassFragmentation->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel BufferManager_SizeClassFragmentation\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_BufferManager_SizeClassFragmentation->size() << ")\n"
+      << "  Actual:   " << __index << "\n";
+    const TlmEntry_BufferManager_SizeClassFragmentation& e =
+      this->tlmHistory_BufferManager_SizeClassFragmentation->at(__index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << __index
+      << " on telmetry channel BufferManager_SizeClassFragmentation\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Events
   // ----------------------------------------------------------------------
@@ -35,6 +35,24 @@
 #define ASSERT_TLM_BufferManager_AllocatedSize(index, value) \
   this->assertTlm_BufferManager_AllocatedSize(__FILE__, __LINE__, index, value)
 
+#define ASSERT_TLM_BufferManager_SizeClassHighWater_SIZE(size) \
+  this->assertTlm_BufferManager_SizeClassHighWater_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_SizeClassHighWater(index, value) \
+  this->assertTlm_BufferManager_SizeClassHighWater(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_SizeClassFailures_SIZE(size) \
+  this->assertTlm_BufferManager_SizeClassFailures_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_SizeClassFailures(index, value) \
+  this->assertTlm_BufferManager_SizeClassFailures(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_BufferManager_SizeClassFragmentation_SIZE(size) \
+  this->assertTlm_BufferManager_SizeClassFragmentation_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_BufferManager_SizeClassFragmentation(index, value) \
+  this->assertTlm_BufferManager_SizeClassFragmentation(__FILE__, __LINE__, index, value)
+
 // ----------------------------------------------------------------------
 // Macros for event history assertions 
 // ----------------------------------------------------------------------
@@ -137,6 +155,69 @@ namespace Svc {
           const U32& val /*!< The channel value*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassHighWater
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_SizeClassHighWater_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_SizeClassHighWater(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassFailures
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_SizeClassFailures_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_SizeClassFailures(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassFragmentation
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_BufferManager_SizeClassFragmentation_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_BufferManager_SizeClassFragmentation(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 __index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
@@ -40,6 +40,12 @@ namespace Svc {
       new History<TlmEntry_BufferManager_NumAllocatedBuffers>(maxHistorySize);
     this->tlmHistory_BufferManager_AllocatedSize = 
       new History<TlmEntry_BufferManager_AllocatedSize>(maxHistorySize);
+    this->tlmHistory_BufferManager_SizeClassHighWater = 
+      new History<TlmEntry_BufferManager_SizeClassHighWater>(maxHistorySize);
+    this->tlmHistory_BufferManager_SizeClassFailures = 
+      new History<TlmEntry_BufferManager_SizeClassFailures>(maxHistorySize);
+    this->tlmHistory_BufferManager_SizeClassFragmentation = 
+      new History<TlmEntry_BufferManager_SizeClassFragmentation>(maxHistorySize);
     // Initialize event histories
 #if FW_ENABLE_TEXT_LOGGING
     this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
@@ -54,6 +60,9 @@ namespace Svc {
     // Destroy telemetry histories
     delete this->tlmHistory_BufferManager_NumAllocatedBuffers;
     delete this->tlmHistory_BufferManager_AllocatedSize;
+    delete this->tlmHistory_BufferManager_SizeClassHighWater;
+    delete this->tlmHistory_BufferManager_SizeClassFailures;
+    delete this->tlmHistory_BufferManager_SizeClassFragmentation;
     // Destroy event histories
 #if FW_ENABLE_TEXT_LOGGING
     delete this->textLogHistory;
@@ -512,6 +521,42 @@ namespace Svc {
         break;
       }
 
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_SIZECLASSHIGHWATER:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_SizeClassHighWater: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_SizeClassHighWater(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_SIZECLASSFAILURES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_SizeClassFailures: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_SizeClassFailures(timeTag, arg);
+        break;
+      }
+
+      case BufferManagerComponentBase::CHANNELID_BUFFERMANAGER_SIZECLASSFRAGMENTATION:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing BufferManager_SizeClassFragmentation: %d\n", _status);
+          return;
+        }
+        this->tlmInput_BufferManager_SizeClassFragmentation(timeTag, arg);
+        break;
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -527,6 +572,9 @@ namespace Svc {
     this->tlmSize = 0;
     this->tlmHistory_BufferManager_NumAllocatedBuffers->clear();
     this->tlmHistory_BufferManager_AllocatedSize->clear();
+    this->tlmHistory_BufferManager_SizeClassHighWater->clear();
+    this->tlmHistory_BufferManager_SizeClassFailures->clear();
+    this->tlmHistory_BufferManager_SizeClassFragmentation->clear();
   }
 
   // ---------------------------------------------------------------------- 
@@ -559,6 +607,51 @@ namespace Svc {
     ++this->tlmSize;
   }
 
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_SizeClassHighWater
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_SizeClassHighWater(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_SizeClassHighWater e = { timeTag, val };
+    this->tlmHistory_BufferManager_SizeClassHighWater->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_SizeClassFailures
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_SizeClassFailures(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_SizeClassFailures e = { timeTag, val };
+    this->tlmHistory_BufferManager_SizeClassFailures->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ---------------------------------------------------------------------- 
+  // Channel: BufferManager_SizeClassFragmentation
+  // ---------------------------------------------------------------------- 
+
+  void BufferManagerTesterBase ::
+    tlmInput_BufferManager_SizeClassFragmentation(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_BufferManager_SizeClassFragmentation e = { timeTag, val };
+    this->tlmHistory_BufferManager_SizeClassFragmentation->push_back(e);
+    ++this->tlmSize;
+  }
+
   // ----------------------------------------------------------------------
   // Event dispatch
   // ----------------------------------------------------------------------
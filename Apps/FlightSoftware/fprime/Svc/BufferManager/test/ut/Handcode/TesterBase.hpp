@@ -475,6 +475,81 @@ namespace Svc {
       History<TlmEntry_BufferManager_AllocatedSize> 
         *tlmHistory_BufferManager_AllocatedSize;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassHighWater
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_SizeClassHighWater
+      //!
+      virtual void tlmInput_BufferManager_SizeClassHighWater(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_SizeClassHighWater
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_SizeClassHighWater;
+
+      //! The history of BufferManager_SizeClassHighWater values
+      //!
+      History<TlmEntry_BufferManager_SizeClassHighWater> 
+        *tlmHistory_BufferManager_SizeClassHighWater;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassFailures
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_SizeClassFailures
+      //!
+      virtual void tlmInput_BufferManager_SizeClassFailures(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_SizeClassFailures
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_SizeClassFailures;
+
+      //! The history of BufferManager_SizeClassFailures values
+      //!
+      History<TlmEntry_BufferManager_SizeClassFailures> 
+        *tlmHistory_BufferManager_SizeClassFailures;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: BufferManager_SizeClassFragmentation
+      // ----------------------------------------------------------------------
+
+      //! Handle channel BufferManager_SizeClassFragmentation
+      //!
+      virtual void tlmInput_BufferManager_SizeClassFragmentation(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel BufferManager_SizeClassFragmentation
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_BufferManager_SizeClassFragmentation;
+
+      //! The history of BufferManager_SizeClassFragmentation values
+      //!
+      History<TlmEntry_BufferManager_SizeClassFragmentation> 
+        *tlmHistory_BufferManager_SizeClassFragmentation;
+
     protected:
 
       // ----------------------------------------------------------------------
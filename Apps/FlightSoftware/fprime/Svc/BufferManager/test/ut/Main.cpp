@@ -9,6 +9,26 @@ TEST(Test, ThreeBufferProblem) {
   tester.three_buffer_problem();
 }
 
+TEST(SizeClass, OutOfOrder) {
+  Svc::Tester tester;
+  tester.size_class_out_of_order();
+}
+
+TEST(SizeClass, Failures) {
+  Svc::Tester tester;
+  tester.size_class_failures();
+}
+
+TEST(SizeClass, Telemetry) {
+  Svc::Tester tester;
+  tester.size_class_telemetry();
+}
+
+TEST(Performance, MixedWorkloadBenchmark) {
+  Svc::Tester tester;
+  tester.mixed_workload_benchmark();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
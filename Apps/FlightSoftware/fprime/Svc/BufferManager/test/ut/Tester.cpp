@@ -11,10 +11,55 @@
 // ====================================================================== 
 
 #include "Tester.hpp"
+#include "Os/IntervalTimer.hpp"
+#include <stdio.h>
+#include <string.h>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
 
+namespace {
+
+  // Size classes for the unit tests
+  const Svc::BufferManager::SizeClass TEST_CLASSES[] = {
+    { 16, 2 },
+    { 64, 2 },
+    { 256, 1 }
+  };
+
+  // A stream of buffer requests in the mixed workload
+  struct Stream {
+    const char* name;
+    U32 size; // Buffer size
+    U32 holdSteps; // Steps until the consumer returns the buffer
+    U32 percent; // Share of the requests
+  };
+
+  // Camera frames held by a slow consumer, file packets, and
+  // telemetry-sized buffers
+  const Stream STREAMS[] = {
+    { "camera", 8192, 40, 10 },
+    { "file", 512, 4, 30 },
+    { "tlm", 64, 1, 60 }
+  };
+
+  enum {
+    NUM_STREAMS = FW_NUM_ARRAY_ELEMENTS(STREAMS),
+    WORKLOAD_STEPS = 200000,
+    MAX_OUTSTANDING = 64
+  };
+
+  // The same memory and buffer count for both modes
+  const Svc::BufferManager::SizeClass WORKLOAD_CLASSES[] = {
+    { 64, 8 },
+    { 512, 8 },
+    { 8192, 6 }
+  };
+  const U32 WORKLOAD_STORE_SIZE = 64*8 + 512*8 + 8192*6;
+  const U32 WORKLOAD_NUM_BUFFERS = 8 + 8 + 6;
+
+}
+
 namespace Svc {
 
   // ----------------------------------------------------------------------
@@ -63,6 +108,199 @@ namespace Svc {
       ASSERT_EQ(0xDEADBEEF,*((U32*)buffer2.getdata()));
   }
 
+  void Tester ::
+    size_class_out_of_order(void)
+  {
+    this->setupSizeClasses();
+
+    // The third small buffer comes from the next class up
+    Fw::Buffer buffer1 = this->invoke_to_bufferGetCallee(0, 10);
+    Fw::Buffer buffer2 = this->invoke_to_bufferGetCallee(0, 10);
+    Fw::Buffer buffer3 = this->invoke_to_bufferGetCallee(0, 10);
+    ASSERT_NE(0U, buffer1.getdata());
+    ASSERT_NE(0U, buffer2.getdata());
+    ASSERT_NE(0U, buffer3.getdata());
+    ASSERT_EQ(10U, buffer3.getsize());
+    *((U32*)buffer1.getdata()) = 0xDEADBEEF;
+
+    // Return the newer buffers while the oldest is held
+    this->invoke_to_bufferSendIn(0, buffer2);
+    this->invoke_to_bufferSendIn(0, buffer3);
+
+    // The freed buffer is reused right away
+    Fw::Buffer buffer4 = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_EQ(buffer2.getdata(), buffer4.getdata());
+    *((U32*)buffer4.getdata()) = 0x0;
+    ASSERT_EQ(0xDEADBEEF, *((U32*)buffer1.getdata()));
+
+    this->invoke_to_bufferSendIn(0, buffer1);
+    this->invoke_to_bufferSendIn(0, buffer4);
+    ASSERT_EVENTS_SIZE(0);
+  }
+
+  void Tester ::
+    size_class_failures(void)
+  {
+    this->setupSizeClasses();
+
+    // Use every buffer
+    Fw::Buffer buffers[5];
+    const U32 sizes[5] = { 16, 16, 64, 64, 256 };
+    for (U32 i = 0; i < 5; ++i) {
+      buffers[i] = this->invoke_to_bufferGetCallee(0, sizes[i]);
+      ASSERT_NE(0U, buffers[i].getdata());
+    }
+
+    // A small request fails in every class that fits. The warning is
+    // issued once.
+    Fw::Buffer buffer = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_EQ(0U, buffer.getdata());
+    buffer = this->invoke_to_bufferGetCallee(0, 8);
+    ASSERT_EQ(0U, buffer.getdata());
+    ASSERT_EVENTS_TooManyBuffers_SIZE(1);
+    ASSERT_TLM_BufferManager_SizeClassFailures_SIZE(2);
+    ASSERT_TLM_BufferManager_SizeClassFailures(1, 2);
+
+    // A request larger than any class also fails
+    buffer = this->invoke_to_bufferGetCallee(0, 257);
+    ASSERT_EQ(0U, buffer.getdata());
+    ASSERT_EVENTS_StoreSizeExceeded_SIZE(1);
+    ASSERT_TLM_BufferManager_SizeClassFailures_SIZE(3);
+    ASSERT_TLM_BufferManager_SizeClassFailures(2, 3);
+
+    // Returning any buffer makes room again
+    this->invoke_to_bufferSendIn(0, buffers[3]);
+    buffer = this->invoke_to_bufferGetCallee(0, 16);
+    ASSERT_EQ(buffers[3].getdata(), buffer.getdata());
+    ASSERT_EVENTS_ClearedErrorState_SIZE(1);
+  }
+
+  void Tester ::
+    size_class_telemetry(void)
+  {
+    this->setupSizeClasses();
+
+    Fw::Buffer buffer1 = this->invoke_to_bufferGetCallee(0, 4);
+    ASSERT_TLM_BufferManager_SizeClassHighWater_SIZE(1);
+    ASSERT_TLM_BufferManager_SizeClassHighWater(0, 1);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation(0, 75);
+
+    Fw::Buffer buffer2 = this->invoke_to_bufferGetCallee(0, 12);
+    ASSERT_TLM_BufferManager_SizeClassHighWater_SIZE(2);
+    ASSERT_TLM_BufferManager_SizeClassHighWater(1, 2);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation(1, 50);
+
+    this->invoke_to_bufferSendIn(0, buffer1);
+    this->invoke_to_bufferSendIn(0, buffer2);
+    ASSERT_TLM_BufferManager_SizeClassHighWater_SIZE(2);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation_SIZE(4);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation(2, 25);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation(3, 0);
+
+    // The channels cover the buffers of all classes
+    Fw::Buffer buffers[3];
+    const U32 sizes[3] = { 16, 16, 40 };
+    for (U32 i = 0; i < 3; ++i) {
+      buffers[i] = this->invoke_to_bufferGetCallee(0, sizes[i]);
+      ASSERT_NE(0U, buffers[i].getdata());
+    }
+    ASSERT_TLM_BufferManager_SizeClassHighWater_SIZE(3);
+    ASSERT_TLM_BufferManager_SizeClassHighWater(2, 3);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation_SIZE(5);
+    ASSERT_TLM_BufferManager_SizeClassFragmentation(4, 25);
+    for (U32 i = 0; i < 3; ++i) {
+      this->invoke_to_bufferSendIn(0, buffers[i]);
+    }
+  }
+
+  void Tester ::
+    mixed_workload_benchmark(void)
+  {
+    BufferManager arena("ArenaManager", WORKLOAD_STORE_SIZE, WORKLOAD_NUM_BUFFERS);
+    arena.init(INSTANCE);
+    this->runMixedWorkload(arena, "arena", true);
+
+    BufferManager sizeClasses("SizeClassManager", 0, 0);
+    sizeClasses.init(INSTANCE);
+    sizeClasses.setSizeClasses(WORKLOAD_CLASSES, FW_NUM_ARRAY_ELEMENTS(WORKLOAD_CLASSES));
+    this->runMixedWorkload(sizeClasses, "size class", false);
+  }
+
+  void Tester ::
+    runMixedWorkload(
+        BufferManager& manager,
+        const char *const mode,
+        const bool fifoRelease
+    )
+  {
+    struct Outstanding {
+      Fw::Buffer buffer;
+      U32 due;
+    } outstanding[MAX_OUTSTANDING];
+    U32 numOutstanding = 0;
+    U32 requests[NUM_STREAMS];
+    U32 failures[NUM_STREAMS];
+    (void) memset(requests, 0, sizeof(requests));
+    (void) memset(failures, 0, sizeof(failures));
+    U32 seed = 1;
+    U32 operations = 0;
+
+    Os::IntervalTimer timer;
+    timer.start();
+    for (U32 step = 0; step < WORKLOAD_STEPS; ++step) {
+      // Consumers return the buffers they are done with. The arena must get
+      // them back in order, so a held buffer holds up all later ones.
+      U32 kept = 0;
+      for (U32 i = 0; i < numOutstanding; ++i) {
+        if (outstanding[i].due <= step && (!fifoRelease || kept == 0)) {
+          manager.get_bufferSendIn_InputPort(0)->invoke(outstanding[i].buffer);
+          ++operations;
+        } else {
+          outstanding[kept++] = outstanding[i];
+        }
+      }
+      numOutstanding = kept;
+
+      // Producers request one buffer per step
+      seed = seed * 1103515245 + 12345;
+      U32 pick = (seed >> 16) % 100;
+      U32 s = 0;
+      while (pick >= STREAMS[s].percent) {
+        pick -= STREAMS[s].percent;
+        ++s;
+      }
+      Fw::Buffer buffer =
+        manager.get_bufferGetCallee_InputPort(0)->invoke(STREAMS[s].size);
+      ++operations;
+      ++requests[s];
+      if (buffer.getdata() == 0) {
+        ++failures[s];
+      } else {
+        ASSERT_LT(numOutstanding, static_cast<U32>(MAX_OUTSTANDING));
+        outstanding[numOutstanding].buffer = buffer;
+        outstanding[numOutstanding].due = step + STREAMS[s].holdSteps;
+        ++numOutstanding;
+      }
+    }
+    timer.stop();
+
+    for (U32 i = 0; i < numOutstanding; ++i) {
+      manager.get_bufferSendIn_InputPort(0)->invoke(outstanding[i].buffer);
+    }
+
+    U32 usec = timer.getDiffUsec();
+    if (usec == 0) {
+      usec = 1;
+    }
+    printf("%-10s: %.0f operations/s, failed requests:", mode,
+        (static_cast<F64>(operations) * 1000000.0) / usec);
+    for (U32 s = 0; s < NUM_STREAMS; ++s) {
+      printf(" %s %.1f%%", STREAMS[s].name,
+          (100.0 * failures[s]) / (requests[s] ? requests[s] : 1));
+    }
+    printf("\n");
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods 
   // ----------------------------------------------------------------------
@@ -118,4 +356,13 @@ namespace Svc {
     );
   }
 
+  void Tester ::
+    setupSizeClasses(void)
+  {
+    this->component.setSizeClasses(
+        TEST_CLASSES,
+        FW_NUM_ARRAY_ELEMENTS(TEST_CLASSES)
+    );
+  }
+
 } // end namespace Svc
@@ -43,6 +43,19 @@ namespace Svc {
       // ---------------------------------------------------------------------- 
 
       void three_buffer_problem(void);
+
+      //! Buffers returned out of order in the size class mode
+      void size_class_out_of_order(void);
+
+      //! Requests the size classes cannot serve
+      void size_class_failures(void);
+
+      //! Size class telemetry
+      void size_class_telemetry(void);
+
+      //! Allocations per second and failure rates for a mixed workload
+      void mixed_workload_benchmark(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -57,6 +70,18 @@ namespace Svc {
       //!
       void initComponents(void);
 
+      //! Set up the size classes used by the tests
+      //!
+      void setupSizeClasses(void);
+
+      //! Run the mixed workload on a buffer manager and print the results
+      //!
+      void runMixedWorkload(
+          BufferManager& manager, //!< The buffer manager
+          const char *const mode, //!< The mode, for printing
+          const bool fifoRelease //!< Whether buffers must be returned in order
+      );
+
     private:
 
       // ----------------------------------------------------------------------
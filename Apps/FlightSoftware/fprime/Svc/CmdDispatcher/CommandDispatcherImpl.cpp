@@ -8,6 +8,7 @@
 #include <Svc/CmdDispatcher/CommandDispatcherImpl.hpp>
 #include <Fw/Cmd/CmdPacket.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Utils/Hash/IdHash.hpp>
 #include <stdio.h>
 
 namespace Svc {
@@ -17,10 +18,18 @@ namespace Svc {
 #else
     CommandDispatcherImpl::CommandDispatcherImpl() :
 #endif
-    m_seq(0), m_numCmdsDispatched(0), m_numCmdErrors(0)
+    m_numEntries(0), m_numPending(0), m_seq(0), m_numCmdsDispatched(0), m_numCmdErrors(0)
     {
+        // lookups mask the hash and sequence number, so sizes must be powers of two
+        COMPILE_TIME_ASSERT((CMD_DISPATCHER_DISPATCH_HASH_SIZE & (CMD_DISPATCHER_DISPATCH_HASH_SIZE - 1)) == 0,CmdDispHashSizePowerOfTwo);
+        COMPILE_TIME_ASSERT(CMD_DISPATCHER_DISPATCH_HASH_SIZE > CMD_DISPATCHER_DISPATCH_TABLE_SIZE,CmdDispHashSizeLargerThanTable);
+        COMPILE_TIME_ASSERT((CMD_DISPATCHER_SEQUENCER_TABLE_SIZE & (CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1)) == 0,CmdDispSeqTableSizePowerOfTwo);
+
         memset(this->m_entryTable,0,sizeof(this->m_entryTable));
         memset(this->m_sequenceTracker,0,sizeof(this->m_sequenceTracker));
+        for (NATIVE_UINT_TYPE slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_opcodeIndex); slot++) {
+            this->m_opcodeIndex[slot] = -1;
+        }
     }
 
     CommandDispatcherImpl::~CommandDispatcherImpl() {
@@ -33,21 +42,39 @@ namespace Svc {
         CommandDispatcherComponentBase::init(queueDepth);
     }
 
-    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
-        // search for an empty slot
-        bool slotFound = false;
-        for (U32 slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); slot++) {
-            if ((not this->m_entryTable[slot].used) and (not slotFound)) {
-                this->m_entryTable[slot].opcode = opCode;
-                this->m_entryTable[slot].port = portNum;
-                this->m_entryTable[slot].used = true;
-                this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
-                slotFound = true;
-            } else if (this->m_entryTable[slot].used) { // make sure no duplicates
-                FW_ASSERT(this->m_entryTable[slot].opcode != opCode, opCode);
+    NATIVE_UINT_TYPE CommandDispatcherImpl::hashOpcode(FwOpcodeType opCode) {
+        return Utils::hashId(static_cast<U32>(opCode)) & (CMD_DISPATCHER_DISPATCH_HASH_SIZE - 1);
+    }
+
+    NATIVE_INT_TYPE CommandDispatcherImpl::findEntry(FwOpcodeType opCode) {
+        NATIVE_UINT_TYPE slot = this->hashOpcode(opCode);
+        // the index is never full, so there is always an empty slot to stop at
+        while (this->m_opcodeIndex[slot] != -1) {
+            NATIVE_INT_TYPE entry = this->m_opcodeIndex[slot];
+            if (this->m_entryTable[entry].opcode == opCode) {
+                return entry;
             }
+            slot = (slot + 1) & (CMD_DISPATCHER_DISPATCH_HASH_SIZE - 1);
         }
-        FW_ASSERT(slotFound,opCode);
+        return -1;
+    }
+
+    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
+        // make sure there is room and no duplicates
+        FW_ASSERT(this->m_numEntries < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable),opCode);
+        FW_ASSERT(this->findEntry(opCode) == -1, opCode);
+        // take the next free entry
+        U32 entry = this->m_numEntries++;
+        this->m_entryTable[entry].opcode = opCode;
+        this->m_entryTable[entry].port = portNum;
+        this->m_entryTable[entry].used = true;
+        // add it to the index at the first empty slot
+        NATIVE_UINT_TYPE slot = this->hashOpcode(opCode);
+        while (this->m_opcodeIndex[slot] != -1) {
+            slot = (slot + 1) & (CMD_DISPATCHER_DISPATCH_HASH_SIZE - 1);
+        }
+        this->m_opcodeIndex[slot] = entry;
+        this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,entry);
     }
 
     void CommandDispatcherImpl::compCmdStat_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode, U32 cmdSeq, Fw::CommandResponse response) {
@@ -83,19 +110,23 @@ namespace Svc {
             }
             this->log_WARNING_HI_OpCodeError(opCode,evrResp);
         }
-        // look for command source
+        // look for command source, starting at the slot for the sequence number
         NATIVE_INT_TYPE portToCall = -1;
         U32 context;
-        for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-            if (
-                    (this->m_sequenceTracker[pending].seq == cmdSeq) &&
-                    (this->m_sequenceTracker[pending].used)
-                ) {
+        NATIVE_UINT_TYPE usedSeen = 0;
+        for (U32 probe = 0; (probe < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker)) and (usedSeen < this->m_numPending); probe++) {
+            U32 pending = (cmdSeq + probe) & (CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1);
+            if (not this->m_sequenceTracker[pending].used) {
+                continue;
+            }
+            usedSeen++;
+            if (this->m_sequenceTracker[pending].seq == cmdSeq) {
                 portToCall = this->m_sequenceTracker[pending].callerPort;
                 context = this->m_sequenceTracker[pending].context;
                 FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
                 FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
                 this->m_sequenceTracker[pending].used = false;
+                this->m_numPending--;
                 break;
             }
         }
@@ -142,22 +173,18 @@ namespace Svc {
             return;
         }
 
-        // search for opcode in dispatch table
-        U32 entry;
-        bool entryFound = false;
+        // look up opcode in dispatch table
+        NATIVE_INT_TYPE entry = this->findEntry(cmdPkt.getOpCode());
+        bool entryFound = (entry != -1);
 
-        for (entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); entry++) {
-            if ((this->m_entryTable[entry].used) and (cmdPkt.getOpCode() == this->m_entryTable[entry].opcode)) {
-                entryFound = true;
-                break;
-            }
-        }
         if (entryFound and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
             // register command in command tracker only if response port is connect
             if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
                 bool pendingFound = false;
 
-                for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
+                // start at the slot for the sequence number and take the first free one
+                for (U32 probe = 0; (probe < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker)) and (this->m_numPending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker)); probe++) {
+                    U32 pending = (static_cast<U32>(this->m_seq) + probe) & (CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1);
                     if (not this->m_sequenceTracker[pending].used) {
                         pendingFound = true;
                         this->m_sequenceTracker[pending].used = true;
@@ -165,6 +192,7 @@ namespace Svc {
                         this->m_sequenceTracker[pending].seq = this->m_seq;
                         this->m_sequenceTracker[pending].context = context;
                         this->m_sequenceTracker[pending].callerPort = portNum;
+                        this->m_numPending++;
                         break;
                     }
                 }
@@ -225,6 +253,7 @@ namespace Svc {
         for (NATIVE_INT_TYPE entry = 0; entry < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; entry++) {
             this->m_sequenceTracker[entry].used = false;
         }
+        this->m_numPending = 0;
         this->cmdResponse_out(opCode,cmdSeq,Fw::COMMAND_OK);
     }
 
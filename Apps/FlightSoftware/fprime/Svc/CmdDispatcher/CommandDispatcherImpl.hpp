@@ -133,16 +133,28 @@ namespace Svc {
             //!  \param cmdSeq the assigned sequence number for the command
             void CMD_CLEAR_TRACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
 
+            //!  \brief Find the dispatch table entry of an opcode
+            //!
+            //!  \param opCode the opcode to look up
+            //!  \return the index in m_entryTable, or -1 if the opcode is not registered
+            NATIVE_INT_TYPE findEntry(FwOpcodeType opCode);
+
+            //!  \brief Compute the starting slot of an opcode in the lookup index
+            //!
+            //!  \param opCode the opcode to hash
+            //!  \return the slot in m_opcodeIndex to start probing from
+            NATIVE_UINT_TYPE hashOpcode(FwOpcodeType opCode);
+
             //! \struct DispatchEntry
             //! \brief table used to store opcode to port mappings
             //!
             //! The DispatchEntry table is used to map incoming opcodes to the port
             //! connected to the component that implements the opcode.
-            //! As each command opcode is registered, a new entry is found
-            //! in the table by checking for the "used" flag. The opcode
-            //! member is set to the opcode, and the port member set to the
-            //! port to dispatch to. When a new opcode is received for
-            //! execution, the table is traversed until the opcode is located.
+            //! As each command opcode is registered, it is placed in the next
+            //! free entry of the table. The opcode member is set to the opcode,
+            //! and the port member set to the port to dispatch to. The entry
+            //! is also added to m_opcodeIndex so that an incoming opcode is
+            //! located without traversing the table.
 
             struct DispatchEntry {
                     bool used; //!< if entry has been used yet
@@ -150,18 +162,28 @@ namespace Svc {
                     NATIVE_INT_TYPE port; //!< which port the entry invokes
             } m_entryTable[CMD_DISPATCHER_DISPATCH_TABLE_SIZE]; //!< table of dispatch entries
 
+            NATIVE_UINT_TYPE m_numEntries; //!< number of entries used in m_entryTable
+
+            //! Open-addressed index of m_entryTable by opcode. Each slot holds
+            //! an index into m_entryTable, or -1 if it is empty. An opcode is
+            //! hashed to a starting slot and the following slots are probed
+            //! until the opcode or an empty slot is found.
+            NATIVE_INT_TYPE m_opcodeIndex[CMD_DISPATCHER_DISPATCH_HASH_SIZE];
+
             //! \struct SequenceTracker
             //! \brief table used to store opcode that are being executed
             //!
             //! The SequenceTracker table is used to track commands that are being executed
             //! but are not yet complete. When a new command opcode is received,
             //! the status port that would be used to report the completion status
-            //! is checked. If it is connected, then an entry is placed in this table.
+            //! is checked. If it is connected, then an entry is placed in this table,
+            //! starting at the slot given by the sequence number modulo the table size.
             //! The "used" flag is set, and the "seq" member is set to the the
             //! assigned sequence number for the command. The "opCode" field is
             //! used for the opcode, and the "callerPort" field is used to store
             //! the port number of the caller so the status can be reported back to
-            //! correct port.
+            //! correct port. Since sequence numbers are assigned in order, a
+            //! completion almost always finds its entry in the first slot checked.
 
             struct SequenceTracker {
                     bool used; //!< if this slot is used
@@ -171,6 +193,8 @@ namespace Svc {
                     NATIVE_INT_TYPE callerPort; //!< port command source port
             } m_sequenceTracker[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< sequence tracking port for command completions;
 
+            NATIVE_UINT_TYPE m_numPending; //!< number of used entries in m_sequenceTracker
+
             I32 m_seq; //!< current command sequence number
 
             U32 m_numCmdsDispatched; //!< number of commands dispatched
@@ -10,11 +10,25 @@
 
 // Define configuration values for dispatcher
 
-enum {
-    CMD_DISPATCHER_DISPATCH_TABLE_SIZE = 6, // !< The size of the table holding opcodes to dispatch
-    CMD_DISPATCHER_SEQUENCER_TABLE_SIZE = 5, // !< The size of the table holding commands in progress
-};
+// The size of the table holding opcodes to dispatch. It must hold every
+// opcode in the topology; the generated topology code checks this against
+// the command dictionary at compile time. The default holds the largest
+// in-tree deployment, Ref, with 59 opcodes.
+#ifndef CMD_DISPATCHER_DISPATCH_TABLE_SIZE
+#define CMD_DISPATCHER_DISPATCH_TABLE_SIZE 96
+#endif
 
+// The number of slots in the opcode lookup index. Must be a power of two
+// and larger than CMD_DISPATCHER_DISPATCH_TABLE_SIZE; a load of one half
+// or less keeps lookups to one or two probes.
+#ifndef CMD_DISPATCHER_DISPATCH_HASH_SIZE
+#define CMD_DISPATCHER_DISPATCH_HASH_SIZE 256
+#endif
 
+// The size of the table holding commands in progress. Must be a power of
+// two, since commands are placed by sequence number modulo the size.
+#ifndef CMD_DISPATCHER_SEQUENCER_TABLE_SIZE
+#define CMD_DISPATCHER_SEQUENCER_TABLE_SIZE 8
+#endif
 
 #endif /* CMDDISPATCHER_COMMANDDISPATCHERIMPLCFG_HPP_ */
@@ -430,6 +430,7 @@ namespace Svc {
         ASSERT_EVENTS_OpCodeRegistered_SIZE(1);
         ASSERT_EVENTS_OpCodeRegistered(0,(U32)testOpCode,0,4);
 
+        // commands are tracked in the slot for their sequence number
         U32 currSeq = 0;
 
         // dispatch a test command
@@ -450,11 +451,11 @@ namespace Svc {
         ASSERT_EVENTS_OpCodeDispatched(0,(U32)testOpCode,0);
 
         // verify sequence table entry
-        ASSERT_TRUE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].context,testContext);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_TRUE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].context,testContext);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
 
         // verify command received
         ASSERT_TRUE(this->m_cmdSendRcvd);
@@ -472,10 +473,10 @@ namespace Svc {
         ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
 
         // Check dispatch table
-        ASSERT_FALSE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_FALSE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
 
         // Verify completed event
         ASSERT_EVENTS_SIZE(1);
@@ -504,11 +505,11 @@ namespace Svc {
         ASSERT_EVENTS_OpCodeDispatched(0,(U32)testOpCode,0);
 
         // verify sequence table entry
-        ASSERT_TRUE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].context,testContext);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_TRUE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].context,testContext);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
 
         // verify command received
         ASSERT_TRUE(this->m_cmdSendRcvd);
@@ -525,10 +526,10 @@ namespace Svc {
         ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
 
         // Check dispatch table
-        ASSERT_FALSE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_FALSE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
 
         // Verify completed event
         ASSERT_EVENTS_SIZE(1);
@@ -558,11 +559,11 @@ namespace Svc {
         ASSERT_EVENTS_OpCodeDispatched(0,(U32)testOpCode,0);
 
         // verify sequence table entry
-        ASSERT_TRUE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].context,testContext);
+        ASSERT_TRUE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].context,testContext);
 
         // verify command received
         ASSERT_TRUE(this->m_cmdSendRcvd);
@@ -579,10 +580,10 @@ namespace Svc {
         ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
 
         // Check dispatch table
-        ASSERT_FALSE(this->m_impl.m_sequenceTracker[0].used);
-        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[0].seq);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].opCode,testOpCode);
-        ASSERT_EQ(this->m_impl.m_sequenceTracker[0].callerPort,(NATIVE_INT_TYPE)0);
+        ASSERT_FALSE(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].used);
+        ASSERT_EQ(currSeq,this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].seq);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].opCode,testOpCode);
+        ASSERT_EQ(this->m_impl.m_sequenceTracker[currSeq % CMD_DISPATCHER_SEQUENCER_TABLE_SIZE].callerPort,(NATIVE_INT_TYPE)0);
 
         // Verify completed event
         ASSERT_EVENTS_SIZE(1);
@@ -848,6 +849,59 @@ namespace Svc {
 
     }
 
+    void CommandDispatcherImplTester::runDispatchBenchmark(NATIVE_UINT_TYPE numOpcodes) {
+
+        static const NATIVE_UINT_TYPE CYCLES = 100;
+        // opcodes per simulated component
+        static const NATIVE_UINT_TYPE OPS_PER_COMP = 8;
+
+        if (numOpcodes > CMD_DISPATCHER_DISPATCH_TABLE_SIZE) {
+            printf("%4u opcodes: skipped, needs CMD_DISPATCHER_DISPATCH_TABLE_SIZE >= %u\n",numOpcodes,numOpcodes);
+            return;
+        }
+
+        // register opcodes the way a topology would: a few per component, offset by component base ID
+        for (NATIVE_UINT_TYPE n = 0; n < numOpcodes; n++) {
+            FwOpcodeType opCode = (n / OPS_PER_COMP + 1) * 0x100 + (n % OPS_PER_COMP);
+            this->invoke_to_compCmdReg(0,opCode);
+        }
+        ASSERT_EQ(numOpcodes,this->m_impl.m_numEntries);
+
+        Os::IntervalTimer timer;
+        U32 totalUsec = 0;
+
+        for (NATIVE_UINT_TYPE cycle = 0; cycle < CYCLES; cycle++) {
+            // dispatch and complete every opcode once per cycle
+            timer.start();
+            for (NATIVE_UINT_TYPE n = 0; n < numOpcodes; n++) {
+                FwOpcodeType opCode = (n / OPS_PER_COMP + 1) * 0x100 + (n % OPS_PER_COMP);
+                Fw::ComBuffer buff;
+                ASSERT_EQ(buff.serialize(FwPacketDescriptorType(Fw::ComPacket::FW_PACKET_COMMAND)),Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(buff.serialize(opCode),Fw::FW_SERIALIZE_OK);
+
+                this->m_cmdSendRcvd = false;
+                this->invoke_to_seqCmdBuff(0,buff,n);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_TRUE(this->m_cmdSendRcvd);
+                ASSERT_EQ(opCode,this->m_cmdSendOpCode);
+
+                // complete the command so the tracker entry is released
+                this->m_seqStatusRcvd = false;
+                this->invoke_to_compCmdStat(0,opCode,this->m_cmdSendCmdSeq,Fw::COMMAND_OK);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_TRUE(this->m_seqStatusRcvd);
+                ASSERT_EQ(n,this->m_seqStatusCmdSeq);
+            }
+            timer.stop();
+            totalUsec += timer.getDiffUsec();
+            ASSERT_EQ(0u,this->m_impl.m_numPending);
+            this->clearHistory();
+        }
+
+        printf("%4u opcodes: %6.3f us per command dispatched and completed\n",
+                numOpcodes,static_cast<F64>(totalUsec)/(CYCLES*numOpcodes));
+    }
+
     void CommandDispatcherImplTester::from_pingOut_handler(
               const NATIVE_INT_TYPE portNum, /*!< The port number*/
               U32 key /*!< Value to return to pinger*/
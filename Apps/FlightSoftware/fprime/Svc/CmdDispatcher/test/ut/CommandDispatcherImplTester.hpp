@@ -27,6 +27,7 @@ namespace Svc {
             void runOverflowCommands(void);
             void runNopCommands(void);
             void runClearCommandTracking();
+            void runDispatchBenchmark(NATIVE_UINT_TYPE numOpcodes);
 
         private:
             Svc::CommandDispatcherImpl& m_impl;
@@ -183,6 +183,35 @@ TEST(CmdDispTestOffNominal,ClearSequenceTracker) {
 
 }
 
+TEST(CmdDispTestNominal,DispatchBenchmark) {
+
+    COMMENT("Time command dispatch with a large number of registered opcodes.");
+
+    const NATIVE_UINT_TYPE numOpcodes[] = {16,96,512};
+
+    for (NATIVE_UINT_TYPE size = 0; size < FW_NUM_ARRAY_ELEMENTS(numOpcodes); size++) {
+
+        // large table sizes don't fit on the stack
+        Svc::CommandDispatcherImpl* impl = new Svc::CommandDispatcherImpl("CmdDispImpl");
+
+        impl->init(10,0);
+
+        Svc::CommandDispatcherImplTester* tester = new Svc::CommandDispatcherImplTester(*impl);
+
+        tester->init();
+
+        // connect ports
+        connectPorts(*impl,*tester);
+
+        // run test
+        tester->runDispatchBenchmark(numOpcodes[size]);
+
+        delete tester;
+        delete impl;
+    }
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
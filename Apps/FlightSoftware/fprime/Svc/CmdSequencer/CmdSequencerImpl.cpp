@@ -43,7 +43,15 @@ namespace Svc {
         m_executedCount(0),
         m_totalExecutedCount(0),
         m_sequencesCompletedCount(0),
-        m_timeout(0)
+        m_timeout(0),
+        m_recordState(RECORD_NONE),
+        m_pipelineDepth(1),
+        m_inFlight(0),
+        m_owedResponses(0),
+        m_tickBudget(0),
+        m_tickCount(0),
+        m_rateSeconds(0),
+        m_rateCount(0)
     {
 
     }
@@ -57,6 +65,15 @@ namespace Svc {
         this->m_timeout = timeout;
     }
 
+    void CmdSequencerComponentImpl::setPipelineDepth(NATIVE_UINT_TYPE depth) {
+        FW_ASSERT(depth > 0);
+        this->m_pipelineDepth = depth;
+    }
+
+    void CmdSequencerComponentImpl::setTickBudget(NATIVE_UINT_TYPE commands) {
+        this->m_tickBudget = commands;
+    }
+
     void CmdSequencerComponentImpl ::
       setSequenceFormat(Sequence& sequence)
     {
@@ -117,6 +134,8 @@ namespace Svc {
         // Check the step mode. If it is auto, start the sequence
         if (AUTO == this->m_stepMode) {
             this->m_runMode = RUNNING;
+            this->m_owedResponses = 0;
+            this->startCommandRate(this->getTime());
             this->performCmd_Step();
         }
 
@@ -183,6 +202,8 @@ namespace Svc {
         // Check the step mode. If it is auto, start the sequence
         if (AUTO == this->m_stepMode) {
             this->m_runMode = RUNNING;
+            this->m_owedResponses = 0;
+            this->startCommandRate(this->getTime());
             this->performCmd_Step();
         }
 
@@ -229,6 +250,10 @@ namespace Svc {
         this->m_runMode = STOPPED;
         this->m_cmdTimer.clear();
         this->m_cmdTimeoutTimer.clear();
+        this->m_recordState = RECORD_NONE;
+        // the commands still in flight respond after the sequence stops
+        this->m_owedResponses = this->m_inFlight;
+        this->m_inFlight = 0;
         this->m_executedCount = 0;
         // write sequence done port with error, if connected
         if (this->isConnected_seqDone_OutputPort(0)) {
@@ -246,23 +271,41 @@ namespace Svc {
       )
     {
         if (this->m_runMode == STOPPED) {
-            // Sequencer is not running
-            this->log_WARNING_HI_CS_UnexpectedCompletion(opcode);
+            if (this->m_owedResponses > 0) {
+                // A command sent before the sequence was canceled
+                --this->m_owedResponses;
+            } else {
+                // Sequencer is not running
+                this->log_WARNING_HI_CS_UnexpectedCompletion(opcode);
+            }
         } else {
-            // clear command timeout
+            if (this->m_inFlight > 0) {
+                --this->m_inFlight;
+            }
+            // clear command timeout, or restart it for the commands still in flight
             this->m_cmdTimeoutTimer.clear();
+            if (this->m_inFlight > 0) {
+                this->setCmdTimeout(this->getTime());
+            }
             if (response != Fw::COMMAND_OK) {
                 this->commandError(this->m_executedCount, opcode, response);
                 this->performCmd_Cancel();
             } else if (this->m_runMode == RUNNING && this->m_stepMode == AUTO) {
-                // Auto mode
+                // Auto mode. A timed record goes out from schedIn.
                 this->commandComplete(opcode);
-                if (not this->m_sequence->hasMoreRecords()) {
-                    // No data left
-                    this->m_runMode = STOPPED;
-                    this->sequenceComplete();
-                } else {
-                    this->performCmd_Step();
+                if (this->m_recordState == RECORD_BLOCKED) {
+                    if (this->m_inFlight == 0) {
+                        this->issueRecord();
+                        this->fillPipeline();
+                    }
+                } else if (this->m_recordState == RECORD_NONE) {
+                    if (this->m_sequence->hasMoreRecords()) {
+                        this->fillPipeline();
+                    } else if (this->m_inFlight == 0) {
+                        // No data left
+                        this->m_runMode = STOPPED;
+                        this->sequenceComplete();
+                    }
                 }
             } else { 
                 // Manual step mode
@@ -280,12 +323,15 @@ namespace Svc {
     {
 
         Fw::Time currTime = this->getTime();
+        // start a new command budget
+        this->m_tickCount = 0;
+        this->updateCommandRate(currTime);
         // check to see if a command time is pending
         if (this->m_cmdTimer.isExpiredAt(currTime)) {
-            this->comCmdOut_out(0, m_record.m_command, 0);
             this->m_cmdTimer.clear();
-            // start command timeout timer
-            this->setCmdTimeout(currTime);
+            this->m_recordState = RECORD_NONE;
+            this->dispatchRecord(currTime);
+            this->fillPipeline();
         } else if (this->m_cmdTimeoutTimer.isExpiredAt(this->getTime())) { // check for command timeout
             this->log_WARNING_HI_CS_SequenceTimeout(
                 m_sequence->getLogFileName(),
@@ -310,6 +356,8 @@ namespace Svc {
             return;
         }
         this->m_runMode = RUNNING;
+        this->m_owedResponses = 0;
+        this->startCommandRate(this->getTime());
         this->performCmd_Step();
         this->log_ACTIVITY_HI_CS_CmdStarted(this->m_sequence->getLogFileName());
         this->cmdResponse_out(opcode, cmdSeq, Fw::COMMAND_OK);
@@ -387,23 +435,62 @@ namespace Svc {
     }
 
     void CmdSequencerComponentImpl::performCmd_Step(void) {
+        this->stepRecord();
+        this->fillPipeline();
+    }
 
-        this->m_sequence->nextRecord(m_record);
+    void CmdSequencerComponentImpl::stepRecord(void) {
+
+        if (not this->m_sequence->nextRecord(m_record)) {
+            // the sequence could not be read. The sequence reported why.
+            this->error();
+            this->performCmd_Cancel();
+            return;
+        }
         // set clock time base and context from value set when sequence was loaded
         const Sequence::Header& header = this->m_sequence->getHeader();
         this->m_record.m_timeTag.setTimeBase(header.m_timeBase);
         this->m_record.m_timeTag.setTimeContext(header.m_timeContext);
 
+        this->issueRecord();
+    }
+
+    void CmdSequencerComponentImpl::issueRecord(void) {
+
+        // in auto mode, only records that are due go out ahead of the
+        // responses to earlier commands. Others wait until the commands
+        // in flight have completed.
+        const bool blocked = (this->m_stepMode == AUTO) and (this->m_inFlight > 0);
+
         Fw::Time currentTime = this->getTime();
         switch (this->m_record.m_descriptor) {
           case Sequence::Record::END_OF_SEQUENCE:
+                if (blocked) {
+                    this->m_recordState = RECORD_BLOCKED;
+                    break;
+                }
+                this->m_recordState = RECORD_NONE;
                 this->m_runMode = STOPPED;
                 this->sequenceComplete();
                 break;
           case Sequence::Record::RELATIVE:
+                // a nonzero delay counts from the completion of the previous command
+                if (
+                    blocked and (
+                      this->m_record.m_timeTag.getSeconds() != 0 or
+                      this->m_record.m_timeTag.getUSeconds() != 0
+                    )
+                ) {
+                    this->m_recordState = RECORD_BLOCKED;
+                    break;
+                }
                 this->performCmd_Step_RELATIVE(currentTime);
                 break;
           case Sequence::Record::ABSOLUTE:
+                if (blocked and not (currentTime >= this->m_record.m_timeTag)) {
+                    this->m_recordState = RECORD_BLOCKED;
+                    break;
+                }
                 this->performCmd_Step_ABSOLUTE(currentTime);
                 break;
           default:
@@ -418,6 +505,7 @@ namespace Svc {
         this->log_ACTIVITY_HI_CS_SequenceComplete(this->m_sequence->getLogFileName());
         this->tlmWrite_CS_SequencesCompleted(this->m_sequencesCompletedCount);
         this->m_executedCount = 0;
+        this->m_inFlight = 0;
         // write sequence done port, if connected
         if (this->isConnected_seqDone_OutputPort(0)) {
             this->seqDone_out(0,0,0,Fw::COMMAND_OK);
@@ -432,6 +520,7 @@ namespace Svc {
         );
         ++this->m_executedCount;
         ++this->m_totalExecutedCount;
+        ++this->m_rateCount;
         this->tlmWrite_CS_CommandsExecuted(this->m_totalExecutedCount);
     }
 
@@ -445,14 +534,40 @@ namespace Svc {
     void CmdSequencerComponentImpl ::
       performCmd_Step_ABSOLUTE(Fw::Time& currentTime)
     {
-        if (currentTime >= this->m_record.m_timeTag) {
-            this->comCmdOut_out(0, m_record.m_command, 0);
-            this->setCmdTimeout(currentTime);
+        const bool inBudget =
+            (this->m_tickBudget == 0) or (this->m_tickCount < this->m_tickBudget);
+        if (currentTime >= this->m_record.m_timeTag and inBudget) {
+            this->m_recordState = RECORD_NONE;
+            this->dispatchRecord(currentTime);
         } else {
+            // a due record over the budget goes out on the next schedIn call
+            this->m_recordState = RECORD_TIMED;
             this->m_cmdTimer.set(this->m_record.m_timeTag);
         }
     }
 
+    void CmdSequencerComponentImpl ::
+      dispatchRecord(const Fw::Time& currentTime)
+    {
+        this->comCmdOut_out(0, m_record.m_command, 0);
+        ++this->m_inFlight;
+        ++this->m_tickCount;
+        // start command timeout timer
+        this->setCmdTimeout(currentTime);
+    }
+
+    void CmdSequencerComponentImpl::fillPipeline(void) {
+        while (
+            (this->m_runMode == RUNNING) and
+            (this->m_stepMode == AUTO) and
+            (this->m_recordState == RECORD_NONE) and
+            (this->m_inFlight < this->m_pipelineDepth) and
+            this->m_sequence->hasMoreRecords()
+        ) {
+            this->stepRecord();
+        }
+    }
+
     void CmdSequencerComponentImpl ::
       pingIn_handler(
           NATIVE_INT_TYPE portNum, /*!< The port number*/
@@ -474,5 +589,32 @@ namespace Svc {
         }
     }
 
+    void CmdSequencerComponentImpl ::
+      startCommandRate(const Fw::Time &currentTime)
+    {
+        this->m_rateSeconds = currentTime.getSeconds();
+        this->m_rateCount = 0;
+    }
+
+    void CmdSequencerComponentImpl ::
+      updateCommandRate(const Fw::Time &currentTime)
+    {
+        const U32 seconds = currentTime.getSeconds();
+        if (seconds == this->m_rateSeconds) {
+            return;
+        }
+        // report while a sequence runs, and once after it stops
+        if (
+            (seconds > this->m_rateSeconds) and
+            (this->m_runMode == RUNNING or this->m_rateCount > 0)
+        ) {
+            this->tlmWrite_CS_CommandRate(
+                this->m_rateCount / (seconds - this->m_rateSeconds)
+            );
+        }
+        this->m_rateSeconds = seconds;
+        this->m_rateCount = 0;
+    }
+
 }
 
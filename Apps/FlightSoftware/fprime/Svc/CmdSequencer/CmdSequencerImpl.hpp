@@ -41,6 +41,13 @@ namespace Svc {
         AUTO, MANUAL
       };
 
+      //! The state of the current record
+      enum RecordState {
+        RECORD_NONE, //!< No record waiting to go out
+        RECORD_TIMED, //!< Record waiting for the command timer
+        RECORD_BLOCKED //!< Record waiting for the commands in flight
+      };
+
     public:
 
       // ----------------------------------------------------------------------
@@ -247,7 +254,7 @@ namespace Svc {
           );
 
           //! Deallocate the buffer
-          void deallocateBuffer(
+          virtual void deallocateBuffer(
               Fw::MemAllocator& allocator //!< The allocator
           );
 
@@ -275,9 +282,10 @@ namespace Svc {
           //! \return Yes or no
           virtual bool hasMoreRecords(void) const = 0;
 
-          //! Get the next record in the sequence
-          //! Asserts on failure
-          virtual void nextRecord(
+          //! Get the next record in the sequence.
+          //! On failure the sequence is cleared.
+          //! \return Success or failure
+          virtual bool nextRecord(
               Record& record //!< The returned record
           ) = 0;
 
@@ -324,7 +332,15 @@ namespace Svc {
         PRIVATE:
 
           enum Constants {
-            INITIAL_COMPUTED_VALUE = 0xFFFFFFFFU
+            INITIAL_COMPUTED_VALUE = 0xFFFFFFFFU,
+            //! Serialized size of the largest record
+            MAX_RECORD_SIZE =
+              sizeof(U8) +
+              sizeof(U32) +
+              sizeof(U32) +
+              sizeof(U32) +
+              Fw::ComBuffer::SERIALIZED_SIZE -
+              sizeof(FwPacketDescriptorType)
           };
 
         public:
@@ -356,6 +372,83 @@ namespace Svc {
 
           };
 
+          //! \class CacheKey
+          //! \brief Identifies the contents of a sequence file
+          struct CacheKey {
+
+            //! Construct a CacheKey
+            CacheKey(void);
+
+            //! Read the key of a sequence file
+            //! \return Whether the file size and time could be read
+            bool read(
+                const Fw::CmdStringArg& fileName //!< The file name
+            );
+
+            //! Query whether this key is valid and equal to another
+            //! \return Yes or no
+            bool matches(
+                const CacheKey& key //!< The other key
+            ) const;
+
+            //! Whether the key is valid
+            bool m_valid;
+
+            //! The file name
+            Fw::CmdStringArg m_fileName;
+
+            //! The file size
+            U64 m_fileSize;
+
+            //! The modification time, seconds
+            U32 m_modSeconds;
+
+            //! The modification time, microseconds
+            U32 m_modUSeconds;
+
+          };
+
+          //! \class Cache
+          //! \brief The last sequence loaded and validated. Its records
+          //! stay in the buffer until another sequence is loaded.
+          struct Cache {
+
+            //! Construct a Cache
+            Cache(void);
+
+            //! Whether the cache holds a sequence
+            bool m_valid;
+
+            //! The key of the sequence file
+            CacheKey m_key;
+
+            //! The sequence header, before time validation
+            Header m_header;
+
+          };
+
+          //! \class Stream
+          //! \brief State of a sequence larger than the buffer. The records
+          //! are read from the file in chunks as the sequence runs.
+          struct Stream {
+
+            //! Construct a Stream
+            Stream(void);
+
+            //! Whether the sequence is streamed
+            bool m_enabled;
+
+            //! The size of the record data in the file
+            U32 m_dataSize;
+
+            //! The record data read into the buffer so far
+            U32 m_dataRead;
+
+            //! The number of records read so far
+            U32 m_recordNumber;
+
+          };
+
         public:
 
           //! Construct an FPrimeSequence
@@ -376,8 +469,9 @@ namespace Svc {
           bool hasMoreRecords(void) const;
 
           //! Get the next record in the sequence.
-          //! Asserts on failure
-          void nextRecord(
+          //! Fails if a streamed sequence can no longer be read.
+          //! \return Success or failure
+          bool nextRecord(
               Record& record //!< The returned record
           );
 
@@ -390,8 +484,17 @@ namespace Svc {
           //! After calling this, hasMoreRecords should return false.
           void clear(void);
 
+          //! Deallocate the buffer. Also empties the cache.
+          void deallocateBuffer(
+              Fw::MemAllocator& allocator //!< The allocator
+          );
+
         PRIVATE:
 
+          //! Load the records of the cached sequence
+          //! \return Success or failure
+          bool loadCachedRecords(void);
+
           //! Read a sequence file
           //! \return Success or failure
           bool readFile(void);
@@ -417,6 +520,32 @@ namespace Svc {
           //! \return Success or failure
           bool extractCRC(void);
 
+          //! Compute the CRC of streamed record data one buffer at a
+          //! time, then read the stored CRC
+          //! \return Success or failure
+          bool readStreamedCRC(void);
+
+          //! Read record data from the sequence file
+          //! \return Success or failure
+          bool readData(
+              U8 *const data, //!< The destination
+              const NATIVE_INT_TYPE size //!< The number of bytes to read
+          );
+
+          //! Open the sequence file for streaming, if the sequence is
+          //! streamed
+          //! \return Success or failure
+          bool openStream(void);
+
+          //! Move a streamed sequence back to the first record
+          //! \return Success or failure
+          bool rewindStream(void);
+
+          //! Read more record data into the buffer, if less than a
+          //! record is left in it
+          //! \return Success or failure
+          bool fillStream(void);
+
           //! Validate the CRC
           //! \return Success or failure
           bool validateCRC(void);
@@ -456,6 +585,10 @@ namespace Svc {
           //! \return Success or failure
           bool validateRecords(void);
 
+          //! Validate the records of a streamed sequence
+          //! \return Success or failure
+          bool validateStreamedRecords(void);
+
         PRIVATE:
 
           //! The CRC values
@@ -464,6 +597,15 @@ namespace Svc {
           //! The sequence file
           Os::File m_sequenceFile;
 
+          //! The key of the file being loaded
+          CacheKey m_fileKey;
+
+          //! The validated sequence cache
+          Cache m_cache;
+
+          //! The streaming state
+          Stream m_stream;
+
       };
 
     PRIVATE:
@@ -559,6 +701,21 @@ namespace Svc {
           NATIVE_UINT_TYPE seconds //!< The number of seconds
       );
 
+      //! (Optional) Set the number of commands in flight.
+      //! In auto mode, records that are due go out without waiting for
+      //! the responses to earlier commands, until this many commands are
+      //! awaiting a response. The default of one waits for each response.
+      void setPipelineDepth(
+          NATIVE_UINT_TYPE depth //!< The number of commands
+      );
+
+      //! (Optional) Set the number of commands sent per schedIn call.
+      //! A due record beyond the budget goes out on the next schedIn call.
+      //! The default of zero means no limit.
+      void setTickBudget(
+          NATIVE_UINT_TYPE commands //!< The number of commands
+      );
+
       //! (Optional) Set the sequence format.
       //! CmdSequencer will use the sequence object you pass in 
       //! to load and run sequences. By default, it uses an FPrimeSequence
@@ -697,6 +854,21 @@ namespace Svc {
       //! Perform a Step command
       void performCmd_Step(void);
 
+      //! Read the next record and issue it
+      void stepRecord(void);
+
+      //! Send the current record, or set it waiting
+      void issueRecord(void);
+
+      //! In auto mode, keep stepping while records go out at once
+      //! and there is room in the pipeline
+      void fillPipeline(void);
+
+      //! Send the current record
+      void dispatchRecord(
+          const Fw::Time& currentTime //!< The current time
+      );
+
       //! Perform a Step command with a relative time
       void performCmd_Step_RELATIVE(
           Fw::Time& currentTime //!< The time
@@ -736,6 +908,16 @@ namespace Svc {
           const Fw::Time &currentTime //!< The current time
       );
 
+      //! Start the command rate window for a new sequence
+      void startCommandRate(
+          const Fw::Time &currentTime //!< The current time
+      );
+
+      //! Report the command rate once per second
+      void updateCommandRate(
+          const Fw::Time &currentTime //!< The current time
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -784,6 +966,31 @@ namespace Svc {
       //! timeout timer
       Timer m_cmdTimeoutTimer;
 
+      //! The state of m_record
+      RecordState m_recordState;
+
+      //! The maximum number of commands in flight
+      NATIVE_UINT_TYPE m_pipelineDepth;
+
+      //! The number of commands sent and awaiting a response
+      NATIVE_UINT_TYPE m_inFlight;
+
+      //! The number of responses still owed by commands in flight when
+      //! the sequence was canceled
+      NATIVE_UINT_TYPE m_owedResponses;
+
+      //! The maximum number of commands sent per schedIn call, zero for no limit
+      NATIVE_UINT_TYPE m_tickBudget;
+
+      //! The number of commands sent since the last schedIn call
+      NATIVE_UINT_TYPE m_tickCount;
+
+      //! The second of the current command rate window
+      U32 m_rateSeconds;
+
+      //! The number of commands completed in the current rate window
+      U32 m_rateCount;
+
   };
 
 };
@@ -10,11 +10,12 @@
 // 
 // ====================================================================== 
 
+#include <string.h>
+
 #include "Fw/Types/Assert.hpp"
+#include "Os/FileSystem.hpp"
 #include "Svc/CmdSequencer/CmdSequencerImpl.hpp"
-extern "C" {
-#include "Utils/Hash/libcrc/lib_crc.h"
-}
+#include "Utils/Hash/crc32/CRC32Engine.hpp"
 
 namespace Svc {
 
@@ -36,9 +37,11 @@ namespace Svc {
     update(const BYTE* buffer, NATIVE_UINT_TYPE bufferSize) 
   {
     FW_ASSERT(buffer);
-    for(NATIVE_UINT_TYPE index = 0; index < bufferSize; index++) {
-      this->m_computed = update_crc_32(this->m_computed, buffer[index]);
-    }
+    this->m_computed = Utils::CRC32Engine::update(
+        this->m_computed,
+        buffer,
+        bufferSize
+    );
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence::CRC ::
@@ -47,6 +50,59 @@ namespace Svc {
     this->m_computed = ~this->m_computed;
   }
 
+  CmdSequencerComponentImpl::FPrimeSequence::CacheKey ::
+    CacheKey(void) :
+      m_valid(false),
+      m_fileSize(0),
+      m_modSeconds(0),
+      m_modUSeconds(0)
+  {
+
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence::CacheKey ::
+    read(const Fw::CmdStringArg& fileName)
+  {
+    const char *const path = fileName.toChar();
+    this->m_fileName = fileName;
+    this->m_valid =
+      (Os::FileSystem::getFileSize(path, this->m_fileSize) ==
+       Os::FileSystem::OP_OK) and
+      (Os::FileSystem::getFileModTime(
+        path,
+        this->m_modSeconds,
+        this->m_modUSeconds
+      ) == Os::FileSystem::OP_OK);
+    return this->m_valid;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence::CacheKey ::
+    matches(const CacheKey& key) const
+  {
+    return this->m_valid and key.m_valid
+      and (this->m_fileName == key.m_fileName)
+      and (this->m_fileSize == key.m_fileSize)
+      and (this->m_modSeconds == key.m_modSeconds)
+      and (this->m_modUSeconds == key.m_modUSeconds);
+  }
+
+  CmdSequencerComponentImpl::FPrimeSequence::Cache ::
+    Cache(void) :
+      m_valid(false)
+  {
+
+  }
+
+  CmdSequencerComponentImpl::FPrimeSequence::Stream ::
+    Stream(void) :
+      m_enabled(false),
+      m_dataSize(0),
+      m_dataRead(0),
+      m_recordNumber(0)
+  {
+
+  }
+
   CmdSequencerComponentImpl::FPrimeSequence ::
     FPrimeSequence(CmdSequencerComponentImpl& component) :
       Sequence(component)
@@ -76,12 +132,37 @@ namespace Svc {
     FW_ASSERT(this->m_buffer.getBuffAddr());
 
     this->setFileName(fileName);
+    this->clear();
+
+    // A file that has not changed since it was last loaded is not read
+    // again: its records are still in the buffer
+    (void) this->m_fileKey.read(fileName);
+    if (this->m_cache.m_valid and this->m_cache.m_key.matches(this->m_fileKey)) {
+      this->m_header = this->m_cache.m_header;
+      const bool status = this->m_header.validateTime(this->m_component)
+       and this->loadCachedRecords();
+      return status;
+    }
 
-    const bool status = this->readFile()
-     and this->validateCRC()
+    // The file overwrites the cached records
+    this->m_cache.m_valid = false;
+    bool status = this->readFile()
+     and this->validateCRC();
+    const Header header = this->m_header;
+    status = status
      and this->m_header.validateTime(this->m_component)
+     and this->openStream()
      and this->validateRecords();
 
+    if (status) {
+      this->m_cache.m_valid = true;
+      this->m_cache.m_key = this->m_fileKey;
+      this->m_cache.m_header = header;
+    }
+    else if (this->m_stream.m_enabled) {
+      this->clear();
+    }
+
     return status;
 
   }
@@ -89,26 +170,79 @@ namespace Svc {
   bool CmdSequencerComponentImpl::FPrimeSequence ::
     hasMoreRecords(void) const
   {
-    return this->m_buffer.getBuffLeft() > 0;
+    return (this->m_buffer.getBuffLeft() > 0) or
+      (this->m_stream.m_dataRead < this->m_stream.m_dataSize);
   }
 
-  void CmdSequencerComponentImpl::FPrimeSequence ::
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
      nextRecord(Record& record)
   {
-    Fw::SerializeStatus status = this->deserializeRecord(record);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    if (not this->m_stream.m_enabled) {
+      Fw::SerializeStatus status = this->deserializeRecord(record);
+      FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+      return true;
+    }
+    // The streamed records were validated when the sequence was loaded,
+    // but the file may have changed since. Fail the sequence on an error.
+    if (not this->fillStream()) {
+      this->clear();
+      return false;
+    }
+    const Fw::SerializeStatus status = this->deserializeRecord(record);
+    if (status != Fw::FW_SERIALIZE_OK) {
+      this->m_events.recordInvalid(this->m_stream.m_recordNumber, status);
+      this->clear();
+      return false;
+    }
+    ++this->m_stream.m_recordNumber;
+    return true;
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
     reset(void)
   {
-    this->m_buffer.resetDeser();
+    if (this->m_stream.m_enabled) {
+      (void) this->rewindStream();
+    }
+    else {
+      this->m_buffer.resetDeser();
+    }
   }
 
   void CmdSequencerComponentImpl::FPrimeSequence ::
     clear(void)
   {
     this->m_buffer.resetSer();
+    if (this->m_stream.m_enabled) {
+      this->m_sequenceFile.close();
+      this->m_stream = Stream();
+    }
+  }
+
+  void CmdSequencerComponentImpl::FPrimeSequence ::
+    deallocateBuffer(Fw::MemAllocator& allocator)
+  {
+    this->clear();
+    this->m_cache.m_valid = false;
+    Sequence::deallocateBuffer(allocator);
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    loadCachedRecords(void)
+  {
+    this->m_stream.m_enabled =
+      this->m_header.m_fileSize > this->m_buffer.getBuffCapacity();
+    if (this->m_stream.m_enabled) {
+      const bool status = this->openStream();
+      if (not status) {
+        this->clear();
+      }
+      return status;
+    }
+    const U32 dataSize = this->m_header.m_fileSize - sizeof(this->m_crc.m_stored);
+    const Fw::SerializeStatus status = this->m_buffer.setBuffLen(dataSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
   }
 
   bool CmdSequencerComponentImpl::FPrimeSequence ::
@@ -145,13 +279,20 @@ namespace Svc {
     bool status = this->readHeader();
     if (status) {
       this->m_crc.update(buffAddr, Sequence::Header::SERIALIZED_SIZE);
-      status = this->deserializeHeader()
-        and this->readRecordsAndCRC()
+      status = this->deserializeHeader();
+    }
+    if (status and this->m_stream.m_enabled) {
+      status = this->readStreamedCRC();
+    }
+    else if (status) {
+      status = this->readRecordsAndCRC()
         and this->extractCRC();
+      if (status) {
+        const NATIVE_UINT_TYPE buffLen = this->m_buffer.getBuffLength();
+        this->m_crc.update(buffAddr, buffLen);
+      }
     }
     if (status) {
-      const NATIVE_UINT_TYPE buffLen = this->m_buffer.getBuffLength();
-      this->m_crc.update(buffAddr, buffLen);
       this->m_crc.finalize();
     }
     return status;
@@ -223,8 +364,19 @@ namespace Svc {
       return false;
     }
     if (header.m_fileSize > buffer.getBuffCapacity()) {
-      this->m_events.fileSizeError(header.m_fileSize);
-      return false;
+      // A sequence larger than the buffer is streamed from the file,
+      // which must hold all of it
+      const U64 streamSize =
+        static_cast<U64>(Sequence::Header::SERIALIZED_SIZE) + header.m_fileSize;
+      if (
+          (buffer.getBuffCapacity() < MAX_RECORD_SIZE) or
+          (not this->m_fileKey.m_valid) or
+          (this->m_fileKey.m_fileSize < streamSize)
+      ) {
+        this->m_events.fileSizeError(header.m_fileSize);
+        return false;
+      }
+      this->m_stream.m_enabled = true;
     }
     // Number of records
     serializeStatus = buffer.deserialize(header.m_numRecords);
@@ -325,6 +477,131 @@ namespace Svc {
     return true;
   }
 
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    readStreamedCRC(void)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    U8 *const buffAddr = buffer.getBuffAddr();
+    const U32 crcSize = sizeof(this->m_crc.m_stored);
+    FW_ASSERT(this->m_header.m_fileSize >= crcSize, this->m_header.m_fileSize);
+    const U32 dataSize = this->m_header.m_fileSize - crcSize;
+
+    // Compute the CRC of the record data
+    for (U32 dataRead = 0; dataRead < dataSize; ) {
+      const NATIVE_INT_TYPE readLen =
+        FW_MIN(buffer.getBuffCapacity(), dataSize - dataRead);
+      if (not this->readData(buffAddr, readLen)) {
+        return false;
+      }
+      this->m_crc.update(buffAddr, readLen);
+      dataRead += readLen;
+    }
+    // Read the stored CRC after the data
+    if (not this->readData(buffAddr, crcSize)) {
+      return false;
+    }
+    Fw::ExternalSerializeBuffer crcBuff(buffAddr, crcSize);
+    Fw::SerializeStatus status = crcBuff.setBuffLen(crcSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    status = crcBuff.deserialize(this->m_crc.m_stored);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    buffer.resetSer();
+    return true;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    readData(U8 *const data, const NATIVE_INT_TYPE size)
+  {
+    Os::File& file = this->m_sequenceFile;
+    NATIVE_INT_TYPE readLen = size;
+    const Os::File::Status fileStatus = file.read(data, readLen);
+    if (fileStatus != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      return false;
+    }
+    if (readLen != size) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA_SIZE,
+          readLen
+      );
+      return false;
+    }
+    return true;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    openStream(void)
+  {
+    if (not this->m_stream.m_enabled) {
+      return true;
+    }
+    const Os::File::Status status = this->m_sequenceFile.open(
+      this->m_fileName.toChar(),
+      Os::File::OPEN_READ
+    );
+    if (status == Os::File::DOESNT_EXIST) {
+      this->m_events.fileNotFound();
+      return false;
+    }
+    if (status != Os::File::OP_OK) {
+      this->m_events.fileReadError();
+      return false;
+    }
+    this->m_stream.m_dataSize =
+      this->m_header.m_fileSize - sizeof(this->m_crc.m_stored);
+    return this->rewindStream();
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    rewindStream(void)
+  {
+    Os::File& file = this->m_sequenceFile;
+    this->m_buffer.resetSer();
+    this->m_stream.m_dataRead = 0;
+    this->m_stream.m_recordNumber = 0;
+    const Os::File::Status status = file.seek(Sequence::Header::SERIALIZED_SIZE);
+    if (status != Os::File::OP_OK) {
+      this->m_events.fileInvalid(
+          Events::FileReadStage::READ_SEQ_DATA,
+          file.getLastError()
+      );
+      this->clear();
+      return false;
+    }
+    return true;
+  }
+
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    fillStream(void)
+  {
+    Fw::SerializeBufferBase& buffer = this->m_buffer;
+    const NATIVE_UINT_TYPE buffLeft = buffer.getBuffLeft();
+    const U32 fileLeft = this->m_stream.m_dataSize - this->m_stream.m_dataRead;
+    // A whole record is left in the buffer, or all the data is
+    if (buffLeft >= MAX_RECORD_SIZE or fileLeft == 0) {
+      return true;
+    }
+    // Move the data left to the front of the buffer and read after it
+    U8 *const buffAddr = buffer.getBuffAddr();
+    (void) memmove(
+        buffAddr,
+        &buffAddr[buffer.getBuffLength() - buffLeft],
+        buffLeft
+    );
+    const NATIVE_INT_TYPE readLen =
+      FW_MIN(buffer.getBuffCapacity() - buffLeft, fileLeft);
+    if (not this->readData(&buffAddr[buffLeft], readLen)) {
+      return false;
+    }
+    this->m_stream.m_dataRead += readLen;
+    const Fw::SerializeStatus status = buffer.setBuffLen(buffLeft + readLen);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
+  }
+
   Fw::SerializeStatus CmdSequencerComponentImpl::FPrimeSequence ::
     deserializeRecord(Record& record)
   {
@@ -422,6 +699,9 @@ namespace Svc {
   bool CmdSequencerComponentImpl::FPrimeSequence ::
     validateRecords(void)
   {
+    if (this->m_stream.m_enabled) {
+      return this->validateStreamedRecords();
+    }
     Fw::SerializeBufferBase& buffer = this->m_buffer;
     const U32 numRecords = this->m_header.m_numRecords;
     Sequence::Record record;
@@ -446,5 +726,32 @@ namespace Svc {
     return true;
   }
 
-}
+  bool CmdSequencerComponentImpl::FPrimeSequence ::
+    validateStreamedRecords(void)
+  {
+    const U32 numRecords = this->m_header.m_numRecords;
+    Sequence::Record record;
 
+    // Deserialize all records, reading the file as for a run
+    for (NATIVE_UINT_TYPE recordNumber = 0; recordNumber < numRecords; recordNumber++) {
+      if (not this->fillStream()) {
+        return false;
+      }
+      Fw::SerializeStatus status = this->deserializeRecord(record);
+      if (status != Fw::FW_SERIALIZE_OK) {
+        this->m_events.recordInvalid(recordNumber, status);
+        return false;
+      }
+    }
+    // Check there is no data left
+    const U32 dataLeft = this->m_buffer.getBuffLeft() +
+      (this->m_stream.m_dataSize - this->m_stream.m_dataRead);
+    if (dataLeft > 0) {
+      this->m_events.recordMismatch(numRecords, dataLeft);
+      return false;
+    }
+    // Rewind to the first record
+    return this->rewindStream();
+  }
+
+}
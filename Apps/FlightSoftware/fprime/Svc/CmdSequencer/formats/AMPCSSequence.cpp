@@ -174,11 +174,12 @@ namespace Svc {
     return this->m_buffer.getBuffLeft() > 0;
   }
 
-  void AMPCSSequence ::
+  bool AMPCSSequence ::
      nextRecord(Sequence::Record& record)
   {
     Fw::SerializeStatus status = this->deserializeRecord(record);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return true;
   }
 
   void AMPCSSequence ::
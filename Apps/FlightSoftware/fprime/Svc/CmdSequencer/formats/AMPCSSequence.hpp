@@ -109,7 +109,8 @@ namespace Svc {
 
       //! Get the next record in the sequence.
       //! Asserts on failure
-      void nextRecord(
+      //! \return Success
+      bool nextRecord(
           Sequence::Record& record //!< The returned record
       );
 
@@ -382,6 +382,56 @@ namespace Svc {
       << "  Actual:   " << e.arg << "\n";
   }
 
+  // ----------------------------------------------------------------------
+  // Channel: CS_CommandRate
+  // ----------------------------------------------------------------------
+
+  void CmdSequencerGTestBase ::
+    assertTlm_CS_CommandRate_size(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_CS_CommandRate->size(), size)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel CS_CommandRate\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_CS_CommandRate->size() << "\n";
+  }
+
+  void CmdSequencerGTestBase ::
+    assertTlm_CS_CommandRate(
+        const char *const __ISF_callSiteFileName,
+        const U32 __ISF_callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_CS_CommandRate->size())
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel CS_CommandRate\n"
+      << "  Expected: Less than size of history (" 
+      << this->tlmHistory_CS_CommandRate->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_CS_CommandRate& e =
+      this->tlmHistory_CS_CommandRate->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __ISF_callSiteFileName << "\n"
+      << "  Line:     " << __ISF_callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel CS_CommandRate\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
   // ----------------------------------------------------------------------
   // Events
   // ----------------------------------------------------------------------
@@ -63,6 +63,12 @@
 #define ASSERT_TLM_CS_SequencesCompleted(index, value) \
   this->assertTlm_CS_SequencesCompleted(__FILE__, __LINE__, index, value)
 
+#define ASSERT_TLM_CS_CommandRate_SIZE(size) \
+  this->assertTlm_CS_CommandRate_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_CS_CommandRate(index, value) \
+  this->assertTlm_CS_CommandRate(__FILE__, __LINE__, index, value)
+
 // ----------------------------------------------------------------------
 // Macros for event history assertions 
 // ----------------------------------------------------------------------
@@ -488,6 +494,27 @@ namespace Svc {
           const U32& val /*!< The channel value*/
       ) const;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: CS_CommandRate
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_CS_CommandRate_size(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_CS_CommandRate(
+          const char *const __ISF_callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __ISF_callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
     protected:
 
       // ----------------------------------------------------------------------
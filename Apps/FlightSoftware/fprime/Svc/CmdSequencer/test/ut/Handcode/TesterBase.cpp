@@ -48,6 +48,8 @@ namespace Svc {
       new History<TlmEntry_CS_CommandsExecuted>(maxHistorySize);
     this->tlmHistory_CS_SequencesCompleted = 
       new History<TlmEntry_CS_SequencesCompleted>(maxHistorySize);
+    this->tlmHistory_CS_CommandRate = 
+      new History<TlmEntry_CS_CommandRate>(maxHistorySize);
     // Initialize event histories
 #if FW_ENABLE_TEXT_LOGGING
     this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
@@ -116,6 +118,7 @@ namespace Svc {
     delete this->tlmHistory_CS_Errors;
     delete this->tlmHistory_CS_CommandsExecuted;
     delete this->tlmHistory_CS_SequencesCompleted;
+    delete this->tlmHistory_CS_CommandRate;
     // Destroy event histories
 #if FW_ENABLE_TEXT_LOGGING
     delete this->textLogHistory;
@@ -1451,6 +1454,18 @@ namespace Svc {
         break;
       }
 
+      case CmdSequencerComponentBase::CHANNELID_CS_COMMANDRATE:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing CS_CommandRate: %d\n", _status);
+          return;
+        }
+        this->tlmInput_CS_CommandRate(timeTag, arg);
+        break;
+      }
+
       default: {
         FW_ASSERT(0, id);
         break;
@@ -1469,6 +1484,7 @@ namespace Svc {
     this->tlmHistory_CS_Errors->clear();
     this->tlmHistory_CS_CommandsExecuted->clear();
     this->tlmHistory_CS_SequencesCompleted->clear();
+    this->tlmHistory_CS_CommandRate->clear();
   }
 
   // ---------------------------------------------------------------------- 
@@ -1546,6 +1562,21 @@ namespace Svc {
     ++this->tlmSize;
   }
 
+  // ---------------------------------------------------------------------- 
+  // Channel: CS_CommandRate
+  // ---------------------------------------------------------------------- 
+
+  void CmdSequencerTesterBase ::
+    tlmInput_CS_CommandRate(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_CS_CommandRate e = { timeTag, val };
+    this->tlmHistory_CS_CommandRate->push_back(e);
+    ++this->tlmSize;
+  }
+
   // ----------------------------------------------------------------------
   // Event dispatch
   // ----------------------------------------------------------------------
@@ -1414,6 +1414,31 @@ namespace Svc {
       History<TlmEntry_CS_SequencesCompleted> 
         *tlmHistory_CS_SequencesCompleted;
 
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: CS_CommandRate
+      // ----------------------------------------------------------------------
+
+      //! Handle channel CS_CommandRate
+      //!
+      virtual void tlmInput_CS_CommandRate(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel CS_CommandRate
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_CS_CommandRate;
+
+      //! The history of CS_CommandRate values
+      //!
+      History<TlmEntry_CS_CommandRate> 
+        *tlmHistory_CS_CommandRate;
+
     protected:
 
       // ----------------------------------------------------------------------
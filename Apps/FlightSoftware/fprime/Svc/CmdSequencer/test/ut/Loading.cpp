@@ -0,0 +1,274 @@
+// ======================================================================
+// \title  Loading.cpp
+// \author Canham/Bocchino
+// \brief  Test the loading of cached and streamed sequences
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "Os/IntervalTimer.hpp"
+#include "Os/Stubs/FileStubs.hpp"
+#include "Svc/CmdSequencer/test/ut/Loading.hpp"
+
+namespace Svc {
+
+  namespace Loading {
+
+    // ----------------------------------------------------------------------
+    // Constructors
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        ImmediateBase::Tester(SequenceFiles::File::Format::F_PRIME)
+    {
+
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      CacheHit(void)
+    {
+      const U32 numRecords = 5;
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Validate the file
+      this->validateFile(0, fileName);
+      // Run the sequence. The file is not opened again.
+      this->openInterceptor.enable();
+      this->openInterceptor.fileStatus = Os::File::DOESNT_EXIST;
+      this->runSequence(0, fileName);
+      this->executeCommandsAuto(
+          fileName,
+          numRecords,
+          numRecords,
+          CmdExecMode::NO_NEW_SEQUENCE
+      );
+      this->openInterceptor.disable();
+      // Check for command complete on seqDone
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_OK);
+    }
+
+    void Tester ::
+      CacheMiss(void)
+    {
+      SequenceFiles::ImmediateFile file(5, this->format);
+      SequenceFiles::ImmediateFile otherFile(4, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the files
+      const char *const fileName = file.getName().toChar();
+      const char *const otherFileName = otherFile.getName().toChar();
+      file.write();
+      otherFile.write();
+      // Validate both files. The second replaces the first in the cache.
+      this->validateFile(0, fileName);
+      this->validateFile(0, otherFileName);
+      // Run the first sequence. The file is opened again.
+      this->openInterceptor.enable();
+      this->openInterceptor.fileStatus = Os::File::DOESNT_EXIST;
+      this->sendCmd_CS_RUN(0, 0, fileName);
+      this->clearAndDispatch();
+      this->openInterceptor.disable();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      // Assert events
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileNotFound(0, fileName);
+      // Remove the cached file and run it
+      this->validateFile(0, otherFileName);
+      otherFile.remove();
+      this->sendCmd_CS_RUN(0, 0, otherFileName);
+      this->clearAndDispatch();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_EXECUTION_ERROR
+      );
+      // Assert events
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_FileNotFound(0, otherFileName);
+    }
+
+    void Tester ::
+      Streamed(void)
+    {
+      SequenceFiles::ImmediateFile file(STREAMED_RECORDS, this->format);
+      this->parameterizedAutoByCommand(
+          file,
+          STREAMED_RECORDS,
+          STREAMED_RECORDS
+      );
+      // The sequence did not fit in the buffer
+      ASSERT_GT(
+          this->component.m_FPrimeSequence.m_cache.m_header.m_fileSize,
+          BUFFER_SIZE
+      );
+    }
+
+    void Tester ::
+      StreamedCancel(void)
+    {
+      SequenceFiles::ImmediateFile file(STREAMED_RECORDS, this->format);
+      this->parameterizedCancel(
+          file,
+          STREAMED_RECORDS,
+          STREAMED_RECORDS / 2
+      );
+      // The sequence is back at the first record
+      ASSERT_TRUE(this->component.m_FPrimeSequence.hasMoreRecords());
+      ASSERT_EQ(0U, this->component.m_FPrimeSequence.m_stream.m_recordNumber);
+    }
+
+    void Tester ::
+      StreamedFileErrors(void)
+    {
+      SequenceFiles::ImmediateFile file(STREAMED_RECORDS, this->format);
+      this->parameterizedFileErrors(file);
+    }
+
+    void Tester ::
+      StreamedTruncated(void)
+    {
+      SequenceFiles::ImmediateFile file(STREAMED_RECORDS, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Validate the file
+      this->validateFile(0, fileName);
+      // Run the sequence
+      this->runSequence(0, fileName);
+      // Cut the file after the data read into the buffer so far
+      const CmdSequencerComponentImpl::FPrimeSequence& sequence =
+        this->component.m_FPrimeSequence;
+      const U32 dataRead = sequence.m_stream.m_dataRead;
+      ASSERT_LT(dataRead, sequence.m_stream.m_dataSize);
+      const U32 fileSize =
+        CmdSequencerComponentImpl::Sequence::Header::SERIALIZED_SIZE + dataRead;
+      ASSERT_EQ(0, truncate(fileName, fileSize));
+      // Complete commands until the sequence reaches the missing data
+      U32 numCommands = 0;
+      while (this->fromPortHistory_seqDone->size() == 0) {
+        ASSERT_LT(numCommands, STREAMED_RECORDS);
+        ASSERT_from_comCmdOut_SIZE(1);
+        this->invoke_to_cmdResponseIn(0, numCommands, 0, Fw::COMMAND_OK);
+        this->clearAndDispatch();
+        ++numCommands;
+      }
+      // The sequence failed instead of completing
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_from_comCmdOut_SIZE(0);
+      ASSERT_EVENTS_CS_FileInvalid_SIZE(1);
+      ASSERT_EVENTS_CS_FileInvalid(
+          0,
+          fileName,
+          CmdSequencerComponentImpl::SEQ_READ_SEQ_DATA_SIZE,
+          0
+      );
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(0);
+      ASSERT_TLM_CS_Errors_SIZE(1);
+      ASSERT_TLM_CS_Errors(0, 1);
+      ASSERT_TLM_CS_SequencesCompleted_SIZE(0);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::STOPPED,
+          this->component.m_runMode
+      );
+      ASSERT_FALSE(this->component.m_FPrimeSequence.hasMoreRecords());
+    }
+
+    void Tester ::
+      StartLatency(void)
+    {
+      const U32 numRuns = 50;
+      // One sequence that fits in the buffer and one that does not
+      const U32 sizes[] = { 40, 300 };
+      const char *const names[] = { "buffered", "streamed" };
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      for (U32 s = 0; s < FW_NUM_ARRAY_ELEMENTS(sizes); ++s) {
+        // Two files, so that each cold start loads a different one
+        SequenceFiles::ImmediateFile file(sizes[s], this->format);
+        SequenceFiles::ImmediateFile otherFile(sizes[s] - 1, this->format);
+        const char *const fileName = file.getName().toChar();
+        const char *const otherFileName = otherFile.getName().toChar();
+        file.write();
+        otherFile.write();
+        U32 cold = 0;
+        U32 warm = 0;
+        for (U32 run = 0; run < numRuns; ++run) {
+          this->startSequence(otherFileName, cold);
+          this->startSequence(fileName, cold);
+          this->startSequence(fileName, warm);
+          this->startSequence(fileName, warm);
+        }
+        printf(
+            "%s sequence of %u records: start latency cold %u us, warm %u us\n",
+            names[s],
+            sizes[s],
+            cold / (2 * numRuns),
+            warm / (2 * numRuns)
+        );
+        ASSERT_TRUE(this->component.m_FPrimeSequence.m_cache.m_valid);
+      }
+    }
+
+    // ----------------------------------------------------------------------
+    // Private helper methods
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      startSequence(const char *const fileName, U32& latency)
+    {
+      Os::IntervalTimer timer;
+      timer.start();
+      this->sendCmd_CS_RUN(0, 0, fileName);
+      this->clearAndDispatch();
+      timer.stop();
+      latency += timer.getDiffUsec();
+      // Assert command response
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          CmdSequencerComponentBase::OPCODE_CS_RUN,
+          0,
+          Fw::COMMAND_OK
+      );
+      // Assert the first command
+      ASSERT_from_comCmdOut_SIZE(1);
+      this->cancelSequence(0, fileName);
+    }
+
+  }
+
+}
@@ -0,0 +1,92 @@
+// ======================================================================
+// \title  Loading.hpp
+// \author Canham/Bocchino
+// \brief  Test the loading of cached and streamed sequences
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Loading_HPP
+#define Svc_Loading_HPP
+
+#include "Svc/CmdSequencer/test/ut/ImmediateBase.hpp"
+
+namespace Svc {
+
+  namespace Loading {
+
+    //! Test the sequence cache and sequences larger than the buffer
+    class Tester :
+      public ImmediateBase::Tester
+    {
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Constants
+        // ----------------------------------------------------------------------
+
+        //! The number of records in a sequence larger than the buffer
+        static const U32 STREAMED_RECORDS = 100;
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Run a validated sequence without reading the file again
+        void CacheHit(void);
+
+        //! Read the file again after another sequence is loaded, or after
+        //! the file is removed
+        void CacheMiss(void);
+
+        //! Run a sequence larger than the buffer
+        void Streamed(void);
+
+        //! Start and cancel a sequence larger than the buffer
+        void StreamedCancel(void);
+
+        //! Inject file errors in a sequence larger than the buffer
+        void StreamedFileErrors(void);
+
+        //! Truncate the file of a sequence larger than the buffer while
+        //! the sequence runs
+        void StreamedTruncated(void);
+
+        //! Report the sequence start latency, cold and warm
+        void StartLatency(void);
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Private helper methods
+        // ----------------------------------------------------------------------
+
+        //! Run a sequence, then cancel it after the first command
+        void startSequence(
+            const char *const fileName, //!< The file name
+            U32& latency //!< Time to start the sequence in microseconds, added to
+        );
+
+    };
+
+  }
+
+}
+
+#endif
@@ -10,7 +10,9 @@
 #include "Svc/CmdSequencer/test/ut/Immediate.hpp"
 #include "Svc/CmdSequencer/test/ut/ImmediateEOS.hpp"
 #include "Svc/CmdSequencer/test/ut/InvalidFiles.hpp"
+#include "Svc/CmdSequencer/test/ut/Loading.hpp"
 #include "Svc/CmdSequencer/test/ut/NoFiles.hpp"
+#include "Svc/CmdSequencer/test/ut/Pipelined.hpp"
 #include "Svc/CmdSequencer/test/ut/Relative.hpp"
 #include "Svc/CmdSequencer/test/ut/SequenceFiles/SequenceFiles.hpp"
 #include "Svc/CmdSequencer/test/ut/Tester.hpp"
@@ -313,6 +315,41 @@ TEST(InvalidFiles, USecFieldTooShort) {
   tester.USecFieldTooShort();
 }
 
+TEST(Loading, CacheHit) {
+  Svc::Loading::Tester tester;
+  tester.CacheHit();
+}
+
+TEST(Loading, CacheMiss) {
+  Svc::Loading::Tester tester;
+  tester.CacheMiss();
+}
+
+TEST(Loading, StartLatency) {
+  Svc::Loading::Tester tester;
+  tester.StartLatency();
+}
+
+TEST(Loading, Streamed) {
+  Svc::Loading::Tester tester;
+  tester.Streamed();
+}
+
+TEST(Loading, StreamedCancel) {
+  Svc::Loading::Tester tester;
+  tester.StreamedCancel();
+}
+
+TEST(Loading, StreamedFileErrors) {
+  Svc::Loading::Tester tester;
+  tester.StreamedFileErrors();
+}
+
+TEST(Loading, StreamedTruncated) {
+  Svc::Loading::Tester tester;
+  tester.StreamedTruncated();
+}
+
 TEST(Mixed, AutoByCommand) {
   TEST_CASE(103.1.4,"Nominal Timed Relative Commands");
   Svc::Mixed::Tester tester;
@@ -356,6 +393,26 @@ TEST(NoFiles, NoSequenceActiveAMPCS) {
   tester.NoSequenceActive();
 }
 
+TEST(Pipelined, Depth) {
+  Svc::Pipelined::Tester tester;
+  tester.Depth();
+}
+
+TEST(Pipelined, FailedCommand) {
+  Svc::Pipelined::Tester tester;
+  tester.FailedCommand();
+}
+
+TEST(Pipelined, Throughput) {
+  Svc::Pipelined::Tester tester;
+  tester.Throughput();
+}
+
+TEST(Pipelined, TickBudget) {
+  Svc::Pipelined::Tester tester;
+  tester.TickBudget();
+}
+
 TEST(Relative, AutoByCommand) {
   TEST_CASE(103.1.3,"Nominal Relative Commands");
   Svc::Relative::Tester tester;
@@ -0,0 +1,280 @@
+// ======================================================================
+// \title  Pipelined.cpp
+// \author Canham/Bocchino
+// \brief  Test immediate command sequences with commands in flight
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <stdio.h>
+
+#include "Os/IntervalTimer.hpp"
+#include "Svc/CmdSequencer/test/ut/CommandBuffers.hpp"
+#include "Svc/CmdSequencer/test/ut/Pipelined.hpp"
+
+namespace Svc {
+
+  namespace Pipelined {
+
+    // ----------------------------------------------------------------------
+    // Constructors
+    // ----------------------------------------------------------------------
+
+    Tester ::
+      Tester(void) :
+        Svc::Tester(SequenceFiles::File::Format::F_PRIME),
+        numSent(0)
+    {
+      this->component.deallocateBuffer(this->mallocator);
+      this->component.allocateBuffer(
+          ALLOCATOR_ID,
+          this->mallocator,
+          PIPELINED_BUFFER_SIZE
+      );
+    }
+
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      from_comCmdOut_handler(
+          const NATIVE_INT_TYPE portNum,
+          Fw::ComBuffer &data,
+          U32 context
+      )
+    {
+      // Commands go out in sequence order
+      Fw::ComBuffer comBuff;
+      CommandBuffers::create(comBuff, this->numSent, this->numSent + 1);
+      ASSERT_EQ(comBuff, data);
+      ASSERT_EQ(0U, context);
+      ++this->numSent;
+    }
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      Depth(void)
+    {
+      const U32 numRecords = 5;
+      const U32 depth = 3;
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence
+      this->component.setPipelineDepth(depth);
+      this->runSequence(0, fileName);
+      // The first commands go out without waiting for responses
+      ASSERT_EQ(depth, this->numSent);
+      ASSERT_EQ(depth, this->component.m_inFlight);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::SET,
+          this->component.m_cmdTimeoutTimer.m_state
+      );
+      // Each response makes room for one more command
+      for (U32 i = 0; i < numRecords; ++i) {
+        this->respond(i, Fw::COMMAND_OK);
+        ASSERT_EQ(FW_MIN(i + 1 + depth, numRecords), this->numSent);
+        if (i < numRecords - 1) {
+          // Assert events
+          ASSERT_EVENTS_SIZE(1);
+          ASSERT_EVENTS_CS_CommandComplete(0, fileName, i, i);
+          ASSERT_from_seqDone_SIZE(0);
+        }
+        else {
+          // The sequence completes with the last response
+          ASSERT_EVENTS_SIZE(2);
+          ASSERT_EVENTS_CS_CommandComplete(0, fileName, i, i);
+          ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+          ASSERT_from_seqDone_SIZE(1);
+          ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_OK);
+        }
+      }
+      ASSERT_EQ(0U, this->component.m_inFlight);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::CLEAR,
+          this->component.m_cmdTimeoutTimer.m_state
+      );
+    }
+
+    void Tester ::
+      TickBudget(void)
+    {
+      const U32 numRecords = 5;
+      const U32 depth = 4;
+      const U32 budget = 2;
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence
+      this->component.setPipelineDepth(depth);
+      this->component.setTickBudget(budget);
+      this->runSequence(0, fileName);
+      // The budget holds the third command for the next tick
+      ASSERT_EQ(budget, this->numSent);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::SET,
+          this->component.m_cmdTimer.m_state
+      );
+      // A response does not send it early
+      this->respond(0, Fw::COMMAND_OK);
+      ASSERT_EQ(budget, this->numSent);
+      // Each tick sends the budget
+      this->invoke_to_schedIn(0, 0);
+      this->clearAndDispatch();
+      ASSERT_EQ(2 * budget, this->numSent);
+      this->invoke_to_schedIn(0, 0);
+      this->clearAndDispatch();
+      ASSERT_EQ(numRecords, this->numSent);
+      ASSERT_EQ(
+          CmdSequencerComponentImpl::Timer::CLEAR,
+          this->component.m_cmdTimer.m_state
+      );
+      // Complete the sequence
+      for (U32 i = 1; i < numRecords; ++i) {
+        this->respond(i, Fw::COMMAND_OK);
+      }
+      ASSERT_EVENTS_CS_SequenceComplete_SIZE(1);
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_OK);
+    }
+
+    void Tester ::
+      FailedCommand(void)
+    {
+      const U32 numRecords = 5;
+      const U32 depth = 3;
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      // Run the sequence
+      this->component.setPipelineDepth(depth);
+      this->runSequence(0, fileName);
+      ASSERT_EQ(depth, this->numSent);
+      // Fail the first command
+      this->respond(0, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_CommandError(0, fileName, 0, 0, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_from_seqDone_SIZE(1);
+      ASSERT_from_seqDone(0, 0U, 0U, Fw::COMMAND_EXECUTION_ERROR);
+      ASSERT_EQ(CmdSequencerComponentImpl::STOPPED, this->component.m_runMode);
+      ASSERT_EQ(0U, this->component.m_inFlight);
+      ASSERT_EQ(depth - 1, this->component.m_owedResponses);
+      // The commands still in flight complete quietly after the sequence
+      for (U32 i = 1; i < depth; ++i) {
+        this->respond(i, Fw::COMMAND_OK);
+        ASSERT_EVENTS_SIZE(0);
+      }
+      ASSERT_EQ(0U, this->component.m_owedResponses);
+      ASSERT_EQ(depth, this->numSent);
+      // A response beyond those is unexpected
+      this->respond(depth, Fw::COMMAND_OK);
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_CS_UnexpectedCompletion(0, depth);
+    }
+
+    void Tester ::
+      Throughput(void)
+    {
+      const U32 numRecords = 200;
+      const U32 depths[] = { 1, 4, 16 };
+      const U32 budgets[] = { 0, 8 };
+      SequenceFiles::ImmediateFile file(numRecords, this->format);
+      // Set the time
+      Fw::Time testTime(TB_WORKSTATION_TIME, 1, 1);
+      this->setTestTime(testTime);
+      // Write the file
+      const char *const fileName = file.getName().toChar();
+      file.write();
+      for (U32 d = 0; d < FW_NUM_ARRAY_ELEMENTS(depths); ++d) {
+        for (U32 b = 0; b < FW_NUM_ARRAY_ELEMENTS(budgets); ++b) {
+          const U32 depth = depths[d];
+          const U32 budget = budgets[b];
+          this->component.setPipelineDepth(depth);
+          this->component.setTickBudget(budget);
+          Os::IntervalTimer timer;
+          timer.start();
+          const U32 ticks = this->runTicks(fileName, numRecords);
+          timer.stop();
+          printf(
+              "depth %2u budget %2u: %3u ticks for %u commands, %5.1f commands/tick, %u us\n",
+              depth,
+              budget,
+              ticks,
+              numRecords,
+              static_cast<F64>(numRecords) / ticks,
+              timer.getDiffUsec()
+          );
+          // Each tick answers the commands sent before it
+          U32 perTick = depth;
+          if (budget != 0 and budget < perTick) {
+            perTick = budget;
+          }
+          ASSERT_LE(ticks, (numRecords + perTick - 1) / perTick + 1);
+          if (depth == 1) {
+            ASSERT_EQ(numRecords, ticks);
+          }
+        }
+      }
+    }
+
+    // ----------------------------------------------------------------------
+    // Private helper methods
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      respond(const U32 i, const Fw::CommandResponse response)
+    {
+      this->invoke_to_cmdResponseIn(0, i, 0, response);
+      this->clearAndDispatch();
+    }
+
+    U32 Tester ::
+      runTicks(const char *const fileName, const U32 numCommands)
+    {
+      this->numSent = 0;
+      this->runSequence(0, fileName);
+      U32 ticks = 0;
+      U32 answered = 0;
+      while (this->component.m_runMode == CmdSequencerComponentImpl::RUNNING) {
+        ++ticks;
+        const U32 sent = this->numSent;
+        this->invoke_to_schedIn(0, 0);
+        this->clearAndDispatch();
+        while (answered < sent) {
+          this->respond(answered, Fw::COMMAND_OK);
+          ++answered;
+        }
+        // Stop a sequence that makes no progress
+        EXPECT_LE(ticks, numCommands);
+        if (ticks > numCommands) {
+          break;
+        }
+      }
+      EXPECT_EQ(numCommands, this->numSent);
+      EXPECT_EQ(numCommands, answered);
+      return ticks;
+    }
+
+  }
+
+}
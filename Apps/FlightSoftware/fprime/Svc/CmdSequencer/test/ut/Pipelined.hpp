@@ -0,0 +1,112 @@
+// ======================================================================
+// \title  Pipelined.hpp
+// \author Canham/Bocchino
+// \brief  Test immediate command sequences with commands in flight
+//
+// \copyright
+// Copyright (C) 2018 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Pipelined_HPP
+#define Svc_Pipelined_HPP
+
+#include "Svc/CmdSequencer/test/ut/Tester.hpp"
+
+namespace Svc {
+
+  namespace Pipelined {
+
+    //! Test sequences run with a pipeline depth and a tick budget
+    class Tester :
+      public Svc::Tester
+    {
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Constants
+        // ----------------------------------------------------------------------
+
+        //! Sequence buffer size, large enough for the benchmark sequence
+        static const NATIVE_UINT_TYPE PIPELINED_BUFFER_SIZE = 8192;
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Constructors
+        // ----------------------------------------------------------------------
+
+        //! Construct object Tester
+        Tester(void);
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Run a sequence with several commands in flight
+        void Depth(void);
+
+        //! Run a sequence with a per-tick command budget
+        void TickBudget(void);
+
+        //! Run a sequence with a failed command while others are in flight
+        void FailedCommand(void);
+
+        //! Report the ticks taken to run an immediate sequence
+        void Throughput(void);
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Handlers for typed from ports
+        // ----------------------------------------------------------------------
+
+        //! Handler for from_comCmdOut. Checks and counts the commands in
+        //! place of the port history, which is too short for a pipeline.
+        void from_comCmdOut_handler(
+            const NATIVE_INT_TYPE portNum, //!< The port number
+            Fw::ComBuffer &data, //!< Buffer containing packet data
+            U32 context //!< Call context value; meaning chosen by user
+        );
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Private helper methods
+        // ----------------------------------------------------------------------
+
+        //! Send a command response and dispatch it
+        void respond(
+            const U32 i, //!< The command number
+            const Fw::CommandResponse response //!< The response
+        );
+
+        //! Run a sequence, answering each command on the tick after it
+        //! was sent
+        //! \return The number of ticks to complete the sequence
+        U32 runTicks(
+            const char *const fileName, //!< The file name
+            const U32 numCommands //!< The number of commands in the sequence
+        );
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Variables
+        // ----------------------------------------------------------------------
+
+        //! The number of commands sent
+        U32 numSent;
+
+    };
+
+  }
+
+}
+
+#endif
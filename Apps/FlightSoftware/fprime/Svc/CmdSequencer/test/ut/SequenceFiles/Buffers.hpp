@@ -29,7 +29,7 @@ namespace Svc {
         public:
 
           enum Constants {
-            CAPACITY = 4096
+            CAPACITY = 8192
           };
 
         public:
@@ -12,10 +12,12 @@ TEST_SRC= \
   ImmediateEOS.cpp \
   Interceptors.cpp \
   InvalidFiles.cpp \
+  Loading.cpp \
   Main.cpp \
   Mixed.cpp \
   MixedRelativeBase.cpp \
   NoFiles.cpp \
+  Pipelined.cpp \
   Relative.cpp \
   SequenceFiles/AMPCS/CRCs.cpp \
   SequenceFiles/AMPCS/Headers.cpp \
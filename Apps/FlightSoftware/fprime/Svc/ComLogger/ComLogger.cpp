@@ -182,6 +182,9 @@ namespace Svc {
       // Reset byte count:
       this->byteCount = 0;
 
+      // Start a new hash, updated as data is written:
+      this->hash.init();
+
       // Set mode:
       this->fileMode = OPEN; 
     }    
@@ -239,6 +242,12 @@ namespace Svc {
   {
     NATIVE_INT_TYPE size = length;
     Os::File::Status ret = file.write(data, size);
+
+    // Hash whatever reached the file, so the hash file matches its contents:
+    if( size > 0 && size <= (NATIVE_INT_TYPE) length ) {
+      this->hash.update(data, size);
+    }
+
     if( Os::File::OP_OK != ret || size != (NATIVE_INT_TYPE) length ) {
       if( !writeErrorOccured ) { // throttle this event, otherwise a positive 
                                  // feedback event loop can occur!
@@ -257,8 +266,11 @@ namespace Svc {
     writeHashFile(
     )
   {
+    // Use the running hash rather than re-reading the whole file:
+    Utils::HashBuffer hashBuffer;
+    this->hash.final(hashBuffer);
     Os::ValidateFile::Status validateStatus;
-    validateStatus = Os::ValidateFile::createValidation((char*) this->fileName, (char*)this->hashFileName);
+    validateStatus = Os::ValidateFile::writeValidation((char*)this->hashFileName, hashBuffer);
     if( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
       Fw::LogStringArg logStringArg1((char*) this->fileName);
       Fw::LogStringArg logStringArg2((char*) this->hashFileName);
@@ -102,6 +102,7 @@ namespace Svc {
       bool writeErrorOccured;
       bool openErrorOccured;
       bool storeBufferLength;
+      Utils::Hash hash; // running hash of the bytes written to the open file
       
       // ----------------------------------------------------------------------
       // File functions:
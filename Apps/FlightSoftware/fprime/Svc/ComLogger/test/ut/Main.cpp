@@ -31,6 +31,11 @@ TEST(Test, closeFileCommand) {
   tester.closeFileCommand();
 }
 
+TEST(Test, rolloverLatency) {
+  Svc::Tester tester("Tester");
+  tester.rolloverLatency();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -9,6 +9,7 @@
 #include <Os/ValidateFile.hpp>
 #include <Os/FileSystem.hpp>
 #include <Fw/Types/SerialBuffer.hpp>
+#include <Os/IntervalTimer.hpp>
 
 #define ID_BASE 256
 
@@ -553,6 +554,69 @@ namespace Svc {
     file.close();
   }
 
+  void Tester ::
+    rolloverLatency(void) 
+  {
+    // Measure the cost of closing a log file of 1 MB to 100 MB. Closing
+    // writes the hash kept while logging. Before that, closing re-read
+    // the whole file to hash it, so that cost is also timed for comparison.
+    const U32 sizesMB[] = { 1, 10, 100 };
+    U8 fileName[2048];
+    U8 hashFileName[2048];
+    U8 data[FW_COM_BUFFER_MAX_SIZE];
+    for(U32 i = 0; i < sizeof(data); i++) {
+      data[i] = i & 0xFF;
+    }
+    Fw::ComBuffer buffer(data, sizeof(data));
+
+    printf("ComLogger rollover latency:\n");
+    for(U32 i = 0; i < sizeof(sizesMB)/sizeof(sizesMB[0]); i++) {
+      const U32 fileSize = sizesMB[i]*1024*1024;
+      this->comLogger.maxFileSize = fileSize + sizeof(data) + sizeof(U16);
+      this->clearHistory();
+
+      Fw::Time testTime(TB_NONE, 100+i, 0);
+      setTestTime(testTime);
+      memset(fileName, 0, sizeof(fileName));
+      snprintf((char*) fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+      memset(hashFileName, 0, sizeof(hashFileName));
+      snprintf((char*) hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.com%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+      // Fill the file:
+      do {
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+        ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      } while( comLogger.byteCount < fileSize );
+
+      // Close with the running hash:
+      Os::IntervalTimer timer;
+      timer.start();
+      sendCmd_CloseFile(0, i);
+      dispatchAll();
+      timer.stop();
+      const U32 closeUsec = timer.getDiffUsec();
+      ASSERT_TRUE(comLogger.fileMode == ComLogger::CLOSED);
+      ASSERT_EVENTS_FileClosed_SIZE(1);
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK,
+        Os::ValidateFile::validate((char*) fileName, (char*) hashFileName));
+
+      // Re-read and hash the file, as closing used to:
+      timer.start();
+      const Os::ValidateFile::Status status =
+        Os::ValidateFile::createValidation((char*) fileName, (char*) hashFileName);
+      timer.stop();
+      const U32 rereadUsec = timer.getDiffUsec();
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, status);
+
+      printf("  %3u MB: close %8u us, close + re-read %8u us\n",
+        sizesMB[i], closeUsec, closeUsec + rereadUsec);
+
+      (void) remove((char*) fileName);
+      (void) remove((char*) hashFileName);
+    }
+  }
+
   void Tester ::
     from_pingOut_handler(
         const NATIVE_INT_TYPE portNum,
@@ -31,6 +31,7 @@ namespace Svc {
       void openError(void);
       void writeError(void);
       void closeFileCommand(void);
+      void rolloverLatency(void);
     private:
       void connectPorts(void);
       void initComponents(void);
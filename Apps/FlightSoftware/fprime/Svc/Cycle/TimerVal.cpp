@@ -42,6 +42,10 @@ namespace Svc {
         return Os::IntervalTimer::getDiffUsec(this->m_timerVal,time.m_timerVal);
     }
 
+    U32 TimerVal::diffNSec(const TimerVal& time) {
+        return Os::IntervalTimer::getDiffNsec(this->m_timerVal,time.m_timerVal);
+    }
+
     Fw::SerializeStatus TimerVal::serialize(Fw::SerializeBufferBase& buffer) const {
         Fw::SerializeStatus stat = buffer.serialize(this->m_timerVal.upper);
         if (stat != Fw::FW_SERIALIZE_OK) {
@@ -88,6 +88,16 @@ namespace Svc {
 
             U32 diffUSec(const TimerVal& time); //!< takes difference between stored time and passed time
 
+            //!  \brief Compute difference function in nanoseconds
+            //!
+            //!  Same as diffUSec, in nanoseconds. Resolution is that of the
+            //!  platform timer; the result saturates or wraps past about 4.29 s
+            //!  depending on the platform.
+            //!
+            //!  \param time time to compute difference from
+
+            U32 diffNSec(const TimerVal& time); //!< takes difference between stored time and passed time
+
         PRIVATE:
             TimerVal(U32 upper, U32 lower); //!< Private constructor for testing
             Os::IntervalTimer::RawTime m_timerVal; //!< Stored timer value
@@ -0,0 +1,24 @@
+/*
+* \file:
+* \brief
+*
+* This file has configuration settings for the Deframer component.
+*
+*/
+
+#ifndef DEFRAMER_DEFRAMERCFG_HPP_
+#define DEFRAMER_DEFRAMERCFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Size in bytes of the deframer ring. Must be a power of two. The
+        //! largest frame accepted is the ring size less the frame overhead.
+        DEFRAMER_RING_SIZE = 4096,
+        //! Uplink frame sync word, the ground system's packet delimiter
+        DEFRAMER_SYNC_WORD = 0x5A5A5A5A,
+    };
+
+}
+
+#endif /* DEFRAMER_DEFRAMERCFG_HPP_ */
@@ -0,0 +1,209 @@
+// ======================================================================
+// \title  DeframerComponentImpl.cpp
+// \brief  cpp file for Deframer component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/Deframer/DeframerComponentImpl.hpp>
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <string.h>
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction
+  // ----------------------------------------------------------------------
+
+  DeframerComponentImpl ::
+#if FW_OBJECT_NAMES == 1
+    DeframerComponentImpl(
+        const char *const compName
+    ) :
+      DeframerComponentBase(compName),
+#else
+    DeframerComponentImpl(void) :
+#endif
+      m_droppedPackets(0),
+      m_lastDroppedPackets(0)
+  {
+    memset(&this->m_lastStats, 0, sizeof(this->m_lastStats));
+  }
+
+  void DeframerComponentImpl ::
+    init(
+        const NATIVE_INT_TYPE instance
+    )
+  {
+    DeframerComponentBase::init(instance);
+  }
+
+  void DeframerComponentImpl ::
+    setup(const U32 syncWord, const bool checksum)
+  {
+    this->m_deframer.setup(
+        syncWord,
+        StreamDeframer::RING_SIZE - StreamDeframer::HEADER_SIZE - StreamDeframer::CHECKSUM_SIZE,
+        checksum);
+  }
+
+  DeframerComponentImpl ::
+    ~DeframerComponentImpl(void)
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  void DeframerComponentImpl ::
+    framedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &serBuffer,
+        Drv::SerialReadStatus &status
+    )
+  {
+    // A driver out of buffers calls with an empty buffer that is not ours
+    // to return
+    if (status == Drv::SER_NO_BUFFERS) {
+      return;
+    }
+
+    if (status == Drv::SER_OK) {
+      const U8* const data = reinterpret_cast<const U8*>(serBuffer.getdata());
+      const U32 size = serBuffer.getsize();
+      U32 offset = 0;
+      while (offset < size) {
+        // A full ring always holds a frame or bytes to discard, so every
+        // pass makes room for more of the chunk
+        const U32 taken = this->m_deframer.push(&data[offset], size - offset);
+        offset += taken;
+        this->processFrames();
+        FW_ASSERT(taken > 0 || this->m_deframer.getUsed() < StreamDeframer::RING_SIZE,
+            offset, size);
+      }
+      this->writeTlm();
+    }
+
+    if (this->isConnected_framedDeallocate_OutputPort(0)) {
+      this->framedDeallocate_out(0, serBuffer);
+    }
+  }
+
+  void DeframerComponentImpl ::
+    processFrames(void)
+  {
+    StreamDeframer::Frame frame;
+    while (true) {
+      switch (this->m_deframer.nextFrame(frame)) {
+        case StreamDeframer::FRAME_OK:
+          this->sendFrame(frame);
+          break;
+        case StreamDeframer::FRAME_NEED_DATA:
+          return;
+        case StreamDeframer::FRAME_SIZE_ERROR:
+          // Usually a sync word pattern in noise or in another frame's
+          // data; counted in telemetry only
+          break;
+        case StreamDeframer::FRAME_CHECKSUM_ERROR:
+          this->log_WARNING_HI_DF_ChecksumError();
+          break;
+        default:
+          FW_ASSERT(0);
+      }
+    }
+  }
+
+  void DeframerComponentImpl ::
+    sendFrame(const StreamDeframer::Frame& frame)
+  {
+    switch (frame.descriptor) {
+      case Fw::ComPacket::FW_PACKET_COMMAND:
+      {
+        if (frame.size > FW_COM_BUFFER_MAX_SIZE) {
+          this->log_WARNING_HI_DF_CommandTooBig(frame.size);
+          break;
+        }
+        // The packet, descriptor included, goes straight from the ring
+        // into the com buffer
+        Fw::ComBuffer com;
+        Fw::SerializeStatus stat = com.serialize(frame.first, frame.firstSize, true);
+        FW_ASSERT(stat == Fw::FW_SERIALIZE_OK, stat);
+        stat = com.serialize(frame.second, frame.secondSize, true);
+        FW_ASSERT(stat == Fw::FW_SERIALIZE_OK, stat);
+        if (this->isConnected_comOut_OutputPort(0)) {
+          this->comOut_out(0, com, 0);
+        } else {
+          this->m_droppedPackets++;
+        }
+        break;
+      }
+
+      case Fw::ComPacket::FW_PACKET_FILE:
+      {
+        if (not this->isConnected_bufferAllocate_OutputPort(0) or
+            not this->isConnected_bufferOut_OutputPort(0)) {
+          this->m_droppedPackets++;
+          break;
+        }
+        const U32 dataSize = frame.size - StreamDeframer::DESC_SIZE;
+        Fw::Buffer buffer = this->bufferAllocate_out(0, dataSize);
+        U8* const data = reinterpret_cast<U8*>(buffer.getdata());
+        if (data == NULL) {
+          this->log_WARNING_HI_DF_AllocationError(dataSize);
+          break;
+        }
+        if (buffer.getsize() < dataSize) {
+          // Give back the short buffer so the pool does not leak
+          if (this->isConnected_bufferDeallocate_OutputPort(0)) {
+            this->bufferDeallocate_out(0, buffer);
+          }
+          this->log_WARNING_HI_DF_AllocationError(dataSize);
+          break;
+        }
+        frame.copy(data, StreamDeframer::DESC_SIZE, dataSize);
+        buffer.setsize(dataSize);
+        this->bufferOut_out(0, buffer);
+        break;
+      }
+
+      default:
+        this->log_WARNING_HI_DF_UnknownDescriptor(frame.descriptor);
+        break;
+    }
+  }
+
+  void DeframerComponentImpl ::
+    writeTlm(void)
+  {
+    StreamDeframer::Stats stats;
+    this->m_deframer.getStats(stats);
+
+    if (stats.frames != this->m_lastStats.frames) {
+      this->tlmWrite_DF_Frames(stats.frames);
+    }
+    if (stats.discardedBytes != this->m_lastStats.discardedBytes) {
+      this->tlmWrite_DF_DiscardedBytes(stats.discardedBytes);
+    }
+    if (stats.sizeErrors != this->m_lastStats.sizeErrors) {
+      this->tlmWrite_DF_SizeErrors(stats.sizeErrors);
+    }
+    if (stats.checksumErrors != this->m_lastStats.checksumErrors) {
+      this->tlmWrite_DF_ChecksumErrors(stats.checksumErrors);
+    }
+
+    if (this->m_droppedPackets != this->m_lastDroppedPackets) {
+      this->tlmWrite_DF_DroppedPackets(this->m_droppedPackets);
+    }
+
+    this->m_lastStats = stats;
+    this->m_lastDroppedPackets = this->m_droppedPackets;
+  }
+
+} // end namespace Svc
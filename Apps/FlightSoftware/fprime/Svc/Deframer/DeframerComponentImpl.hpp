@@ -0,0 +1,103 @@
+// ======================================================================
+// \title  DeframerComponentImpl.hpp
+// \brief  hpp file for Deframer component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Deframer_HPP
+#define Deframer_HPP
+
+#include <Svc/Deframer/StreamDeframer.hpp>
+
+#include "Svc/Deframer/DeframerComponentAc.hpp"
+
+namespace Svc {
+
+  //! \class DeframerComponentImpl
+  //! \brief Turns an uplink byte stream into command and file packets
+  //!
+  //! Byte chunks from a serial or radio driver are pushed through a
+  //! StreamDeframer. Command packets go out on comOut and file packets,
+  //! less the descriptor, go out on bufferOut in a buffer from
+  //! bufferAllocate. Each packet is copied once, from the ring into the
+  //! outgoing buffer. A packet whose output ports are not connected is
+  //! dropped and counted, so a deployment without file uplink can leave
+  //! the buffer ports unconnected.
+  //!
+  class DeframerComponentImpl :
+    public DeframerComponentBase
+  {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction, initialization, and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct object Deframer
+      //!
+      DeframerComponentImpl(
+#if FW_OBJECT_NAMES == 1
+          const char *const compName /*!< The component name*/
+#else
+          void
+#endif
+      );
+
+      //! Initialize object Deframer
+      //!
+      void init(
+          const NATIVE_INT_TYPE instance = 0 /*!< The instance number*/
+      );
+
+      //! Set the sync word and whether frames carry a CRC-32 trailer. The
+      //! default is DEFRAMER_SYNC_WORD without checksums, which matches the
+      //! ground system's socket framing.
+      //!
+      void setup(
+          const U32 syncWord, /*!< The sync word*/
+          const bool checksum /*!< Frames end with a CRC-32 of the packet*/
+      );
+
+      //! Destroy object Deframer
+      //!
+      ~DeframerComponentImpl(void);
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for user-defined typed input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for framedIn
+      //!
+      void framedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &serBuffer, /*!< Buffer containing data*/
+          Drv::SerialReadStatus &status /*!< Status of read*/
+      );
+
+      //! Send every complete frame in the ring
+      void processFrames(void);
+
+      //! Send one frame to comOut or bufferOut
+      void sendFrame(const StreamDeframer::Frame& frame);
+
+      //! Write the telemetry that changed since the last call
+      void writeTlm(void);
+
+      StreamDeframer m_deframer; //!< Ring and frame parser
+      StreamDeframer::Stats m_lastStats; //!< Counters at the last telemetry update
+      U32 m_droppedPackets; //!< Packets with no connected output
+      U32 m_lastDroppedPackets; //!< m_droppedPackets at the last telemetry update
+
+  };
+
+} // end namespace Svc
+
+#endif
@@ -0,0 +1,239 @@
+// ======================================================================
+// \title  StreamDeframer.cpp
+// \brief  cpp file for the uplink frame ring and parser
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/Deframer/StreamDeframer.hpp>
+#include <Utils/Hash/crc32/CRC32Engine.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <string.h>
+
+namespace Svc {
+
+  namespace {
+
+    const U32 RING_MASK = StreamDeframer::RING_SIZE - 1;
+
+    //! Ones in each byte of a word
+    const U32 LOW_BITS = 0x01010101U;
+    //! The top bit of each byte of a word
+    const U32 HIGH_BITS = 0x80808080U;
+
+  }
+
+  void StreamDeframer::Frame ::
+    copy(U8* const dest, const U32 offset, const U32 length) const
+  {
+    FW_ASSERT(dest);
+    FW_ASSERT(offset + length <= this->size, offset, length, this->size);
+    U32 done = 0;
+    if (offset < this->firstSize) {
+      done = this->firstSize - offset;
+      if (done > length) {
+        done = length;
+      }
+      (void) memcpy(dest, this->first + offset, done);
+    }
+    if (done < length) {
+      (void) memcpy(dest + done, this->second + (offset + done - this->firstSize), length - done);
+    }
+  }
+
+  StreamDeframer ::
+    StreamDeframer(void) :
+      m_head(0),
+      m_tail(0),
+      m_syncWord(DEFRAMER_SYNC_WORD),
+      m_maxPacketSize(RING_SIZE - HEADER_SIZE - CHECKSUM_SIZE),
+      m_checksum(false)
+  {
+    FW_ASSERT((RING_SIZE & RING_MASK) == 0, RING_SIZE);
+    memset(&this->m_stats, 0, sizeof(this->m_stats));
+  }
+
+  void StreamDeframer ::
+    setup(const U32 syncWord, const U32 maxPacketSize, const bool checksum)
+  {
+    // A full ring must always hold a whole frame or something to discard,
+    // or the parser could stall with no room to receive the rest
+    FW_ASSERT(maxPacketSize >= DESC_SIZE, maxPacketSize);
+    FW_ASSERT(maxPacketSize <= RING_SIZE - HEADER_SIZE - CHECKSUM_SIZE, maxPacketSize);
+    this->m_syncWord = syncWord;
+    this->m_maxPacketSize = maxPacketSize;
+    this->m_checksum = checksum;
+    this->reset();
+  }
+
+  void StreamDeframer ::
+    reset(void)
+  {
+    this->m_head = 0;
+    this->m_tail = 0;
+  }
+
+  U32 StreamDeframer ::
+    push(const U8* const data, const U32 size)
+  {
+    FW_ASSERT(data);
+    const U32 room = RING_SIZE - this->getUsed();
+    const U32 count = (size < room) ? size : room;
+    const U32 start = this->m_head & RING_MASK;
+    const U32 firstCount = (count < RING_SIZE - start) ? count : RING_SIZE - start;
+    (void) memcpy(&this->m_data[start], data, firstCount);
+    (void) memcpy(this->m_data, data + firstCount, count - firstCount);
+    this->m_head += count;
+    return count;
+  }
+
+  StreamDeframer::Status StreamDeframer ::
+    nextFrame(Frame& frame)
+  {
+    while (true) {
+
+      const U32 used = this->getUsed();
+      if (used < sizeof(U32)) {
+        return FRAME_NEED_DATA;
+      }
+
+      if (this->peek32(0) != this->m_syncWord) {
+        // Drop everything up to the next byte that could start a sync word
+        const U32 skip = this->findSyncByte(1);
+        this->consume(skip);
+        this->m_stats.discardedBytes += skip;
+        continue;
+      }
+
+      if (used < HEADER_SIZE) {
+        return FRAME_NEED_DATA;
+      }
+
+      const U32 size = this->peek32(sizeof(U32));
+      if (size < DESC_SIZE || size > this->m_maxPacketSize) {
+        this->consume(1);
+        this->m_stats.discardedBytes++;
+        this->m_stats.sizeErrors++;
+        return FRAME_SIZE_ERROR;
+      }
+
+      const U32 total = HEADER_SIZE + size + (this->m_checksum ? CHECKSUM_SIZE : 0);
+      if (used < total) {
+        return FRAME_NEED_DATA;
+      }
+
+      if (this->m_checksum &&
+          this->checksum(HEADER_SIZE, size) != this->peek32(HEADER_SIZE + size)) {
+        this->consume(1);
+        this->m_stats.discardedBytes++;
+        this->m_stats.checksumErrors++;
+        return FRAME_CHECKSUM_ERROR;
+      }
+
+      const U32 start = (this->m_tail + HEADER_SIZE) & RING_MASK;
+      frame.descriptor = this->peek32(HEADER_SIZE);
+      frame.size = size;
+      frame.first = &this->m_data[start];
+      frame.firstSize = (size < RING_SIZE - start) ? size : RING_SIZE - start;
+      frame.second = this->m_data;
+      frame.secondSize = size - frame.firstSize;
+
+      // The bytes stay in place until the next push()
+      this->consume(total);
+      this->m_stats.frames++;
+      return FRAME_OK;
+    }
+  }
+
+  U32 StreamDeframer ::
+    getUsed(void) const
+  {
+    return this->m_head - this->m_tail;
+  }
+
+  void StreamDeframer ::
+    getStats(Stats& stats) const
+  {
+    stats = this->m_stats;
+  }
+
+  U8 StreamDeframer ::
+    peek(const U32 offset) const
+  {
+    return this->m_data[(this->m_tail + offset) & RING_MASK];
+  }
+
+  U32 StreamDeframer ::
+    peek32(const U32 offset) const
+  {
+    return (static_cast<U32>(this->peek(offset)) << 24)
+        | (static_cast<U32>(this->peek(offset + 1)) << 16)
+        | (static_cast<U32>(this->peek(offset + 2)) << 8)
+        | static_cast<U32>(this->peek(offset + 3));
+  }
+
+  void StreamDeframer ::
+    consume(const U32 size)
+  {
+    FW_ASSERT(size <= this->getUsed(), size, this->getUsed());
+    this->m_tail += size;
+  }
+
+  U32 StreamDeframer ::
+    findSyncByte(const U32 start) const
+  {
+    const U32 used = this->getUsed();
+    FW_ASSERT(start <= used, start, used);
+    const U32 begin = (this->m_tail + start) & RING_MASK;
+    const U32 run = (used - start < RING_SIZE - begin) ? used - start : RING_SIZE - begin;
+
+    const U8* const base = &this->m_data[begin];
+    const U8* const end = base + run;
+    const U8* p = base;
+    const U8 first = static_cast<U8>(this->m_syncWord >> 24);
+
+    // Bytes up to a word boundary
+    while (p < end && (reinterpret_cast<POINTER_CAST>(p) & (sizeof(U32) - 1)) != 0) {
+      if (*p == first) {
+        return start + static_cast<U32>(p - base);
+      }
+      p++;
+    }
+
+    // Then a word at a time. XOR with the byte repeated leaves a zero byte
+    // where it matches, and (w - 0x01..) & ~w & 0x80.. is non-zero exactly
+    // when w has a zero byte.
+    const U32 pattern = first * LOW_BITS;
+    while (end - p >= static_cast<NATIVE_INT_TYPE>(sizeof(U32))) {
+      U32 word;
+      (void) memcpy(&word, p, sizeof(word));
+      word ^= pattern;
+      if (((word - LOW_BITS) & ~word & HIGH_BITS) != 0) {
+        break;
+      }
+      p += sizeof(U32);
+    }
+
+    // The matching word, or the tail of the run
+    while (p < end && *p != first) {
+      p++;
+    }
+    return start + static_cast<U32>(p - base);
+  }
+
+  U32 StreamDeframer ::
+    checksum(const U32 offset, const U32 size) const
+  {
+    const U32 start = (this->m_tail + offset) & RING_MASK;
+    const U32 firstSize = (size < RING_SIZE - start) ? size : RING_SIZE - start;
+    U32 crc = Utils::CRC32Engine::INITIAL_VALUE;
+    crc = Utils::CRC32Engine::update(crc, &this->m_data[start], firstSize);
+    crc = Utils::CRC32Engine::update(crc, this->m_data, size - firstSize);
+    return ~crc;
+  }
+
+}
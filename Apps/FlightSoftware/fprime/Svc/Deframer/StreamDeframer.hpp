@@ -0,0 +1,156 @@
+// ======================================================================
+// \title  StreamDeframer.hpp
+// \brief  Ring buffer and resynchronizing parser for uplink frames
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_STREAM_DEFRAMER_HPP
+#define SVC_STREAM_DEFRAMER_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Svc/Deframer/DeframerCfg.hpp>
+
+namespace Svc {
+
+  //! \class StreamDeframer
+  //! \brief Splits an uplink byte stream arriving in arbitrary chunks into frames
+  //!
+  //! A frame is a big-endian sync word, a big-endian size and size bytes
+  //! of packet, the first four of which are the packet descriptor. When
+  //! checksums are enabled the packet is followed by the big-endian CRC-32
+  //! of the packet.
+  //!
+  //! Chunks are pushed into a ring and nextFrame() is called until it
+  //! returns FRAME_NEED_DATA. A frame is returned in place as up to two
+  //! ring segments, so it can be copied straight into its destination
+  //! buffer. It stays valid until the next call to push().
+  //!
+  //! Anything that fails validation, a size out of range or a bad
+  //! checksum, is treated as a false sync word: the parser moves one byte
+  //! on and searches again, so a corrupt byte costs at most the frame it
+  //! landed in.
+  //!
+  class StreamDeframer {
+
+    public:
+
+      enum {
+        RING_SIZE = DEFRAMER_RING_SIZE, //!< Ring size in bytes
+        HEADER_SIZE = 8, //!< Sync word plus size
+        DESC_SIZE = 4, //!< Size of the packet descriptor
+        CHECKSUM_SIZE = 4 //!< Size of the CRC-32 trailer
+      };
+
+      typedef enum {
+        FRAME_OK, //!< A complete frame was returned
+        FRAME_NEED_DATA, //!< No complete frame is buffered
+        FRAME_SIZE_ERROR, //!< A sync word was followed by a size out of range
+        FRAME_CHECKSUM_ERROR //!< A frame failed its checksum
+      } Status;
+
+      //! A parsed frame, in place in the ring
+      struct Frame {
+        U32 descriptor; //!< The packet descriptor
+        U32 size; //!< Size of the packet, including the descriptor
+        const U8* first; //!< First segment of the packet
+        U32 firstSize; //!< Size of the first segment
+        const U8* second; //!< Second segment, where the packet wraps the ring
+        U32 secondSize; //!< Size of the second segment, zero if none
+
+        //! Copy length bytes of the packet from offset to dest
+        void copy(
+            U8* const dest, //!< The destination
+            const U32 offset, //!< Offset into the packet
+            const U32 length //!< Number of bytes to copy
+        ) const;
+      };
+
+      //! Frame counters. Counters are running totals.
+      struct Stats {
+        U32 frames; //!< frames returned
+        U32 discardedBytes; //!< bytes dropped while searching for a sync word
+        U32 sizeErrors; //!< sync words followed by a size out of range
+        U32 checksumErrors; //!< frames that failed the checksum
+      };
+
+      StreamDeframer(void);
+
+      //! Set the sync word, the largest packet accepted and whether frames
+      //! carry a checksum. Discards any buffered bytes.
+      //!
+      void setup(
+          const U32 syncWord, //!< The sync word
+          const U32 maxPacketSize, //!< Largest packet, including the descriptor
+          const bool checksum //!< Frames end with a CRC-32 of the packet
+      );
+
+      //! Discard any buffered bytes, e.g. after a link drop
+      //!
+      void reset(void);
+
+      //! Copy bytes into the ring. Invalidates any previously returned frame.
+      //!
+      //! \return The number of bytes taken, less than size when the ring is full
+      //!
+      U32 push(
+          const U8* const data, //!< The bytes
+          const U32 size //!< The number of bytes
+      );
+
+      //! Parse the next frame from the buffered bytes
+      //!
+      //! \return The parse status
+      //!
+      Status nextFrame(
+          Frame& frame //!< The frame, valid when FRAME_OK is returned
+      );
+
+      //! Get the number of bytes in the ring
+      //!
+      U32 getUsed(void) const;
+
+      //! Copy the counters
+      //!
+      void getStats(
+          Stats& stats //!< The counters
+      ) const;
+
+    PRIVATE:
+
+      //! Byte at an offset from the oldest buffered byte
+      U8 peek(const U32 offset) const;
+
+      //! Big-endian word at an offset from the oldest buffered byte
+      U32 peek32(const U32 offset) const;
+
+      //! Drop bytes from the front of the ring
+      void consume(const U32 size);
+
+      //! Offset of the first byte at or after start that could begin the
+      //! sync word, searching the contiguous run of the ring from start.
+      //! Returns the end of the run when there is none.
+      U32 findSyncByte(const U32 start) const;
+
+      //! CRC-32 of size bytes of the ring starting at offset
+      U32 checksum(const U32 offset, const U32 size) const;
+
+      U8 m_data[RING_SIZE]; //!< Ring storage
+      // The indices run freely and are masked on access, so head - tail
+      // is the fill level even across wraps
+      U32 m_head; //!< Next byte to write
+      U32 m_tail; //!< Oldest buffered byte
+      U32 m_syncWord; //!< Sync word
+      U32 m_maxPacketSize; //!< Largest packet accepted
+      bool m_checksum; //!< Frames carry a CRC-32 trailer
+      Stats m_stats; //!< Counters
+
+  };
+
+}
+
+#endif
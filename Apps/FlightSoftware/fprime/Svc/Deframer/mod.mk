@@ -0,0 +1,5 @@
+SRC = DeframerComponentAi.xml DeframerComponentImpl.cpp StreamDeframer.cpp
+
+HDR = DeframerComponentImpl.hpp StreamDeframer.hpp DeframerCfg.hpp
+
+SUBDIRS = test
@@ -0,0 +1,623 @@
+// ======================================================================
+// \title  Deframer/test/ut/GTestBase.cpp
+// \author Auto-generated
+// \brief  cpp file for Deframer component Google Test harness base class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "GTestBase.hpp"
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  DeframerGTestBase ::
+    DeframerGTestBase(
+#if FW_OBJECT_NAMES == 1
+        const char *const compName,
+        const U32 maxHistorySize
+#else
+        const U32 maxHistorySize
+#endif
+    ) :
+        DeframerTesterBase (
+#if FW_OBJECT_NAMES == 1
+            compName,
+#endif
+            maxHistorySize
+        )
+  {
+
+  }
+
+  DeframerGTestBase ::
+    ~DeframerGTestBase(void)
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Telemetry
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->tlmSize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Total size of all telemetry histories\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmSize << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_Frames
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_DF_Frames_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_DF_Frames->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel DF_Frames\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_DF_Frames->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertTlm_DF_Frames(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_DF_Frames->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel DF_Frames\n"
+      << "  Expected: Less than size of history ("
+      << this->tlmHistory_DF_Frames->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_DF_Frames& e =
+      this->tlmHistory_DF_Frames->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel DF_Frames\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_DiscardedBytes
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_DF_DiscardedBytes_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_DF_DiscardedBytes->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel DF_DiscardedBytes\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_DF_DiscardedBytes->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertTlm_DF_DiscardedBytes(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_DF_DiscardedBytes->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel DF_DiscardedBytes\n"
+      << "  Expected: Less than size of history ("
+      << this->tlmHistory_DF_DiscardedBytes->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_DF_DiscardedBytes& e =
+      this->tlmHistory_DF_DiscardedBytes->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel DF_DiscardedBytes\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_SizeErrors
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_DF_SizeErrors_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_DF_SizeErrors->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel DF_SizeErrors\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_DF_SizeErrors->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertTlm_DF_SizeErrors(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_DF_SizeErrors->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel DF_SizeErrors\n"
+      << "  Expected: Less than size of history ("
+      << this->tlmHistory_DF_SizeErrors->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_DF_SizeErrors& e =
+      this->tlmHistory_DF_SizeErrors->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel DF_SizeErrors\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_ChecksumErrors
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_DF_ChecksumErrors_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_DF_ChecksumErrors->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel DF_ChecksumErrors\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_DF_ChecksumErrors->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertTlm_DF_ChecksumErrors(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_DF_ChecksumErrors->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel DF_ChecksumErrors\n"
+      << "  Expected: Less than size of history ("
+      << this->tlmHistory_DF_ChecksumErrors->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_DF_ChecksumErrors& e =
+      this->tlmHistory_DF_ChecksumErrors->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel DF_ChecksumErrors\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_DroppedPackets
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertTlm_DF_DroppedPackets_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(this->tlmHistory_DF_DroppedPackets->size(), size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for telemetry channel DF_DroppedPackets\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->tlmHistory_DF_DroppedPackets->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertTlm_DF_DroppedPackets(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32& val
+    )
+    const
+  {
+    ASSERT_LT(index, this->tlmHistory_DF_DroppedPackets->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of telemetry channel DF_DroppedPackets\n"
+      << "  Expected: Less than size of history ("
+      << this->tlmHistory_DF_DroppedPackets->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const TlmEntry_DF_DroppedPackets& e =
+      this->tlmHistory_DF_DroppedPackets->at(index);
+    ASSERT_EQ(val, e.arg)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value at index "
+      << index
+      << " on telmetry channel DF_DroppedPackets\n"
+      << "  Expected: " << val << "\n"
+      << "  Actual:   " << e.arg << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Events
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertEvents_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventsSize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Total size of all event histories\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventsSize << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_ChecksumError
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertEvents_DF_ChecksumError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventsSize_DF_ChecksumError)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DF_ChecksumError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventsSize_DF_ChecksumError << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_CommandTooBig
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertEvents_DF_CommandTooBig_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DF_CommandTooBig->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DF_CommandTooBig\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DF_CommandTooBig->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertEvents_DF_CommandTooBig(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32 size
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DF_CommandTooBig->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DF_CommandTooBig\n"
+      << "  Expected: Less than size of history ("
+      << this->eventHistory_DF_CommandTooBig->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DF_CommandTooBig& e =
+      this->eventHistory_DF_CommandTooBig->at(index);
+    ASSERT_EQ(size, e.size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument size at index "
+      << index
+      << " in history of event DF_CommandTooBig\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << e.size << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_AllocationError
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertEvents_DF_AllocationError_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DF_AllocationError->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DF_AllocationError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DF_AllocationError->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertEvents_DF_AllocationError(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32 size
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DF_AllocationError->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DF_AllocationError\n"
+      << "  Expected: Less than size of history ("
+      << this->eventHistory_DF_AllocationError->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DF_AllocationError& e =
+      this->eventHistory_DF_AllocationError->at(index);
+    ASSERT_EQ(size, e.size)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument size at index "
+      << index
+      << " in history of event DF_AllocationError\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << e.size << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_UnknownDescriptor
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertEvents_DF_UnknownDescriptor_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->eventHistory_DF_UnknownDescriptor->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for event DF_UnknownDescriptor\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->eventHistory_DF_UnknownDescriptor->size() << "\n";
+  }
+
+  void DeframerGTestBase ::
+    assertEvents_DF_UnknownDescriptor(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 index,
+        const U32 descriptor
+    ) const
+  {
+    ASSERT_GT(this->eventHistory_DF_UnknownDescriptor->size(), index)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Index into history of event DF_UnknownDescriptor\n"
+      << "  Expected: Less than size of history ("
+      << this->eventHistory_DF_UnknownDescriptor->size() << ")\n"
+      << "  Actual:   " << index << "\n";
+    const EventEntry_DF_UnknownDescriptor& e =
+      this->eventHistory_DF_UnknownDescriptor->at(index);
+    ASSERT_EQ(descriptor, e.descriptor)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Value of argument descriptor at index "
+      << index
+      << " in history of event DF_UnknownDescriptor\n"
+      << "  Expected: " << descriptor << "\n"
+      << "  Actual:   " << e.descriptor << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From ports
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assertFromPortHistory_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistorySize)
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Total size of all from port histories\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistorySize << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: framedDeallocate
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assert_from_framedDeallocate_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistory_framedDeallocate->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for from_framedDeallocate\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistory_framedDeallocate->size() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: comOut
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assert_from_comOut_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistory_comOut->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for from_comOut\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistory_comOut->size() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferAllocate
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assert_from_bufferAllocate_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistory_bufferAllocate->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for from_bufferAllocate\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistory_bufferAllocate->size() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferDeallocate
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assert_from_bufferDeallocate_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistory_bufferDeallocate->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for from_bufferDeallocate\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistory_bufferDeallocate->size() << "\n";
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferOut
+  // ----------------------------------------------------------------------
+
+  void DeframerGTestBase ::
+    assert_from_bufferOut_size(
+        const char *const __callSiteFileName,
+        const U32 __callSiteLineNumber,
+        const U32 size
+    ) const
+  {
+    ASSERT_EQ(size, this->fromPortHistory_bufferOut->size())
+      << "\n"
+      << "  File:     " << __callSiteFileName << "\n"
+      << "  Line:     " << __callSiteLineNumber << "\n"
+      << "  Value:    Size of history for from_bufferOut\n"
+      << "  Expected: " << size << "\n"
+      << "  Actual:   " << this->fromPortHistory_bufferOut->size() << "\n";
+  }
+
+} // end namespace Svc
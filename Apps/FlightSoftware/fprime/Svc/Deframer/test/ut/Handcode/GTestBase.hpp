@@ -0,0 +1,536 @@
+// ======================================================================
+// \title  Deframer/test/ut/GTestBase.hpp
+// \author Auto-generated
+// \brief  hpp file for Deframer component Google Test harness base class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Deframer_GTEST_BASE_HPP
+#define Deframer_GTEST_BASE_HPP
+
+#include "TesterBase.hpp"
+#include "gtest/gtest.h"
+
+// ----------------------------------------------------------------------
+// Macros for telemetry history assertions
+// ----------------------------------------------------------------------
+
+#define ASSERT_TLM_SIZE(size) \
+  this->assertTlm_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_Frames_SIZE(size) \
+  this->assertTlm_DF_Frames_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_Frames(index, value) \
+  this->assertTlm_DF_Frames(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_DF_DiscardedBytes_SIZE(size) \
+  this->assertTlm_DF_DiscardedBytes_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_DiscardedBytes(index, value) \
+  this->assertTlm_DF_DiscardedBytes(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_DF_SizeErrors_SIZE(size) \
+  this->assertTlm_DF_SizeErrors_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_SizeErrors(index, value) \
+  this->assertTlm_DF_SizeErrors(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_DF_ChecksumErrors_SIZE(size) \
+  this->assertTlm_DF_ChecksumErrors_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_ChecksumErrors(index, value) \
+  this->assertTlm_DF_ChecksumErrors(__FILE__, __LINE__, index, value)
+
+#define ASSERT_TLM_DF_DroppedPackets_SIZE(size) \
+  this->assertTlm_DF_DroppedPackets_size(__FILE__, __LINE__, size)
+
+#define ASSERT_TLM_DF_DroppedPackets(index, value) \
+  this->assertTlm_DF_DroppedPackets(__FILE__, __LINE__, index, value)
+
+// ----------------------------------------------------------------------
+// Macros for event history assertions
+// ----------------------------------------------------------------------
+
+#define ASSERT_EVENTS_SIZE(size) \
+  this->assertEvents_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DF_ChecksumError_SIZE(size) \
+  this->assertEvents_DF_ChecksumError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DF_CommandTooBig_SIZE(size) \
+  this->assertEvents_DF_CommandTooBig_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DF_CommandTooBig(index, _size) \
+  this->assertEvents_DF_CommandTooBig(__FILE__, __LINE__, index, _size)
+
+#define ASSERT_EVENTS_DF_AllocationError_SIZE(size) \
+  this->assertEvents_DF_AllocationError_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DF_AllocationError(index, _size) \
+  this->assertEvents_DF_AllocationError(__FILE__, __LINE__, index, _size)
+
+#define ASSERT_EVENTS_DF_UnknownDescriptor_SIZE(size) \
+  this->assertEvents_DF_UnknownDescriptor_size(__FILE__, __LINE__, size)
+
+#define ASSERT_EVENTS_DF_UnknownDescriptor(index, _descriptor) \
+  this->assertEvents_DF_UnknownDescriptor(__FILE__, __LINE__, index, _descriptor)
+
+// ----------------------------------------------------------------------
+// Macros for typed user from port history assertions
+// ----------------------------------------------------------------------
+
+#define ASSERT_FROM_PORT_HISTORY_SIZE(size) \
+  this->assertFromPortHistory_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_framedDeallocate_SIZE(size) \
+  this->assert_from_framedDeallocate_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_framedDeallocate(index, _fwBuffer) \
+  { \
+    ASSERT_GT(this->fromPortHistory_framedDeallocate->size(), static_cast<U32>(index)) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Index into history of from_framedDeallocate\n" \
+    << "  Expected: Less than size of history (" \
+    << this->fromPortHistory_framedDeallocate->size() << ")\n" \
+    << "  Actual:   " << index << "\n"; \
+    const FromPortEntry_framedDeallocate& _e = \
+      this->fromPortHistory_framedDeallocate->at(index); \
+    ASSERT_EQ(_fwBuffer, _e.fwBuffer) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument fwBuffer at index " \
+    << index \
+    << " in history of from_framedDeallocate\n" \
+    << "  Expected: " << _fwBuffer << "\n" \
+    << "  Actual:   " << _e.fwBuffer << "\n"; \
+  }
+
+#define ASSERT_from_comOut_SIZE(size) \
+  this->assert_from_comOut_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_comOut(index, _data, _context) \
+  { \
+    ASSERT_GT(this->fromPortHistory_comOut->size(), static_cast<U32>(index)) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Index into history of from_comOut\n" \
+    << "  Expected: Less than size of history (" \
+    << this->fromPortHistory_comOut->size() << ")\n" \
+    << "  Actual:   " << index << "\n"; \
+    const FromPortEntry_comOut& _e = \
+      this->fromPortHistory_comOut->at(index); \
+    ASSERT_EQ(_data, _e.data) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument data at index " \
+    << index \
+    << " in history of from_comOut\n" \
+    << "  Expected: " << _data << "\n" \
+    << "  Actual:   " << _e.data << "\n"; \
+    ASSERT_EQ(_context, _e.context) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument context at index " \
+    << index \
+    << " in history of from_comOut\n" \
+    << "  Expected: " << _context << "\n" \
+    << "  Actual:   " << _e.context << "\n"; \
+  }
+
+#define ASSERT_from_bufferAllocate_SIZE(size) \
+  this->assert_from_bufferAllocate_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_bufferAllocate(index, _size) \
+  { \
+    ASSERT_GT(this->fromPortHistory_bufferAllocate->size(), static_cast<U32>(index)) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Index into history of from_bufferAllocate\n" \
+    << "  Expected: Less than size of history (" \
+    << this->fromPortHistory_bufferAllocate->size() << ")\n" \
+    << "  Actual:   " << index << "\n"; \
+    const FromPortEntry_bufferAllocate& _e = \
+      this->fromPortHistory_bufferAllocate->at(index); \
+    ASSERT_EQ(_size, _e.size) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument size at index " \
+    << index \
+    << " in history of from_bufferAllocate\n" \
+    << "  Expected: " << _size << "\n" \
+    << "  Actual:   " << _e.size << "\n"; \
+  }
+
+#define ASSERT_from_bufferDeallocate_SIZE(size) \
+  this->assert_from_bufferDeallocate_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_bufferDeallocate(index, _fwBuffer) \
+  { \
+    ASSERT_GT(this->fromPortHistory_bufferDeallocate->size(), static_cast<U32>(index)) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Index into history of from_bufferDeallocate\n" \
+    << "  Expected: Less than size of history (" \
+    << this->fromPortHistory_bufferDeallocate->size() << ")\n" \
+    << "  Actual:   " << index << "\n"; \
+    const FromPortEntry_bufferDeallocate& _e = \
+      this->fromPortHistory_bufferDeallocate->at(index); \
+    ASSERT_EQ(_fwBuffer, _e.fwBuffer) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument fwBuffer at index " \
+    << index \
+    << " in history of from_bufferDeallocate\n" \
+    << "  Expected: " << _fwBuffer << "\n" \
+    << "  Actual:   " << _e.fwBuffer << "\n"; \
+  }
+
+#define ASSERT_from_bufferOut_SIZE(size) \
+  this->assert_from_bufferOut_size(__FILE__, __LINE__, size)
+
+#define ASSERT_from_bufferOut(index, _fwBuffer) \
+  { \
+    ASSERT_GT(this->fromPortHistory_bufferOut->size(), static_cast<U32>(index)) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Index into history of from_bufferOut\n" \
+    << "  Expected: Less than size of history (" \
+    << this->fromPortHistory_bufferOut->size() << ")\n" \
+    << "  Actual:   " << index << "\n"; \
+    const FromPortEntry_bufferOut& _e = \
+      this->fromPortHistory_bufferOut->at(index); \
+    ASSERT_EQ(_fwBuffer, _e.fwBuffer) \
+    << "\n" \
+    << "  File:     " << __FILE__ << "\n" \
+    << "  Line:     " << __LINE__ << "\n" \
+    << "  Value:    Value of argument fwBuffer at index " \
+    << index \
+    << " in history of from_bufferOut\n" \
+    << "  Expected: " << _fwBuffer << "\n" \
+    << "  Actual:   " << _e.fwBuffer << "\n"; \
+  }
+
+namespace Svc {
+
+  //! \class DeframerGTestBase
+  //! \brief Auto-generated base class for Deframer component Google Test harness
+  //!
+  class DeframerGTestBase :
+    public DeframerTesterBase
+  {
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct object DeframerGTestBase
+      //!
+      DeframerGTestBase(
+#if FW_OBJECT_NAMES == 1
+          const char *const compName, /*!< The component name*/
+          const U32 maxHistorySize /*!< The maximum size of each history*/
+#else
+          const U32 maxHistorySize /*!< The maximum size of each history*/
+#endif
+      );
+
+      //! Destroy object DeframerGTestBase
+      //!
+      virtual ~DeframerGTestBase(void);
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Telemetry
+      // ----------------------------------------------------------------------
+
+      //! Assert size of telemetry history
+      //!
+      void assertTlm_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_Frames
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_DF_Frames_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_DF_Frames(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_DiscardedBytes
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_DF_DiscardedBytes_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_DF_DiscardedBytes(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_SizeErrors
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_DF_SizeErrors_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_DF_SizeErrors(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_ChecksumErrors
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_DF_ChecksumErrors_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_DF_ChecksumErrors(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_DroppedPackets
+      // ----------------------------------------------------------------------
+
+      //! Assert telemetry value in history at index
+      //!
+      void assertTlm_DF_DroppedPackets_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertTlm_DF_DroppedPackets(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32& val /*!< The channel value*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Events
+      // ----------------------------------------------------------------------
+
+      void assertEvents_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_ChecksumError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DF_ChecksumError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_CommandTooBig
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DF_CommandTooBig_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DF_CommandTooBig(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 size /*!< The packet size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_AllocationError
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DF_AllocationError_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DF_AllocationError(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 size /*!< The requested size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_UnknownDescriptor
+      // ----------------------------------------------------------------------
+
+      void assertEvents_DF_UnknownDescriptor_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+      void assertEvents_DF_UnknownDescriptor(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 index, /*!< The index*/
+          const U32 descriptor /*!< The packet descriptor*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From ports
+      // ----------------------------------------------------------------------
+
+      void assertFromPortHistory_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From port: framedDeallocate
+      // ----------------------------------------------------------------------
+
+      void assert_from_framedDeallocate_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From port: comOut
+      // ----------------------------------------------------------------------
+
+      void assert_from_comOut_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From port: bufferAllocate
+      // ----------------------------------------------------------------------
+
+      void assert_from_bufferAllocate_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From port: bufferDeallocate
+      // ----------------------------------------------------------------------
+
+      void assert_from_bufferDeallocate_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // From port: bufferOut
+      // ----------------------------------------------------------------------
+
+      void assert_from_bufferOut_size(
+          const char *const __callSiteFileName, /*!< The name of the file containing the call site*/
+          const U32 __callSiteLineNumber, /*!< The line number of the call site*/
+          const U32 size /*!< The asserted size*/
+      ) const;
+
+  };
+
+} // end namespace Svc
+
+#endif
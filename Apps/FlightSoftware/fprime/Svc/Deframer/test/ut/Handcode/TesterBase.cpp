@@ -0,0 +1,1404 @@
+// ======================================================================
+// \title  Deframer/test/ut/TesterBase.cpp
+// \author Auto-generated
+// \brief  cpp file for Deframer component test harness base class
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <stdlib.h>
+#include <string.h>
+#include "TesterBase.hpp"
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction
+  // ----------------------------------------------------------------------
+
+  DeframerTesterBase ::
+    DeframerTesterBase(
+#if FW_OBJECT_NAMES == 1
+        const char *const compName,
+        const U32 maxHistorySize
+#else
+        const U32 maxHistorySize
+#endif
+    ) :
+#if FW_OBJECT_NAMES == 1
+      Fw::PassiveComponentBase(compName)
+#else
+      Fw::PassiveComponentBase()
+#endif
+  {
+    // Initialize telemetry histories
+    this->tlmHistory_DF_Frames =
+      new History<TlmEntry_DF_Frames>(maxHistorySize);
+    this->tlmHistory_DF_DiscardedBytes =
+      new History<TlmEntry_DF_DiscardedBytes>(maxHistorySize);
+    this->tlmHistory_DF_SizeErrors =
+      new History<TlmEntry_DF_SizeErrors>(maxHistorySize);
+    this->tlmHistory_DF_ChecksumErrors =
+      new History<TlmEntry_DF_ChecksumErrors>(maxHistorySize);
+    this->tlmHistory_DF_DroppedPackets =
+      new History<TlmEntry_DF_DroppedPackets>(maxHistorySize);
+    // Initialize event histories
+#if FW_ENABLE_TEXT_LOGGING
+    this->textLogHistory = new History<TextLogEntry>(maxHistorySize);
+#endif
+    this->eventHistory_DF_CommandTooBig =
+      new History<EventEntry_DF_CommandTooBig>(maxHistorySize);
+    this->eventHistory_DF_AllocationError =
+      new History<EventEntry_DF_AllocationError>(maxHistorySize);
+    this->eventHistory_DF_UnknownDescriptor =
+      new History<EventEntry_DF_UnknownDescriptor>(maxHistorySize);
+    // Initialize histories for typed user output ports
+    this->fromPortHistory_framedDeallocate =
+      new History<FromPortEntry_framedDeallocate>(maxHistorySize);
+    this->fromPortHistory_comOut =
+      new History<FromPortEntry_comOut>(maxHistorySize);
+    this->fromPortHistory_bufferAllocate =
+      new History<FromPortEntry_bufferAllocate>(maxHistorySize);
+    this->fromPortHistory_bufferDeallocate =
+      new History<FromPortEntry_bufferDeallocate>(maxHistorySize);
+    this->fromPortHistory_bufferOut =
+      new History<FromPortEntry_bufferOut>(maxHistorySize);
+    // Clear history
+    this->clearHistory();
+  }
+
+  DeframerTesterBase ::
+    ~DeframerTesterBase(void)
+  {
+    // Destroy telemetry histories
+    delete this->tlmHistory_DF_Frames;
+    delete this->tlmHistory_DF_DiscardedBytes;
+    delete this->tlmHistory_DF_SizeErrors;
+    delete this->tlmHistory_DF_ChecksumErrors;
+    delete this->tlmHistory_DF_DroppedPackets;
+    // Destroy event histories
+#if FW_ENABLE_TEXT_LOGGING
+    delete this->textLogHistory;
+#endif
+    delete this->eventHistory_DF_CommandTooBig;
+    delete this->eventHistory_DF_AllocationError;
+    delete this->eventHistory_DF_UnknownDescriptor;
+    // Destroy port histories
+    delete this->fromPortHistory_framedDeallocate;
+    delete this->fromPortHistory_comOut;
+    delete this->fromPortHistory_bufferAllocate;
+    delete this->fromPortHistory_bufferDeallocate;
+    delete this->fromPortHistory_bufferOut;
+  }
+
+  void DeframerTesterBase ::
+    init(
+        const NATIVE_INT_TYPE instance
+    )
+  {
+
+    // Initialize base class
+
+		Fw::PassiveComponentBase::init(instance);
+
+    // Attach input port framedDeallocate
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_framedDeallocate();
+        ++_port
+    ) {
+
+      this->m_from_framedDeallocate[_port].init();
+      this->m_from_framedDeallocate[_port].addCallComp(
+          this,
+          from_framedDeallocate_static
+      );
+      this->m_from_framedDeallocate[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_framedDeallocate[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_framedDeallocate[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port comOut
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_comOut();
+        ++_port
+    ) {
+
+      this->m_from_comOut[_port].init();
+      this->m_from_comOut[_port].addCallComp(
+          this,
+          from_comOut_static
+      );
+      this->m_from_comOut[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_comOut[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_comOut[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port bufferAllocate
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_bufferAllocate();
+        ++_port
+    ) {
+
+      this->m_from_bufferAllocate[_port].init();
+      this->m_from_bufferAllocate[_port].addCallComp(
+          this,
+          from_bufferAllocate_static
+      );
+      this->m_from_bufferAllocate[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_bufferAllocate[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_bufferAllocate[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port bufferDeallocate
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_bufferDeallocate();
+        ++_port
+    ) {
+
+      this->m_from_bufferDeallocate[_port].init();
+      this->m_from_bufferDeallocate[_port].addCallComp(
+          this,
+          from_bufferDeallocate_static
+      );
+      this->m_from_bufferDeallocate[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_bufferDeallocate[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_bufferDeallocate[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port bufferOut
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_bufferOut();
+        ++_port
+    ) {
+
+      this->m_from_bufferOut[_port].init();
+      this->m_from_bufferOut[_port].addCallComp(
+          this,
+          from_bufferOut_static
+      );
+      this->m_from_bufferOut[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_bufferOut[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_bufferOut[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port Tlm
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_Tlm();
+        ++_port
+    ) {
+
+      this->m_from_Tlm[_port].init();
+      this->m_from_Tlm[_port].addCallComp(
+          this,
+          from_Tlm_static
+      );
+      this->m_from_Tlm[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_Tlm[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_Tlm[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port Log
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_Log();
+        ++_port
+    ) {
+
+      this->m_from_Log[_port].init();
+      this->m_from_Log[_port].addCallComp(
+          this,
+          from_Log_static
+      );
+      this->m_from_Log[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_Log[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_Log[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Attach input port LogText
+
+#if FW_ENABLE_TEXT_LOGGING == 1
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_LogText();
+        ++_port
+    ) {
+
+      this->m_from_LogText[_port].init();
+      this->m_from_LogText[_port].addCallComp(
+          this,
+          from_LogText_static
+      );
+      this->m_from_LogText[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_LogText[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_LogText[_port].setObjName(_portName);
+#endif
+
+    }
+#endif
+
+    // Attach input port Time
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_from_Time();
+        ++_port
+    ) {
+
+      this->m_from_Time[_port].init();
+      this->m_from_Time[_port].addCallComp(
+          this,
+          from_Time_static
+      );
+      this->m_from_Time[_port].setPortNum(_port);
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      (void) snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_from_Time[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_from_Time[_port].setObjName(_portName);
+#endif
+
+    }
+
+    // Initialize output port framedIn
+
+    for (
+        NATIVE_INT_TYPE _port = 0;
+        _port < this->getNum_to_framedIn();
+        ++_port
+    ) {
+      this->m_to_framedIn[_port].init();
+
+#if FW_OBJECT_NAMES == 1
+      char _portName[80];
+      snprintf(
+          _portName,
+          sizeof(_portName),
+          "%s_to_framedIn[%d]",
+          this->m_objName,
+          _port
+      );
+      this->m_to_framedIn[_port].setObjName(_portName);
+#endif
+
+    }
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Getters for port counts
+  // ----------------------------------------------------------------------
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_to_framedIn(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_to_framedIn);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_framedDeallocate(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_framedDeallocate);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_comOut(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_comOut);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_bufferAllocate(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_bufferAllocate);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_bufferDeallocate(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_bufferDeallocate);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_bufferOut(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_bufferOut);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_Tlm(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_Tlm);
+  }
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_Log(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_Log);
+  }
+#if FW_ENABLE_TEXT_LOGGING == 1
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_LogText(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_LogText);
+  }
+#endif
+
+  NATIVE_INT_TYPE DeframerTesterBase ::
+    getNum_from_Time(void) const
+  {
+    return (NATIVE_INT_TYPE) FW_NUM_ARRAY_ELEMENTS(this->m_from_Time);
+  }
+
+  // ----------------------------------------------------------------------
+  // Connectors for to ports
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    connect_to_framedIn(
+        const NATIVE_INT_TYPE portNum,
+        Drv::InputSerialReadPort *const framedIn
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_to_framedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_framedIn[portNum].addCallPort(framedIn);
+  }
+
+
+  // ----------------------------------------------------------------------
+  // Invocation functions for to ports
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    invoke_to_framedIn(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &serBuffer,
+        Drv::SerialReadStatus &status
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_to_framedIn(),static_cast<AssertArg>(portNum));
+    FW_ASSERT(portNum < this->getNum_to_framedIn(),static_cast<AssertArg>(portNum));
+    this->m_to_framedIn[portNum].invoke(
+        serBuffer, status
+    );
+  }
+
+  // ----------------------------------------------------------------------
+  // Connection status for to ports
+  // ----------------------------------------------------------------------
+
+  bool DeframerTesterBase ::
+    isConnected_to_framedIn(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_to_framedIn(), static_cast<AssertArg>(portNum));
+    return this->m_to_framedIn[portNum].isConnected();
+  }
+
+  // ----------------------------------------------------------------------
+  // Getters for from ports
+  // ----------------------------------------------------------------------
+ 
+  Fw::InputBufferSendPort *DeframerTesterBase ::
+    get_from_framedDeallocate(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_framedDeallocate(),static_cast<AssertArg>(portNum));
+    return &this->m_from_framedDeallocate[portNum];
+  }
+
+  Fw::InputComPort *DeframerTesterBase ::
+    get_from_comOut(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_comOut(),static_cast<AssertArg>(portNum));
+    return &this->m_from_comOut[portNum];
+  }
+
+  Fw::InputBufferGetPort *DeframerTesterBase ::
+    get_from_bufferAllocate(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferAllocate(),static_cast<AssertArg>(portNum));
+    return &this->m_from_bufferAllocate[portNum];
+  }
+
+  Fw::InputBufferSendPort *DeframerTesterBase ::
+    get_from_bufferDeallocate(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferDeallocate(),static_cast<AssertArg>(portNum));
+    return &this->m_from_bufferDeallocate[portNum];
+  }
+
+  Fw::InputBufferSendPort *DeframerTesterBase ::
+    get_from_bufferOut(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferOut(),static_cast<AssertArg>(portNum));
+    return &this->m_from_bufferOut[portNum];
+  }
+
+  Fw::InputTlmPort *DeframerTesterBase ::
+    get_from_Tlm(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_Tlm(),static_cast<AssertArg>(portNum));
+    return &this->m_from_Tlm[portNum];
+  }
+
+  Fw::InputLogPort *DeframerTesterBase ::
+    get_from_Log(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_Log(),static_cast<AssertArg>(portNum));
+    return &this->m_from_Log[portNum];
+  }
+#if FW_ENABLE_TEXT_LOGGING == 1
+
+  Fw::InputLogTextPort *DeframerTesterBase ::
+    get_from_LogText(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_LogText(),static_cast<AssertArg>(portNum));
+    return &this->m_from_LogText[portNum];
+  }
+#endif
+
+  Fw::InputTimePort *DeframerTesterBase ::
+    get_from_Time(const NATIVE_INT_TYPE portNum)
+  {
+    FW_ASSERT(portNum < this->getNum_from_Time(),static_cast<AssertArg>(portNum));
+    return &this->m_from_Time[portNum];
+  }
+
+  // ----------------------------------------------------------------------
+  // Static functions for from ports
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    from_framedDeallocate_static(
+        Fw::PassiveComponentBase *const callComp,
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(callComp);
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(callComp);
+    _testerBase->from_framedDeallocate_handlerBase(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_comOut_static(
+        Fw::PassiveComponentBase *const callComp,
+        const NATIVE_INT_TYPE portNum,
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    FW_ASSERT(callComp);
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(callComp);
+    _testerBase->from_comOut_handlerBase(
+        portNum,
+        data,
+        context
+    );
+  }
+
+  Fw::Buffer DeframerTesterBase ::
+    from_bufferAllocate_static(
+        Fw::PassiveComponentBase *const callComp,
+        const NATIVE_INT_TYPE portNum,
+        U32 size
+    )
+  {
+    FW_ASSERT(callComp);
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(callComp);
+    return _testerBase->from_bufferAllocate_handlerBase(
+        portNum,
+        size
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_bufferDeallocate_static(
+        Fw::PassiveComponentBase *const callComp,
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(callComp);
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(callComp);
+    _testerBase->from_bufferDeallocate_handlerBase(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_bufferOut_static(
+        Fw::PassiveComponentBase *const callComp,
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(callComp);
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(callComp);
+    _testerBase->from_bufferOut_handlerBase(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_Tlm_static(
+        Fw::PassiveComponentBase *const component,
+        NATIVE_INT_TYPE portNum,
+        FwChanIdType id,
+        Fw::Time &timeTag,
+        Fw::TlmBuffer &val
+    )
+  {
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(component);
+    _testerBase->dispatchTlm(id, timeTag, val);
+  }
+
+  void DeframerTesterBase ::
+    from_Log_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        FwEventIdType id,
+        Fw::Time &timeTag,
+        Fw::LogSeverity severity,
+        Fw::LogBuffer &args
+    )
+  {
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(component);
+    _testerBase->dispatchEvents(id, timeTag, severity, args);
+  }
+
+#if FW_ENABLE_TEXT_LOGGING == 1
+  void DeframerTesterBase ::
+    from_LogText_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        FwEventIdType id,
+        Fw::Time &timeTag,
+        Fw::TextLogSeverity severity,
+        Fw::TextLogString &text
+    )
+  {
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(component);
+    _testerBase->textLogIn(id,timeTag,severity,text);
+  }
+#endif
+
+  void DeframerTesterBase ::
+    from_Time_static(
+        Fw::PassiveComponentBase *const component,
+        const NATIVE_INT_TYPE portNum,
+        Fw::Time& time
+    )
+  {
+    DeframerTesterBase* _testerBase =
+      static_cast<DeframerTesterBase*>(component);
+    time = _testerBase->m_testTime;
+  }
+
+  // ----------------------------------------------------------------------
+  // Histories for typed from ports
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    clearFromPortHistory(void)
+  {
+    this->fromPortHistorySize = 0;
+    this->fromPortHistory_framedDeallocate->clear();
+    this->fromPortHistory_comOut->clear();
+    this->fromPortHistory_bufferAllocate->clear();
+    this->fromPortHistory_bufferDeallocate->clear();
+    this->fromPortHistory_bufferOut->clear();
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: framedDeallocate
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    pushFromPortEntry_framedDeallocate(
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FromPortEntry_framedDeallocate _e = {
+      fwBuffer
+    };
+    this->fromPortHistory_framedDeallocate->push_back(_e);
+    ++this->fromPortHistorySize;
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: comOut
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    pushFromPortEntry_comOut(
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    FromPortEntry_comOut _e = {
+      data, context
+    };
+    this->fromPortHistory_comOut->push_back(_e);
+    ++this->fromPortHistorySize;
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferAllocate
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    pushFromPortEntry_bufferAllocate(
+        U32 size
+    )
+  {
+    FromPortEntry_bufferAllocate _e = {
+      size
+    };
+    this->fromPortHistory_bufferAllocate->push_back(_e);
+    ++this->fromPortHistorySize;
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferDeallocate
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    pushFromPortEntry_bufferDeallocate(
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FromPortEntry_bufferDeallocate _e = {
+      fwBuffer
+    };
+    this->fromPortHistory_bufferDeallocate->push_back(_e);
+    ++this->fromPortHistorySize;
+  }
+
+  // ----------------------------------------------------------------------
+  // From port: bufferOut
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    pushFromPortEntry_bufferOut(
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FromPortEntry_bufferOut _e = {
+      fwBuffer
+    };
+    this->fromPortHistory_bufferOut->push_back(_e);
+    ++this->fromPortHistorySize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler base functions for from ports
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    from_framedDeallocate_handlerBase(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_from_framedDeallocate(),static_cast<AssertArg>(portNum));
+    this->from_framedDeallocate_handler(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_comOut_handlerBase(
+        const NATIVE_INT_TYPE portNum,
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_from_comOut(),static_cast<AssertArg>(portNum));
+    this->from_comOut_handler(
+        portNum,
+        data,
+        context
+    );
+  }
+
+  Fw::Buffer DeframerTesterBase ::
+    from_bufferAllocate_handlerBase(
+        const NATIVE_INT_TYPE portNum,
+        U32 size
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferAllocate(),static_cast<AssertArg>(portNum));
+    return this->from_bufferAllocate_handler(
+        portNum,
+        size
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_bufferDeallocate_handlerBase(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferDeallocate(),static_cast<AssertArg>(portNum));
+    this->from_bufferDeallocate_handler(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  void DeframerTesterBase ::
+    from_bufferOut_handlerBase(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    FW_ASSERT(portNum < this->getNum_from_bufferOut(),static_cast<AssertArg>(portNum));
+    this->from_bufferOut_handler(
+        portNum,
+        fwBuffer
+    );
+  }
+
+  // ----------------------------------------------------------------------
+  // History
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    clearHistory()
+  {
+    this->clearTlm();
+#if FW_ENABLE_TEXT_LOGGING
+    this->textLogHistory->clear();
+#endif
+    this->clearEvents();
+    this->clearFromPortHistory();
+  }
+
+  // ----------------------------------------------------------------------
+  // Time
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    setTestTime(const Fw::Time& time)
+  {
+    this->m_testTime = time;
+  }
+
+  // ----------------------------------------------------------------------
+  // Telemetry dispatch
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    dispatchTlm(
+        const FwChanIdType id,
+        const Fw::Time &timeTag,
+        Fw::TlmBuffer &val
+    )
+  {
+
+    val.resetDeser();
+
+    const U32 idBase = this->getIdBase();
+    FW_ASSERT(id >= idBase, id, idBase);
+
+    switch (id - idBase) {
+
+      case DeframerComponentBase::CHANNELID_DF_FRAMES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing DF_Frames: %d\n", _status);
+          return;
+        }
+        this->tlmInput_DF_Frames(timeTag, arg);
+        break;
+      }
+
+      case DeframerComponentBase::CHANNELID_DF_DISCARDEDBYTES:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing DF_DiscardedBytes: %d\n", _status);
+          return;
+        }
+        this->tlmInput_DF_DiscardedBytes(timeTag, arg);
+        break;
+      }
+
+      case DeframerComponentBase::CHANNELID_DF_SIZEERRORS:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing DF_SizeErrors: %d\n", _status);
+          return;
+        }
+        this->tlmInput_DF_SizeErrors(timeTag, arg);
+        break;
+      }
+
+      case DeframerComponentBase::CHANNELID_DF_CHECKSUMERRORS:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing DF_ChecksumErrors: %d\n", _status);
+          return;
+        }
+        this->tlmInput_DF_ChecksumErrors(timeTag, arg);
+        break;
+      }
+
+      case DeframerComponentBase::CHANNELID_DF_DROPPEDPACKETS:
+      {
+        U32 arg;
+        const Fw::SerializeStatus _status = val.deserialize(arg);
+        if (_status != Fw::FW_SERIALIZE_OK) {
+          printf("Error deserializing DF_DroppedPackets: %d\n", _status);
+          return;
+        }
+        this->tlmInput_DF_DroppedPackets(timeTag, arg);
+        break;
+      }
+
+      default: {
+        FW_ASSERT(0, id);
+        break;
+      }
+
+    }
+
+  }
+
+  void DeframerTesterBase ::
+    clearTlm(void)
+  {
+    this->tlmSize = 0;
+    this->tlmHistory_DF_Frames->clear();
+    this->tlmHistory_DF_DiscardedBytes->clear();
+    this->tlmHistory_DF_SizeErrors->clear();
+    this->tlmHistory_DF_ChecksumErrors->clear();
+    this->tlmHistory_DF_DroppedPackets->clear();
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_Frames
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    tlmInput_DF_Frames(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_DF_Frames e = { timeTag, val };
+    this->tlmHistory_DF_Frames->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_DiscardedBytes
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    tlmInput_DF_DiscardedBytes(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_DF_DiscardedBytes e = { timeTag, val };
+    this->tlmHistory_DF_DiscardedBytes->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_SizeErrors
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    tlmInput_DF_SizeErrors(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_DF_SizeErrors e = { timeTag, val };
+    this->tlmHistory_DF_SizeErrors->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_ChecksumErrors
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    tlmInput_DF_ChecksumErrors(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_DF_ChecksumErrors e = { timeTag, val };
+    this->tlmHistory_DF_ChecksumErrors->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Channel: DF_DroppedPackets
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    tlmInput_DF_DroppedPackets(
+        const Fw::Time& timeTag,
+        const U32& val
+    )
+  {
+    TlmEntry_DF_DroppedPackets e = { timeTag, val };
+    this->tlmHistory_DF_DroppedPackets->push_back(e);
+    ++this->tlmSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event dispatch
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    dispatchEvents(
+        const FwEventIdType id,
+        Fw::Time &timeTag,
+        const Fw::LogSeverity severity,
+        Fw::LogBuffer &args
+    )
+  {
+
+    args.resetDeser();
+
+    const U32 idBase = this->getIdBase();
+    FW_ASSERT(id >= idBase, id, idBase);
+    switch (id - idBase) {
+
+      case DeframerComponentBase::EVENTID_DF_CHECKSUMERROR:
+      {
+
+#if FW_AMPCS_COMPATIBLE
+        // For AMPCS, decode zero arguments
+        Fw::SerializeStatus _zero_status = Fw::FW_SERIALIZE_OK;
+        U8 _noArgs;
+        _zero_status = args.deserialize(_noArgs);
+        FW_ASSERT(
+            _zero_status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_zero_status)
+        );
+#endif
+        this->logIn_WARNING_HI_DF_ChecksumError();
+
+        break;
+
+      }
+
+      case DeframerComponentBase::EVENTID_DF_COMMANDTOOBIG:
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+
+#endif
+        U32 size;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif
+        _status = args.deserialize(size);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_DF_CommandTooBig(size);
+
+        break;
+
+      }
+
+      case DeframerComponentBase::EVENTID_DF_ALLOCATIONERROR:
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+
+#endif
+        U32 size;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif
+        _status = args.deserialize(size);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_DF_AllocationError(size);
+
+        break;
+
+      }
+
+      case DeframerComponentBase::EVENTID_DF_UNKNOWNDESCRIPTOR:
+      {
+
+        Fw::SerializeStatus _status = Fw::FW_SERIALIZE_OK;
+#if FW_AMPCS_COMPATIBLE
+        // Deserialize the number of arguments.
+        U8 _numArgs;
+        _status = args.deserialize(_numArgs);
+        FW_ASSERT(
+          _status == Fw::FW_SERIALIZE_OK,
+          static_cast<AssertArg>(_status)
+        );
+        // verify they match expected.
+        FW_ASSERT(_numArgs == 1,_numArgs,1);
+
+#endif
+        U32 descriptor;
+#if FW_AMPCS_COMPATIBLE
+        {
+          // Deserialize the argument size
+          U8 _argSize;
+          _status = args.deserialize(_argSize);
+          FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+          );
+          FW_ASSERT(_argSize == sizeof(U32),_argSize,sizeof(U32));
+        }
+#endif
+        _status = args.deserialize(descriptor);
+        FW_ASSERT(
+            _status == Fw::FW_SERIALIZE_OK,
+            static_cast<AssertArg>(_status)
+        );
+
+        this->logIn_WARNING_HI_DF_UnknownDescriptor(descriptor);
+
+        break;
+
+      }
+
+      default: {
+        FW_ASSERT(0, id);
+        break;
+      }
+
+    }
+
+  }
+
+  void DeframerTesterBase ::
+    clearEvents(void)
+  {
+    this->eventsSize = 0;
+    this->eventsSize_DF_ChecksumError = 0;
+    this->eventHistory_DF_CommandTooBig->clear();
+    this->eventHistory_DF_AllocationError->clear();
+    this->eventHistory_DF_UnknownDescriptor->clear();
+  }
+
+#if FW_ENABLE_TEXT_LOGGING
+
+  // ----------------------------------------------------------------------
+  // Text events
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    textLogIn(
+        const U32 id,
+        Fw::Time &timeTag,
+        const Fw::TextLogSeverity severity,
+        const Fw::TextLogString &text
+    )
+  {
+    TextLogEntry e = { id, timeTag, severity, text };
+    textLogHistory->push_back(e);
+  }
+
+  void DeframerTesterBase ::
+    printTextLogHistoryEntry(
+        const TextLogEntry& e,
+        FILE* file
+    )
+  {
+    const char *severityString = "UNKNOWN";
+    switch (e.severity) {
+      case Fw::LOG_FATAL:
+        severityString = "FATAL";
+        break;
+      case Fw::LOG_WARNING_HI:
+        severityString = "WARNING_HI";
+        break;
+      case Fw::LOG_WARNING_LO:
+        severityString = "WARNING_LO";
+        break;
+      case Fw::LOG_COMMAND:
+        severityString = "COMMAND";
+        break;
+      case Fw::LOG_ACTIVITY_HI:
+        severityString = "ACTIVITY_HI";
+        break;
+      case Fw::LOG_ACTIVITY_LO:
+        severityString = "ACTIVITY_LO";
+        break;
+      case Fw::LOG_DIAGNOSTIC:
+       severityString = "DIAGNOSTIC";
+        break;
+      default:
+        severityString = "SEVERITY ERROR";
+        break;
+    }
+
+    fprintf(
+        file,
+        "EVENT: (%d) (%d:%d,%d) %s: %s\n",
+        e.id,
+        const_cast<TextLogEntry&>(e).timeTag.getTimeBase(),
+        const_cast<TextLogEntry&>(e).timeTag.getSeconds(),
+        const_cast<TextLogEntry&>(e).timeTag.getUSeconds(),
+        severityString,
+        e.text.toChar()
+    );
+
+  }
+
+  void DeframerTesterBase ::
+    printTextLogHistory(FILE *file)
+  {
+    for (U32 i = 0; i < this->textLogHistory->size(); ++i) {
+      this->printTextLogHistoryEntry(
+          this->textLogHistory->at(i),
+          file
+      );
+    }
+  }
+
+#endif
+
+  // ----------------------------------------------------------------------
+  // Event: DF_ChecksumError
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    logIn_WARNING_HI_DF_ChecksumError(
+        void
+    )
+  {
+    ++this->eventsSize_DF_ChecksumError;
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_CommandTooBig
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    logIn_WARNING_HI_DF_CommandTooBig(
+        U32 size
+    )
+  {
+    EventEntry_DF_CommandTooBig e = {
+      size
+    };
+    eventHistory_DF_CommandTooBig->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_AllocationError
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    logIn_WARNING_HI_DF_AllocationError(
+        U32 size
+    )
+  {
+    EventEntry_DF_AllocationError e = {
+      size
+    };
+    eventHistory_DF_AllocationError->push_back(e);
+    ++this->eventsSize;
+  }
+
+  // ----------------------------------------------------------------------
+  // Event: DF_UnknownDescriptor
+  // ----------------------------------------------------------------------
+
+  void DeframerTesterBase ::
+    logIn_WARNING_HI_DF_UnknownDescriptor(
+        U32 descriptor
+    )
+  {
+    EventEntry_DF_UnknownDescriptor e = {
+      descriptor
+    };
+    eventHistory_DF_UnknownDescriptor->push_back(e);
+    ++this->eventsSize;
+  }
+
+} // end namespace Svc
@@ -0,0 +1,976 @@
+// ======================================================================
+// \title  Deframer/test/ut/TesterBase.hpp
+// \author Auto-generated
+// \brief  hpp file for Deframer component test harness base class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Deframer_TESTER_BASE_HPP
+#define Deframer_TESTER_BASE_HPP
+
+#include <Svc/Deframer/DeframerComponentAc.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Comp/PassiveComponentBase.hpp>
+#include <stdio.h>
+#include <Fw/Port/InputSerializePort.hpp>
+
+namespace Svc {
+
+  //! \class DeframerTesterBase
+  //! \brief Auto-generated base class for Deframer component test harness
+  //!
+  class DeframerTesterBase :
+    public Fw::PassiveComponentBase
+  {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Initialization
+      // ----------------------------------------------------------------------
+
+      //! Initialize object DeframerTesterBase
+      //!
+      virtual void init(
+          const NATIVE_INT_TYPE instance = 0 /*!< The instance number*/
+      );
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Connectors for 'to' ports
+      // Connect these output ports to the input ports under test
+      // ----------------------------------------------------------------------
+
+      //! Connect framedIn to to_framedIn[portNum]
+      //!
+      void connect_to_framedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Drv::InputSerialReadPort *const framedIn /*!< The port*/
+      );
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Getters for 'from' ports
+      // Connect these input ports to the output ports under test
+      // ----------------------------------------------------------------------
+
+      //! Get the port that receives input from framedDeallocate
+      //!
+      //! \return from_framedDeallocate[portNum]
+      //!
+      Fw::InputBufferSendPort* get_from_framedDeallocate(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from comOut
+      //!
+      //! \return from_comOut[portNum]
+      //!
+      Fw::InputComPort* get_from_comOut(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from bufferAllocate
+      //!
+      //! \return from_bufferAllocate[portNum]
+      //!
+      Fw::InputBufferGetPort* get_from_bufferAllocate(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from bufferDeallocate
+      //!
+      //! \return from_bufferDeallocate[portNum]
+      //!
+      Fw::InputBufferSendPort* get_from_bufferDeallocate(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from bufferOut
+      //!
+      //! \return from_bufferOut[portNum]
+      //!
+      Fw::InputBufferSendPort* get_from_bufferOut(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from Tlm
+      //!
+      //! \return from_Tlm[portNum]
+      //!
+      Fw::InputTlmPort* get_from_Tlm(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Get the port that receives input from Log
+      //!
+      //! \return from_Log[portNum]
+      //!
+      Fw::InputLogPort* get_from_Log(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+#if FW_ENABLE_TEXT_LOGGING == 1
+
+      //! Get the port that receives input from LogText
+      //!
+      //! \return from_LogText[portNum]
+      //!
+      Fw::InputLogTextPort* get_from_LogText(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+#endif
+
+      //! Get the port that receives input from Time
+      //!
+      //! \return from_Time[portNum]
+      //!
+      Fw::InputTimePort* get_from_Time(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct object DeframerTesterBase
+      //!
+      DeframerTesterBase(
+#if FW_OBJECT_NAMES == 1
+          const char *const compName, /*!< The component name*/
+          const U32 maxHistorySize /*!< The maximum size of each history*/
+#else
+          const U32 maxHistorySize /*!< The maximum size of each history*/
+#endif
+      );
+
+      //! Destroy object DeframerTesterBase
+      //!
+      virtual ~DeframerTesterBase(void);
+
+      // ----------------------------------------------------------------------
+      // Test history
+      // ----------------------------------------------------------------------
+
+    protected:
+
+      //! \class History
+      //! \brief A history of port inputs
+      //!
+      template <typename T> class History {
+
+        public:
+
+          //! Create a History
+          //!
+          History(
+              const U32 maxSize /*!< The maximum history size*/
+          ) :
+              numEntries(0),
+              maxSize(maxSize)
+          {
+            this->entries = new T[maxSize];
+          }
+
+          //! Destroy a History
+          //!
+          ~History() {
+            delete[] this->entries;
+          }
+
+          //! Clear the history
+          //!
+          void clear() { this->numEntries = 0; }
+
+          //! Push an item onto the history
+          //!
+          void push_back(
+              T entry /*!< The item*/
+          ) {
+            FW_ASSERT(this->numEntries < this->maxSize);
+            entries[this->numEntries++] = entry;
+          }
+
+          //! Get an item at an index
+          //!
+          //! \return The item at index i
+          //!
+          T at(
+              const U32 i /*!< The index*/
+          ) const {
+            FW_ASSERT(i < this->numEntries);
+            return entries[i];
+          }
+
+          //! Get the number of entries in the history
+          //!
+          //! \return The number of entries in the history
+          //!
+          U32 size(void) const { return this->numEntries; }
+
+        private:
+
+          //! The number of entries in the history
+          //!
+          U32 numEntries;
+
+          //! The maximum history size
+          //!
+          const U32 maxSize;
+
+          //! The entries
+          //!
+          T *entries;
+
+      };
+
+      //! Clear all history
+      //!
+      void clearHistory(void);
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Handler prototypes for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler prototype for from_framedDeallocate
+      //!
+      virtual void from_framedDeallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      ) = 0;
+
+      //! Handler base function for from_framedDeallocate
+      //!
+      void from_framedDeallocate_handlerBase(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! Handler prototype for from_comOut
+      //!
+      virtual void from_comOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      ) = 0;
+
+      //! Handler base function for from_comOut
+      //!
+      void from_comOut_handlerBase(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+      //! Handler prototype for from_bufferAllocate
+      //!
+      virtual Fw::Buffer from_bufferAllocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size 
+      ) = 0;
+
+      //! Handler base function for from_bufferAllocate
+      //!
+      Fw::Buffer from_bufferAllocate_handlerBase(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size 
+      );
+
+      //! Handler prototype for from_bufferDeallocate
+      //!
+      virtual void from_bufferDeallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      ) = 0;
+
+      //! Handler base function for from_bufferDeallocate
+      //!
+      void from_bufferDeallocate_handlerBase(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! Handler prototype for from_bufferOut
+      //!
+      virtual void from_bufferOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      ) = 0;
+
+      //! Handler base function for from_bufferOut
+      //!
+      void from_bufferOut_handlerBase(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Histories for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Clear from port history
+      //!
+      void clearFromPortHistory(void);
+
+      //! The total number of from port entries
+      //!
+      U32 fromPortHistorySize;
+
+      //! Push an entry on the history for from_framedDeallocate
+      void pushFromPortEntry_framedDeallocate(
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! A history entry for from_framedDeallocate
+      //!
+      typedef struct {
+        Fw::Buffer fwBuffer;
+      } FromPortEntry_framedDeallocate;
+
+      //! The history for from_framedDeallocate
+      //!
+      History<FromPortEntry_framedDeallocate>
+        *fromPortHistory_framedDeallocate;
+
+      //! Push an entry on the history for from_comOut
+      void pushFromPortEntry_comOut(
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+      //! A history entry for from_comOut
+      //!
+      typedef struct {
+        Fw::ComBuffer data;
+        U32 context;
+      } FromPortEntry_comOut;
+
+      //! The history for from_comOut
+      //!
+      History<FromPortEntry_comOut>
+        *fromPortHistory_comOut;
+
+      //! Push an entry on the history for from_bufferAllocate
+      void pushFromPortEntry_bufferAllocate(
+          U32 size 
+      );
+
+      //! A history entry for from_bufferAllocate
+      //!
+      typedef struct {
+        U32 size;
+      } FromPortEntry_bufferAllocate;
+
+      //! The history for from_bufferAllocate
+      //!
+      History<FromPortEntry_bufferAllocate>
+        *fromPortHistory_bufferAllocate;
+
+      //! Push an entry on the history for from_bufferDeallocate
+      void pushFromPortEntry_bufferDeallocate(
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! A history entry for from_bufferDeallocate
+      //!
+      typedef struct {
+        Fw::Buffer fwBuffer;
+      } FromPortEntry_bufferDeallocate;
+
+      //! The history for from_bufferDeallocate
+      //!
+      History<FromPortEntry_bufferDeallocate>
+        *fromPortHistory_bufferDeallocate;
+
+      //! Push an entry on the history for from_bufferOut
+      void pushFromPortEntry_bufferOut(
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! A history entry for from_bufferOut
+      //!
+      typedef struct {
+        Fw::Buffer fwBuffer;
+      } FromPortEntry_bufferOut;
+
+      //! The history for from_bufferOut
+      //!
+      History<FromPortEntry_bufferOut>
+        *fromPortHistory_bufferOut;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Invocation functions for to ports
+      // ----------------------------------------------------------------------
+
+      //! Invoke the to port connected to framedIn
+      //!
+      void invoke_to_framedIn(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &serBuffer, /*!< Buffer containing data*/
+          Drv::SerialReadStatus &status /*!< Status of read*/
+      );
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Getters for port counts
+      // ----------------------------------------------------------------------
+
+      //! Get the number of to_framedIn ports
+      //!
+      //! \return The number of to_framedIn ports
+      //!
+      NATIVE_INT_TYPE getNum_to_framedIn(void) const;
+
+      //! Get the number of from_framedDeallocate ports
+      //!
+      //! \return The number of from_framedDeallocate ports
+      //!
+      NATIVE_INT_TYPE getNum_from_framedDeallocate(void) const;
+
+      //! Get the number of from_comOut ports
+      //!
+      //! \return The number of from_comOut ports
+      //!
+      NATIVE_INT_TYPE getNum_from_comOut(void) const;
+
+      //! Get the number of from_bufferAllocate ports
+      //!
+      //! \return The number of from_bufferAllocate ports
+      //!
+      NATIVE_INT_TYPE getNum_from_bufferAllocate(void) const;
+
+      //! Get the number of from_bufferDeallocate ports
+      //!
+      //! \return The number of from_bufferDeallocate ports
+      //!
+      NATIVE_INT_TYPE getNum_from_bufferDeallocate(void) const;
+
+      //! Get the number of from_bufferOut ports
+      //!
+      //! \return The number of from_bufferOut ports
+      //!
+      NATIVE_INT_TYPE getNum_from_bufferOut(void) const;
+
+      //! Get the number of from_Tlm ports
+      //!
+      //! \return The number of from_Tlm ports
+      //!
+      NATIVE_INT_TYPE getNum_from_Tlm(void) const;
+
+      //! Get the number of from_Log ports
+      //!
+      //! \return The number of from_Log ports
+      //!
+      NATIVE_INT_TYPE getNum_from_Log(void) const;
+#if FW_ENABLE_TEXT_LOGGING == 1
+
+      //! Get the number of from_LogText ports
+      //!
+      //! \return The number of from_LogText ports
+      //!
+      NATIVE_INT_TYPE getNum_from_LogText(void) const;
+#endif
+
+      //! Get the number of from_Time ports
+      //!
+      //! \return The number of from_Time ports
+      //!
+      NATIVE_INT_TYPE getNum_from_Time(void) const;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Connection status for to ports
+      // ----------------------------------------------------------------------
+
+      //! Check whether port is connected
+      //!
+      //! Whether to_framedIn[portNum] is connected
+      //!
+      bool isConnected_to_framedIn(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event dispatch
+      // ----------------------------------------------------------------------
+
+      //! Dispatch an event
+      //!
+      void dispatchEvents(
+          const FwEventIdType id, /*!< The event ID*/
+          Fw::Time& timeTag, /*!< The time*/
+          const Fw::LogSeverity severity, /*!< The severity*/
+          Fw::LogBuffer& args /*!< The serialized arguments*/
+      );
+
+      //! Clear event history
+      //!
+      void clearEvents(void);
+
+      //! The total number of events seen
+      //!
+      U32 eventsSize;
+
+#if FW_ENABLE_TEXT_LOGGING
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Text events
+      // ----------------------------------------------------------------------
+
+      //! Handle a text event
+      //!
+      virtual void textLogIn(
+          const FwEventIdType id, /*!< The event ID*/
+          Fw::Time& timeTag, /*!< The time*/
+          const Fw::TextLogSeverity severity, /*!< The severity*/
+          const Fw::TextLogString& text /*!< The event string*/
+      );
+
+      //! A history entry for the text log
+      //!
+      typedef struct {
+        U32 id;
+        Fw::Time timeTag;
+        Fw::TextLogSeverity severity;
+        Fw::TextLogString text;
+      } TextLogEntry;
+
+      //! The history of text log events
+      //!
+      History<TextLogEntry> *textLogHistory;
+
+      //! Print a text log history entry
+      //!
+      static void printTextLogHistoryEntry(
+          const TextLogEntry& e,
+          FILE* file
+      );
+
+      //! Print the text log history
+      //!
+      void printTextLogHistory(FILE *const file);
+
+#endif
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_ChecksumError
+      // ----------------------------------------------------------------------
+
+      //! Handle event DF_ChecksumError
+      //!
+      virtual void logIn_WARNING_HI_DF_ChecksumError(
+          void
+      );
+
+      //! Size of history for event DF_ChecksumError
+      //!
+      U32 eventsSize_DF_ChecksumError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_CommandTooBig
+      // ----------------------------------------------------------------------
+
+      //! Handle event DF_CommandTooBig
+      //!
+      virtual void logIn_WARNING_HI_DF_CommandTooBig(
+          U32 size /*!< The packet size*/
+      );
+
+      //! A history entry for event DF_CommandTooBig
+      //!
+      typedef struct {
+        U32 size;
+      } EventEntry_DF_CommandTooBig;
+
+      //! The history of DF_CommandTooBig events
+      //!
+      History<EventEntry_DF_CommandTooBig>
+        *eventHistory_DF_CommandTooBig;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_AllocationError
+      // ----------------------------------------------------------------------
+
+      //! Handle event DF_AllocationError
+      //!
+      virtual void logIn_WARNING_HI_DF_AllocationError(
+          U32 size /*!< The requested size*/
+      );
+
+      //! A history entry for event DF_AllocationError
+      //!
+      typedef struct {
+        U32 size;
+      } EventEntry_DF_AllocationError;
+
+      //! The history of DF_AllocationError events
+      //!
+      History<EventEntry_DF_AllocationError>
+        *eventHistory_DF_AllocationError;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Event: DF_UnknownDescriptor
+      // ----------------------------------------------------------------------
+
+      //! Handle event DF_UnknownDescriptor
+      //!
+      virtual void logIn_WARNING_HI_DF_UnknownDescriptor(
+          U32 descriptor /*!< The packet descriptor*/
+      );
+
+      //! A history entry for event DF_UnknownDescriptor
+      //!
+      typedef struct {
+        U32 descriptor;
+      } EventEntry_DF_UnknownDescriptor;
+
+      //! The history of DF_UnknownDescriptor events
+      //!
+      History<EventEntry_DF_UnknownDescriptor>
+        *eventHistory_DF_UnknownDescriptor;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Telemetry dispatch
+      // ----------------------------------------------------------------------
+
+      //! Dispatch telemetry
+      //!
+      void dispatchTlm(
+          const FwChanIdType id, /*!< The channel ID*/
+          const Fw::Time& timeTag, /*!< The time*/
+          Fw::TlmBuffer& val /*!< The channel value*/
+      );
+
+      //! Clear telemetry history
+      //!
+      void clearTlm(void);
+
+      //! The total number of telemetry inputs seen
+      //!
+      U32 tlmSize;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_Frames
+      // ----------------------------------------------------------------------
+
+      //! Handle channel DF_Frames
+      //!
+      virtual void tlmInput_DF_Frames(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel DF_Frames
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_DF_Frames;
+
+      //! The history of DF_Frames values
+      //!
+      History<TlmEntry_DF_Frames>
+        *tlmHistory_DF_Frames;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_DiscardedBytes
+      // ----------------------------------------------------------------------
+
+      //! Handle channel DF_DiscardedBytes
+      //!
+      virtual void tlmInput_DF_DiscardedBytes(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel DF_DiscardedBytes
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_DF_DiscardedBytes;
+
+      //! The history of DF_DiscardedBytes values
+      //!
+      History<TlmEntry_DF_DiscardedBytes>
+        *tlmHistory_DF_DiscardedBytes;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_SizeErrors
+      // ----------------------------------------------------------------------
+
+      //! Handle channel DF_SizeErrors
+      //!
+      virtual void tlmInput_DF_SizeErrors(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel DF_SizeErrors
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_DF_SizeErrors;
+
+      //! The history of DF_SizeErrors values
+      //!
+      History<TlmEntry_DF_SizeErrors>
+        *tlmHistory_DF_SizeErrors;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_ChecksumErrors
+      // ----------------------------------------------------------------------
+
+      //! Handle channel DF_ChecksumErrors
+      //!
+      virtual void tlmInput_DF_ChecksumErrors(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel DF_ChecksumErrors
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_DF_ChecksumErrors;
+
+      //! The history of DF_ChecksumErrors values
+      //!
+      History<TlmEntry_DF_ChecksumErrors>
+        *tlmHistory_DF_ChecksumErrors;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Channel: DF_DroppedPackets
+      // ----------------------------------------------------------------------
+
+      //! Handle channel DF_DroppedPackets
+      //!
+      virtual void tlmInput_DF_DroppedPackets(
+          const Fw::Time& timeTag, /*!< The time*/
+          const U32& val /*!< The channel value*/
+      );
+
+      //! A telemetry entry for channel DF_DroppedPackets
+      //!
+      typedef struct {
+        Fw::Time timeTag;
+        U32 arg;
+      } TlmEntry_DF_DroppedPackets;
+
+      //! The history of DF_DroppedPackets values
+      //!
+      History<TlmEntry_DF_DroppedPackets>
+        *tlmHistory_DF_DroppedPackets;
+
+    protected:
+
+      // ----------------------------------------------------------------------
+      // Test time
+      // ----------------------------------------------------------------------
+
+      //! Set the test time for events and telemetry
+      //!
+      void setTestTime(
+          const Fw::Time& timeTag /*!< The time*/
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // To ports
+      // ----------------------------------------------------------------------
+
+      //! To port connected to framedIn
+      //!
+      Drv::OutputSerialReadPort m_to_framedIn[1];
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // From ports
+      // ----------------------------------------------------------------------
+
+      //! From port connected to framedDeallocate
+      //!
+      Fw::InputBufferSendPort m_from_framedDeallocate[1];
+
+      //! From port connected to comOut
+      //!
+      Fw::InputComPort m_from_comOut[1];
+
+      //! From port connected to bufferAllocate
+      //!
+      Fw::InputBufferGetPort m_from_bufferAllocate[1];
+
+      //! From port connected to bufferDeallocate
+      //!
+      Fw::InputBufferSendPort m_from_bufferDeallocate[1];
+
+      //! From port connected to bufferOut
+      //!
+      Fw::InputBufferSendPort m_from_bufferOut[1];
+
+      //! From port connected to Tlm
+      //!
+      Fw::InputTlmPort m_from_Tlm[1];
+
+      //! From port connected to Log
+      //!
+      Fw::InputLogPort m_from_Log[1];
+#if FW_ENABLE_TEXT_LOGGING == 1
+
+      //! From port connected to LogText
+      //!
+      Fw::InputLogTextPort m_from_LogText[1];
+#endif
+
+      //! From port connected to Time
+      //!
+      Fw::InputTimePort m_from_Time[1];
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Static functions for output ports
+      // ----------------------------------------------------------------------
+
+      //! Static function for port from_framedDeallocate
+      //!
+      static void from_framedDeallocate_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! Static function for port from_comOut
+      //!
+      static void from_comOut_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+      //! Static function for port from_bufferAllocate
+      //!
+      static Fw::Buffer from_bufferAllocate_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size 
+      );
+
+      //! Static function for port from_bufferDeallocate
+      //!
+      static void from_bufferDeallocate_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! Static function for port from_bufferOut
+      //!
+      static void from_bufferOut_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer 
+      );
+
+      //! Static function for port from_Tlm
+      //!
+      static void from_Tlm_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwChanIdType id, /*!< Telemetry Channel ID*/
+          Fw::Time &timeTag, /*!< Time Tag*/
+          Fw::TlmBuffer &val /*!< Buffer containing serialized telemetry value*/
+      );
+
+      //! Static function for port from_Log
+      //!
+      static void from_Log_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwEventIdType id, /*!< Log ID*/
+          Fw::Time &timeTag, /*!< Time Tag*/
+          Fw::LogSeverity severity, /*!< The severity argument*/
+          Fw::LogBuffer &args /*!< Buffer containing serialized log entry*/
+      );
+
+#if FW_ENABLE_TEXT_LOGGING == 1
+      //! Static function for port from_LogText
+      //!
+      static void from_LogText_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          FwEventIdType id, /*!< Log ID*/
+          Fw::Time &timeTag, /*!< Time Tag*/
+          Fw::TextLogSeverity severity, /*!< The severity argument*/
+          Fw::TextLogString &text /*!< Text of log message*/
+      );
+#endif
+
+      //! Static function for port from_Time
+      //!
+      static void from_Time_static(
+          Fw::PassiveComponentBase *const callComp, /*!< The component instance*/
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Time &time /*!< The U32 cmd argument*/
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Test time
+      // ----------------------------------------------------------------------
+
+      //! Test time stamp
+      //!
+      Fw::Time m_testTime;
+
+  };
+
+} // end namespace Svc
+
+#endif
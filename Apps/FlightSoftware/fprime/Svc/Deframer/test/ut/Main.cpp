@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------
+// Main.cpp
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Deframer, ChunkedFrames) {
+  Svc::Tester tester;
+  tester.chunkedFrames();
+}
+
+TEST(Deframer, ChunkLargerThanRing) {
+  Svc::Tester tester;
+  tester.chunkLargerThanRing();
+}
+
+TEST(Deframer, FullRingMakesProgress) {
+  Svc::Tester tester;
+  tester.fullRingMakesProgress();
+}
+
+TEST(Deframer, ReadErrors) {
+  Svc::Tester tester;
+  tester.readErrors();
+}
+
+TEST(Deframer, CommandTooBig) {
+  Svc::Tester tester;
+  tester.commandTooBig();
+}
+
+TEST(Deframer, UnknownDescriptor) {
+  Svc::Tester tester;
+  tester.unknownDescriptor();
+}
+
+TEST(Deframer, AllocationFails) {
+  Svc::Tester tester;
+  tester.allocationFails();
+}
+
+TEST(Deframer, ShortBuffer) {
+  Svc::Tester tester;
+  tester.shortBuffer();
+}
+
+TEST(Deframer, UnconnectedOutputs) {
+  Svc::Tester tester(false);
+  tester.unconnectedOutputs();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
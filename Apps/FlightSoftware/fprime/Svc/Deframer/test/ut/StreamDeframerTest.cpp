@@ -0,0 +1,370 @@
+// ----------------------------------------------------------------------
+// StreamDeframerTest.cpp
+// ----------------------------------------------------------------------
+//
+// Feeds StreamDeframer whole, split and corrupted frames, then noisy
+// streams in random chunk sizes.
+
+#include <Svc/Deframer/StreamDeframer.hpp>
+#include <Utils/Hash/crc32/CRC32Engine.hpp>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+
+namespace {
+
+  typedef std::vector<U8> Bytes;
+
+  const U32 SYNC = Svc::DEFRAMER_SYNC_WORD;
+  const U32 MAX_PACKET =
+      Svc::StreamDeframer::RING_SIZE - Svc::StreamDeframer::HEADER_SIZE - Svc::StreamDeframer::CHECKSUM_SIZE;
+
+  //! xorshift32, so runs are repeatable
+  class Random {
+    public:
+      explicit Random(U32 seed) : m_state(seed) {}
+      U32 next(void) {
+        this->m_state ^= this->m_state << 13;
+        this->m_state ^= this->m_state >> 17;
+        this->m_state ^= this->m_state << 5;
+        return this->m_state;
+      }
+      //! Uniform in [low, high]
+      U32 range(U32 low, U32 high) {
+        return low + this->next() % (high - low + 1);
+      }
+    private:
+      U32 m_state;
+  };
+
+  void appendBe32(Bytes& out, U32 value) {
+    out.push_back(static_cast<U8>(value >> 24));
+    out.push_back(static_cast<U8>(value >> 16));
+    out.push_back(static_cast<U8>(value >> 8));
+    out.push_back(static_cast<U8>(value));
+  }
+
+  //! A packet: descriptor then payload
+  Bytes makePacket(U32 descriptor, U32 payloadSize, U32 seed) {
+    Bytes packet;
+    appendBe32(packet, descriptor);
+    for (U32 i = 0; i < payloadSize; i++) {
+      packet.push_back(static_cast<U8>(seed + i * 13));
+    }
+    return packet;
+  }
+
+  void appendFrame(Bytes& out, const Bytes& packet, bool checksum) {
+    appendBe32(out, SYNC);
+    appendBe32(out, packet.size());
+    out.insert(out.end(), packet.begin(), packet.end());
+    if (checksum) {
+      const U32 crc = Utils::CRC32Engine::update(Utils::CRC32Engine::INITIAL_VALUE, &packet[0], packet.size());
+      appendBe32(out, ~crc);
+    }
+  }
+
+  //! Bytes that never contain the first sync word byte
+  void appendQuietNoise(Bytes& out, U32 size, Random& random) {
+    for (U32 i = 0; i < size; i++) {
+      U8 byte = static_cast<U8>(random.next());
+      if (byte == static_cast<U8>(SYNC >> 24)) {
+        byte++;
+      }
+      out.push_back(byte);
+    }
+  }
+
+  //! Any bytes, including runs of the sync byte
+  void appendNoise(Bytes& out, U32 size, Random& random) {
+    for (U32 i = 0; i < size; i++) {
+      const U32 r = random.next();
+      out.push_back((r & 0x700) == 0 ? static_cast<U8>(SYNC >> 24) : static_cast<U8>(r));
+    }
+  }
+
+  //! Copy a returned frame out of the ring
+  Bytes framePacket(const Svc::StreamDeframer::Frame& frame) {
+    Bytes packet(frame.size);
+    frame.copy(&packet[0], 0, frame.size);
+    return packet;
+  }
+
+  //! Push a stream in chunks of the given sizes, collecting every frame
+  void feed(Svc::StreamDeframer& deframer, const Bytes& stream, Random* random, U32 maxChunk,
+      std::vector<Bytes>& packets) {
+    U32 offset = 0;
+    while (offset < stream.size()) {
+      U32 chunk = (random != NULL) ? random->range(1, maxChunk) : maxChunk;
+      if (chunk > stream.size() - offset) {
+        chunk = stream.size() - offset;
+      }
+      U32 taken = 0;
+      while (taken < chunk) {
+        taken += deframer.push(&stream[offset + taken], chunk - taken);
+        Svc::StreamDeframer::Frame frame;
+        Svc::StreamDeframer::Status status;
+        while ((status = deframer.nextFrame(frame)) != Svc::StreamDeframer::FRAME_NEED_DATA) {
+          if (status == Svc::StreamDeframer::FRAME_OK) {
+            packets.push_back(framePacket(frame));
+          }
+        }
+      }
+      offset += chunk;
+    }
+  }
+
+  F64 nowNsec(void) {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return static_cast<F64>(t.tv_sec) * 1.0e9 + t.tv_nsec;
+  }
+
+}
+
+TEST(StreamDeframer, SingleFrame) {
+  Svc::StreamDeframer deframer;
+  const Bytes packet = makePacket(0, 20, 1);
+  Bytes stream;
+  appendFrame(stream, packet, false);
+
+  ASSERT_EQ(stream.size(), deframer.push(&stream[0], stream.size()));
+  Svc::StreamDeframer::Frame frame;
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_OK, deframer.nextFrame(frame));
+  ASSERT_EQ(0U, frame.descriptor);
+  ASSERT_EQ(packet.size(), frame.size);
+  ASSERT_EQ(0U, frame.secondSize);
+  ASSERT_TRUE(packet == framePacket(frame));
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_NEED_DATA, deframer.nextFrame(frame));
+  ASSERT_EQ(0U, deframer.getUsed());
+
+  // Part of a packet
+  U8 part[5];
+  frame.copy(part, 6, sizeof(part));
+  ASSERT_EQ(0, memcmp(&packet[6], part, sizeof(part)));
+
+  Svc::StreamDeframer::Stats stats;
+  deframer.getStats(stats);
+  ASSERT_EQ(1U, stats.frames);
+  ASSERT_EQ(0U, stats.discardedBytes);
+}
+
+TEST(StreamDeframer, EverySplit) {
+  Bytes stream;
+  appendFrame(stream, makePacket(0, 9, 2), true);
+  appendFrame(stream, makePacket(3, 30, 3), true);
+
+  for (U32 split = 1; split < stream.size(); split++) {
+    Svc::StreamDeframer deframer;
+    deframer.setup(SYNC, MAX_PACKET, true);
+    std::vector<Bytes> packets;
+    feed(deframer, Bytes(stream.begin(), stream.begin() + split), NULL, split, packets);
+    feed(deframer, Bytes(stream.begin() + split, stream.end()), NULL, stream.size(), packets);
+    ASSERT_EQ(2U, packets.size()) << "split " << split;
+    ASSERT_TRUE(makePacket(0, 9, 2) == packets[0]);
+    ASSERT_TRUE(makePacket(3, 30, 3) == packets[1]);
+  }
+}
+
+TEST(StreamDeframer, ResyncAfterNoise) {
+  Random random(1);
+  Svc::StreamDeframer deframer;
+  const Bytes packet = makePacket(0, 40, 4);
+
+  // Every alignment of the noise, so the word-at-a-time search starts
+  // from each offset within a word
+  U32 expectedDiscard = 0;
+  for (U32 noise = 1; noise <= 67; noise++) {
+    Bytes stream;
+    appendQuietNoise(stream, noise, random);
+    appendFrame(stream, packet, false);
+    std::vector<Bytes> packets;
+    feed(deframer, stream, NULL, stream.size(), packets);
+    ASSERT_EQ(1U, packets.size());
+    ASSERT_TRUE(packet == packets[0]);
+    expectedDiscard += noise;
+  }
+
+  Svc::StreamDeframer::Stats stats;
+  deframer.getStats(stats);
+  ASSERT_EQ(expectedDiscard, stats.discardedBytes);
+}
+
+TEST(StreamDeframer, PartialSyncPrefix) {
+  // Sync bytes ahead of the real sync word, as from a truncated frame
+  Svc::StreamDeframer deframer;
+  const Bytes packet = makePacket(0, 12, 5);
+  Bytes stream(3, static_cast<U8>(SYNC >> 24));
+  appendFrame(stream, packet, false);
+  std::vector<Bytes> packets;
+  feed(deframer, stream, NULL, 1, packets);
+  ASSERT_EQ(1U, packets.size());
+  ASSERT_TRUE(packet == packets[0]);
+}
+
+TEST(StreamDeframer, SizeOutOfRange) {
+  Svc::StreamDeframer deframer;
+  deframer.setup(SYNC, 100, false);
+  const Bytes packet = makePacket(0, 8, 6);
+
+  Bytes stream;
+  appendBe32(stream, SYNC);
+  appendBe32(stream, 3);
+  appendBe32(stream, SYNC);
+  appendBe32(stream, 101);
+  appendFrame(stream, packet, false);
+
+  deframer.push(&stream[0], stream.size());
+  Svc::StreamDeframer::Frame frame;
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_SIZE_ERROR, deframer.nextFrame(frame));
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_SIZE_ERROR, deframer.nextFrame(frame));
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_OK, deframer.nextFrame(frame));
+  ASSERT_TRUE(packet == framePacket(frame));
+
+  Svc::StreamDeframer::Stats stats;
+  deframer.getStats(stats);
+  ASSERT_EQ(2U, stats.sizeErrors);
+  ASSERT_EQ(16U, stats.discardedBytes);
+}
+
+TEST(StreamDeframer, ChecksumRejects) {
+  Svc::StreamDeframer deframer;
+  deframer.setup(SYNC, MAX_PACKET, true);
+  const Bytes bad = makePacket(0, 50, 7);
+  const Bytes good = makePacket(3, 50, 8);
+
+  Bytes stream;
+  appendFrame(stream, bad, true);
+  stream[Svc::StreamDeframer::HEADER_SIZE + 20] ^= 0x10;
+  appendFrame(stream, good, true);
+
+  deframer.push(&stream[0], stream.size());
+  Svc::StreamDeframer::Frame frame;
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_CHECKSUM_ERROR, deframer.nextFrame(frame));
+  ASSERT_EQ(Svc::StreamDeframer::FRAME_OK, deframer.nextFrame(frame));
+  ASSERT_TRUE(good == framePacket(frame));
+
+  Svc::StreamDeframer::Stats stats;
+  deframer.getStats(stats);
+  ASSERT_EQ(1U, stats.checksumErrors);
+  ASSERT_EQ(1U, stats.frames);
+}
+
+TEST(StreamDeframer, WrapsRing) {
+  Svc::StreamDeframer deframer;
+  deframer.setup(SYNC, MAX_PACKET, true);
+  const Bytes packet = makePacket(3, 1000, 9);
+
+  // Walk the frame around the ring so every packet position is seen,
+  // including split descriptors, split checksums and split sync words
+  Bytes stream;
+  appendFrame(stream, packet, true);
+  bool wrapped = false;
+  for (U32 round = 0; round < 200; round++) {
+    Bytes step(round % 7 + 1, 0);
+    step.insert(step.end(), stream.begin(), stream.end());
+    ASSERT_EQ(step.size(), deframer.push(&step[0], step.size()));
+    Svc::StreamDeframer::Frame frame;
+    ASSERT_EQ(Svc::StreamDeframer::FRAME_OK, deframer.nextFrame(frame));
+    ASSERT_TRUE(packet == framePacket(frame));
+    wrapped = wrapped || (frame.secondSize > 0);
+  }
+  ASSERT_TRUE(wrapped);
+}
+
+TEST(StreamDeframer, FullRingMakesProgress) {
+  Svc::StreamDeframer deframer;
+  deframer.setup(SYNC, MAX_PACKET, true);
+
+  // A largest frame fills the ring exactly
+  const Bytes packet = makePacket(0, MAX_PACKET - Svc::StreamDeframer::DESC_SIZE, 10);
+  Bytes stream;
+  appendFrame(stream, packet, true);
+  ASSERT_EQ(static_cast<size_t>(Svc::StreamDeframer::RING_SIZE), stream.size());
+  std::vector<Bytes> packets;
+  feed(deframer, stream, NULL, stream.size(), packets);
+  ASSERT_EQ(1U, packets.size());
+
+  // A ring full of sync bytes and in-range sizes drains without a frame
+  Bytes junk;
+  while (junk.size() < 3 * Svc::StreamDeframer::RING_SIZE) {
+    appendBe32(junk, SYNC);
+    appendBe32(junk, 2000);
+  }
+  appendFrame(junk, packet, true);
+  packets.clear();
+  feed(deframer, junk, NULL, 500, packets);
+  ASSERT_EQ(1U, packets.size());
+  ASSERT_TRUE(packet == packets[0]);
+}
+
+// Frames between bursts of noise, some of them corrupted, pushed in random
+// chunk sizes. Every intact frame must come out, in order, and nothing else.
+TEST(StreamDeframer, Fuzz) {
+  for (U32 seed = 1; seed <= 20; seed++) {
+    Random random(seed * 2654435761U);
+    Svc::StreamDeframer deframer;
+    deframer.setup(SYNC, MAX_PACKET, true);
+
+    Bytes stream;
+    std::vector<Bytes> expected;
+    for (U32 i = 0; i < 300; i++) {
+      appendNoise(stream, random.range(0, 40), random);
+      const Bytes packet = makePacket(random.range(0, 5), random.range(0, 600), random.next());
+      const U32 start = stream.size();
+      appendFrame(stream, packet, true);
+      if (random.range(0, 9) == 0) {
+        stream[random.range(start, stream.size() - 1)] ^= static_cast<U8>(random.range(1, 255));
+      } else {
+        expected.push_back(packet);
+      }
+    }
+
+    std::vector<Bytes> packets;
+    feed(deframer, stream, &random, 300, packets);
+    ASSERT_EQ(expected.size(), packets.size()) << "seed " << seed;
+    for (U32 i = 0; i < expected.size(); i++) {
+      ASSERT_TRUE(expected[i] == packets[i]) << "seed " << seed << " frame " << i;
+    }
+  }
+}
+
+// Deframing rate on a noisy stream: 256 byte packets with up to 64 bytes of
+// noise between them, in radio-sized chunks, with and without checksums.
+// Also the search rate through pure noise.
+TEST(Performance, NoisyStream) {
+  Random random(12345);
+  Bytes stream;
+  U32 frameCount = 0;
+  while (stream.size() < 8 * 1024 * 1024) {
+    appendNoise(stream, random.range(0, 64), random);
+    appendFrame(stream, makePacket(0, 252, random.next()), true);
+    frameCount++;
+  }
+  Bytes plain;
+  while (plain.size() < stream.size()) {
+    appendNoise(plain, random.range(0, 64), random);
+    appendFrame(plain, makePacket(0, 252, random.next()), false);
+  }
+  Bytes noise;
+  appendQuietNoise(noise, stream.size(), random);
+
+  const char* names[] = { "checksummed frames", "plain frames", "noise only" };
+  const Bytes* streams[] = { &stream, &plain, &noise };
+  for (U32 i = 0; i < 3; i++) {
+    Svc::StreamDeframer deframer;
+    deframer.setup(SYNC, MAX_PACKET, (i == 0));
+    std::vector<Bytes> packets;
+    Random chunks(7);
+    const F64 start = nowNsec();
+    feed(deframer, *streams[i], &chunks, 128, packets);
+    const F64 elapsed = nowNsec() - start;
+    if (i == 0) {
+      ASSERT_EQ(frameCount, packets.size());
+    }
+    printf("%-20s %8.1f MB/s, %u frames\n", names[i],
+        streams[i]->size() / elapsed * 1.0e3, static_cast<U32>(packets.size()));
+  }
+}
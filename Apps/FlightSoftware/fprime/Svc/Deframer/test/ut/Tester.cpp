@@ -0,0 +1,506 @@
+// ======================================================================
+// \title  Deframer/test/ut/Tester.cpp
+// \brief  cpp file for Deframer test harness implementation class
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <string.h>
+
+#include "Tester.hpp"
+#include <Fw/Com/ComPacket.hpp>
+#include <Utils/Hash/crc32/CRC32Engine.hpp>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 1000
+
+namespace {
+
+  //! Append a big-endian word
+  void appendBe32(std::vector<U8>& out, const U32 value) {
+    out.push_back(static_cast<U8>(value >> 24));
+    out.push_back(static_cast<U8>(value >> 16));
+    out.push_back(static_cast<U8>(value >> 8));
+    out.push_back(static_cast<U8>(value));
+  }
+
+}
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  Tester ::
+    Tester(const bool connectOutputs) :
+#if FW_OBJECT_NAMES == 1
+      DeframerGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("Deframer"),
+#else
+      DeframerGTestBase(MAX_HISTORY_SIZE),
+      component(),
+#endif
+      allocateSize(sizeof(fileStorage)),
+      framedInCalls(0)
+  {
+    this->initComponents();
+    this->connectPorts(connectOutputs);
+  }
+
+  Tester ::
+    ~Tester(void)
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    chunkedFrames(void)
+  {
+    const Bytes command1 = makePacket(Fw::ComPacket::FW_PACKET_COMMAND, 20, 1);
+    const Bytes file = makePacket(Fw::ComPacket::FW_PACKET_FILE, 100, 2);
+    const Bytes command2 = makePacket(Fw::ComPacket::FW_PACKET_COMMAND, 7, 3);
+
+    // Some bytes ahead of each frame that are not a sync word
+    Bytes stream(5, 0x11);
+    appendFrame(stream, command1, false);
+    stream.insert(stream.end(), 3, 0x22);
+    appendFrame(stream, file, false);
+    appendFrame(stream, command2, false);
+
+    U32 frames = 0;
+    for (U32 maxChunk = 1; maxChunk <= stream.size(); maxChunk++) {
+      this->clearHistory();
+      this->filePackets.clear();
+      this->framedInCalls = 0;
+
+      this->sendStream(stream, maxChunk);
+      frames += 3;
+
+      // Every framedIn buffer goes back, one call each
+      ASSERT_from_framedDeallocate_SIZE(this->framedInCalls);
+
+      ASSERT_from_comOut_SIZE(2);
+      assertComPacket(this->fromPortHistory_comOut->at(0).data, command1);
+      assertComPacket(this->fromPortHistory_comOut->at(1).data, command2);
+      ASSERT_EQ(0U, this->fromPortHistory_comOut->at(0).context);
+
+      ASSERT_from_bufferAllocate_SIZE(1);
+      ASSERT_from_bufferAllocate(0, file.size() - StreamDeframer::DESC_SIZE);
+      ASSERT_from_bufferOut_SIZE(1);
+      ASSERT_from_bufferDeallocate_SIZE(0);
+      ASSERT_EQ(1U, this->filePackets.size());
+      ASSERT_TRUE(Bytes(file.begin() + StreamDeframer::DESC_SIZE, file.end()) == this->filePackets[0])
+        << "chunk " << maxChunk;
+
+      ASSERT_EVENTS_SIZE(0);
+      const U32 frameTlm = this->tlmHistory_DF_Frames->size();
+      ASSERT_GT(frameTlm, 0U);
+      ASSERT_TLM_DF_Frames(frameTlm - 1, frames);
+      ASSERT_TLM_DF_DroppedPackets_SIZE(0);
+    }
+  }
+
+  void Tester ::
+    chunkLargerThanRing(void)
+  {
+    Bytes stream;
+    std::vector<Bytes> packets;
+    while (stream.size() < 3 * StreamDeframer::RING_SIZE) {
+      const Bytes packet = makePacket(Fw::ComPacket::FW_PACKET_FILE, 1500, packets.size());
+      appendFrame(stream, packet, false);
+      packets.push_back(Bytes(packet.begin() + StreamDeframer::DESC_SIZE, packet.end()));
+    }
+
+    this->sendStream(stream, stream.size());
+
+    ASSERT_from_framedDeallocate_SIZE(1);
+    ASSERT_from_bufferOut_SIZE(packets.size());
+    ASSERT_EQ(packets.size(), this->filePackets.size());
+    for (U32 i = 0; i < packets.size(); i++) {
+      ASSERT_TRUE(packets[i] == this->filePackets[i]) << "packet " << i;
+    }
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_TLM_DF_Frames_SIZE(1);
+    ASSERT_TLM_DF_Frames(0, packets.size());
+  }
+
+  void Tester ::
+    fullRingMakesProgress(void)
+  {
+    this->component.setup(DEFRAMER_SYNC_WORD, true);
+
+    // Sync words and in-range sizes fill the ring without a valid frame,
+    // so the chunk loop must drain the ring to take the rest of the chunk
+    Bytes stream;
+    while (stream.size() < 3 * StreamDeframer::RING_SIZE) {
+      appendBe32(stream, DEFRAMER_SYNC_WORD);
+      appendBe32(stream, 2000);
+    }
+    const Bytes packet = makePacket(
+        Fw::ComPacket::FW_PACKET_FILE,
+        StreamDeframer::RING_SIZE - StreamDeframer::HEADER_SIZE -
+          StreamDeframer::CHECKSUM_SIZE - StreamDeframer::DESC_SIZE,
+        4);
+    appendFrame(stream, packet, true);
+
+    this->sendStream(stream, stream.size());
+
+    ASSERT_from_framedDeallocate_SIZE(1);
+    ASSERT_from_bufferOut_SIZE(1);
+    ASSERT_TRUE(Bytes(packet.begin() + StreamDeframer::DESC_SIZE, packet.end()) == this->filePackets[0]);
+
+    // The checksum errors are throttled
+    ASSERT_EVENTS_DF_ChecksumError_SIZE(5);
+    ASSERT_EVENTS_SIZE(5);
+    ASSERT_TLM_DF_Frames_SIZE(1);
+    ASSERT_TLM_DF_Frames(0, 1);
+    ASSERT_TLM_DF_ChecksumErrors_SIZE(1);
+  }
+
+  void Tester ::
+    readErrors(void)
+  {
+    Bytes stream;
+    appendFrame(stream, makePacket(Fw::ComPacket::FW_PACKET_COMMAND, 10, 5), false);
+    Fw::Buffer buffer(0, 0, reinterpret_cast<U64>(&stream[0]), stream.size());
+
+    // A driver with no buffers sends one it does not own; nothing is
+    // deframed or returned
+    Drv::SerialReadStatus status = Drv::SER_NO_BUFFERS;
+    this->invoke_to_framedIn(0, buffer, status);
+    ASSERT_FROM_PORT_HISTORY_SIZE(0);
+    ASSERT_TLM_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+
+    // A read error returns the buffer without deframing it
+    status = Drv::SER_PARITY_ERR;
+    this->invoke_to_framedIn(0, buffer, status);
+    ASSERT_FROM_PORT_HISTORY_SIZE(1);
+    ASSERT_from_framedDeallocate_SIZE(1);
+    ASSERT_from_framedDeallocate(0, buffer);
+    ASSERT_TLM_SIZE(0);
+
+    // The same buffer read cleanly is deframed
+    status = Drv::SER_OK;
+    this->invoke_to_framedIn(0, buffer, status);
+    ASSERT_from_framedDeallocate_SIZE(2);
+    ASSERT_from_framedDeallocate(1, buffer);
+    ASSERT_from_comOut_SIZE(1);
+    ASSERT_TLM_DF_Frames(0, 1);
+  }
+
+  void Tester ::
+    commandTooBig(void)
+  {
+    // Exactly a com buffer fits; one more byte does not
+    const Bytes largest = makePacket(
+        Fw::ComPacket::FW_PACKET_COMMAND, FW_COM_BUFFER_MAX_SIZE - StreamDeframer::DESC_SIZE, 6);
+    const Bytes tooBig = makePacket(
+        Fw::ComPacket::FW_PACKET_COMMAND, FW_COM_BUFFER_MAX_SIZE - StreamDeframer::DESC_SIZE + 1, 7);
+    Bytes stream;
+    appendFrame(stream, tooBig, false);
+    appendFrame(stream, largest, false);
+
+    this->sendStream(stream, 64);
+
+    ASSERT_from_comOut_SIZE(1);
+    assertComPacket(this->fromPortHistory_comOut->at(0).data, largest);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DF_CommandTooBig_SIZE(1);
+    ASSERT_EVENTS_DF_CommandTooBig(0, tooBig.size());
+    const U32 frameTlm = this->tlmHistory_DF_Frames->size();
+    ASSERT_TLM_DF_Frames(frameTlm - 1, 2);
+  }
+
+  void Tester ::
+    unknownDescriptor(void)
+  {
+    const U32 descriptor = Fw::ComPacket::FW_PACKET_TELEM;
+    const Bytes unknown = makePacket(descriptor, 12, 8);
+    const Bytes command = makePacket(Fw::ComPacket::FW_PACKET_COMMAND, 12, 9);
+    Bytes stream;
+    appendFrame(stream, unknown, false);
+    appendFrame(stream, command, false);
+
+    this->sendStream(stream, stream.size());
+
+    ASSERT_from_comOut_SIZE(1);
+    assertComPacket(this->fromPortHistory_comOut->at(0).data, command);
+    ASSERT_from_bufferAllocate_SIZE(0);
+    ASSERT_from_bufferOut_SIZE(0);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DF_UnknownDescriptor_SIZE(1);
+    ASSERT_EVENTS_DF_UnknownDescriptor(0, descriptor);
+  }
+
+  void Tester ::
+    allocationFails(void)
+  {
+    this->allocateSize = 0;
+    const Bytes file = makePacket(Fw::ComPacket::FW_PACKET_FILE, 50, 10);
+    Bytes stream;
+    appendFrame(stream, file, false);
+
+    this->sendStream(stream, stream.size());
+
+    ASSERT_from_bufferAllocate_SIZE(1);
+    ASSERT_from_bufferAllocate(0, 50U);
+    ASSERT_from_bufferDeallocate_SIZE(0);
+    ASSERT_from_bufferOut_SIZE(0);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DF_AllocationError_SIZE(1);
+    ASSERT_EVENTS_DF_AllocationError(0, 50U);
+  }
+
+  void Tester ::
+    shortBuffer(void)
+  {
+    this->allocateSize = 49;
+    const Bytes file = makePacket(Fw::ComPacket::FW_PACKET_FILE, 50, 11);
+    Bytes stream;
+    appendFrame(stream, file, false);
+
+    this->sendStream(stream, stream.size());
+
+    // The short buffer goes back to its pool, unchanged
+    ASSERT_from_bufferAllocate_SIZE(1);
+    ASSERT_from_bufferAllocate(0, 50U);
+    ASSERT_from_bufferDeallocate_SIZE(1);
+    ASSERT_from_bufferDeallocate(0, Fw::Buffer(0, 0, reinterpret_cast<U64>(this->fileStorage), 49));
+    ASSERT_from_bufferOut_SIZE(0);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_DF_AllocationError_SIZE(1);
+    ASSERT_EVENTS_DF_AllocationError(0, 50U);
+
+    // A buffer of the exact size is used
+    this->clearHistory();
+    this->allocateSize = 50;
+    this->sendStream(stream, stream.size());
+    ASSERT_from_bufferDeallocate_SIZE(0);
+    ASSERT_from_bufferOut_SIZE(1);
+    ASSERT_from_bufferOut(0, Fw::Buffer(0, 0, reinterpret_cast<U64>(this->fileStorage), 50));
+    ASSERT_EVENTS_SIZE(0);
+  }
+
+  void Tester ::
+    unconnectedOutputs(void)
+  {
+    Bytes stream;
+    appendFrame(stream, makePacket(Fw::ComPacket::FW_PACKET_COMMAND, 10, 12), false);
+    appendFrame(stream, makePacket(Fw::ComPacket::FW_PACKET_FILE, 10, 13), false);
+
+    this->sendStream(stream, stream.size());
+
+    ASSERT_from_framedDeallocate_SIZE(1);
+    ASSERT_FROM_PORT_HISTORY_SIZE(1);
+    ASSERT_EVENTS_SIZE(0);
+    ASSERT_TLM_DF_Frames(0, 2);
+    ASSERT_TLM_DF_DroppedPackets_SIZE(1);
+    ASSERT_TLM_DF_DroppedPackets(0, 2);
+
+    // The count only goes out when it changes
+    this->clearHistory();
+    Bytes noise(10, 0x33);
+    this->sendStream(noise, noise.size());
+    ASSERT_TLM_DF_DroppedPackets_SIZE(0);
+  }
+
+  // ----------------------------------------------------------------------
+  // Handlers for typed from ports
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    from_framedDeallocate_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->pushFromPortEntry_framedDeallocate(fwBuffer);
+  }
+
+  void Tester ::
+    from_comOut_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    this->pushFromPortEntry_comOut(data, context);
+  }
+
+  Fw::Buffer Tester ::
+    from_bufferAllocate_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 size
+    )
+  {
+    this->pushFromPortEntry_bufferAllocate(size);
+    const U64 data = (this->allocateSize > 0) ? reinterpret_cast<U64>(this->fileStorage) : 0;
+    Fw::Buffer buffer(0, 0, data, this->allocateSize);
+    return buffer;
+  }
+
+  void Tester ::
+    from_bufferDeallocate_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->pushFromPortEntry_bufferDeallocate(fwBuffer);
+  }
+
+  void Tester ::
+    from_bufferOut_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->pushFromPortEntry_bufferOut(fwBuffer);
+    // The buffer is reused for the next file packet, so keep a copy
+    const U8* const data = reinterpret_cast<const U8*>(fwBuffer.getdata());
+    this->filePackets.push_back(Bytes(data, data + fwBuffer.getsize()));
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    connectPorts(const bool connectOutputs)
+  {
+
+    // framedIn
+    this->connect_to_framedIn(
+        0,
+        this->component.get_framedIn_InputPort(0)
+    );
+
+    // framedDeallocate
+    this->component.set_framedDeallocate_OutputPort(
+        0,
+        this->get_from_framedDeallocate(0)
+    );
+
+    if (connectOutputs) {
+
+      // comOut
+      this->component.set_comOut_OutputPort(
+          0,
+          this->get_from_comOut(0)
+      );
+
+      // bufferAllocate
+      this->component.set_bufferAllocate_OutputPort(
+          0,
+          this->get_from_bufferAllocate(0)
+      );
+
+      // bufferOut
+      this->component.set_bufferOut_OutputPort(
+          0,
+          this->get_from_bufferOut(0)
+      );
+
+    }
+
+    // bufferDeallocate
+    this->component.set_bufferDeallocate_OutputPort(
+        0,
+        this->get_from_bufferDeallocate(0)
+    );
+
+    // Tlm
+    this->component.set_Tlm_OutputPort(
+        0,
+        this->get_from_Tlm(0)
+    );
+
+    // Log
+    this->component.set_Log_OutputPort(
+        0,
+        this->get_from_Log(0)
+    );
+
+    // LogText
+#if FW_ENABLE_TEXT_LOGGING == 1
+    this->component.set_LogText_OutputPort(
+        0,
+        this->get_from_LogText(0)
+    );
+#endif
+
+    // Time
+    this->component.set_Time_OutputPort(
+        0,
+        this->get_from_Time(0)
+    );
+
+  }
+
+  void Tester ::
+    initComponents(void)
+  {
+    this->init();
+    this->component.init(
+        INSTANCE
+    );
+  }
+
+  Tester::Bytes Tester ::
+    makePacket(const U32 descriptor, const U32 payloadSize, const U8 seed)
+  {
+    Bytes packet;
+    appendBe32(packet, descriptor);
+    for (U32 i = 0; i < payloadSize; i++) {
+      packet.push_back(static_cast<U8>(seed + i * 13));
+    }
+    return packet;
+  }
+
+  void Tester ::
+    appendFrame(Bytes& stream, const Bytes& packet, const bool checksum)
+  {
+    appendBe32(stream, DEFRAMER_SYNC_WORD);
+    appendBe32(stream, packet.size());
+    stream.insert(stream.end(), packet.begin(), packet.end());
+    if (checksum) {
+      const U32 crc = Utils::CRC32Engine::update(
+          Utils::CRC32Engine::INITIAL_VALUE, &packet[0], packet.size());
+      appendBe32(stream, ~crc);
+    }
+  }
+
+  void Tester ::
+    sendStream(const Bytes& stream, const U32 maxChunk)
+  {
+    // framedIn takes a non-const buffer, so send from a copy
+    Bytes data(stream);
+    for (U32 offset = 0; offset < data.size(); offset += maxChunk) {
+      U32 size = data.size() - offset;
+      if (size > maxChunk) {
+        size = maxChunk;
+      }
+      Fw::Buffer buffer(0, 0, reinterpret_cast<U64>(&data[offset]), size);
+      Drv::SerialReadStatus status = Drv::SER_OK;
+      this->invoke_to_framedIn(0, buffer, status);
+      this->framedInCalls++;
+    }
+  }
+
+  void Tester ::
+    assertComPacket(const Fw::ComBuffer& com, const Bytes& packet)
+  {
+    ASSERT_EQ(packet.size(), com.getBuffLength());
+    ASSERT_EQ(0, memcmp(&packet[0], com.getBuffAddr(), packet.size()));
+  }
+
+} // end namespace Svc
@@ -0,0 +1,205 @@
+// ======================================================================
+// \title  Deframer/test/ut/Tester.hpp
+// \brief  hpp file for Deframer test harness implementation class
+//
+// \copyright
+// Copyright 2009-2016, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include <Svc/Deframer/DeframerComponentImpl.hpp>
+#include "GTestBase.hpp"
+#include <vector>
+
+namespace Svc {
+
+  class Tester :
+    public DeframerGTestBase
+  {
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object Tester
+      //!
+      Tester(
+          const bool connectOutputs = true //!< Connect comOut, bufferAllocate and bufferOut
+      );
+
+      //! Destroy object Tester
+      //!
+      ~Tester(void);
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Tests
+      // ----------------------------------------------------------------------
+
+      //! Send command and file frames split into chunks of every size
+      //!
+      void chunkedFrames(void);
+
+      //! Send one chunk larger than the ring, holding several frames
+      //!
+      void chunkLargerThanRing(void);
+
+      //! Send a chunk that fills the ring with frame headers but no frame
+      //!
+      void fullRingMakesProgress(void);
+
+      //! Call framedIn with SER_NO_BUFFERS and with a read error
+      //!
+      void readErrors(void);
+
+      //! Send a command frame larger than a com buffer
+      //!
+      void commandTooBig(void);
+
+      //! Send a frame with an unknown descriptor
+      //!
+      void unknownDescriptor(void);
+
+      //! Send a file frame with no buffer available
+      //!
+      void allocationFails(void);
+
+      //! Send a file frame when the allocated buffer is too small
+      //!
+      void shortBuffer(void);
+
+      //! Send frames with the output ports not connected
+      //!
+      void unconnectedOutputs(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_framedDeallocate
+      //!
+      void from_framedDeallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+      //! Handler for from_comOut
+      //!
+      void from_comOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+      //! Handler for from_bufferAllocate
+      //!
+      Fw::Buffer from_bufferAllocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size
+      );
+
+      //! Handler for from_bufferDeallocate
+      //!
+      void from_bufferDeallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+      //! Handler for from_bufferOut
+      //!
+      void from_bufferOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      typedef std::vector<U8> Bytes;
+
+      //! Connect ports
+      //!
+      void connectPorts(
+          const bool connectOutputs //!< Connect comOut, bufferAllocate and bufferOut
+      );
+
+      //! Initialize components
+      //!
+      void initComponents(void);
+
+      //! Make a packet: a descriptor then payload bytes
+      //!
+      static Bytes makePacket(
+          const U32 descriptor, //!< The packet descriptor
+          const U32 payloadSize, //!< The number of bytes after the descriptor
+          const U8 seed //!< The first payload byte
+      );
+
+      //! Append a frame holding a packet to a stream
+      //!
+      static void appendFrame(
+          Bytes& stream, //!< The stream
+          const Bytes& packet, //!< The packet
+          const bool checksum //!< Whether to end the frame with a CRC-32
+      );
+
+      //! Send a stream to framedIn in chunks of at most maxChunk bytes
+      //!
+      void sendStream(
+          const Bytes& stream, //!< The stream
+          const U32 maxChunk //!< The largest chunk
+      );
+
+      //! Assert that a com buffer holds a packet
+      //!
+      static void assertComPacket(
+          const Fw::ComBuffer& com, //!< The com buffer
+          const Bytes& packet //!< The expected packet
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      DeframerComponentImpl component;
+
+      //! Storage for the buffers bufferAllocate returns
+      //!
+      U8 fileStorage[DEFRAMER_RING_SIZE];
+
+      //! The size of the buffer bufferAllocate returns. Zero returns a
+      //! buffer with no data.
+      //!
+      U32 allocateSize;
+
+      //! A copy of each file packet from bufferOut
+      //!
+      std::vector<Bytes> filePackets;
+
+      //! The number of framedIn calls, and so of framedIn buffers
+      //! owed back on framedDeallocate
+      //!
+      U32 framedInCalls;
+
+  };
+
+}
+
+#endif
@@ -27,10 +27,13 @@ namespace Svc {
     ) :
       FileDownlinkComponentBase(name),
       downlinkPacketSize(downlinkPacketSize),
+      dataBuffer(new U8[downlinkPacketSize]),
       filesSent(this),
       packetsSent(this),
       warnings(this),
-      sequenceIndex(0)
+      sequenceIndex(0),
+      packetsInFlight(0),
+      packetsInFlightReported(0)
   {
 
   }
@@ -44,10 +47,60 @@ namespace Svc {
     FileDownlinkComponentBase::init(queueDepth, instance);
   }
 
+  void FileDownlink ::
+    configureStreaming(
+        const U32 ticksPerSecond,
+        const U32 packetsPerTick,
+        const U32 bytesPerSecond,
+        const U32 maxInFlight
+    )
+  {
+    FW_ASSERT(ticksPerSecond > 0);
+    FW_ASSERT(packetsPerTick > 0);
+    this->stream.ticksPerSecond = ticksPerSecond;
+    this->stream.packetsPerTick = packetsPerTick;
+    this->stream.bytesPerSecond = bytesPerSecond;
+    this->stream.maxInFlight = maxInFlight;
+  }
+
   FileDownlink ::
     ~FileDownlink(void)
   {
+    delete[] this->dataBuffer;
+  }
 
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  void FileDownlink ::
+    Run_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    if (!this->stream.isEnabled()) {
+      return;
+    }
+    this->stream.refill(
+        Fw::FilePacket::DataPacket::HEADERSIZE + this->downlinkPacketSize
+    );
+    if (this->stream.active) {
+      this->streamPackets();
+    }
+    this->updateThroughput();
+  }
+
+  void FileDownlink ::
+    bufferReturn_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    if (this->packetsInFlight > 0) {
+      --this->packetsInFlight;
+    }
+    this->bufferReturnOut_out(0, fwBuffer);
   }
 
   // ----------------------------------------------------------------------
@@ -65,6 +118,12 @@ namespace Svc {
 
     Os::File::Status status;
 
+    if (this->stream.active) {
+      // Only one streaming transfer at a time
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_BUSY);
+      return;
+    }
+
     if (this->mode.get() == Mode::CANCEL) {
       Fw::LogStringArg sourceLogStringArg(sourceFileName);
       Fw::LogStringArg destLogStringArg(destFileName);
@@ -85,14 +144,30 @@ namespace Svc {
     );
     if (status != Os::File::OP_OK) { 
       this->warnings.fileOpenError();
+      this->mode.set(Mode::IDLE);
       this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
       return; 
     }
 
+    if (this->stream.isEnabled()) {
+      // Packets go out from Run_handler, which also sends the
+      // command response when the transfer ends
+      this->stream.active = true;
+      this->stream.opCode = opCode;
+      this->stream.cmdSeq = cmdSeq;
+      this->stream.byteOffset = 0;
+      this->stream.stagedSize = 0;
+      this->stream.startSent = false;
+      this->sequenceIndex = 1;
+      return;
+    }
+
     this->sendStartPacket();
 
     status = this->sendDataPackets();
     if (status != Os::File::OP_OK) { 
+      this->file.osFile.close();
+      this->mode.set(Mode::IDLE);
       this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
       return; 
     }
@@ -132,25 +207,96 @@ namespace Svc {
     this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
   }
 
+  void FileDownlink ::
+    FileDownlink_SetRate_cmdHandler(
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        U32 packetsPerTick,
+        U32 bytesPerSecond
+    )
+  {
+    if (!this->stream.isEnabled()) {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_EXECUTION_ERROR);
+      return;
+    }
+    if (packetsPerTick == 0) {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_VALIDATION_ERROR);
+      return;
+    }
+    this->stream.packetsPerTick = packetsPerTick;
+    this->stream.bytesPerSecond = bytesPerSecond;
+    this->log_ACTIVITY_LO_FileDownlink_RateSet(packetsPerTick, bytesPerSecond);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::COMMAND_OK);
+  }
+
   // ----------------------------------------------------------------------
   // Private helper methods 
   // ----------------------------------------------------------------------
 
-  Os::File::Status FileDownlink ::
-    sendDataPacket(const U32 byteOffset)
+  U16 FileDownlink ::
+    getDataSize(const U32 byteOffset) const
   {
-
     const U32 fileSize = this->file.size;
     FW_ASSERT(byteOffset < fileSize, byteOffset);
     const U16 maxDataSize = this->downlinkPacketSize;
-    const U16 dataSize = (byteOffset + maxDataSize > fileSize) ?
+    return (byteOffset + maxDataSize > fileSize) ?
       fileSize - byteOffset : maxDataSize;
-    U8 buffer[dataSize];
+  }
 
+  Os::File::Status FileDownlink ::
+    readDataPacket(const U32 byteOffset, const U16 dataSize)
+  {
     const Os::File::Status status = 
-      this->file.read(buffer, byteOffset, dataSize);
+      this->file.read(this->dataBuffer, byteOffset, dataSize);
     if (status != Os::File::OP_OK) {
       this->warnings.fileRead();
+    }
+    return status;
+  }
+
+  FileDownlink::SendStatus FileDownlink ::
+    trySendDataPacket(const U32 byteOffset, const U16 dataSize)
+  {
+
+    // Data is read once; if no buffer is available it stays staged in
+    // dataBuffer until the next attempt, so the checksum is not updated twice
+    if (this->stream.stagedSize == 0) {
+      const Os::File::Status status = 
+        this->readDataPacket(byteOffset, dataSize);
+      if (status != Os::File::OP_OK) {
+        return SEND_ERROR;
+      }
+      this->stream.stagedSize = dataSize;
+    }
+    FW_ASSERT(this->stream.stagedSize == dataSize, this->stream.stagedSize, dataSize);
+
+    const Fw::FilePacket::DataPacket dataPacket = {
+      { Fw::FilePacket::T_DATA, this->sequenceIndex },
+      byteOffset,
+      dataSize,
+      this->dataBuffer
+    };
+    Fw::FilePacket filePacket;
+    filePacket.fromDataPacket(dataPacket);
+    if (!this->trySendFilePacket(filePacket)) {
+      return SEND_NO_BUFFER;
+    }
+    ++this->sequenceIndex;
+    this->stream.stagedSize = 0;
+
+    return SEND_OK;
+
+  }
+
+  Os::File::Status FileDownlink ::
+    sendDataPacket(const U32 byteOffset)
+  {
+
+    const U16 dataSize = this->getDataSize(byteOffset);
+
+    const Os::File::Status status = 
+      this->readDataPacket(byteOffset, dataSize);
+    if (status != Os::File::OP_OK) {
       return status;
     }
 
@@ -158,7 +304,7 @@ namespace Svc {
       { Fw::FilePacket::T_DATA, this->sequenceIndex },
       byteOffset,
       dataSize,
-      buffer
+      this->dataBuffer
     };
     ++this->sequenceIndex;
     Fw::FilePacket filePacket;
@@ -189,18 +335,16 @@ namespace Svc {
   }
 
   void FileDownlink ::
-    sendCancelPacket(void)
+    makeCancelPacket(Fw::FilePacket& filePacket)
   {
     const Fw::FilePacket::CancelPacket cancelPacket = {
       { Fw::FilePacket::T_CANCEL, this->sequenceIndex }
     };
-    Fw::FilePacket filePacket;
     filePacket.fromCancelPacket(cancelPacket);
-    this->sendFilePacket(filePacket);
   }
 
   void FileDownlink ::
-    sendEndPacket(void)
+    makeEndPacket(Fw::FilePacket& filePacket)
   {
 
     const Fw::FilePacket::Header header = {
@@ -214,14 +358,12 @@ namespace Svc {
     this->file.getChecksum(checksum);
     endPacket.setChecksum(checksum);
 
-    Fw::FilePacket filePacket;
     filePacket.fromEndPacket(endPacket);
-    this->sendFilePacket(filePacket);
 
   }
 
   void FileDownlink ::
-    sendStartPacket(void)
+    makeStartPacket(Fw::FilePacket& filePacket)
   {
     Fw::FilePacket::StartPacket startPacket;
     startPacket.initialize(
@@ -229,22 +371,193 @@ namespace Svc {
         this->file.sourceName.toChar(),
         this->file.destName.toChar()
     );
-    Fw::FilePacket filePacket;
     filePacket.fromStartPacket(startPacket);
+  }
+
+  void FileDownlink ::
+    sendCancelPacket(void)
+  {
+    Fw::FilePacket filePacket;
+    this->makeCancelPacket(filePacket);
     this->sendFilePacket(filePacket);
   }
 
   void FileDownlink ::
-    sendFilePacket(const Fw::FilePacket& filePacket)
+    sendEndPacket(void)
+  {
+    Fw::FilePacket filePacket;
+    this->makeEndPacket(filePacket);
+    this->sendFilePacket(filePacket);
+  }
+
+  void FileDownlink ::
+    sendStartPacket(void)
+  {
+    Fw::FilePacket filePacket;
+    this->makeStartPacket(filePacket);
+    this->sendFilePacket(filePacket);
+  }
+
+  bool FileDownlink ::
+    trySendFilePacket(const Fw::FilePacket& filePacket)
   {
     const U32 bufferSize = filePacket.bufferSize();
     Fw::Buffer buffer = this->bufferGetCaller_out(0, bufferSize);
-    FW_ASSERT(buffer.getdata() != 0);
+    if (buffer.getdata() == 0) {
+      return false;
+    }
     FW_ASSERT(buffer.getsize() == bufferSize, bufferSize, buffer.getsize());
     const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     this->bufferSendOut_out(0, buffer);
     this->packetsSent.packetSent();
+    // Packets are only tracked in flight when returns are routed through us
+    if (this->isConnected_bufferReturnOut_OutputPort(0)) {
+      ++this->packetsInFlight;
+    }
+    if (this->stream.isEnabled()) {
+      this->stream.consume(bufferSize);
+      this->stream.bytesThisSecond += bufferSize;
+    }
+    return true;
+  }
+
+  void FileDownlink ::
+    sendFilePacket(const Fw::FilePacket& filePacket)
+  {
+    const bool sent = this->trySendFilePacket(filePacket);
+    FW_ASSERT(sent);
+  }
+
+  void FileDownlink ::
+    streamPackets(void)
+  {
+
+    // Cancellation takes effect between chunks
+    if (this->mode.get() == Mode::CANCEL) {
+      this->finishStream(true);
+      return;
+    }
+
+    U32 sent = 0;
+
+    if (!this->stream.startSent) {
+      Fw::FilePacket filePacket;
+      this->makeStartPacket(filePacket);
+      if (!this->trySendFilePacket(filePacket)) {
+        return;
+      }
+      this->stream.startSent = true;
+      ++sent;
+    }
+
+    while (
+        (sent < this->stream.packetsPerTick) &&
+        (this->stream.byteOffset < this->file.size)
+    ) {
+      if (
+          (this->stream.maxInFlight > 0) &&
+          (this->packetsInFlight >= this->stream.maxInFlight)
+      ) {
+        return;
+      }
+      const U16 dataSize = this->getDataSize(this->stream.byteOffset);
+      if (!this->stream.allows(Fw::FilePacket::DataPacket::HEADERSIZE + dataSize)) {
+        return;
+      }
+      const SendStatus status = 
+        this->trySendDataPacket(this->stream.byteOffset, dataSize);
+      if (status == SEND_NO_BUFFER) {
+        return;
+      }
+      if (status == SEND_ERROR) {
+        this->file.osFile.close();
+        this->stream.active = false;
+        this->mode.set(Mode::IDLE);
+        this->cmdResponse_out(
+            this->stream.opCode,
+            this->stream.cmdSeq,
+            Fw::COMMAND_EXECUTION_ERROR
+        );
+        return;
+      }
+      this->stream.byteOffset += dataSize;
+      ++sent;
+    }
+
+    if (this->stream.byteOffset >= this->file.size) {
+      this->finishStream(false);
+    }
+
+  }
+
+  void FileDownlink ::
+    finishStream(const bool canceled)
+  {
+
+    // Nothing reached the ground if the start packet was never sent
+    if (!canceled || this->stream.startSent) {
+      Fw::FilePacket filePacket;
+      if (canceled) {
+        this->makeCancelPacket(filePacket);
+      }
+      else {
+        this->makeEndPacket(filePacket);
+      }
+      if (!this->trySendFilePacket(filePacket)) {
+        // Try again on the next tick
+        return;
+      }
+    }
+
+    this->file.osFile.close();
+
+    if (canceled) {
+      this->log_ACTIVITY_HI_FileDownlink_DownlinkCanceled(
+          this->file.sourceName,
+          this->file.destName
+      );
+    }
+    else {
+      this->log_ACTIVITY_HI_FileDownlink_FileSent(
+          this->file.sourceName,
+          this->file.destName
+      );
+      this->filesSent.fileSent();
+    }
+
+    this->stream.active = false;
+    this->mode.set(Mode::IDLE);
+
+    this->cmdResponse_out(
+        this->stream.opCode,
+        this->stream.cmdSeq,
+        Fw::COMMAND_OK
+    );
+
+  }
+
+  void FileDownlink ::
+    updateThroughput(void)
+  {
+    ++this->stream.tickCount;
+    if (this->stream.tickCount >= this->stream.ticksPerSecond) {
+      // Report once per second while traffic is flowing, plus the
+      // first idle second so the ground sees the rate drop to zero
+      if (
+          (this->stream.bytesThisSecond != 0) ||
+          (this->stream.bytesLastSecond != 0)
+      ) {
+        this->tlmWrite_FileDownlink_BytesPerSecond(this->stream.bytesThisSecond);
+      }
+      this->stream.bytesLastSecond = this->stream.bytesThisSecond;
+      this->stream.bytesThisSecond = 0;
+      this->stream.tickCount = 0;
+    }
+    if (this->packetsInFlight != this->packetsInFlightReported) {
+      this->tlmWrite_FileDownlink_PacketsInFlight(this->packetsInFlight);
+      this->packetsInFlightReported = this->packetsInFlight;
+    }
   }
 
   void FileDownlink ::
@@ -211,6 +211,105 @@ namespace Svc {
 
       };
 
+      //! Class holding the streaming downlink configuration and state
+      class Stream {
+
+        public:
+
+          //! Construct a Stream object
+          Stream(void) :
+            ticksPerSecond(0),
+            packetsPerTick(0),
+            bytesPerSecond(0),
+            maxInFlight(0),
+            active(false),
+            opCode(0),
+            cmdSeq(0),
+            byteOffset(0),
+            stagedSize(0),
+            startSent(false),
+            credit(0),
+            creditRemainder(0),
+            tickCount(0),
+            bytesThisSecond(0),
+            bytesLastSecond(0)
+          { }
+
+        public:
+
+          //! Whether streaming downlink is enabled
+          bool isEnabled(void) const {
+            return this->packetsPerTick > 0;
+          }
+
+          //! Add one tick worth of byte credit, capped at one second's worth
+          //! or one packet, whichever is larger
+          void refill(const U32 maxPacketSize);
+
+          //! Whether the byte budget allows sending size bytes
+          bool allows(const U32 size) const {
+            return (this->bytesPerSecond == 0) || (this->credit >= size);
+          }
+
+          //! Consume byte budget for a sent packet
+          void consume(const U32 size);
+
+        public:
+
+          //! The rate at which Run is invoked
+          U32 ticksPerSecond;
+
+          //! The maximum number of packets sent per tick
+          U32 packetsPerTick;
+
+          //! The byte budget per second, or 0 for no limit
+          U32 bytesPerSecond;
+
+          //! The maximum number of packets in flight, or 0 for no limit
+          U32 maxInFlight;
+
+          //! Whether a streaming transfer is in progress
+          bool active;
+
+          //! The opcode of the SendFile command being serviced
+          FwOpcodeType opCode;
+
+          //! The sequence number of the SendFile command being serviced
+          U32 cmdSeq;
+
+          //! The offset of the next data packet
+          U32 byteOffset;
+
+          //! The size of data read from the file but not yet sent, or 0
+          U32 stagedSize;
+
+          //! Whether the start packet has been sent
+          bool startSent;
+
+          //! The available byte budget
+          U32 credit;
+
+          //! Credit remainder carried between ticks
+          U32 creditRemainder;
+
+          //! Ticks counted in the current throughput window
+          U32 tickCount;
+
+          //! Bytes sent in the current throughput window
+          U32 bytesThisSecond;
+
+          //! Bytes sent in the last throughput window
+          U32 bytesLastSecond;
+
+      };
+
+      //! Result of trying to send a packet
+      typedef enum {
+        SEND_OK, //!< The packet was sent
+        SEND_NO_BUFFER, //!< No buffer was available, try again later
+        SEND_ERROR //!< The file could not be read
+      } SendStatus;
+
     public:
 
       // ----------------------------------------------------------------------
@@ -231,6 +330,20 @@ namespace Svc {
           const NATIVE_INT_TYPE instance //!< The instance number
       );
 
+      //! Enable streaming downlink driven by the Run port
+      //!
+      //! In streaming mode SendFile returns once the file is open, and
+      //! each Run invocation sends up to packetsPerTick packets within
+      //! the byte budget. The command response is sent when the transfer
+      //! ends. Call before the component is started.
+      //!
+      void configureStreaming(
+          const U32 ticksPerSecond, //!< The rate at which Run is invoked
+          const U32 packetsPerTick, //!< The maximum number of packets sent per tick
+          const U32 bytesPerSecond, //!< The byte budget per second, or 0 for no limit
+          const U32 maxInFlight //!< The maximum number of packets in flight, or 0 for no limit
+      );
+
       //! Destroy object FileDownlink
       //!
       ~FileDownlink(void);
@@ -257,6 +370,35 @@ namespace Svc {
           const U32 cmdSeq //!< The command sequence number
       );
 
+      //! Implementation for FileDownlink_SetRate command handler
+      //!
+      void FileDownlink_SetRate_cmdHandler(
+          const FwOpcodeType opCode, //!< The opcode
+          const U32 cmdSeq, //!< The command sequence number
+          U32 packetsPerTick, //!< The maximum number of packets sent per Run tick
+          U32 bytesPerSecond //!< The downlink byte budget per second, or 0 for no limit
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for user-defined typed input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for Run
+      //!
+      void Run_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
+      //! Handler implementation for bufferReturn
+      //!
+      void bufferReturn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
       //! Handler implementation for pingIn
       //!
       void pingIn_handler(
@@ -271,18 +413,38 @@ namespace Svc {
       // Private helper methods 
       // ----------------------------------------------------------------------
 
+      U16 getDataSize(const U32 byteOffset) const;
+
+      Os::File::Status readDataPacket(const U32 byteOffset, const U16 dataSize);
+
+      SendStatus trySendDataPacket(const U32 byteOffset, const U16 dataSize);
+
       Os::File::Status sendDataPacket(const U32 byteOffset);
 
       Os::File::Status sendDataPackets(void);
 
+      void makeCancelPacket(Fw::FilePacket& filePacket);
+
+      void makeEndPacket(Fw::FilePacket& filePacket);
+
+      void makeStartPacket(Fw::FilePacket& filePacket);
+
       void sendCancelPacket(void);
 
       void sendEndPacket(void);
 
       void sendStartPacket(void);
 
+      bool trySendFilePacket(const Fw::FilePacket& filePacket);
+
       void sendFilePacket(const Fw::FilePacket& filePacket);
 
+      void streamPackets(void);
+
+      void finishStream(const bool canceled);
+
+      void updateThroughput(void);
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -292,6 +454,9 @@ namespace Svc {
       //! The size of a downlink packet
       const U32 downlinkPacketSize;
 
+      //! Scratch buffer holding the data of one downlink packet
+      U8 *const dataBuffer;
+
       //! The mode
       Mode mode;
 
@@ -310,6 +475,15 @@ namespace Svc {
       //! The current sequence index
       U32 sequenceIndex;
 
+      //! Streaming downlink configuration and state
+      Stream stream;
+
+      //! Packets sent and not yet returned on bufferReturn
+      U32 packetsInFlight;
+
+      //! Packets in flight at the last telemetry update
+      U32 packetsInFlightReported;
+
     };
 
 } // end namespace Svc
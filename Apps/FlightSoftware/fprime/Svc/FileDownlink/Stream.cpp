@@ -0,0 +1,47 @@
+// ====================================================================== 
+// \title  Stream.cpp
+// \brief  cpp file for FileDownlink::Stream
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Svc/FileDownlink/FileDownlink.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+  void FileDownlink::Stream ::
+    refill(const U32 maxPacketSize)
+  {
+    if (this->bytesPerSecond == 0) {
+      return;
+    }
+    FW_ASSERT(this->ticksPerSecond > 0);
+
+    // Spread the per-second budget over the ticks, carrying the remainder
+    U32 increment = this->bytesPerSecond / this->ticksPerSecond;
+    this->creditRemainder += this->bytesPerSecond % this->ticksPerSecond;
+    if (this->creditRemainder >= this->ticksPerSecond) {
+      ++increment;
+      this->creditRemainder -= this->ticksPerSecond;
+    }
+
+    // Allow at most one second of burst, but always enough for one packet
+    const U32 cap = (this->bytesPerSecond > maxPacketSize) ?
+      this->bytesPerSecond : maxPacketSize;
+    this->credit = (this->credit > cap - increment) ?
+      cap : this->credit + increment;
+  }
+
+  void FileDownlink::Stream ::
+    consume(const U32 size)
+  {
+    this->credit = (this->credit > size) ? this->credit - size : 0;
+  }
+
+}
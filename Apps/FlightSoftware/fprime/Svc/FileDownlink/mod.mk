@@ -6,6 +6,7 @@ SRC = \
 			FileDownlinkComponentAi.xml \
 			File.cpp \
 			FileDownlink.cpp \
+			Stream.cpp \
 			Warnings.cpp
 
 HDR = FileDownlink.hpp
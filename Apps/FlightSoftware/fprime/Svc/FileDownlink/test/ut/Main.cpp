@@ -14,6 +14,11 @@ TEST(FileDownlink, FileOpenError) {
   tester.fileOpenError();
 }
 
+TEST(FileDownlink, FileReadError) {
+  Svc::Tester tester;
+  tester.fileReadError();
+}
+
 TEST(FileDownlink, CancelDownlink) {
   Svc::Tester tester;
   tester.cancelDownlink();
@@ -24,6 +29,41 @@ TEST(FileDownlink, CancelInIdleMode) {
   tester.cancelInIdleMode();
 }
 
+TEST(FileDownlink, StreamDownlink) {
+  Svc::Tester tester;
+  tester.streamDownlink();
+}
+
+TEST(FileDownlink, StreamCancel) {
+  Svc::Tester tester;
+  tester.streamCancel();
+}
+
+TEST(FileDownlink, StreamRateLimit) {
+  Svc::Tester tester;
+  tester.streamRateLimit();
+}
+
+TEST(FileDownlink, StreamNoBuffer) {
+  Svc::Tester tester;
+  tester.streamNoBuffer();
+}
+
+TEST(FileDownlink, StreamInFlight) {
+  Svc::Tester tester;
+  tester.streamInFlight();
+}
+
+TEST(FileDownlink, StreamBusy) {
+  Svc::Tester tester;
+  tester.streamBusy();
+}
+
+TEST(FileDownlink, SetRate) {
+  Svc::Tester tester;
+  tester.setRate();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
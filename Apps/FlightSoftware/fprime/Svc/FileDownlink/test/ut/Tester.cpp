@@ -14,6 +14,7 @@
 #include <unistd.h>
 
 #include "Tester.hpp"
+#include <Os/FileSystem.hpp>
 
 #define INSTANCE 0
 #define CMD_SEQ 0
@@ -22,6 +23,7 @@
 #define DOWNLINK_PACKET_SIZE 5
 #define MANAGER_ID 100
 #define BUFFER_ID 200
+#define TICKS_PER_SECOND 2
 
 namespace Svc {
 
@@ -32,7 +34,8 @@ namespace Svc {
   Tester ::
     Tester(void) : 
       FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE),
-      component("FileDownlink", DOWNLINK_PACKET_SIZE)
+      component("FileDownlink", DOWNLINK_PACKET_SIZE),
+      bufferUnavailable(false)
   {
     this->connectPorts();
     this->initComponents();
@@ -124,6 +127,47 @@ namespace Svc {
     ASSERT_EVENTS_SIZE(1);
     ASSERT_EVENTS_FileDownlink_FileOpenError(0, sourceFileName);
 
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+  }
+
+  void Tester ::
+    fileReadError(void) 
+  {
+
+    // A directory opens for reading, reports a nonzero size,
+    // and fails on the first read
+    const char *const sourceFileName = "source_dir";
+    const Os::FileSystem::Status fsStatus =
+      Os::FileSystem::createDirectory(sourceFileName);
+    ASSERT_EQ(Os::FileSystem::OP_OK, fsStatus);
+
+    // Send the file and assert COMMAND_EXECUTION_ERROR
+    this->sendFile(sourceFileName, "dest.bin", Fw::COMMAND_EXECUTION_ERROR);
+
+    // Assert events
+    ASSERT_EVENTS_FileDownlink_FileReadError_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileReadError(0, sourceFileName);
+
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+    // A cancel in idle mode does not affect the next downlink
+    this->clearHistory();
+    this->cancel(Fw::COMMAND_OK);
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+    this->clearHistory();
+
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write("source.bin");
+    this->sendFile("source.bin", "dest.bin", Fw::COMMAND_OK);
+    ASSERT_EVENTS_FileDownlink_FileSent_SIZE(1);
+
+    this->removeFile("source.bin");
+    (void) Os::FileSystem::removeDirectory(sourceFileName);
+
   }
 
   void Tester ::
@@ -177,6 +221,305 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    streamDownlink(void) 
+  {
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 1, 0, 0);
+
+    // Create a file
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // The command stays pending until the transfer ends
+    this->startStream(sourceFileName, destFileName);
+    ASSERT_EQ(FileDownlink::Mode::DOWNLINK, this->component.mode.get());
+    ASSERT_from_bufferSendOut_SIZE(0);
+
+    // One packet per tick: start, data, data
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(0);
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(2);
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+    // The last data packet is followed by the end packet
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+
+    // Assert telemetry: two ticks make one second
+    ASSERT_TLM_FileDownlink_PacketsSent_SIZE(4);
+    ASSERT_TLM_FileDownlink_FilesSent_SIZE(1);
+    ASSERT_TLM_FileDownlink_FilesSent(0, 1);
+    ASSERT_TLM_FileDownlink_BytesPerSecond_SIZE(1);
+
+    // Assert events
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileSent_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_FileSent(0, sourceFileName, destFileName);
+
+    // Validate the packet history
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        4,
+        checksum
+    );
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    // Assert idle mode
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    streamCancel(void) 
+  {
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 1, 0, 0);
+
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // Send the start packet and the first data packet
+    this->startStream(sourceFileName, destFileName);
+    this->tick();
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(2);
+
+    // Cancel takes effect on the next tick
+    this->cancel(Fw::COMMAND_OK);
+    ASSERT_EQ(FileDownlink::Mode::CANCEL, this->component.mode.get());
+    this->clearHistory();
+    this->tick();
+
+    // The pending SendFile completes with the cancel packet
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SENDFILE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_from_bufferSendOut_SIZE(1);
+    validateCancelPacket(this->fromPortHistory_bufferSendOut->at(0).fwBuffer, 2);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_DownlinkCanceled(0, sourceFileName, destFileName);
+    ASSERT_EQ(FileDownlink::Mode::IDLE, this->component.mode.get());
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    streamRateLimit(void) 
+  {
+
+    // One data packet (header plus DOWNLINK_PACKET_SIZE bytes) per tick
+    const U32 dataPacketSize = 
+      Fw::FilePacket::DataPacket::HEADERSIZE + DOWNLINK_PACKET_SIZE;
+    this->component.configureStreaming(
+        TICKS_PER_SECOND,
+        10,
+        TICKS_PER_SECOND * dataPacketSize,
+        0
+    );
+
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->startStream(sourceFileName, destFileName);
+
+    // The start packet uses up the first tick's budget
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(1);
+
+    // Then one data packet per tick, despite 10 packets per tick allowed
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(2);
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        4,
+        checksum
+    );
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    streamNoBuffer(void) 
+  {
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 10, 0, 0);
+
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->startStream(sourceFileName, destFileName);
+
+    // Nothing goes out while the buffer manager is empty
+    this->bufferUnavailable = true;
+    this->tick();
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(0);
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+    // The transfer resumes and the checksum is still correct
+    this->bufferUnavailable = false;
+    this->tick();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_END,
+        4,
+        checksum
+    );
+    FileBuffer fileBufferIn(dataPackets);
+    ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    streamInFlight(void) 
+  {
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 10, 0, 2);
+
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->startStream(sourceFileName, destFileName);
+
+    // Start and one data packet fill the window
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(2);
+    ASSERT_TLM_FileDownlink_PacketsInFlight_SIZE(1);
+    ASSERT_TLM_FileDownlink_PacketsInFlight(0, 2);
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(2);
+
+    // Returning one buffer opens the window for one more
+    Fw::Buffer buffer = this->fromPortHistory_bufferSendOut->at(0).fwBuffer;
+    this->invoke_to_bufferReturn(0, buffer);
+    this->component.doDispatch();
+    ASSERT_from_bufferReturnOut_SIZE(1);
+    this->tick();
+    ASSERT_from_bufferSendOut_SIZE(4);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    streamBusy(void) 
+  {
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 1, 0, 0);
+
+    const char *const sourceFileName = "source.bin";
+    U8 data[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    this->startStream(sourceFileName, "dest.bin");
+    this->sendFile(sourceFileName, "dest2.bin", Fw::COMMAND_BUSY);
+
+    this->removeFile(sourceFileName);
+
+  }
+
+  void Tester ::
+    setRate(void) 
+  {
+
+    // Not available without streaming
+    this->sendCmd_FileDownlink_SetRate(INSTANCE, CMD_SEQ, 1, 1000);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SETRATE,
+        CMD_SEQ,
+        Fw::COMMAND_EXECUTION_ERROR
+    );
+
+    this->component.configureStreaming(TICKS_PER_SECOND, 1, 0, 0);
+
+    // Zero packets per tick is rejected
+    this->clearHistory();
+    this->sendCmd_FileDownlink_SetRate(INSTANCE, CMD_SEQ, 0, 1000);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SETRATE,
+        CMD_SEQ,
+        Fw::COMMAND_VALIDATION_ERROR
+    );
+
+    this->clearHistory();
+    this->sendCmd_FileDownlink_SetRate(INSTANCE, CMD_SEQ, 4, 1000);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(
+        0,
+        FileDownlink::OPCODE_FILEDOWNLINK_SETRATE,
+        CMD_SEQ,
+        Fw::COMMAND_OK
+    );
+    ASSERT_EVENTS_FileDownlink_RateSet_SIZE(1);
+    ASSERT_EVENTS_FileDownlink_RateSet(0, 4, 1000);
+    ASSERT_EQ(4U, this->component.stream.packetsPerTick);
+    ASSERT_EQ(1000U, this->component.stream.bytesPerSecond);
+
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -187,6 +530,10 @@ namespace Svc {
         U32 size
     )
   {
+    if (this->bufferUnavailable) {
+      Fw::Buffer buffer(MANAGER_ID, BUFFER_ID, 0, size);
+      return buffer;
+    }
     U8 *const data = new U8[size];
     Fw::Buffer buffer(
         MANAGER_ID,
@@ -215,6 +562,15 @@ namespace Svc {
     this->pushFromPortEntry_pingOut(key);
   }
 
+  void Tester ::
+    from_bufferReturnOut_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer& fwBuffer
+    )
+  {
+    this->pushFromPortEntry_bufferReturnOut(fwBuffer);
+  }
+
   // ----------------------------------------------------------------------
   // Private instance methods
   // ----------------------------------------------------------------------
@@ -289,6 +645,24 @@ namespace Svc {
         this->get_from_pingOut(0)
     );
 
+    // Run
+    this->connect_to_Run(
+        0,
+        this->component.get_Run_InputPort(0)
+    );
+
+    // bufferReturn
+    this->connect_to_bufferReturn(
+        0,
+        this->component.get_bufferReturn_InputPort(0)
+    );
+
+    // bufferReturnOut
+    this->component.set_bufferReturnOut_OutputPort(
+        0,
+        this->get_from_bufferReturnOut(0)
+    );
+
   }
 
   void Tester ::
@@ -331,6 +705,35 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    startStream(
+        const char *const sourceFileName,
+        const char *const destFileName
+    )
+  {
+
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_FileDownlink_SendFile(
+        INSTANCE, 
+        CMD_SEQ, 
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+
+    // The response comes when the transfer ends
+    ASSERT_CMD_RESPONSE_SIZE(0);
+
+  }
+
+  void Tester ::
+    tick(void)
+  {
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+  }
+
   void Tester ::
     cancel(const Fw::CommandResponse response)
   {
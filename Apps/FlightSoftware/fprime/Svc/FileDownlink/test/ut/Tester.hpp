@@ -111,6 +111,10 @@ namespace Svc {
       //!
       void fileOpenError(void);
 
+      //! Cause a file read error
+      //!
+      void fileReadError(void);
+
       //! Start and then cancel a downlink
       //!
       void cancelDownlink(void);
@@ -119,6 +123,34 @@ namespace Svc {
       //!
       void cancelInIdleMode(void);
 
+      //! Downlink a file in streaming mode, one packet per tick
+      //!
+      void streamDownlink(void);
+
+      //! Cancel a streaming downlink between ticks
+      //!
+      void streamCancel(void);
+
+      //! Limit a streaming downlink with a byte budget
+      //!
+      void streamRateLimit(void);
+
+      //! Resume a streaming downlink after buffers run out
+      //!
+      void streamNoBuffer(void);
+
+      //! Limit a streaming downlink by packets in flight
+      //!
+      void streamInFlight(void);
+
+      //! Reject a second file while streaming
+      //!
+      void streamBusy(void);
+
+      //! Change the streaming rate by command
+      //!
+      void setRate(void);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -146,6 +178,13 @@ namespace Svc {
           U32 key /*!< Value to return to pinger*/
       );
 
+      //! Handler for from_bufferReturnOut
+      //!
+      void from_bufferReturnOut_handler(
+          const NATIVE_INT_TYPE portNum, //!< The port number
+          Fw::Buffer& fwBuffer
+      );
+
 
 
     private:
@@ -171,6 +210,18 @@ namespace Svc {
           const Fw::CommandResponse response //!< The expected command response
       );
 
+      //! Command the FileDownlink component to send a file in streaming mode
+      //! Assert that the command is still pending
+      //!
+      void startStream(
+          const char *const sourceFileName, //!< The source file name
+          const char *const destFileName //!< The destination file name
+      );
+
+      //! Invoke the Run port and dispatch the tick
+      //!
+      void tick(void);
+
       //! Command the FileDownlink component to cancel a file downlink
       //! Assert a command response
       //!
@@ -254,6 +305,10 @@ namespace Svc {
       //!
       U32 sequenceIndex;
 
+      //! Whether buffer requests should fail
+      //!
+      bool bufferUnavailable;
+
   };
 
 } // end namespace Svc
@@ -1,8 +1,6 @@
 #include <Svc/LinuxTime/CubeRoverTimeImpl.hpp>
 #include <Fw/Time/Time.hpp>
-
-#include <HAL/include/FreeRTOS.h>
-#include <HAL/include/os_task.h>
+#include <Os/CycleCounter.hpp>
 
 
 namespace Svc {
@@ -23,10 +21,13 @@ namespace Svc {
             Fw::Time &time /*!< The U32 cmd argument*/
         ) {
 
-        // Assumption here is that configTICK_RATE_HZ is set to 1000
-        // from the freeRTOS configuration.
-        uint32_t second = xTaskGetTickCount() / configTICK_RATE_HZ;
-        time.set(TB_WORKSTATION_TIME, 0, second, xTaskGetTickCount() * 1000);
+        // Time since the cycle counter started, split into whole seconds and
+        // the microseconds of the remainder with the precomputed conversion,
+        // since a 64-bit division is a library call on the target
+        U32 seconds;
+        U32 useconds;
+        Os::CycleCounter::toTime(Os::CycleCounter::read(), seconds, useconds);
+        time.set(TB_WORKSTATION_TIME, 0, seconds, useconds);
     }
 
     void CubeRoverTimeImpl::init(NATIVE_INT_TYPE instance) {
@@ -5,6 +5,16 @@
 
 namespace Svc {
 
+//! \class CubeRoverTimeImpl
+//! \brief Time since boot from Os::CycleCounter
+//!
+//! The cycle counter is 32 bits on the target and is extended to 64 bits
+//! in software by Os::CycleCounter::read(). The extension only sees one
+//! wrap between reads, so read() must run at least once per wrap, about
+//! every 19.5 s at 220 MHz. Each time request reads the counter, and so
+//! does each TimerVal a rate group takes, so any running rate group keeps
+//! the time valid. With no reads for longer than that, the time falls
+//! behind by a whole number of wraps.
 class CubeRoverTimeImpl: public TimeComponentBase {
     public:
 #if FW_OBJECT_NAMES == 1
@@ -10,6 +10,25 @@
 #include <Fw/Types/BasicTypes.hpp>
 
 namespace Svc {
+
+#if POLYDB_USE_SEQLOCK
+    static U32 loadAcquire(const volatile U32* ptr) {
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+    }
+
+    static U32 loadRelaxed(const volatile U32* ptr) {
+        return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    }
+
+    static void storeRelaxed(volatile U32* ptr, U32 value) {
+        __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+    }
+
+    static void storeRelease(volatile U32* ptr, U32 value) {
+        __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+    }
+#endif
+
 #if FW_OBJECT_NAMES == 1
     PolyDbImpl::PolyDbImpl(const char* name) : PolyDbComponentBase(name) {
 #else
@@ -17,7 +36,8 @@ namespace Svc {
 #endif
         // initialize all entries to stale
         for (NATIVE_INT_TYPE entry = 0; entry < POLYDB_NUM_DB_ENTRIES; entry++) {
-            this->m_db[entry].status = MEASUREMENT_STALE;
+            this->m_db[entry].data.seq = 0;
+            this->m_db[entry].data.status = MEASUREMENT_STALE;
         }
     }
 
@@ -25,21 +45,54 @@ namespace Svc {
         PolyDbComponentBase::init(instance);
     }
 
-    // If ports are no longer guarded, these accesses need to be protected from each other
-    // If there are a lot of accesses, perhaps an interrupt lock could be used instead of guarded ports
+    // The ports are synchronous, so the handlers protect the database
+    // themselves. With POLYDB_USE_SEQLOCK, readers don't take the mutex
+    // unless an entry stays busy; writers always do.
 
     void PolyDbImpl::getValue_handler(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val) {
         FW_ASSERT(entry < POLYDB_NUM_DB_ENTRIES,entry);
-        status = this->m_db[entry].status;
-        time = this->m_db[entry].time;
-        val = this->m_db[entry].val;
+        const t_dbStruct& db = this->m_db[entry].data;
+#if POLYDB_USE_SEQLOCK
+        for (NATIVE_UINT_TYPE retry = 0; retry < POLYDB_READ_RETRIES; retry++) {
+            const U32 seq = loadAcquire(&db.seq);
+            if (seq & 1) {
+                // update in progress
+                continue;
+            }
+            status = db.status;
+            time = db.time;
+            val = db.val;
+            // the copy must be done before the count is read again
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (loadRelaxed(&db.seq) == seq) {
+                return;
+            }
+        }
+#endif
+        this->m_lock.lock();
+        status = db.status;
+        time = db.time;
+        val = db.val;
+        this->m_lock.unLock();
     }
 
     void PolyDbImpl::setValue_handler(NATIVE_INT_TYPE portNum, U32 entry, MeasurementStatus &status, Fw::Time &time, Fw::PolyType &val) {
         FW_ASSERT(entry < POLYDB_NUM_DB_ENTRIES,entry);
-        this->m_db[entry].status = status;
-        this->m_db[entry].time = time;
-        this->m_db[entry].val = val;
+        t_dbStruct& db = this->m_db[entry].data;
+        this->m_lock.lock();
+#if POLYDB_USE_SEQLOCK
+        const U32 seq = db.seq;
+        storeRelaxed(&db.seq, seq + 1);
+        // readers must see the odd count before any of the new values
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+        db.status = status;
+        db.time = time;
+        db.val = val;
+#if POLYDB_USE_SEQLOCK
+        storeRelease(&db.seq, seq + 2);
+#endif
+        this->m_lock.unLock();
     }
 
     PolyDbImpl::~PolyDbImpl() {
@@ -15,6 +15,7 @@
 #include <Svc/PolyDb/PolyDbComponentAc.hpp>
 #include <Fw/Types/PolyType.hpp>
 #include <Svc/PolyDb/PolyDbImplCfg.hpp>
+#include <Os/Mutex.hpp>
 
 namespace Svc {
 
@@ -92,10 +93,26 @@ namespace Svc {
             //!
 
             struct t_dbStruct {
+                volatile U32 seq; //!< number of updates started; odd while an update is in progress
                 MeasurementStatus status; //!< last status of measurement
                 Fw::PolyType val; //!< the last value of the measurement
                 Fw::Time time; //!< the timetag of the last measurement
-            } m_db[POLYDB_NUM_DB_ENTRIES];
+            };
+
+            //! \struct t_dbEntry
+            //! \brief A database entry padded to whole cache lines
+            //!
+
+            struct t_dbEntry {
+                t_dbStruct data; //!< the measurement
+                U8 pad[POLYDB_CACHE_LINE - (sizeof(t_dbStruct) % POLYDB_CACHE_LINE)]; //!< fills out the last cache line
+            } m_db[POLYDB_NUM_DB_ENTRIES]
+#ifdef __GNUC__
+            __attribute__((aligned(POLYDB_CACHE_LINE)))
+#endif
+            ;
+
+            Os::Mutex m_lock; //!< serializes writers, and readers that can't get a consistent copy
 
     };
 }
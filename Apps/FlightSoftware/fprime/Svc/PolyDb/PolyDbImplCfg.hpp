@@ -8,6 +8,26 @@
 #ifndef POLYDB_POLYDBIMPLCFG_HPP_
 #define POLYDB_POLYDBIMPLCFG_HPP_
 
+// When 1, readers don't lock. Each entry has an update count that writers
+// make odd while they update the entry, and a reader copies the entry again
+// if the count changed. When 0, a mutex guards every read and write.
+#ifndef POLYDB_USE_SEQLOCK
+#define POLYDB_USE_SEQLOCK 1
+#endif
+
+// Number of times a reader copies an entry that is being updated before it
+// waits on the writers' mutex. On a single core, a reader that preempted a
+// writer would otherwise retry until its time slice ran out.
+#ifndef POLYDB_READ_RETRIES
+#define POLYDB_READ_RETRIES 16
+#endif
+
+// Size of a cache line. Entries are padded to whole cache lines so that a
+// write to one entry doesn't disturb readers of its neighbors.
+#ifndef POLYDB_CACHE_LINE
+#define POLYDB_CACHE_LINE 64
+#endif
+
 namespace {
 
     enum {
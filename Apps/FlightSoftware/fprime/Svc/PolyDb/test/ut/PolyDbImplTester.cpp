@@ -6,7 +6,12 @@
  */
 
 #include <Svc/PolyDb/test/ut/PolyDbImplTester.hpp>
+#include <Os/IntervalTimer.hpp>
 #include <cstdio>
+#include <vector>
+#include <algorithm>
+#include <pthread.h>
+#include <time.h>
 #include <gtest/gtest.h>
 #include <Fw/Test/UnitTest.hpp>
 
@@ -90,5 +95,152 @@ namespace Svc {
 
     }
 
+    // Arguments for the writer and reader threads. A writer stores value v
+    // as status v % 3, time (v, v % 1000000) and PolyType v, so a reader can
+    // tell a torn read from a consistent one.
+    struct PolyDbImplTester::ThreadArgs {
+        PolyDbImplTester* tester;
+        bool guarded; //!< take the tester's mutex around each call, like the old guarded ports
+        U32 iterations; //!< reads to do
+        volatile bool* stop; //!< set when the writer should stop
+        U32 seed;
+        U32 errors; //!< inconsistent reads
+        std::vector<U32> latencies; //!< time of each read in ns, if recorded
+        bool record;
+    };
+
+    void* PolyDbImplTester::writerThread(void* arg) {
+        ThreadArgs* args = static_cast<ThreadArgs*>(arg);
+        for (U32 v = POLYDB_NUM_DB_ENTRIES; not *args->stop; v++) {
+            MeasurementStatus stat = (MeasurementStatus) (v % 3);
+            Fw::Time ts(TB_NONE, v, v % 1000000);
+            Fw::PolyType val(v);
+            if (args->guarded) {
+                args->tester->m_guard.lock();
+            }
+            args->tester->setValue_out(0, v % POLYDB_NUM_DB_ENTRIES, stat, ts, val);
+            if (args->guarded) {
+                args->tester->m_guard.unLock();
+            }
+        }
+        return NULL;
+    }
+
+    void* PolyDbImplTester::readerThread(void* arg) {
+        ThreadArgs* args = static_cast<ThreadArgs*>(arg);
+        U32 seed = args->seed;
+        for (U32 iter = 0; iter < args->iterations; iter++) {
+            seed = seed * 1103515245 + 12345;
+            MeasurementStatus stat;
+            Fw::Time ts;
+            Fw::PolyType val;
+            // IntervalTimer only resolves microseconds here
+            timespec t1, t2;
+            (void) clock_gettime(CLOCK_MONOTONIC, &t1);
+            if (args->guarded) {
+                args->tester->m_guard.lock();
+            }
+            args->tester->getValue_out(0, (seed >> 16) % POLYDB_NUM_DB_ENTRIES, stat, ts, val);
+            if (args->guarded) {
+                args->tester->m_guard.unLock();
+            }
+            (void) clock_gettime(CLOCK_MONOTONIC, &t2);
+            if (args->record) {
+                args->latencies.push_back((t2.tv_sec - t1.tv_sec) * 1000000000 + (t2.tv_nsec - t1.tv_nsec));
+            }
+            U32 v = (U32) val;
+            if ((ts.getSeconds() != v) or (ts.getUSeconds() != v % 1000000) or (stat != (MeasurementStatus) (v % 3))) {
+                args->errors++;
+            }
+        }
+        return NULL;
+    }
+
+    U32 PolyDbImplTester::runThreads(ThreadArgs* readers, NATIVE_UINT_TYPE numReaders, bool guarded) {
+        // give every entry a consistent value to start
+        for (U32 entry = 0; entry < POLYDB_NUM_DB_ENTRIES; entry++) {
+            MeasurementStatus stat = (MeasurementStatus) (entry % 3);
+            Fw::Time ts(TB_NONE, entry, entry);
+            Fw::PolyType val(entry);
+            this->setValue_out(0, entry, stat, ts, val);
+        }
+
+        volatile bool stop = false;
+        ThreadArgs writer;
+        writer.tester = this;
+        writer.guarded = guarded;
+        writer.stop = &stop;
+
+        pthread_t writerId;
+        std::vector<pthread_t> readerIds(numReaders);
+        EXPECT_EQ(0, pthread_create(&writerId, NULL, writerThread, &writer));
+        for (NATIVE_UINT_TYPE reader = 0; reader < numReaders; reader++) {
+            readers[reader].tester = this;
+            readers[reader].guarded = guarded;
+            readers[reader].stop = &stop;
+            readers[reader].seed = reader;
+            readers[reader].errors = 0;
+            EXPECT_EQ(0, pthread_create(&readerIds[reader], NULL, readerThread, &readers[reader]));
+        }
+
+        U32 errors = 0;
+        for (NATIVE_UINT_TYPE reader = 0; reader < numReaders; reader++) {
+            EXPECT_EQ(0, pthread_join(readerIds[reader], NULL));
+            errors += readers[reader].errors;
+        }
+        stop = true;
+        EXPECT_EQ(0, pthread_join(writerId, NULL));
+        return errors;
+    }
+
+    void PolyDbImplTester::runConcurrentReadWrite(void) {
+        enum {
+            NUM_READERS = 4
+        };
+        ThreadArgs readers[NUM_READERS];
+        for (NATIVE_UINT_TYPE reader = 0; reader < NUM_READERS; reader++) {
+            readers[reader].iterations = 200000;
+            readers[reader].record = false;
+        }
+        // every read returns one whole update
+        ASSERT_EQ(0U, this->runThreads(readers, NUM_READERS, false));
+    }
+
+    void PolyDbImplTester::runReaderLatencyBenchmark(void) {
+        enum {
+            NUM_READERS = 8,
+            ITERATIONS = 200000
+        };
+        const char* names[2] = {"guarded ports", "sync ports"};
+        for (NATIVE_INT_TYPE mode = 0; mode < 2; mode++) {
+            const bool guarded = (0 == mode);
+            ThreadArgs readers[NUM_READERS];
+            std::vector<U32> all;
+            for (NATIVE_UINT_TYPE reader = 0; reader < NUM_READERS; reader++) {
+                readers[reader].iterations = ITERATIONS;
+                readers[reader].record = true;
+                readers[reader].latencies.reserve(ITERATIONS);
+            }
+            Os::IntervalTimer timer;
+            timer.start();
+            ASSERT_EQ(0U, this->runThreads(readers, NUM_READERS, guarded));
+            timer.stop();
+            for (NATIVE_UINT_TYPE reader = 0; reader < NUM_READERS; reader++) {
+                all.insert(all.end(), readers[reader].latencies.begin(), readers[reader].latencies.end());
+            }
+            std::sort(all.begin(), all.end());
+            U64 sum = 0;
+            for (NATIVE_UINT_TYPE read = 0; read < all.size(); read++) {
+                sum += all[read];
+            }
+            printf("%s (%s), 1 writer, %d readers, %d reads each: %u us\n",
+                    names[mode], POLYDB_USE_SEQLOCK ? "seqlock" : "mutex",
+                    NUM_READERS, ITERATIONS, timer.getDiffUsec());
+            printf("  read latency ns: mean %llu p50 %u p99 %u p99.9 %u max %u\n",
+                    (unsigned long long) (sum / all.size()),
+                    all[all.size() / 2], all[all.size() * 99 / 100],
+                    all[all.size() * 999 / 1000], all[all.size() - 1]);
+        }
+    }
 
 } /* namespace Svc */
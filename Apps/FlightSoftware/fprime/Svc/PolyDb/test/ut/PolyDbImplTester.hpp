@@ -10,6 +10,7 @@
 
 #include <Svc/PolyDb/test/ut/PolyDbComponentTestAc.hpp>
 #include <Svc/PolyDb/PolyDbImpl.hpp>
+#include <Os/Mutex.hpp>
 
 namespace Svc {
 
@@ -21,10 +22,19 @@ namespace Svc {
             void init(NATIVE_INT_TYPE instance = 0);
 
             void runNominalReadWrite(void);
+            void runConcurrentReadWrite(void);
+            void runReaderLatencyBenchmark(void);
 
         private:
             Svc::PolyDbImpl& m_impl;
 
+            struct ThreadArgs;
+            static void* writerThread(void* arg);
+            static void* readerThread(void* arg);
+            //! Run one writer and readers at once; returns the number of inconsistent reads
+            U32 runThreads(ThreadArgs* readers, NATIVE_UINT_TYPE numReaders, bool guarded);
+            Os::Mutex m_guard; //!< stands in for the port guard of the old guarded ports
+
     };
 
 } /* namespace Svc */
@@ -52,6 +52,47 @@ TEST(CmdDispTestNominal,NominalReadWrite) {
 }
 
 
+TEST(CmdDispTestNominal,ConcurrentReadWrite) {
+
+    TEST_CASE(104.1.2, "PolyDb Concurrent Read/Write Test");
+
+    COMMENT(
+            "Read values while another thread writes them, and check"
+            "that no read returns a partly written value."
+            );
+
+    Svc::PolyDbImpl impl("PolyDbImpl");
+
+    impl.init(0);
+
+    Svc::PolyDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runConcurrentReadWrite();
+
+}
+
+TEST(Performance,ReaderLatencyBenchmark) {
+
+    Svc::PolyDbImpl impl("PolyDbImpl");
+
+    impl.init(0);
+
+    Svc::PolyDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runReaderLatencyBenchmark();
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
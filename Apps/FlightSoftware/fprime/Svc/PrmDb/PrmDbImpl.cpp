@@ -8,8 +8,12 @@
 #include <Svc/PrmDb/PrmDbImpl.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/SerialBuffer.hpp>
 
 #include <Os/File.hpp>
+#include <Utils/Hash/IdHash.hpp>
+
+#include <new>
 
 #include <cstring>
 #include <stdio.h>
@@ -37,6 +41,63 @@ namespace Svc {
                 // Set to max of parameter buffer + id
                 U8 m_buff[FW_PARAM_BUFFER_MAX_SIZE + sizeof(FwPrmIdType)];
         };
+
+        // Reads a file in large chunks and hands out contiguous bytes from them
+        class ChunkReader {
+            public:
+
+                ChunkReader(Os::File& file, U8* buff, NATIVE_UINT_TYPE size) :
+                    m_file(file), m_buff(buff), m_size(size), m_head(0), m_tail(0), m_eof(false) {
+                }
+
+                //! Make at least needed bytes available, unless the file ends first
+                Os::File::Status fill(NATIVE_UINT_TYPE needed) {
+                    FW_ASSERT(needed <= this->m_size,needed,this->m_size);
+                    if ((this->available() >= needed) or this->m_eof) {
+                        return Os::File::OP_OK;
+                    }
+                    // move the unread bytes to the front and read the rest of the chunk
+                    const NATIVE_UINT_TYPE remaining = this->available();
+                    memmove(this->m_buff,&this->m_buff[this->m_head],remaining);
+                    this->m_head = 0;
+                    this->m_tail = remaining;
+                    // a waitForFull read that hits end of file reports no data, so
+                    // take partial reads until the chunk is full or the file ends
+                    while ((this->m_tail < this->m_size) and not this->m_eof) {
+                        NATIVE_INT_TYPE readSize = this->m_size - this->m_tail;
+                        const Os::File::Status stat = this->m_file.read(&this->m_buff[this->m_tail],readSize,false);
+                        if (stat != Os::File::OP_OK) {
+                            return stat;
+                        }
+                        if (0 == readSize) {
+                            this->m_eof = true;
+                        }
+                        this->m_tail += readSize;
+                    }
+                    return Os::File::OP_OK;
+                }
+
+                NATIVE_UINT_TYPE available(void) const {
+                    return this->m_tail - this->m_head;
+                }
+
+                const U8* data(void) const {
+                    return &this->m_buff[this->m_head];
+                }
+
+                void consume(NATIVE_UINT_TYPE size) {
+                    FW_ASSERT(size <= this->available(),size,this->available());
+                    this->m_head += size;
+                }
+
+            private:
+                Os::File& m_file;
+                U8* m_buff;
+                NATIVE_UINT_TYPE m_size;
+                NATIVE_UINT_TYPE m_head; // next byte to hand out
+                NATIVE_UINT_TYPE m_tail; // end of the bytes read
+                bool m_eof;
+        };
     }
 
 
@@ -45,6 +106,14 @@ namespace Svc {
 #else
     PrmDbImpl::PrmDbImpl(const char* file) {
 #endif
+        this->m_db = this->m_defaultDb;
+        this->m_dbSize = PRMDB_NUM_DB_ENTRIES;
+        this->m_index = this->m_defaultIndex;
+        this->m_indexMask = PRMDB_NUM_INDEX_SLOTS - 1;
+        this->m_allocatorId = 0;
+        // index must be a power of two and at most half full
+        FW_ASSERT((PRMDB_NUM_INDEX_SLOTS & this->m_indexMask) == 0,PRMDB_NUM_INDEX_SLOTS);
+        FW_ASSERT(PRMDB_NUM_INDEX_SLOTS >= 2*PRMDB_NUM_DB_ENTRIES,PRMDB_NUM_INDEX_SLOTS);
         this->clearDb();
         this->m_fileName = file;
     }
@@ -53,11 +122,102 @@ namespace Svc {
         PrmDbComponentBase::init(queueDepth,instance);
     }
 
+    void PrmDbImpl::allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries) {
+        FW_ASSERT(numEntries > 0);
+        FW_ASSERT(this->m_db == this->m_defaultDb); // only allocate once
+
+        // size the index to a power of two at least twice the number of entries
+        NATIVE_UINT_TYPE indexSlots = 1;
+        while (indexSlots < 2*numEntries) {
+            indexSlots <<= 1;
+        }
+
+        void* dbMem = allocator.allocate(identifier,numEntries*sizeof(t_dbStruct));
+        FW_ASSERT(dbMem);
+        void* indexMem = allocator.allocate(identifier,indexSlots*sizeof(I32));
+        FW_ASSERT(indexMem);
+
+        this->m_db = static_cast<t_dbStruct*>(dbMem);
+        for (NATIVE_UINT_TYPE entry = 0; entry < numEntries; entry++) {
+            new(&this->m_db[entry]) t_dbStruct;
+        }
+        this->m_dbSize = numEntries;
+        this->m_index = static_cast<I32*>(indexMem);
+        this->m_indexMask = indexSlots - 1;
+        this->m_allocatorId = identifier;
+
+        this->clearDb();
+    }
+
+    void PrmDbImpl::deallocateDb(Fw::MemAllocator& allocator) {
+        if (this->m_db == this->m_defaultDb) {
+            return;
+        }
+
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
+            this->m_db[entry].~t_dbStruct();
+        }
+        allocator.deallocate(this->m_allocatorId,this->m_db);
+        allocator.deallocate(this->m_allocatorId,this->m_index);
+
+        this->m_db = this->m_defaultDb;
+        this->m_dbSize = PRMDB_NUM_DB_ENTRIES;
+        this->m_index = this->m_defaultIndex;
+        this->m_indexMask = PRMDB_NUM_INDEX_SLOTS - 1;
+
+        this->clearDb();
+    }
+
     void PrmDbImpl::clearDb(void) {
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_dbSize; entry++) {
             this->m_db[entry].used = false;
             this->m_db[entry].id = 0;
         }
+        for (NATIVE_UINT_TYPE slot = 0; slot <= this->m_indexMask; slot++) {
+            this->m_index[slot] = -1;
+        }
+        this->m_numEntries = 0;
+    }
+
+    I32 PrmDbImpl::findEntry(FwPrmIdType id) const {
+        // linear probe until the ID or an empty slot is found. The index is
+        // at most half full, so there is always an empty slot.
+        NATIVE_UINT_TYPE slot = Utils::hashId(id) & this->m_indexMask;
+        while (this->m_index[slot] != -1) {
+            const I32 entry = this->m_index[slot];
+            if (this->m_db[entry].id == id) {
+                return entry;
+            }
+            slot = (slot + 1) & this->m_indexMask;
+        }
+        return -1;
+    }
+
+    I32 PrmDbImpl::addEntry(FwPrmIdType id) {
+        if (this->m_numEntries >= this->m_dbSize) {
+            return -1;
+        }
+
+        const I32 entry = this->m_numEntries++;
+        this->m_db[entry].used = true;
+        this->m_db[entry].id = id;
+
+        NATIVE_UINT_TYPE slot = Utils::hashId(id) & this->m_indexMask;
+        while (this->m_index[slot] != -1) {
+            slot = (slot + 1) & this->m_indexMask;
+        }
+        this->m_index[slot] = entry;
+
+        return entry;
+    }
+
+    I32 PrmDbImpl::loadEntry(FwPrmIdType id) {
+        // a repeated ID in the file replaces the earlier value
+        const I32 entry = this->findEntry(id);
+        if (entry != -1) {
+            return entry;
+        }
+        return this->addEntry(id);
     }
 
     // If ports are no longer guarded, these accesses need to be protected from each other
@@ -67,14 +227,10 @@ namespace Svc {
         // search for entry
         Fw::ParamValid stat = Fw::PARAM_INVALID;
 
-        for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if (this->m_db[entry].used) {
-                if (this->m_db[entry].id == id) {
-                    val = this->m_db[entry].val;
-                    stat = Fw::PARAM_VALID;
-                    break;
-                }
-            }
+        const I32 entry = this->findEntry(id);
+        if (entry != -1) {
+            val = this->m_db[entry].val;
+            stat = Fw::PARAM_VALID;
         }
 
         // if unable to find parameter, send error message
@@ -94,24 +250,18 @@ namespace Svc {
         bool existingEntry = false;
         bool noSlots = true;
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-            if ((this->m_db[entry].used) && (id == this->m_db[entry].id)) {
-                this->m_db[entry].val = val;
-                existingEntry = true;
-                break;
-            }
+        I32 entry = this->findEntry(id);
+        if (entry != -1) {
+            this->m_db[entry].val = val;
+            existingEntry = true;
         }
 
         // if there is no existing entry, add one
         if (!existingEntry) {
-            for (I32 entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++) {
-                if (!(this->m_db[entry].used)) {
-                    this->m_db[entry].val = val;
-                    this->m_db[entry].id = id;
-                    this->m_db[entry].used = true;
-                    noSlots = false;
-                    break;
-                }
+            entry = this->addEntry(id);
+            if (entry != -1) {
+                this->m_db[entry].val = val;
+                noSlots = false;
             }
         }
 
@@ -145,7 +295,7 @@ namespace Svc {
 
         U32 numRecords = 0;
 
-        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_db); entry++) {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numEntries; entry++) {
             if (this->m_db[entry].used) {
                 // write delimeter
                 static const U8 delim = PRMDB_ENTRY_DELIMETER;
@@ -258,7 +408,7 @@ namespace Svc {
 
         this->clearDb();
 
-        for (NATIVE_INT_TYPE entry = 0; entry < PRMDB_NUM_DB_ENTRIES; entry++)  {
+        for (NATIVE_UINT_TYPE record = 0; record < this->m_dbSize; record++)  {
 
             U8 delimeter;
             NATIVE_INT_TYPE readSize = sizeof(delimeter);
@@ -339,8 +489,9 @@ namespace Svc {
             FW_ASSERT(Fw::FW_SERIALIZE_OK == buff.deserialize(parameterId));
 
             // copy parameter
-            this->m_db[entry].used = true;
-            this->m_db[entry].id = parameterId;
+            const I32 entry = this->loadEntry(parameterId);
+            // can't be full, since there are no more records than entries
+            FW_ASSERT(entry != -1,parameterId);
             readSize = recordSize-sizeof(parameterId);
 
             fStat = paramFile.read(this->m_db[entry].val.getBuffAddr(),readSize);
@@ -365,6 +516,105 @@ namespace Svc {
         this->log_ACTIVITY_HI_PrmFileLoadComplete(recordNum);
     }
 
+    void PrmDbImpl::readParamFileBulk(void) {
+        Os::File paramFile;
+
+        Os::File::Status stat = paramFile.open(this->m_fileName.toChar(),Os::File::OPEN_READ);
+        if (stat != Os::File::OP_OK) {
+            this->log_WARNING_HI_PrmFileReadError(PRM_READ_OPEN,0,stat);
+            return;
+        }
+
+        // delimiter, record size and the largest record must fit in a chunk
+        static const NATIVE_UINT_TYPE headerSize = sizeof(U8) + sizeof(U32);
+        FW_ASSERT(PRMDB_READ_CHUNK_SIZE >= headerSize + FW_PARAM_BUFFER_MAX_SIZE + sizeof(U32),PRMDB_READ_CHUNK_SIZE);
+
+        U8 chunk[PRMDB_READ_CHUNK_SIZE];
+        ChunkReader reader(paramFile,chunk,sizeof(chunk));
+
+        U32 recordNum = 0;
+
+        this->clearDb();
+
+        for (NATIVE_UINT_TYPE record = 0; record < this->m_dbSize; record++)  {
+
+            // read delimiter and record size
+            Os::File::Status fStat = reader.fill(headerSize);
+            if (fStat != Os::File::OP_OK) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_DELIMETER,recordNum,fStat);
+                return;
+            }
+
+            // check for end of file
+            if (0 == reader.available()) {
+                break;
+            }
+
+            const U8 delimeter = reader.data()[0];
+            if (PRMDB_ENTRY_DELIMETER != delimeter) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_DELIMETER_VALUE,recordNum,delimeter);
+                return;
+            }
+
+            if (reader.available() < headerSize) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_RECORD_SIZE_SIZE,recordNum,reader.available() - sizeof(delimeter));
+                return;
+            }
+
+            U32 recordSize = 0;
+            Fw::SerialBuffer sizeBuff(const_cast<U8*>(&reader.data()[sizeof(delimeter)]),sizeof(recordSize));
+            sizeBuff.fill();
+            Fw::SerializeStatus desStat = sizeBuff.deserialize(recordSize);
+            // should never fail
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,(NATIVE_INT_TYPE)desStat);
+
+            // sanity check value. It can't be larger than the maximum parameter buffer size + id
+            // or smaller than the record id
+            if ((recordSize > FW_PARAM_BUFFER_MAX_SIZE + sizeof(U32)) or (recordSize < sizeof(U32))) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_RECORD_SIZE_VALUE,recordNum,recordSize);
+                return;
+            }
+            reader.consume(headerSize);
+
+            // read parameter ID and value
+            fStat = reader.fill(recordSize);
+            if (fStat != Os::File::OP_OK) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_PARAMETER_VALUE,recordNum,fStat);
+                return;
+            }
+            if (reader.available() < sizeof(FwPrmIdType)) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_PARAMETER_ID_SIZE,recordNum,reader.available());
+                return;
+            }
+            if (reader.available() < recordSize) {
+                this->log_WARNING_HI_PrmFileReadError(PRM_READ_PARAMETER_VALUE_SIZE,recordNum,reader.available() - sizeof(FwPrmIdType));
+                return;
+            }
+
+            FwPrmIdType parameterId = 0;
+            Fw::SerialBuffer idBuff(const_cast<U8*>(reader.data()),sizeof(parameterId));
+            idBuff.fill();
+            desStat = idBuff.deserialize(parameterId);
+            // should never fail
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,(NATIVE_INT_TYPE)desStat);
+
+            // copy parameter
+            const I32 entry = this->loadEntry(parameterId);
+            // can't be full, since there are no more records than entries
+            FW_ASSERT(entry != -1,parameterId);
+            desStat = this->m_db[entry].val.setBuff(
+                &reader.data()[sizeof(parameterId)],recordSize-sizeof(parameterId));
+            // should never fail, since record size was checked
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == desStat,(NATIVE_INT_TYPE)desStat);
+            reader.consume(recordSize);
+
+            recordNum++;
+
+        }
+
+        this->log_ACTIVITY_HI_PrmFileLoadComplete(recordNum);
+    }
+
     void PrmDbImpl::pingIn_handler(NATIVE_INT_TYPE portNum, U32 key) {
         // respond to ping
         this->pingOut_out(0,key);
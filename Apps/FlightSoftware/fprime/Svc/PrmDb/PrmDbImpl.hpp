@@ -16,6 +16,7 @@
 #include <Svc/PrmDb/PrmDbComponentAc.hpp>
 #include <Svc/PrmDb/PrmDbImplCfg.hpp>
 #include <Fw/Types/EightyCharString.hpp>
+#include <Fw/Types/MemAllocator.hpp>
 #include <Os/Mutex.hpp>
 
 namespace Svc {
@@ -55,6 +56,25 @@ namespace Svc {
 
             void init(NATIVE_INT_TYPE queueDepth, NATIVE_INT_TYPE instance);
 
+            //!  \brief PrmDb database allocation function
+            //!
+            //!  Replaces the default database of PRMDB_NUM_DB_ENTRIES entries with one
+            //!  of numEntries entries taken from an allocator. Must be called at
+            //!  initialization time, before the parameter file is read. Clears the database.
+            //!
+            //!  \param identifier identifier passed to the allocator
+            //!  \param allocator allocator for the database memory
+            //!  \param numEntries number of parameters the database can hold
+            void allocateDb(NATIVE_INT_TYPE identifier, Fw::MemAllocator& allocator, NATIVE_UINT_TYPE numEntries);
+
+            //!  \brief PrmDb database deallocation function
+            //!
+            //!  Returns memory from allocateDb() to the allocator and reverts to the
+            //!  (cleared) default database.
+            //!
+            //!  \param allocator allocator passed to allocateDb()
+            void deallocateDb(Fw::MemAllocator& allocator);
+
             //!  \brief PrmDb file read function
             //!
             //!  The readFile function reads the set of parameters from the file passed in to
@@ -62,6 +82,14 @@ namespace Svc {
             //!
             void readParamFile(void); // NOTE: Assumed to run at initialzation time. No guard of data structure.
 
+            //!  \brief PrmDb bulk file read function
+            //!
+            //!  Reads the same file format as readParamFile(), but reads the file
+            //!  PRMDB_READ_CHUNK_SIZE bytes at a time and parses records out of memory
+            //!  instead of issuing four reads per record. Preferred for large databases.
+            //!
+            void readParamFileBulk(void); // NOTE: Assumed to run at initialzation time. No guard of data structure.
+
             //!  \brief PrmDb destructor
             //!
             virtual ~PrmDbImpl();
@@ -113,13 +141,50 @@ namespace Svc {
 
             void clearDb(void); //!< clear the parameter database
 
+            //!  \brief PrmDb lookup function
+            //!
+            //!  \param id the parameter ID
+            //!  \return the entry holding the ID, or -1 if there is none
+            I32 findEntry(FwPrmIdType id) const;
+
+            //!  \brief PrmDb entry add function
+            //!
+            //!  Adds an entry for an ID that is not in the database.
+            //!
+            //!  \param id the parameter ID
+            //!  \return the new entry, or -1 if the database is full
+            I32 addEntry(FwPrmIdType id);
+
+            //!  \brief PrmDb load function
+            //!
+            //!  Stores a parameter read from the file, updating it if the ID was seen before
+            //!
+            //!  \param id the parameter ID
+            //!  \return the entry holding the ID, or -1 if the database is full
+            I32 loadEntry(FwPrmIdType id);
+
             Fw::EightyCharString m_fileName; //!< filename for parameter storage
 
             struct t_dbStruct {
                 bool used; //!< whether slot is being used
                 FwPrmIdType id; //!< the id being stored in the slot
                 Fw::ParamBuffer val; //!< the serialized value of the parameter
-            } m_db[PRMDB_NUM_DB_ENTRIES];
+            };
+
+            // Entries are filled in order, so m_db[0..m_numEntries-1] are used. The
+            // index is an open-addressing hash table from ID to entry, with -1 for
+            // empty slots, and is kept at most half full.
+
+            t_dbStruct* m_db; //!< the database entries
+            NATIVE_UINT_TYPE m_dbSize; //!< number of entries in m_db
+            NATIVE_UINT_TYPE m_numEntries; //!< number of entries in use
+            I32* m_index; //!< the ID index
+            NATIVE_UINT_TYPE m_indexMask; //!< number of index slots - 1
+
+            t_dbStruct m_defaultDb[PRMDB_NUM_DB_ENTRIES]; //!< database used unless allocateDb() is called
+            I32 m_defaultIndex[PRMDB_NUM_INDEX_SLOTS]; //!< index used unless allocateDb() is called
+
+            NATIVE_INT_TYPE m_allocatorId; //!< identifier passed to allocateDb()
 
     };
 }
@@ -12,7 +12,9 @@
 namespace {
 
     enum {
-        PRMDB_NUM_DB_ENTRIES = 25, // !< Number of entries in the parameter database
+        PRMDB_NUM_DB_ENTRIES = 25, // !< Number of entries in the parameter database, unless allocated with allocateDb()
+        PRMDB_NUM_INDEX_SLOTS = 64, // !< Number of slots in the ID index for the default database. Power of two, at least twice PRMDB_NUM_DB_ENTRIES
+        PRMDB_READ_CHUNK_SIZE = 1024, // !< Size of the chunks readParamFileBulk() reads from the file. Must hold the largest record.
         PRMDB_ENTRY_DELIMETER = 0xA5 // !< Byte value that should precede each parameter in file; sanity check against file integrity. Should match ground system.
     };
 
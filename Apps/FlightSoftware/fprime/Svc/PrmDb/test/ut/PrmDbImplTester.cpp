@@ -9,6 +9,8 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Com/ComPacket.hpp>
 #include <Os/Stubs/FileStubs.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Fw/Types/MallocAllocator.hpp>
 
 #include <cstdio>
 #include <gtest/gtest.h>
@@ -203,6 +205,108 @@ namespace Svc {
 
     }
 
+    void PrmDbImplTester::runBulkLoad(void) {
+        // save the data
+        this->runNominalSaveFile();
+
+        // read it back in chunks
+        this->clearEvents();
+        this->m_impl.readParamFileBulk();
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileLoadComplete_SIZE(1);
+        ASSERT_EVENTS_PrmFileLoadComplete(0,2);
+
+        // verify values (populated by runNominalPopulate())
+        Fw::ParamBuffer pBuff;
+        U32 testVal;
+        EXPECT_EQ(Fw::PARAM_VALID,this->invoke_to_getPrm(0,0x21,pBuff));
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+        EXPECT_EQ(testVal,(U32)0x15);
+
+        pBuff.resetSer();
+        EXPECT_EQ(Fw::PARAM_VALID,this->invoke_to_getPrm(0,0x25,pBuff));
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+        EXPECT_EQ(testVal,(U32)0x30);
+
+        // file read error on the first chunk
+        this->clearEvents();
+        Os::registerReadInterceptor(this->ReadIntercepter,static_cast<void*>(this));
+        this->m_readsToWait = 0;
+        this->m_testReadStatus = Os::File::NOT_OPENED;
+        this->m_readTestType = FILE_READ_READ_ERROR;
+        this->m_impl.readParamFileBulk();
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError_SIZE(1);
+        ASSERT_EVENTS_PrmFileReadError(0,PrmDbImpl::PRM_READ_DELIMETER,0,Os::File::NOT_OPENED);
+        Os::clearReadInterceptor();
+    }
+
+    void PrmDbImplTester::runLoadBenchmark(void) {
+
+        const NATIVE_UINT_TYPE counts[] = {1000, 5000, 10000};
+        Fw::MallocAllocator allocator;
+        Os::IntervalTimer timer;
+
+        printf("Parameter load times:\n");
+
+        for (NATIVE_UINT_TYPE test = 0; test < FW_NUM_ARRAY_ELEMENTS(counts); test++) {
+            const NATIVE_UINT_TYPE count = counts[test];
+            this->m_impl.allocateDb(0,allocator,count);
+
+            // populate the database with sparse IDs
+            for (NATIVE_UINT_TYPE entry = 0; entry < count; entry++) {
+                Fw::ParamBuffer pBuff;
+                EXPECT_EQ(Fw::FW_SERIALIZE_OK,pBuff.serialize((U32)entry));
+                this->invoke_to_setPrm(0,(FwPrmIdType)(entry*17 + 0x100),pBuff);
+                this->m_impl.doDispatch();
+                this->clearHistory();
+            }
+
+            // save it
+            this->sendCmd_PRM_SAVE_FILE(0,12);
+            this->m_impl.doDispatch();
+            ASSERT_CMD_RESPONSE_SIZE(1);
+            ASSERT_CMD_RESPONSE(0,PrmDbImpl::OPCODE_PRM_SAVE_FILE,12,Fw::COMMAND_OK);
+            ASSERT_EVENTS_PrmFileSaveComplete(0,count);
+
+            // load a record at a time
+            this->clearHistory();
+            timer.start();
+            this->m_impl.readParamFile();
+            timer.stop();
+            const U32 recordUsec = timer.getDiffUsec();
+            ASSERT_EVENTS_PrmFileLoadComplete_SIZE(1);
+            ASSERT_EVENTS_PrmFileLoadComplete(0,count);
+
+            // load in chunks
+            this->clearHistory();
+            timer.start();
+            this->m_impl.readParamFileBulk();
+            timer.stop();
+            const U32 bulkUsec = timer.getDiffUsec();
+            ASSERT_EVENTS_PrmFileLoadComplete_SIZE(1);
+            ASSERT_EVENTS_PrmFileLoadComplete(0,count);
+
+            // look up every parameter
+            timer.start();
+            for (NATIVE_UINT_TYPE entry = 0; entry < count; entry++) {
+                Fw::ParamBuffer pBuff;
+                U32 testVal;
+                ASSERT_EQ(Fw::PARAM_VALID,this->invoke_to_getPrm(0,(FwPrmIdType)(entry*17 + 0x100),pBuff));
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,pBuff.deserialize(testVal));
+                ASSERT_EQ(testVal,(U32)entry);
+            }
+            timer.stop();
+            const U32 getUsec = timer.getDiffUsec();
+
+            printf("  %5u parameters: readParamFile %7u us, readParamFileBulk %7u us, %u gets %6u us\n",
+                count,recordUsec,bulkUsec,count,getUsec);
+
+            this->m_impl.deallocateDb(allocator);
+            this->clearHistory();
+        }
+    }
+
     void PrmDbImplTester::runRefPrmFile(void) {
 
         {
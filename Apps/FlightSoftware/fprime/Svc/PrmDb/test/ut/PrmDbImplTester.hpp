@@ -26,6 +26,8 @@ namespace Svc {
             void runMissingExtraParams(void);
             void runFileReadError(void);
             void runFileWriteError(void);
+            void runBulkLoad(void);
+            void runLoadBenchmark(void);
 
             void runRefPrmFile(void);
 
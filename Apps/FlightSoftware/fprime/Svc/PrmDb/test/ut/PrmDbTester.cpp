@@ -183,6 +183,46 @@ TEST(ParameterDbTest,PrmFileWriteError) {
 
 }
 
+TEST(ParameterDbTest,BulkLoadTest) {
+
+    TEST_CASE(105.1.4,"Bulk file load test");
+    COMMENT("Read the file in chunks and verify the values are correct.");
+
+    Svc::PrmDbImpl impl("PrmDbImpl","TestFile.prm");
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run bulk load tests
+    tester.runBulkLoad();
+
+}
+
+TEST(ParameterDbTest,LoadBenchmark) {
+
+    TEST_CASE(105.3.1,"Load benchmark");
+    COMMENT("Time loading and reading 1k to 10k parameters.");
+
+    Svc::PrmDbImpl impl("PrmDbImpl","TestFile.prm");
+
+    impl.init(10,0);
+
+    Svc::PrmDbImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runLoadBenchmark();
+
+}
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
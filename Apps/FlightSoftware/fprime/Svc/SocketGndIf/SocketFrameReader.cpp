@@ -0,0 +1,198 @@
+// ======================================================================
+// \title  SocketFrameReader.cpp
+// \brief  cpp file for the socket ground interface frame parser
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/SocketGndIf/SocketFrameReader.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <string.h>
+
+namespace Svc {
+
+  namespace {
+
+    inline U32 loadBe32(const U8* const p) {
+      return (static_cast<U32>(p[0]) << 24)
+          | (static_cast<U32>(p[1]) << 16)
+          | (static_cast<U32>(p[2]) << 8)
+          | static_cast<U32>(p[3]);
+    }
+
+  }
+
+  SocketFrameReader ::
+    SocketFrameReader(void) :
+      m_head(0),
+      m_tail(0),
+      m_skip(0),
+      m_dest(NULL),
+      m_discarded(0)
+  {
+
+  }
+
+  void SocketFrameReader ::
+    reset(void)
+  {
+    this->m_head = 0;
+    this->m_tail = 0;
+    this->m_skip = 0;
+    this->m_dest = NULL;
+  }
+
+  bool SocketFrameReader ::
+    isDirect(void) const
+  {
+    // With nothing buffered, the rest of a streamed frame is received
+    // straight into its destination
+    return (this->m_dest != NULL) && (this->m_skip > 0) &&
+      (this->m_head == this->m_tail);
+  }
+
+  U8* SocketFrameReader ::
+    getWriteAddr(void)
+  {
+    if (this->isDirect()) {
+      return this->m_dest;
+    }
+    // Only a partial frame is left behind by nextFrame(), so moving it
+    // to the front keeps the next frame contiguous at little cost
+    if (this->m_head > 0) {
+      const U32 remaining = this->m_tail - this->m_head;
+      if (remaining > 0) {
+        (void) memmove(this->m_buffer, &this->m_buffer[this->m_head], remaining);
+      }
+      this->m_head = 0;
+      this->m_tail = remaining;
+    }
+    return &this->m_buffer[this->m_tail];
+  }
+
+  U32 SocketFrameReader ::
+    getWriteSpace(void) const
+  {
+    if (this->isDirect()) {
+      return this->m_skip;
+    }
+    return BUFFER_SIZE - this->m_tail;
+  }
+
+  void SocketFrameReader ::
+    commit(const U32 size)
+  {
+    FW_ASSERT(size <= this->getWriteSpace(), size, this->m_tail);
+    if (this->isDirect()) {
+      this->m_dest += size;
+      this->m_skip -= size;
+    }
+    else {
+      this->m_tail += size;
+    }
+  }
+
+  SocketFrameReader::Status SocketFrameReader ::
+    nextFrame(Frame& frame)
+  {
+    while (true) {
+
+      U32 available = this->m_tail - this->m_head;
+
+      // Drop or stream the rest of an oversize frame
+      if (this->m_skip > 0) {
+        const U32 drop = (available < this->m_skip) ? available : this->m_skip;
+        if (this->m_dest != NULL) {
+          (void) memcpy(this->m_dest, &this->m_buffer[this->m_head], drop);
+          this->m_dest += drop;
+        }
+        this->m_head += drop;
+        this->m_skip -= drop;
+        if (this->m_skip > 0) {
+          return FRAME_NEED_DATA;
+        }
+        available -= drop;
+      }
+
+      if (this->m_dest != NULL) {
+        this->m_dest = NULL;
+        return FRAME_STREAMED;
+      }
+
+      if (available < sizeof(U32)) {
+        return FRAME_NEED_DATA;
+      }
+
+      const U8* const start = &this->m_buffer[this->m_head];
+      const U32 delimiter = loadBe32(start);
+
+      if (delimiter == QUIT_DELIM) {
+        this->m_head += sizeof(U32);
+        return FRAME_QUIT;
+      }
+
+      if (delimiter != PKT_DELIM) {
+        // Slide forward one byte until a delimiter is found
+        this->m_head++;
+        this->m_discarded++;
+        continue;
+      }
+
+      if (available < HEADER_SIZE) {
+        return FRAME_NEED_DATA;
+      }
+
+      const U32 size = loadBe32(&start[sizeof(U32)]);
+
+      if (size < DESC_SIZE) {
+        // Not a valid frame; resynchronize past the delimiter
+        this->m_head += sizeof(U32);
+        this->m_discarded += sizeof(U32);
+        continue;
+      }
+
+      if (size > BUFFER_SIZE - HEADER_SIZE) {
+        // Return the descriptor so the caller can choose to stream the rest
+        if (available < HEADER_SIZE + DESC_SIZE) {
+          return FRAME_NEED_DATA;
+        }
+        frame.packet = &start[HEADER_SIZE];
+        frame.size = size;
+        frame.descriptor = loadBe32(frame.packet);
+        this->m_head += HEADER_SIZE + DESC_SIZE;
+        this->m_skip = size - DESC_SIZE;
+        return FRAME_TOO_BIG;
+      }
+
+      if (available < HEADER_SIZE + size) {
+        return FRAME_NEED_DATA;
+      }
+
+      frame.packet = &start[HEADER_SIZE];
+      frame.size = size;
+      frame.descriptor = loadBe32(frame.packet);
+      this->m_head += HEADER_SIZE + size;
+      return FRAME_OK;
+    }
+  }
+
+  void SocketFrameReader ::
+    streamFrame(U8* const dest)
+  {
+    FW_ASSERT(dest != NULL);
+    FW_ASSERT(this->m_skip > 0, this->m_skip);
+    FW_ASSERT(this->m_dest == NULL);
+    this->m_dest = dest;
+  }
+
+  U32 SocketFrameReader ::
+    getDiscardedBytes(void) const
+  {
+    return this->m_discarded;
+  }
+
+}
@@ -0,0 +1,121 @@
+// ======================================================================
+// \title  SocketFrameReader.hpp
+// \brief  Receive buffer and frame parser for the socket ground interface
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_SOCKET_FRAME_READER_HPP
+#define SVC_SOCKET_FRAME_READER_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+
+  //! \class SocketFrameReader
+  //! \brief Buffers uplink bytes and splits them into ground frames
+  //!
+  //! An uplink frame is a big-endian delimiter, a big-endian size and
+  //! size bytes of packet, the first four of which are the packet
+  //! descriptor. The socket task receives as many bytes as are available
+  //! directly into the reader's buffer, then calls nextFrame() until it
+  //! returns FRAME_NEED_DATA. Frames are returned in place, so a frame is
+  //! only valid until the next call to getWriteAddr().
+  //!
+  //! A frame larger than the buffer is returned as FRAME_TOO_BIG once its
+  //! descriptor is buffered. The rest of it is discarded, unless the caller
+  //! passes a destination to streamFrame(). Then the rest of the packet is
+  //! received straight into the destination, and nextFrame() returns
+  //! FRAME_STREAMED when it is complete.
+  //!
+  class SocketFrameReader {
+
+    public:
+
+      enum {
+        BUFFER_SIZE = 4096, //!< Receive buffer size; also the largest frame returned in place
+        HEADER_SIZE = 8, //!< Delimiter plus size
+        DESC_SIZE = 4 //!< Size of the packet descriptor
+      };
+
+      static const U32 PKT_DELIM = 0x5A5A5A5A; //!< Start of an uplink frame
+      static const U32 QUIT_DELIM = 0xA5A5A5A5; //!< Request to stop reading
+
+      typedef enum {
+        FRAME_OK, //!< A complete frame was returned
+        FRAME_NEED_DATA, //!< No complete frame is buffered
+        FRAME_QUIT, //!< The quit delimiter was received
+        FRAME_TOO_BIG, //!< A frame larger than the buffer was found; its descriptor and size are returned
+        FRAME_STREAMED //!< A frame passed to streamFrame() has been received
+      } Status;
+
+      //! A parsed frame
+      struct Frame {
+        U32 descriptor; //!< The packet descriptor
+        const U8* packet; //!< Start of the packet, including the descriptor. Only the descriptor is valid for FRAME_TOO_BIG.
+        U32 size; //!< Size of the packet, including the descriptor
+      };
+
+      SocketFrameReader(void);
+
+      //! Discard any buffered bytes, e.g. after a reconnect
+      //!
+      void reset(void);
+
+      //! Get the address to receive new bytes into. Invalidates any
+      //! previously returned frame.
+      //!
+      U8* getWriteAddr(void);
+
+      //! Get the number of bytes that can be written at getWriteAddr()
+      //!
+      U32 getWriteSpace(void) const;
+
+      //! Mark bytes written at getWriteAddr() as received
+      //!
+      void commit(
+          const U32 size //!< The number of bytes received
+      );
+
+      //! Parse the next frame from the buffered bytes
+      //!
+      //! \return The parse status
+      //!
+      Status nextFrame(
+          Frame& frame //!< The frame, valid when FRAME_OK is returned
+      );
+
+      //! Receive the rest of the frame last returned as FRAME_TOO_BIG
+      //! into a destination instead of discarding it. Must be called
+      //! before the next call to getWriteAddr() or nextFrame().
+      //!
+      void streamFrame(
+          U8* const dest //!< Holds frame size minus DESC_SIZE bytes
+      );
+
+      //! Get the number of bytes discarded while searching for a delimiter
+      //!
+      U32 getDiscardedBytes(void) const;
+
+    PRIVATE:
+
+      //! Whether new bytes go straight to a streamed frame's destination
+      //!
+      bool isDirect(void) const;
+
+      U8 m_buffer[BUFFER_SIZE]; //!< Receive buffer
+      U32 m_head; //!< Offset of the first unparsed byte
+      U32 m_tail; //!< Offset one past the last received byte
+      U32 m_skip; //!< Bytes of an oversize frame still to discard or stream
+      U8* m_dest; //!< Where the rest of a streamed frame goes, or NULL to discard it
+      U32 m_discarded; //!< Bytes dropped while resynchronizing
+
+  };
+
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <poll.h>
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
@@ -54,21 +55,6 @@ namespace Svc {
             }
             return total;
         }
-
-        NATIVE_INT_TYPE socketRead(NATIVE_INT_TYPE fd, U8* buf, U32 size) {
-            NATIVE_INT_TYPE total=0;
-            while(size > 0) {
-                NATIVE_INT_TYPE bytesRead = read(fd, (char*)buf, size);
-                if (bytesRead == -1) {
-                  if (errno == EINTR) continue;
-                  return (total == 0) ? -1 : total;
-                }
-                buf += bytesRead;
-                size -= bytesRead;
-                total += bytesRead;
-            }
-            return total;
-        }
     }
 
     /////////////////////////////////////////////////////////////////////
@@ -92,7 +78,11 @@ namespace Svc {
     ,useDefaultHeader(true)
     ,m_prot(SEND_UDP)
     ,m_portConfigured(false)
+    ,m_stopRequested(false)
+    ,m_taskStarted(false)
     {
+        this->m_wakeupFds[0] = -1;
+        this->m_wakeupFds[1] = -1;
     }
 
     void SocketGndIfImpl::init(NATIVE_INT_TYPE instance) {
@@ -100,6 +90,11 @@ namespace Svc {
     }
     
     SocketGndIfImpl::~SocketGndIfImpl() {
+        for (NATIVE_INT_TYPE i = 0; i < 2; i++) {
+            if (this->m_wakeupFds[i] != -1) {
+                (void) close(this->m_wakeupFds[i]);
+            }
+        }
     }
 
     void SocketGndIfImpl ::
@@ -150,12 +145,48 @@ namespace Svc {
                 log_WARNING_LO_NoConnectionToServer(port_number);
                	openSocket(port_number,prot);
 
+#ifndef TGT_OS_TYPE_VXWORKS
+                // Pipe used by stopSocketTask() to wake the read task
+                if (this->m_wakeupFds[0] == -1 && pipe(this->m_wakeupFds) == -1) {
+                    DEBUG_PRINT("pipe error: %s\n",strerror(errno));
+                    this->m_wakeupFds[0] = -1;
+                    this->m_wakeupFds[1] = -1;
+                }
+#endif
+                this->m_stopRequested = false;
+
                 // Spawn read task:
         	Os::Task::TaskStatus stat = this->socketTask.start(name,0,priority,stackSize,SocketGndIfImpl::socketReadTask, (void*) this, cpuAffinity);
         	FW_ASSERT(Os::Task::TASK_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+                this->m_taskStarted = true;
         }
     }
 
+    void SocketGndIfImpl::stopSocketTask(void) {
+        if (!this->m_taskStarted) {
+            return;
+        }
+        this->m_stopRequested = true;
+#ifdef TGT_OS_TYPE_VXWORKS
+        // No poll() on this target; shutting the socket down ends the blocking read
+        (void) shutdown(this->m_socketFd, SHUT_RDWR);
+#else
+        if (this->m_wakeupFds[1] != -1) {
+            const U8 wake = 0;
+            (void) write(this->m_wakeupFds[1], &wake, sizeof(wake));
+        }
+#endif
+        (void) this->socketTask.join(NULL);
+#ifndef TGT_OS_TYPE_VXWORKS
+        // Drain the wakeup so a restarted task does not exit immediately
+        if (this->m_wakeupFds[0] != -1) {
+            U8 wake;
+            (void) read(this->m_wakeupFds[0], &wake, sizeof(wake));
+        }
+#endif
+        this->m_taskStarted = false;
+    }
+
     void SocketGndIfImpl::openSocket(NATIVE_INT_TYPE port, DownlinkProt prot) {
         // set up port connection
         struct sockaddr_in servaddr; // Internet socket address struct
@@ -260,20 +291,134 @@ namespace Svc {
         this->m_connectionFd = this->m_socketFd;
     }
 
+    bool SocketGndIfImpl::waitForData(void) {
+#ifdef TGT_OS_TYPE_VXWORKS
+        return !this->m_stopRequested;
+#else
+        struct pollfd fds[2];
+        fds[0].fd = this->m_socketFd;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd = this->m_wakeupFds[0];
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+        // A negative descriptor is ignored by poll() if the pipe is unavailable
+        while (!this->m_stopRequested) {
+            const int ready = poll(fds, 2, -1);
+            if (ready == -1) {
+                if (errno == EINTR) continue;
+                DEBUG_PRINT("poll error: %s\n",strerror(errno));
+                // Let the read report the error
+                return true;
+            }
+            if (fds[1].revents != 0) {
+                break;
+            }
+            if (fds[0].revents != 0) {
+                return true;
+            }
+        }
+        return false;
+#endif
+    }
+
+    bool SocketGndIfImpl::dispatchFrames(void) {
+        SocketFrameReader::Frame frame;
+
+        while (true) {
+            const SocketFrameReader::Status status = this->m_reader.nextFrame(frame);
+
+            switch (status) {
+                case SocketFrameReader::FRAME_NEED_DATA:
+                    return false;
+
+                case SocketFrameReader::FRAME_QUIT:
+                    DEBUG_PRINT("Received quit delimiter\n");
+                    return true;
+
+                case SocketFrameReader::FRAME_TOO_BIG:
+                    // File packets are received straight into the uplink buffer
+                    if (frame.descriptor == Fw::ComPacket::FW_PACKET_FILE) {
+                        const U32 dataSize = frame.size - SocketFrameReader::DESC_SIZE;
+                        this->m_streamBuffer = this->fileUplinkBufferGet_out(0, dataSize);
+                        U8* data_ptr = (U8*)this->m_streamBuffer.getdata();
+                        if (data_ptr == NULL || this->m_streamBuffer.getsize() < dataSize) {
+                            this->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, this->port_number);
+                            continue;
+                        }
+                        this->m_reader.streamFrame(data_ptr);
+                        continue;
+                    }
+                    this->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketTooBig, this->port_number);
+                    continue;
+
+                case SocketFrameReader::FRAME_STREAMED:
+                    if (this->isConnected_fileUplinkBufferSendOut_OutputPort(0)) {
+                        this->fileUplinkBufferSendOut_out(0, this->m_streamBuffer);
+                    }
+                    continue;
+
+                case SocketFrameReader::FRAME_OK:
+                    break;
+
+                default:
+                    FW_ASSERT(0, status);
+            }
+
+            switch (frame.descriptor) {
+                case Fw::ComPacket::FW_PACKET_COMMAND:
+                    // check size of command
+                    if (frame.size > FW_COM_BUFFER_MAX_SIZE) {
+                        this->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketTooBig, this->port_number);
+                        DEBUG_PRINT("Packet to large! :%d\n",frame.size);
+                        break;
+                    }
+
+                    // The descriptor and payload are already contiguous in the receive buffer
+                    if (this->isConnected_uplinkPort_OutputPort(0)) {
+                        Fw::ComBuffer cmdBuffer(frame.packet, frame.size);
+                        this->uplinkPort_out(0,cmdBuffer,0);
+                    }
+                    break;
+
+                case Fw::ComPacket::FW_PACKET_FILE:
+                {
+                    const U32 dataSize = frame.size - SocketFrameReader::DESC_SIZE;
+                    Fw::Buffer packet_buffer = this->fileUplinkBufferGet_out(0, dataSize);
+                    U8* data_ptr = (U8*)packet_buffer.getdata();
+                    if (data_ptr == NULL || packet_buffer.getsize() < dataSize) {
+                        this->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, this->port_number);
+                        break;
+                    }
+                    (void) memcpy(data_ptr, &frame.packet[SocketFrameReader::DESC_SIZE], dataSize);
+
+                    if (this->isConnected_fileUplinkBufferSendOut_OutputPort(0)) {
+                        this->fileUplinkBufferSendOut_out(0, packet_buffer);
+                    }
+                }
+                    break;
+
+                default:
+                    // Drop frames with an unknown descriptor and read on
+                    this->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, this->port_number);
+                    DEBUG_PRINT("Unknown packet descriptor: %d\n",frame.descriptor);
+                    break;
+            }
+        }
+    }
+
     void SocketGndIfImpl::socketReadTask(void* ptr) {
         FW_ASSERT(ptr);
         bool acceptConnections;
-        uint32_t packetDelimiter;
-        // Gotta love VxWorks...
-        uint32_t packetSize;
-        uint32_t packetDesc;
-        U8 buf[FW_COM_BUFFER_MAX_SIZE];
-        ssize_t bytesRead;
+        ssize_t bytesRead = -1;
 
         // cast pointer to component type
         SocketGndIfImpl* comp = (SocketGndIfImpl*) ptr;
 
         while (comp->m_socketFd == -1){
+            if (comp->m_stopRequested) {
+                return;
+            }
         	comp->openSocket(comp->port_number);
         	(void)Os::Task::delay(1000);
         }
@@ -282,158 +427,56 @@ namespace Svc {
 
         // loop until magic "kill" packet
         while (acceptConnections) {
-//            struct sockaddr them;
-//#ifdef __VXWORKS__ // Gotta love VxWorks...
-//            int theirSize
-//#else
-//            socklen_t theirSize
-//#endif
-//            = sizeof(them);
+
+            comp->m_reader.reset();
 
             // read packets
             while (true) {
-                // first, read packet delimiter
-                bytesRead = socketRead(comp->m_socketFd,(U8*)&packetDelimiter,sizeof(packetDelimiter));
-                if( -1 == bytesRead ) {
-                    DEBUG_PRINT("Delim read error: %s",strerror(errno));
+                if (!comp->waitForData()) {
+                    // stop requested
+                    bytesRead = -1;
                     break;
                 }
 
-                if(0 == bytesRead) {
-                	comp->m_connectionFd = -1;
-                	break;
-                }
-
-                if (bytesRead != sizeof(packetDelimiter)) {
-                    DEBUG_PRINT("Didn't get right pd size: %ld\n",(long int)bytesRead);
-                }
-                // correct for network order
-                packetDelimiter = ntohl(packetDelimiter);
-
-                // if magic number to quit, exit loop
-                if (packetDelimiter == 0xA5A5A5A5) {
-                    DEBUG_PRINT("packetDelimiter = 0x%x\n", packetDelimiter);
-                    break;
-                } else if (packetDelimiter != SocketGndIfImpl::PKT_DELIM) {
-                    DEBUG_PRINT("Unexpected delimiter 0x%08X\n",packetDelimiter);
-                    // just keep reading until a delimiter is found
-                    continue;
-                }
-
-                // now read packet size
-                bytesRead = socketRead(comp->m_connectionFd,(U8*)&packetSize,sizeof(packetSize));
-                if( -1 == bytesRead ) {
-                    DEBUG_PRINT("Size read error: %s",strerror(errno));
+                // Receive everything the socket has that fits in the buffer
+                U8* const writeAddr = comp->m_reader.getWriteAddr();
+                bytesRead = recv(comp->m_socketFd, (char*)writeAddr, comp->m_reader.getWriteSpace(), 0);
+                if (-1 == bytesRead) {
+                    if (errno == EINTR) continue;
+                    comp->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, comp->port_number);
+                    DEBUG_PRINT("Read error: %s",strerror(errno));
                     break;
                 }
 
-                if(0 == bytesRead) {
+                if (0 == bytesRead) {
                 	comp->m_connectionFd = -1;
                 	break;
                 }
 
-                if (bytesRead != sizeof(packetSize)) {
-                    DEBUG_PRINT("Didn't get right ps size!\n");
-                }
-
-                // correct for network order
-                packetSize = ntohl(packetSize);
-
+                comp->m_reader.commit(bytesRead);
 
-                // get packet description
-                bytesRead = socketRead(comp->m_socketFd,(U8*)&packetDesc,sizeof(packetDesc));
-                packetDesc = ntohl(packetDesc);
-
-
-                switch(packetDesc) {
-                    case Fw::ComPacket::FW_PACKET_COMMAND:
-                        
-                        // check size of command
-                        if (packetSize > FW_COM_BUFFER_MAX_SIZE) {
-			  comp->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketTooBig, comp->port_number);
-                            DEBUG_PRINT("Packet to large! :%d\n",packetSize);
-                            // might as well wait for the next packet
-                            break;
-                        }
-
-                        // read cmd packet minus description
-                        bytesRead = socketRead(comp->m_socketFd,(U8*)buf+sizeof(packetDesc),packetSize-sizeof(packetDesc));
-                        if (-1 == bytesRead) {
-			  comp->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, comp->port_number);
-                            DEBUG_PRINT("Size read error: %s\n",strerror(errno));
-                            break;
-                        }
-
-                        if(0 == bytesRead) {
-                            comp->m_connectionFd = -1;
-                            break;
-                        }
-
-                        // Add back description
-                        bytesRead = bytesRead + sizeof(packetDesc);
-
-                        buf[3] = packetDesc & 0xff;
-                        buf[2] = (packetDesc & 0xff00) >> 8;
-                        buf[1] = (packetDesc & 0xff0000) >> 16;
-                        buf[0] = (packetDesc & 0xff000000) >> 24;
-
-                        // check read size
-                        if (bytesRead != (ssize_t)packetSize) {
-			  comp->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_ReadSizeMismatch, comp->port_number);
-                            DEBUG_PRINT("Read size mismatch: A: %ld E: %d\n",(long int)bytesRead,packetSize);
-                        }
-
-
-                        if (comp->isConnected_uplinkPort_OutputPort(0)) {
-                             Fw::ComBuffer cmdBuffer(buf, bytesRead);
-                             comp->uplinkPort_out(0,cmdBuffer,0);
-                        }
-                        break;
-
-                    case Fw::ComPacket::FW_PACKET_FILE:
-                    {   
-                        
-                        // Get Buffer
-                        Fw::Buffer packet_buffer = comp->fileUplinkBufferGet_out(0, packetSize - sizeof(packetDesc));
-                        U8* data_ptr = (U8*)packet_buffer.getdata();
-
-
-                        // Read file packet minus description
-                        bytesRead = socketRead(comp->m_socketFd, data_ptr, packetSize - sizeof(packetDesc));
-                        if (-1 == bytesRead) {
-			  comp->log_WARNING_HI_GNDIF_ReceiveError(GNDIF_PacketReadError, comp->port_number);
-                            DEBUG_PRINT("Size read error: %s\n",strerror(errno));
-                            break;
-                        }
-
-                        // for(uint32_t i =0; i < bytesRead; i++){
-                        //     DEBUG_PRINT("IN_DATA:%02x\n", data_ptr[i]);
-                        // }
-
-                        if (comp->isConnected_fileUplinkBufferSendOut_OutputPort(0)) {
-                            comp->fileUplinkBufferSendOut_out(0, packet_buffer);
-                        }
-
-                    }
-                        break;
-                    default:
-                        FW_ASSERT(0);
+                // Dispatch every complete frame before reading again
+                if (comp->dispatchFrames()) {
+                    bytesRead = -1;
+                    break;
                 }
 
-                
-
             } // while not done with packets
             close(comp->m_socketFd);
+            comp->m_socketFd = -1;
             comp->m_connectionFd = -1;
 
             //try to re-establish connection with server
-            if (bytesRead == 0) {
+            if (bytesRead == 0 && !comp->m_stopRequested) {
                 comp->log_WARNING_LO_LostConnectionToServer(comp->port_number);
-                while (comp->m_connectionFd == -1){
+                while (comp->m_connectionFd == -1 && !comp->m_stopRequested){
                     Os::Task::delay(5000);
                     DEBUG_PRINT("Reopen socket\n");
                     comp->openSocket(comp->port_number);
                 }
+                if (comp->m_stopRequested) {
+                    break;
+                }
             }
             else {
             	break;
@@ -449,7 +492,7 @@ namespace Svc {
     ) {
 
         char buf[256];
-        U32 header_size = this->useDefaultHeader ? 9 : sizeof(SocketGndIfImpl::PKT_DELIM);
+        U32 header_size = this->useDefaultHeader ? 9 : sizeof(SocketFrameReader::PKT_DELIM);
         U32 desc        = 3; // File Desc
         U32 packet_size = 0;
         U32 buffer_size = fwBuffer.getsize();
@@ -460,7 +503,7 @@ namespace Svc {
             strncpy(buf, "A5A5 GUI ", sizeof(buf));
         }
         else {
-            U32 data = SocketGndIfImpl::PKT_DELIM;
+            U32 data = SocketFrameReader::PKT_DELIM;
             memcpy(buf, (U8*)&data, header_size);
         }
         packet_size += header_size;
@@ -494,7 +537,7 @@ namespace Svc {
         I32 bytes_sent;
 
         //this is the size of "A5A5 GUI "
-        header_size = this->useDefaultHeader ? 9 : sizeof(SocketGndIfImpl::PKT_DELIM);
+        header_size = this->useDefaultHeader ? 9 : sizeof(SocketFrameReader::PKT_DELIM);
         data_size = data.getBuffLength();
         data_net_size = htonl(data.getBuffLength());
         // check to see if someone is connected
@@ -504,7 +547,7 @@ namespace Svc {
                 strncpy(buf, "A5A5 GUI ", sizeof(buf));
             }
             else {
-                U32 data = SocketGndIfImpl::PKT_DELIM;
+                U32 data = SocketFrameReader::PKT_DELIM;
                 memcpy(buf, (U8*)&data, header_size);
             }
             memmove(buf + header_size, &data_net_size, sizeof(data_net_size));
@@ -3,6 +3,7 @@
 
 #include <Svc/GndIf/GndIfComponentAc.hpp>
 #include <Os/Task.hpp>
+#include <Svc/SocketGndIf/SocketFrameReader.hpp>
 #include <sys/socket.h>
 #include <arpa/inet.h>
 
@@ -28,12 +29,13 @@ namespace Svc {
 
             void startSocketTask(NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize, U32 port_number, char* hostname,  DownlinkProt prot = SEND_UDP, NATIVE_INT_TYPE cpuAffinity = -1);
             void setUseDefaultHeader(bool useDefault);
+
+            //! Stop the socket read task and wait for it to exit
+            void stopSocketTask(void);
         private:
 
             void openSocket(NATIVE_INT_TYPE port, DownlinkProt prot = SEND_UDP);
 
-            static const U32 PKT_DELIM = 0x5A5A5A5A;
-
             //! Handler for input port fileDownlinkBufferSendIn
             //
             void fileDownlinkBufferSendIn_handler(
@@ -49,6 +51,15 @@ namespace Svc {
             );
 
             static void socketReadTask(void* ptr);
+
+            //! Wait until the socket is readable or a stop is requested
+            //! \return true if the socket is readable
+            bool waitForData(void);
+
+            //! Dispatch every complete frame held by the reader
+            //! \return true if the quit delimiter was received
+            bool dispatchFrames(void);
+
             void downlinkPort_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context);
             Svc::ConnectionStatus isConnected_handler(NATIVE_INT_TYPE portNum);
 
@@ -68,6 +79,12 @@ namespace Svc {
             DownlinkProt m_prot; // is downlink TCP or UDP
 
             bool m_portConfigured;
+
+            SocketFrameReader m_reader; // !< uplink receive buffer
+            Fw::Buffer m_streamBuffer; // !< file buffer receiving a frame larger than m_reader
+            NATIVE_INT_TYPE m_wakeupFds[2]; // !< pipe used to wake the read task for shutdown
+            volatile bool m_stopRequested; // !< set by stopSocketTask()
+            bool m_taskStarted; // !< the read task has been spawned
     };
 
 }
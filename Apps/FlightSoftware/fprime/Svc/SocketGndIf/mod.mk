@@ -15,12 +15,13 @@
 
 SRC =
 
-HDR =				SvcSocketGndIfImpl.hpp
+HDR =				SvcSocketGndIfImpl.hpp \
+					SocketFrameReader.hpp
 
-SRC_LINUX = 		SvcSocketGndIfImpl.cpp
+SRC_LINUX = 		SvcSocketGndIfImpl.cpp SocketFrameReader.cpp
 
-SRC_CYGWIN =		SvcSocketGndIfImpl.cpp
+SRC_CYGWIN =		SvcSocketGndIfImpl.cpp SocketFrameReader.cpp
 
-SRC_DARWIN =        SvcSocketGndIfImpl.cpp
+SRC_DARWIN =        SvcSocketGndIfImpl.cpp SocketFrameReader.cpp
 
-SRC_RASPIAN = 		SvcSocketGndIfImpl.cpp
+SRC_RASPIAN = 		SvcSocketGndIfImpl.cpp SocketFrameReader.cpp
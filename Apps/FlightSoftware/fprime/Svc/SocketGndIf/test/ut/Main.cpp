@@ -0,0 +1,35 @@
+// ----------------------------------------------------------------------
+// Main.cpp
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Nominal, FrameParsing) {
+  Svc::Tester tester;
+  tester.frameParsing();
+}
+
+TEST(Nominal, LoopbackUplink) {
+  Svc::Tester tester;
+  tester.loopbackUplink();
+}
+
+TEST(Nominal, LargeFileUplink) {
+  Svc::Tester tester;
+  tester.largeFileUplink();
+}
+
+TEST(Nominal, StopWhileIdle) {
+  Svc::Tester tester;
+  tester.stopWhileIdle();
+}
+
+TEST(Performance, LoopbackBenchmark) {
+  Svc::Tester tester;
+  tester.loopbackBenchmark();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
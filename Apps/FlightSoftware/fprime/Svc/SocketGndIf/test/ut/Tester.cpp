@@ -0,0 +1,590 @@
+// ======================================================================
+// \title  SocketGndIf/test/ut/Tester.cpp
+// \brief  cpp file for SocketGndIf test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Tester.hpp"
+#include <Fw/Com/ComPacket.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Os/Task.hpp>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+#define TASK_PRIORITY 1
+#define TASK_STACK_SIZE (64 * 1024)
+#define WAIT_TIMEOUT_MS 10000
+#define CMD_PAYLOAD_SIZE 16
+#define BENCH_COMMANDS 100000
+#define LATENCY_FRAMES 1000
+#define LARGE_FILE_SIZE 10000
+
+namespace Svc {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  Tester ::
+    Tester(void) :
+#if FW_OBJECT_NAMES == 1
+      GndIfGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("GndIf"),
+#else
+      GndIfGTestBase(MAX_HISTORY_SIZE),
+      component(),
+#endif
+      listenFd(-1),
+      groundFd(-1),
+      groundPort(0),
+      commandCount(0),
+      fileSize(0),
+      fileCount(0)
+  {
+    (void) strncpy(this->hostname, "127.0.0.1", sizeof(this->hostname));
+    this->initComponents();
+    this->connectPorts();
+  }
+
+  Tester ::
+    ~Tester(void)
+  {
+    this->disconnectComponent();
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    frameParsing(void)
+  {
+    SocketFrameReader reader;
+    SocketFrameReader::Frame frame;
+    U8 stream[SocketFrameReader::BUFFER_SIZE];
+    U8 payload[CMD_PAYLOAD_SIZE];
+    U32 streamSize = 0;
+
+    for (U32 i = 0; i < sizeof(payload); i++) {
+      payload[i] = static_cast<U8>(i);
+    }
+
+    // Three commands with garbage before and between them
+    const U8 garbage[] = { 0x5A, 0x5A, 0x01, 0xA5 };
+    for (U32 i = 0; i < 3; i++) {
+      (void) memcpy(&stream[streamSize], garbage, sizeof(garbage));
+      streamSize += sizeof(garbage);
+      payload[0] = static_cast<U8>(i);
+      streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_COMMAND, payload, sizeof(payload));
+    }
+
+    // Feed one byte at a time so every frame is split across reads
+    U32 frames = 0;
+    for (U32 i = 0; i < streamSize; i++) {
+      ASSERT_GT(reader.getWriteSpace(), 0U);
+      *reader.getWriteAddr() = stream[i];
+      reader.commit(1);
+      while (reader.nextFrame(frame) == SocketFrameReader::FRAME_OK) {
+        ASSERT_EQ(static_cast<U32>(Fw::ComPacket::FW_PACKET_COMMAND), frame.descriptor);
+        ASSERT_EQ(static_cast<U32>(SocketFrameReader::DESC_SIZE + CMD_PAYLOAD_SIZE), frame.size);
+        ASSERT_EQ(frames, frame.packet[SocketFrameReader::DESC_SIZE]);
+        frames++;
+      }
+    }
+    ASSERT_EQ(3U, frames);
+    ASSERT_EQ(3 * sizeof(garbage), reader.getDiscardedBytes());
+
+    // A frame larger than the buffer is skipped, and the next frame still parses
+    reader.reset();
+    U8* write = reader.getWriteAddr();
+    const U32 bigSize = SocketFrameReader::BUFFER_SIZE;
+    U8 header[SocketFrameReader::HEADER_SIZE + SocketFrameReader::DESC_SIZE] = {
+      0x5A, 0x5A, 0x5A, 0x5A,
+      static_cast<U8>(bigSize >> 24), static_cast<U8>(bigSize >> 16),
+      static_cast<U8>(bigSize >> 8), static_cast<U8>(bigSize),
+      0x00, 0x00, 0x00, static_cast<U8>(Fw::ComPacket::FW_PACKET_COMMAND)
+    };
+    (void) memcpy(write, header, SocketFrameReader::HEADER_SIZE);
+    reader.commit(SocketFrameReader::HEADER_SIZE);
+    ASSERT_EQ(SocketFrameReader::FRAME_NEED_DATA, reader.nextFrame(frame));
+    write = reader.getWriteAddr();
+    (void) memcpy(write, &header[SocketFrameReader::HEADER_SIZE], SocketFrameReader::DESC_SIZE);
+    reader.commit(SocketFrameReader::DESC_SIZE);
+    ASSERT_EQ(SocketFrameReader::FRAME_TOO_BIG, reader.nextFrame(frame));
+    ASSERT_EQ(static_cast<U32>(Fw::ComPacket::FW_PACKET_COMMAND), frame.descriptor);
+    ASSERT_EQ(bigSize, frame.size);
+    U32 skipped = SocketFrameReader::DESC_SIZE;
+    while (skipped < bigSize) {
+      write = reader.getWriteAddr();
+      U32 chunk = reader.getWriteSpace();
+      if (chunk > bigSize - skipped) {
+        chunk = bigSize - skipped;
+      }
+      (void) memset(write, 0x5A, chunk);
+      reader.commit(chunk);
+      skipped += chunk;
+      ASSERT_EQ(SocketFrameReader::FRAME_NEED_DATA, reader.nextFrame(frame));
+    }
+    write = reader.getWriteAddr();
+    reader.commit(buildFrame(write, Fw::ComPacket::FW_PACKET_FILE, payload, sizeof(payload)));
+    ASSERT_EQ(SocketFrameReader::FRAME_OK, reader.nextFrame(frame));
+    ASSERT_EQ(static_cast<U32>(Fw::ComPacket::FW_PACKET_FILE), frame.descriptor);
+
+    // A streamed frame: the buffered part is copied, the rest is received in place
+    static U8 bigPayload[LARGE_FILE_SIZE];
+    static U8 bigFrame[SocketFrameReader::HEADER_SIZE + SocketFrameReader::DESC_SIZE + LARGE_FILE_SIZE];
+    for (U32 i = 0; i < sizeof(bigPayload); i++) {
+      bigPayload[i] = static_cast<U8>(i * 7);
+    }
+    const U32 bigFrameSize = buildFrame(bigFrame, Fw::ComPacket::FW_PACKET_FILE, bigPayload, sizeof(bigPayload));
+    const U32 firstChunk = SocketFrameReader::HEADER_SIZE + SocketFrameReader::DESC_SIZE + 100;
+    write = reader.getWriteAddr();
+    (void) memcpy(write, bigFrame, firstChunk);
+    reader.commit(firstChunk);
+    ASSERT_EQ(SocketFrameReader::FRAME_TOO_BIG, reader.nextFrame(frame));
+    ASSERT_EQ(static_cast<U32>(Fw::ComPacket::FW_PACKET_FILE), frame.descriptor);
+    ASSERT_EQ(SocketFrameReader::DESC_SIZE + LARGE_FILE_SIZE, frame.size);
+    (void) memset(this->fileData, 0, sizeof(this->fileData));
+    reader.streamFrame(this->fileData);
+    ASSERT_EQ(SocketFrameReader::FRAME_NEED_DATA, reader.nextFrame(frame));
+    U32 streamed = firstChunk;
+    while (streamed < bigFrameSize) {
+      write = reader.getWriteAddr();
+      ASSERT_EQ(&this->fileData[streamed - SocketFrameReader::HEADER_SIZE - SocketFrameReader::DESC_SIZE], write);
+      ASSERT_EQ(bigFrameSize - streamed, reader.getWriteSpace());
+      const U32 chunk = (bigFrameSize - streamed < 3000) ? bigFrameSize - streamed : 3000;
+      (void) memcpy(write, &bigFrame[streamed], chunk);
+      reader.commit(chunk);
+      streamed += chunk;
+    }
+    ASSERT_EQ(SocketFrameReader::FRAME_STREAMED, reader.nextFrame(frame));
+    ASSERT_EQ(0, memcmp(this->fileData, bigPayload, sizeof(bigPayload)));
+    ASSERT_EQ(SocketFrameReader::FRAME_NEED_DATA, reader.nextFrame(frame));
+
+    // A size too small to hold a descriptor is dropped, then the quit delimiter is seen
+    const U8 tail[] = {
+      0x5A, 0x5A, 0x5A, 0x5A, 0x00, 0x00, 0x00, 0x02,
+      0xA5, 0xA5, 0xA5, 0xA5
+    };
+    write = reader.getWriteAddr();
+    (void) memcpy(write, tail, sizeof(tail));
+    reader.commit(sizeof(tail));
+    ASSERT_EQ(SocketFrameReader::FRAME_QUIT, reader.nextFrame(frame));
+    ASSERT_EQ(SocketFrameReader::FRAME_NEED_DATA, reader.nextFrame(frame));
+  }
+
+  void Tester ::
+    loopbackUplink(void)
+  {
+    U8 stream[SocketFrameReader::BUFFER_SIZE];
+    U8 payload[FW_COM_BUFFER_MAX_SIZE];
+    U32 streamSize = 0;
+
+    this->connectComponent();
+
+    for (U32 i = 0; i < sizeof(payload); i++) {
+      payload[i] = static_cast<U8>(i * 3);
+    }
+
+    // A command too big for a ComBuffer, a file packet, a frame with an unknown
+    // descriptor and a command in one write
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_COMMAND, payload, sizeof(payload));
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_FILE, payload, 100);
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_UNKNOWN, payload, 8);
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_COMMAND, payload, CMD_PAYLOAD_SIZE);
+    this->sendBytes(stream, streamSize);
+
+    ASSERT_TRUE(this->waitForCommands(1));
+    ASSERT_EQ(1U, this->fileCount);
+    ASSERT_EQ(100U, this->fileSize);
+    ASSERT_EQ(0, memcmp(this->fileData, payload, 100));
+
+    // The command arrives with its descriptor intact
+    ASSERT_EQ(static_cast<NATIVE_UINT_TYPE>(SocketFrameReader::DESC_SIZE + CMD_PAYLOAD_SIZE), this->lastCommand.getBuffLength());
+    const U8* const cmd = this->lastCommand.getBuffAddr();
+    ASSERT_EQ(0, cmd[0]);
+    ASSERT_EQ(0, cmd[1]);
+    ASSERT_EQ(0, cmd[2]);
+    ASSERT_EQ(Fw::ComPacket::FW_PACKET_COMMAND, cmd[3]);
+    ASSERT_EQ(0, memcmp(&cmd[SocketFrameReader::DESC_SIZE], payload, CMD_PAYLOAD_SIZE));
+
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_GNDIF_ReceiveError_SIZE(2);
+    ASSERT_EVENTS_GNDIF_ReceiveError(0, GndIfComponentBase::GNDIF_PacketTooBig, this->groundPort);
+    ASSERT_EVENTS_GNDIF_ReceiveError(1, GndIfComponentBase::GNDIF_PacketReadError, this->groundPort);
+
+    // A frame split across two writes
+    streamSize = buildFrame(stream, Fw::ComPacket::FW_PACKET_COMMAND, payload, CMD_PAYLOAD_SIZE);
+    this->sendBytes(stream, 5);
+    Os::Task::delay(10);
+    ASSERT_EQ(1U, this->getCommandCount());
+    this->sendBytes(&stream[5], streamSize - 5);
+    ASSERT_TRUE(this->waitForCommands(2));
+
+    this->disconnectComponent();
+  }
+
+  void Tester ::
+    largeFileUplink(void)
+  {
+    static U8 payload[LARGE_FILE_SIZE];
+    static U8 stream[2 * (SocketFrameReader::HEADER_SIZE + SocketFrameReader::DESC_SIZE + LARGE_FILE_SIZE)];
+    U32 streamSize = 0;
+
+    this->connectComponent();
+
+    for (U32 i = 0; i < sizeof(payload); i++) {
+      payload[i] = static_cast<U8>(i * 5);
+    }
+
+    // A file packet larger than the receive buffer, a command larger
+    // than the receive buffer and a command in one write
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_FILE, payload, sizeof(payload));
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_COMMAND, payload, sizeof(payload));
+    streamSize += buildFrame(&stream[streamSize], Fw::ComPacket::FW_PACKET_COMMAND, payload, CMD_PAYLOAD_SIZE);
+    this->sendBytes(stream, streamSize);
+
+    ASSERT_TRUE(this->waitForCommands(1));
+    ASSERT_EQ(1U, this->fileCount);
+    ASSERT_EQ(static_cast<U32>(LARGE_FILE_SIZE), this->fileSize);
+    ASSERT_EQ(0, memcmp(this->fileData, payload, sizeof(payload)));
+    ASSERT_EQ(0, memcmp(&this->lastCommand.getBuffAddr()[SocketFrameReader::DESC_SIZE], payload, CMD_PAYLOAD_SIZE));
+
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_GNDIF_ReceiveError(0, GndIfComponentBase::GNDIF_PacketTooBig, this->groundPort);
+
+    this->disconnectComponent();
+  }
+
+  void Tester ::
+    stopWhileIdle(void)
+  {
+    this->connectComponent();
+
+    // The read task is blocked in poll(); stopping must not wait on the ground
+    Os::IntervalTimer timer;
+    timer.start();
+    this->component.stopSocketTask();
+    timer.stop();
+    ASSERT_LT(timer.getDiffUsec(), 1000000U);
+
+    this->disconnectComponent();
+  }
+
+  void Tester ::
+    loopbackBenchmark(void)
+  {
+    U8 payload[CMD_PAYLOAD_SIZE];
+    U8 frame[SocketFrameReader::HEADER_SIZE + SocketFrameReader::DESC_SIZE + CMD_PAYLOAD_SIZE];
+    (void) memset(payload, 0x11, sizeof(payload));
+    const U32 frameSize = buildFrame(frame, Fw::ComPacket::FW_PACKET_COMMAND, payload, sizeof(payload));
+
+    this->connectComponent();
+
+    // Per-frame latency: one frame in flight at a time
+    Os::IntervalTimer timer;
+    U32 minUsec = 0xFFFFFFFF;
+    U32 maxUsec = 0;
+    U64 totalUsec = 0;
+    for (U32 i = 0; i < LATENCY_FRAMES; i++) {
+      const U32 expected = this->getCommandCount() + 1;
+      timer.start();
+      this->sendBytes(frame, frameSize);
+      ASSERT_TRUE(this->waitForCommands(expected));
+      timer.stop();
+      const U32 usec = timer.getDiffUsec();
+      minUsec = (usec < minUsec) ? usec : minUsec;
+      maxUsec = (usec > maxUsec) ? usec : maxUsec;
+      totalUsec += usec;
+    }
+    printf("Uplink latency over %u frames: min %u us, avg %.1f us, max %u us\n",
+        LATENCY_FRAMES, minUsec, static_cast<F64>(totalUsec) / LATENCY_FRAMES, maxUsec);
+
+    // Throughput: stream back-to-back frames as a ground system would
+    enum { BATCH_FRAMES = 256 };
+    static U8 batch[BATCH_FRAMES * sizeof(frame)];
+    for (U32 i = 0; i < BATCH_FRAMES; i++) {
+      (void) memcpy(&batch[i * frameSize], frame, frameSize);
+    }
+    const U32 start = this->getCommandCount();
+    timer.start();
+    for (U32 sent = 0; sent < BENCH_COMMANDS; sent += BATCH_FRAMES) {
+      const U32 frames = (BENCH_COMMANDS - sent < BATCH_FRAMES) ? BENCH_COMMANDS - sent : BATCH_FRAMES;
+      this->sendBytes(batch, frames * frameSize);
+    }
+    ASSERT_TRUE(this->waitForCommands(start + BENCH_COMMANDS));
+    timer.stop();
+    U32 usec = timer.getDiffUsec();
+    if (usec == 0) {
+      usec = 1;
+    }
+    printf("Uplink throughput: %u commands in %u us, %.0f commands/s\n",
+        BENCH_COMMANDS, usec, (static_cast<F64>(BENCH_COMMANDS) * 1000000.0) / usec);
+
+    this->disconnectComponent();
+  }
+
+  // ----------------------------------------------------------------------
+  // Handlers for typed from ports
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    from_fileUplinkBufferSendOut_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->fileSize = fwBuffer.getsize();
+    __sync_fetch_and_add(&this->fileCount, 1);
+  }
+
+  void Tester ::
+    from_uplinkPort_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    // Called on the read task; the port history is not thread safe
+    this->lastCommand = data;
+    __sync_fetch_and_add(&this->commandCount, 1);
+  }
+
+  void Tester ::
+    from_fileDownlinkBufferSendOut_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->pushFromPortEntry_fileDownlinkBufferSendOut(fwBuffer);
+  }
+
+  Fw::Buffer Tester ::
+    from_fileUplinkBufferGet_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 size
+    )
+  {
+    FW_ASSERT(size <= sizeof(this->fileData), size);
+    Fw::Buffer buffer(0, 0, reinterpret_cast<U64>(this->fileData), size);
+    return buffer;
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    connectPorts(void)
+  {
+
+    // downlinkPort
+    this->connect_to_downlinkPort(
+        0,
+        this->component.get_downlinkPort_InputPort(0)
+    );
+
+    // isConnected
+    this->connect_to_isConnected(
+        0,
+        this->component.get_isConnected_InputPort(0)
+    );
+
+    // fileDownlinkBufferSendIn
+    this->connect_to_fileDownlinkBufferSendIn(
+        0,
+        this->component.get_fileDownlinkBufferSendIn_InputPort(0)
+    );
+
+    // fileUplinkBufferSendOut
+    this->component.set_fileUplinkBufferSendOut_OutputPort(
+        0,
+        this->get_from_fileUplinkBufferSendOut(0)
+    );
+
+    // Log
+    this->component.set_Log_OutputPort(
+        0,
+        this->get_from_Log(0)
+    );
+
+    // LogText
+    this->component.set_LogText_OutputPort(
+        0,
+        this->get_from_LogText(0)
+    );
+
+    // Time
+    this->component.set_Time_OutputPort(
+        0,
+        this->get_from_Time(0)
+    );
+
+    // uplinkPort
+    this->component.set_uplinkPort_OutputPort(
+        0,
+        this->get_from_uplinkPort(0)
+    );
+
+    // fileDownlinkBufferSendOut
+    this->component.set_fileDownlinkBufferSendOut_OutputPort(
+        0,
+        this->get_from_fileDownlinkBufferSendOut(0)
+    );
+
+    // fileUplinkBufferGet
+    this->component.set_fileUplinkBufferGet_OutputPort(
+        0,
+        this->get_from_fileUplinkBufferGet(0)
+    );
+
+  }
+
+  void Tester ::
+    initComponents(void)
+  {
+    this->init();
+    this->component.init(
+        INSTANCE
+    );
+  }
+
+  void Tester ::
+    openGround(void)
+  {
+    struct sockaddr_in addr;
+    socklen_t addrSize = sizeof(addr);
+
+    this->listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_NE(-1, this->listenFd);
+
+    (void) memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = 0;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(0, bind(this->listenFd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)));
+    ASSERT_EQ(0, listen(this->listenFd, 1));
+
+    // Use whichever port the OS assigned
+    ASSERT_EQ(0, getsockname(this->listenFd, reinterpret_cast<struct sockaddr*>(&addr), &addrSize));
+    this->groundPort = ntohs(addr.sin_port);
+  }
+
+  void Tester ::
+    connectComponent(void)
+  {
+    char registration[14];
+    U32 received = 0;
+
+    this->openGround();
+    this->component.startSocketTask(
+        TASK_PRIORITY,
+        TASK_STACK_SIZE,
+        this->groundPort,
+        this->hostname,
+        SocketGndIfImpl::SEND_TCP
+    );
+
+    this->groundFd = accept(this->listenFd, NULL, NULL);
+    ASSERT_NE(-1, this->groundFd);
+    const int noDelay = 1;
+    (void) setsockopt(this->groundFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    // The component registers itself before uplink starts
+    while (received < 13) {
+      const ssize_t bytes = read(this->groundFd, &registration[received], 13 - received);
+      ASSERT_GT(bytes, 0);
+      received += bytes;
+    }
+    registration[13] = 0;
+    ASSERT_STREQ("Register FSW\n", registration);
+
+    this->clearHistory();
+  }
+
+  void Tester ::
+    disconnectComponent(void)
+  {
+    this->component.stopSocketTask();
+    if (this->groundFd != -1) {
+      (void) close(this->groundFd);
+      this->groundFd = -1;
+    }
+    if (this->listenFd != -1) {
+      (void) close(this->listenFd);
+      this->listenFd = -1;
+    }
+  }
+
+  void Tester ::
+    sendBytes(const U8* data, U32 size)
+  {
+    while (size > 0) {
+      const ssize_t bytes = write(this->groundFd, data, size);
+      if (bytes == -1 && errno == EINTR) {
+        continue;
+      }
+      ASSERT_GT(bytes, 0);
+      data += bytes;
+      size -= bytes;
+    }
+  }
+
+  U32 Tester ::
+    buildFrame(
+        U8* const frame,
+        const U32 descriptor,
+        const U8* const payload,
+        const U32 payloadSize
+    )
+  {
+    const U32 words[3] = {
+      htonl(SocketFrameReader::PKT_DELIM),
+      htonl(SocketFrameReader::DESC_SIZE + payloadSize),
+      htonl(descriptor)
+    };
+    (void) memcpy(frame, words, sizeof(words));
+    (void) memcpy(&frame[sizeof(words)], payload, payloadSize);
+    return sizeof(words) + payloadSize;
+  }
+
+  bool Tester ::
+    waitForCommands(const U32 count)
+  {
+    // Spin briefly for latency, then back off to let the read task run
+    U32 waited = 0;
+    while (this->getCommandCount() < count) {
+      for (U32 spin = 0; spin < 10000 && this->getCommandCount() < count; spin++) {
+      }
+      if (this->getCommandCount() < count) {
+        if (waited++ >= WAIT_TIMEOUT_MS) {
+          return false;
+        }
+        (void) Os::Task::delay(1);
+      }
+    }
+    return true;
+  }
+
+  U32 Tester ::
+    getCommandCount(void)
+  {
+    return __sync_add_and_fetch(&this->commandCount, 0);
+  }
+
+} // end namespace Svc
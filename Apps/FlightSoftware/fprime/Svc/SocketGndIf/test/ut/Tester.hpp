@@ -0,0 +1,197 @@
+// ======================================================================
+// \title  SocketGndIf/test/ut/Tester.hpp
+// \brief  hpp file for SocketGndIf test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "GTestBase.hpp"
+#include <Svc/SocketGndIf/SvcSocketGndIfImpl.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+  class Tester :
+    public GndIfGTestBase
+  {
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object Tester
+      //!
+      Tester(void);
+
+      //! Destroy object Tester
+      //!
+      ~Tester(void);
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Tests
+      // ----------------------------------------------------------------------
+
+      //! Parse frames split across reads, with garbage and oversize frames
+      //!
+      void frameParsing(void);
+
+      //! Uplink commands and file packets through a loopback socket
+      //!
+      void loopbackUplink(void);
+
+      //! Uplink a file packet larger than the receive buffer
+      //!
+      void largeFileUplink(void);
+
+      //! Stop the read task while it is blocked waiting for data
+      //!
+      void stopWhileIdle(void);
+
+      //! Measure uplink commands/s and per-frame latency over loopback
+      //!
+      void loopbackBenchmark(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_fileUplinkBufferSendOut
+      //!
+      void from_fileUplinkBufferSendOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+      //! Handler for from_uplinkPort
+      //!
+      void from_uplinkPort_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+      //! Handler for from_fileDownlinkBufferSendOut
+      //!
+      void from_fileDownlinkBufferSendOut_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+      //! Handler for from_fileUplinkBufferGet
+      //!
+      Fw::Buffer from_fileUplinkBufferGet_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts(void);
+
+      //! Initialize components
+      //!
+      void initComponents(void);
+
+      //! Open the listening socket standing in for the ground system
+      //!
+      void openGround(void);
+
+      //! Start the component and accept its connection
+      //!
+      void connectComponent(void);
+
+      //! Stop the component and close the ground sockets
+      //!
+      void disconnectComponent(void);
+
+      //! Write bytes to the component
+      //!
+      void sendBytes(
+          const U8* data, //!< The bytes
+          U32 size //!< The number of bytes
+      );
+
+      //! Build an uplink frame
+      //!
+      //! \return The size of the frame
+      //!
+      static U32 buildFrame(
+          U8* const frame, //!< The frame buffer
+          const U32 descriptor, //!< The packet descriptor
+          const U8* const payload, //!< The payload following the descriptor
+          const U32 payloadSize //!< The payload size
+      );
+
+      //! Wait until a number of commands have been received
+      //!
+      //! \return Whether the count was reached before timing out
+      //!
+      bool waitForCommands(
+          const U32 count //!< The number of commands
+      );
+
+      //! Read the count of received commands
+      //!
+      U32 getCommandCount(void);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      SocketGndIfImpl component;
+
+      //! Listening socket
+      NATIVE_INT_TYPE listenFd;
+
+      //! Socket accepted from the component
+      NATIVE_INT_TYPE groundFd;
+
+      //! Port the ground stand-in listens on
+      U32 groundPort;
+
+      //! Host name handed to the component
+      char hostname[16];
+
+      //! Commands received on uplinkPort; written by the read task
+      volatile U32 commandCount;
+
+      //! The last command received
+      Fw::ComBuffer lastCommand;
+
+      //! Storage for file uplink buffers
+      U8 fileData[3 * SocketFrameReader::BUFFER_SIZE];
+
+      //! Size of the last file packet received
+      U32 fileSize;
+
+      //! File packets received
+      volatile U32 fileCount;
+
+  };
+
+} // end namespace Svc
+
+#endif
@@ -0,0 +1,19 @@
+#
+#   Copyright 2004-2008, by the California Institute of Technology.
+#   ALL RIGHTS RESERVED. United States Government Sponsorship
+#   acknowledged.
+#
+#
+
+TEST_SRC=Handcode/TesterBase.cpp \
+				 Handcode/GTestBase.cpp \
+				 Tester.cpp \
+				 Main.cpp 
+
+TEST_MODS=Svc/SocketGndIf Svc/GndIf \
+					Fw/Buffer Fw/Cmd Fw/Com Fw/Comp Fw/Log Fw/Obj \
+					Fw/Port Fw/Time Fw/Tlm Fw/Types \
+					Os \
+					gtest
+
+COMPARGS = -I$(CURDIR)/test/ut/Handcode
@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief Perfect hash table type for TlmChan channel lookup
+ *
+ * The topology autocoder builds a minimal perfect hash table over the
+ * telemetry channel IDs of a deployment and emits it as a constant
+ * <Name>TlmChanHash in the generated topology file, along with storage for
+ * the values of its channels. The deployment hands it to
+ * TlmChanImpl::setHashTable(), after which every channel in the table has
+ * its own entry and is found with two hashes and one compare.
+ *
+ * The hash must match Autocoders/Python/src/fprime_ac/utils/TlmChanHash.py.
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef TLMCHANHASHTABLE_HPP_
+#define TLMCHANHASHTABLE_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Cfg/Config.hpp>
+#include <Fw/Time/Time.hpp>
+#include <Fw/Tlm/TlmBuffer.hpp>
+
+namespace Svc {
+
+    //! Storage for the most recent value of a channel
+    struct TlmChanEntry {
+        FwChanIdType id; //!< telemetry id stored in slot
+        bool updated; //!< set whenever a value has been written. Used to skip if writing out values for downlinking
+        Fw::Time lastUpdate; //!< last updated time
+        Fw::TlmBuffer buffer; //!< buffer to store serialized telemetry
+        TlmChanEntry* next; //!< pointer to next bucket in table
+        TlmChanEntry* nextDirty; //!< next entry updated since the set became active
+        bool used; //!< if entry has been used
+        bool packetResolved; //!< set once packetSlot has been looked up
+        NATIVE_INT_TYPE packetSlot; //!< first packet slot carrying the channel; -1 if none
+        NATIVE_UINT_TYPE bucketNo; //!< for testing
+    };
+
+    //! A minimal perfect hash table of channel IDs
+    struct TlmChanHashTable {
+        const FwChanIdType* ids; //!< channel ID in each slot
+        NATIVE_UINT_TYPE numIds; //!< number of slots; one per channel
+        const U16* seeds; //!< hash seed for each bucket of IDs
+        NATIVE_UINT_TYPE numSeeds; //!< number of seeds
+        TlmChanEntry* entries; //!< 2 * numIds entries: one per slot for each of the two value buffers
+    };
+
+    //! Hash a channel ID with a seed
+    inline U32 tlmChanHashMix(U32 id, U32 seed) {
+        U32 h = id ^ (seed * 0x9E3779B9U);
+        h ^= h >> 16;
+        h *= 0x85EBCA6BU;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35U;
+        h ^= h >> 16;
+        return h;
+    }
+
+    //! Find the slot of a channel
+    //! \return the slot, or -1 if the channel is not in the table
+    inline NATIVE_INT_TYPE tlmChanHashLookup(const TlmChanHashTable& table, FwChanIdType id) {
+        if (table.numIds == 0) {
+            return -1;
+        }
+        const U32 seed = table.seeds[tlmChanHashMix(id,0) % table.numSeeds];
+        const NATIVE_UINT_TYPE slot = tlmChanHashMix(id,seed) % table.numIds;
+        return (table.ids[slot] == id) ? static_cast<NATIVE_INT_TYPE>(slot) : -1;
+    }
+
+}
+
+#endif /* TLMCHANHASHTABLE_HPP_ */
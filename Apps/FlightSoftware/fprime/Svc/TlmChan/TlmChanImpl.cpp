@@ -35,18 +35,41 @@ namespace Svc {
         // clear buckets
         for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
             this->m_tlmEntries[0].buckets[entry].used = false;
+            this->m_tlmEntries[0].buckets[entry].updated = false;
             this->m_tlmEntries[0].buckets[entry].bucketNo = entry;
             this->m_tlmEntries[0].buckets[entry].next = 0;
+            this->m_tlmEntries[0].buckets[entry].nextDirty = 0;
             this->m_tlmEntries[0].buckets[entry].id = 0;
+            this->m_tlmEntries[0].buckets[entry].packetResolved = false;
+            this->m_tlmEntries[0].buckets[entry].packetSlot = -1;
             this->m_tlmEntries[1].buckets[entry].used = false;
+            this->m_tlmEntries[1].buckets[entry].updated = false;
             this->m_tlmEntries[1].buckets[entry].bucketNo = entry;
             this->m_tlmEntries[1].buckets[entry].next = 0;
+            this->m_tlmEntries[1].buckets[entry].nextDirty = 0;
             this->m_tlmEntries[1].buckets[entry].id = 0;
+            this->m_tlmEntries[1].buckets[entry].packetResolved = false;
+            this->m_tlmEntries[1].buckets[entry].packetSlot = -1;
+        }
+        // clear free index, dirty lists and statistics
+        for (NATIVE_UINT_TYPE set = 0; set < 2; set++) {
+            this->m_tlmEntries[set].free = 0;
+            this->m_tlmEntries[set].table = 0;
+            this->m_tlmEntries[set].dirtyHead = 0;
+            this->m_tlmEntries[set].dirtyTail = 0;
+            this->m_tlmEntries[set].numDirty = 0;
+            this->m_tlmEntries[set].slotsUsed = 0;
+            this->m_tlmEntries[set].maxChain = 0;
+        }
+        // every channel is hashed until a perfect hash table is supplied
+        this->m_hashTable = 0;
+        // not packetized until a packet list is supplied
+        this->m_packetList = 0;
+        this->m_numPacketSlots = 0;
+        for (NATIVE_UINT_TYPE packet = 0; packet < TLMCHAN_MAX_PACKETS; packet++) {
+            this->m_packets[packet].size = 0;
+            this->m_packets[packet].updated = false;
         }
-        // clear free index
-        this->m_tlmEntries[0].free = 0;
-        this->m_tlmEntries[1].free = 0;
-
 
     }
 
@@ -60,6 +83,98 @@ namespace Svc {
         TlmChanComponentBase::init(queueDepth,instance);
     }
 
+    void TlmChanImpl::setPacketList(const TlmChanPacketList& list) {
+
+        FW_ASSERT(list.packets);
+        FW_ASSERT(list.numPackets <= TLMCHAN_MAX_PACKETS,list.numPackets);
+        this->m_numPacketSlots = 0;
+
+        // each packet is a descriptor, packet ID and time tag followed by the values
+        const NATIVE_UINT_TYPE header =
+                sizeof(FwPacketDescriptorType) + sizeof(FwTlmPacketizeIdType) + Fw::Time::SERIALIZED_SIZE;
+
+        for (NATIVE_UINT_TYPE packet = 0; packet < list.numPackets; packet++) {
+            const TlmChanPacketDef& def = list.packets[packet];
+            FW_ASSERT(def.channels);
+            NATIVE_UINT_TYPE size = 0;
+            for (NATIVE_UINT_TYPE chan = 0; chan < def.numChannels; chan++) {
+                FW_ASSERT(this->m_numPacketSlots < TLMCHAN_MAX_PACKET_CHANNELS,this->m_numPacketSlots);
+                // no channel value can be empty or larger than a telemetry buffer
+                FW_ASSERT((def.channels[chan].size > 0) and (def.channels[chan].size <= FW_TLM_BUFFER_MAX_SIZE),
+                        def.channels[chan].id,def.channels[chan].size);
+                TlmPacketSlot& slot = this->m_packetSlots[this->m_numPacketSlots];
+                slot.id = def.channels[chan].id;
+                slot.packet = packet;
+                slot.offset = size;
+                slot.size = def.channels[chan].size;
+                slot.next = -1;
+                // link from the last slot carrying the same channel
+                for (NATIVE_UINT_TYPE prev = 0; prev < this->m_numPacketSlots; prev++) {
+                    if ((this->m_packetSlots[prev].id == slot.id) && (this->m_packetSlots[prev].next == -1)) {
+                        this->m_packetSlots[prev].next = this->m_numPacketSlots;
+                        break;
+                    }
+                }
+                this->m_numPacketSlots++;
+                size += def.channels[chan].size;
+            }
+            FW_ASSERT(header + size <= FW_COM_BUFFER_MAX_SIZE,def.id,size);
+            // values not yet written are sent as zeros
+            memset(this->m_packets[packet].values,0,sizeof(this->m_packets[packet].values));
+            this->m_packets[packet].size = size;
+            this->m_packets[packet].updated = false;
+        }
+
+        // look up the packets for each channel again on the next run
+        for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
+            this->m_tlmEntries[0].buckets[entry].packetResolved = false;
+            this->m_tlmEntries[0].buckets[entry].packetSlot = -1;
+            this->m_tlmEntries[1].buckets[entry].packetResolved = false;
+            this->m_tlmEntries[1].buckets[entry].packetSlot = -1;
+        }
+        if (this->m_hashTable) {
+            for (NATIVE_UINT_TYPE entry = 0; entry < 2*this->m_hashTable->numIds; entry++) {
+                this->m_hashTable->entries[entry].packetResolved = false;
+                this->m_hashTable->entries[entry].packetSlot = -1;
+            }
+        }
+
+        this->m_packetList = &list;
+    }
+
+    void TlmChanImpl::setHashTable(const TlmChanHashTable& table) {
+
+        FW_ASSERT((table.numIds == 0) or (table.ids and table.seeds and table.numSeeds and table.entries));
+
+        // each set gets one entry per table slot from the table's storage,
+        // so the buckets only hold channels missing from the table
+        for (NATIVE_UINT_TYPE set = 0; set < 2; set++) {
+            TlmSet& tlmSet = this->m_tlmEntries[set];
+            // channels written before now would be stored twice
+            FW_ASSERT(tlmSet.free == 0,tlmSet.free);
+            if (table.numIds == 0) {
+                tlmSet.table = 0;
+                continue;
+            }
+            tlmSet.table = &table.entries[set*table.numIds];
+            for (NATIVE_UINT_TYPE slot = 0; slot < table.numIds; slot++) {
+                TlmEntry& entry = tlmSet.table[slot];
+                entry.id = table.ids[slot];
+                entry.used = false;
+                entry.updated = false;
+                entry.next = 0;
+                entry.nextDirty = 0;
+                entry.packetResolved = false;
+                entry.packetSlot = -1;
+                entry.bucketNo = slot;
+            }
+            // each table channel is a chain of one
+            tlmSet.maxChain = 1;
+        }
+
+        this->m_hashTable = &table;
+    }
+
     NATIVE_UINT_TYPE TlmChanImpl::doHash(FwChanIdType id) {
         return (id % TLMCHAN_HASH_MOD_VALUE)%TLMCHAN_NUM_TLM_HASH_SLOTS;
     }
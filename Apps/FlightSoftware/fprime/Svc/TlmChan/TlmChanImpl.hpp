@@ -15,6 +15,8 @@
 
 #include <Svc/TlmChan/TlmChanComponentAc.hpp>
 #include <Svc/TlmChan/TlmChanImplCfg.hpp>
+#include <Svc/TlmChan/TlmChanPacketDefs.hpp>
+#include <Svc/TlmChan/TlmChanHashTable.hpp>
 #include <Os/Mutex.hpp>
 #include <Fw/Tlm/TlmPacket.hpp>
 
@@ -33,6 +35,24 @@ namespace Svc {
                     NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
                     NATIVE_INT_TYPE instance /*!< The instance number*/
                     );
+
+            //! Switch to packetized mode. Channels in the table are sent as
+            //! packets of values; other channels are still sent one per packet.
+            //! Call before the component is started. The table is not copied
+            //! and must outlive the component.
+            void setPacketList(
+                    const TlmChanPacketList& list /*!< The packet definitions*/
+                    );
+
+            //! Look up channels with a perfect hash table generated for the
+            //! topology. Each channel in the table is stored in its own entry
+            //! of the table's storage; other channels still go through
+            //! doHash() and the buckets. Call after init() and before any
+            //! telemetry is written. The table is not copied and must
+            //! outlive the component.
+            void setHashTable(
+                    const TlmChanHashTable& table /*!< The generated table*/
+                    );
         PROTECTED:
 
             // can be overridden for alternate algorithms
@@ -51,24 +71,54 @@ namespace Svc {
                 U32 key /*!< Value to return to pinger*/
             );
 
-            typedef struct tlmEntry {
-                FwChanIdType id; //!< telemetry id stored in slot
-                bool updated; //!< set whenever a value has been written. Used to skip if writing out values for downlinking
-                Fw::Time lastUpdate; //!< last updated time
-                Fw::TlmBuffer buffer; //!< buffer to store serialized telemetry
-                tlmEntry* next; //!< pointer to next bucket in table
-                bool used; //!< if entry has been used
-                NATIVE_UINT_TYPE bucketNo; //!< for testing
-            } TlmEntry;
+            typedef TlmChanEntry TlmEntry;
 
             struct TlmSet {
                 TlmEntry* slots[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< set of hash slots in hash table
                 TlmEntry buckets[TLMCHAN_HASH_BUCKETS]; //!< set of buckets used in hash table
                 NATIVE_INT_TYPE free; //!< next free bucket
+                TlmEntry* table; //!< entries of the perfect hash table channels; NULL if none
+                TlmEntry* dirtyHead; //!< first entry updated since the set became active
+                TlmEntry* dirtyTail; //!< last entry updated, where the next one is linked
+                NATIVE_UINT_TYPE numDirty; //!< number of entries in the dirty list
+                NATIVE_UINT_TYPE slotsUsed; //!< number of hash slots with at least one bucket
+                NATIVE_UINT_TYPE maxChain; //!< longest chain of buckets in a slot
             } m_tlmEntries[2];
 
             U32 m_activeBuffer; // !< which buffer is active for storing telemetry
 
+            // find the entry for a channel in a set; NULL if never written
+            // or, for channels in the perfect hash table, not used yet
+            TlmEntry* findEntry(TlmSet& set, FwChanIdType id);
+
+            // Run handler steps for packetized mode
+            void resolvePacketSlot(TlmEntry* entry);
+            void updatePackets(TlmSet& set);
+            void sendPackets(void);
+
+            // write hash table statistics
+            void writeTableTlm(void);
+
+            const TlmChanHashTable* m_hashTable; //!< perfect hash table; NULL when not supplied
+
+            const TlmChanPacketList* m_packetList; //!< packet definitions; NULL when not packetized
+
+            struct TlmPacketSlot {
+                FwChanIdType id; //!< channel carried in the slot
+                NATIVE_UINT_TYPE packet; //!< index of the packet definition
+                NATIVE_UINT_TYPE offset; //!< offset of the value in the packet
+                NATIVE_UINT_TYPE size; //!< size of the value
+                NATIVE_INT_TYPE next; //!< next slot carrying the same channel; -1 if last
+            } m_packetSlots[TLMCHAN_MAX_PACKET_CHANNELS];
+            NATIVE_UINT_TYPE m_numPacketSlots; //!< number of channels in all packet definitions
+
+            struct TlmPacketImage {
+                U8 values[FW_COM_BUFFER_MAX_SIZE]; //!< most recent value of each channel in the packet
+                NATIVE_UINT_TYPE size; //!< size of the values
+                Fw::Time timeTag; //!< time tag of the most recent update
+                bool updated; //!< set when a channel in the packet was updated this cycle
+            } m_packets[TLMCHAN_MAX_PACKETS];
+
             // work variables
             Fw::ComBuffer m_comBuffer;
             Fw::TlmPacket m_tlmPacket;
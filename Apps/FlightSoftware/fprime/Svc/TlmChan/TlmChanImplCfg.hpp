@@ -13,9 +13,6 @@
 #ifndef TLMCHANIMPLCFG_HPP_
 #define TLMCHANIMPLCFG_HPP_
 
-// Anonymous namespace for configuration parameters
-
-
 // The parameters below provide for tuning of the hash function used to
 // write and read entries in the database. The has function is very simple;
 // It first takes the telemetry ID and does a modulo computation with
@@ -38,20 +35,40 @@
 //        Entry - a bucket assigned to the slot
 //        ... (Other buckets in the slot)
 //     The number of buckets assigned to each slot can be checked for balance.
+// Deployments built from a topology can skip the tuning by handing the
+// generated perfect hash table to TlmChanImpl::setHashTable(). The table
+// brings its own storage for its channels, so the buckets below only hold
+// channels missing from the table. See docs/sdd.md.
 
-namespace {
+// The table sizes below can be overridden from the build.
 
-    enum {
-        TLMCHAN_NUM_TLM_HASH_SLOTS = 15, // !< Number of slots in the hash table.
+#ifndef TLMCHAN_NUM_TLM_HASH_SLOTS
+#define TLMCHAN_NUM_TLM_HASH_SLOTS 15   // !< Number of slots in the hash table.
                                         // Works best when set to about twice the number of components producing telemetry
-        TLMCHAN_HASH_MOD_VALUE = 99,    // !< The modulo value of the hashing function.
+#endif
+
+#ifndef TLMCHAN_HASH_MOD_VALUE
+#define TLMCHAN_HASH_MOD_VALUE 99       // !< The modulo value of the hashing function.
                                         // Should be set to a little below the ID gaps to spread the entries around
+#endif
+
+#ifndef TLMCHAN_HASH_BUCKETS
+#define TLMCHAN_HASH_BUCKETS 50         // !< Buckets assignable to a hash slot.
+                                        // Buckets must be >= number of telemetry channels not in the perfect hash table
+#endif
 
-        TLMCHAN_HASH_BUCKETS = 50       // !< Buckets assignable to a hash slot.
-                                        // Buckets must be >= number of telemetry channels in system
-    };
+// Packetized mode. When a deployment supplies a packet definition table with
+// TlmChanImpl::setPacketList(), the channels in the table are sent as
+// packets of values instead of one packet per channel. See docs/sdd.md.
 
+#ifndef TLMCHAN_MAX_PACKETS
+#define TLMCHAN_MAX_PACKETS 8           // !< Number of packet definitions that can be supplied.
+                                        // Each costs a FW_COM_BUFFER_MAX_SIZE value image
+#endif
 
-}
+#ifndef TLMCHAN_MAX_PACKET_CHANNELS
+#define TLMCHAN_MAX_PACKET_CHANNELS TLMCHAN_HASH_BUCKETS // !< Number of channel entries in all packet definitions.
+                                        // A channel carried in two packets counts twice
+#endif
 
 #endif /* TLMCHANIMPLCFG_HPP_ */
@@ -14,14 +14,23 @@
 
 namespace Svc {
 
-    void TlmChanImpl::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
+    TlmChanImpl::TlmEntry* TlmChanImpl::findEntry(TlmSet& set, FwChanIdType id) {
+
+        // Channels in the perfect hash table have a reserved entry
+        if (this->m_hashTable) {
+            NATIVE_INT_TYPE perfectSlot = tlmChanHashLookup(*this->m_hashTable,id);
+            if (perfectSlot != -1) {
+                TlmEntry* entry = &set.table[perfectSlot];
+                return entry->used ? entry : 0;
+            }
+        }
 
         // Compute index for entry
 
         NATIVE_UINT_TYPE index = this->doHash(id);
 
         // Search to see if channel has been stored
-        TlmEntry *entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+        TlmEntry *entryToUse = set.slots[index];
         for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
             if (entryToUse) { // If bucket exists, check id
                 if (entryToUse->id == id) {
@@ -34,6 +43,13 @@ namespace Svc {
             }
         }
 
+        return entryToUse;
+    }
+
+    void TlmChanImpl::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
+
+        TlmEntry *entryToUse = this->findEntry(this->m_tlmEntries[this->m_activeBuffer],id);
+
         if (entryToUse) {
             val  = entryToUse->buffer;
             timeTag = entryToUse->lastUpdate;
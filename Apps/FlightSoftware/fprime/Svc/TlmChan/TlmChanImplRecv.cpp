@@ -16,15 +16,28 @@ namespace Svc {
 
     void TlmChanImpl::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
-        // Compute index for entry
-
-        NATIVE_UINT_TYPE index = this->doHash(id);
+        TlmSet& set = this->m_tlmEntries[this->m_activeBuffer];
         TlmEntry* entryToUse = 0;
         TlmEntry* prevEntry = 0;
 
+        // Channels in the perfect hash table have a reserved entry
+        NATIVE_INT_TYPE perfectSlot = -1;
+        if (this->m_hashTable) {
+            perfectSlot = tlmChanHashLookup(*this->m_hashTable,id);
+        }
+
+        // Compute index for entry
+
+        NATIVE_UINT_TYPE index = 0;
+        if (perfectSlot == -1) {
+            index = this->doHash(id);
+        }
+
         // Search to see if channel has already been stored or a bucket needs to be added
-        if (this->m_tlmEntries[this->m_activeBuffer].slots[index]) {
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+        if (perfectSlot != -1) {
+            entryToUse = &set.table[perfectSlot];
+        } else if (set.slots[index]) {
+            entryToUse = set.slots[index];
             for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
                 if (entryToUse) {
                     if (entryToUse->id == id) { // found the matching entry
@@ -35,26 +48,45 @@ namespace Svc {
                     }
                 } else {
                     // Make sure that we haven't run out of buckets
-                    FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
+                    FW_ASSERT(set.free < TLMCHAN_HASH_BUCKETS);
                     // add new bucket from free list
-                    entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
+                    entryToUse = &set.buckets[set.free++];
                     prevEntry->next = entryToUse;
                     // clear next pointer
                     entryToUse->next = 0;
+                    // chain now holds the buckets searched plus the new one
+                    if (bucket + 1 > set.maxChain) {
+                        set.maxChain = bucket + 1;
+                    }
                     break;
                 }
             }
         } else {
             // Make sure that we haven't run out of buckets
-            FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
+            FW_ASSERT(set.free < TLMCHAN_HASH_BUCKETS);
             // create new entry at slot head
-            this->m_tlmEntries[this->m_activeBuffer].slots[index] = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
+            set.slots[index] = &set.buckets[set.free++];
+            entryToUse = set.slots[index];
             entryToUse->next = 0;
+            set.slotsUsed++;
+            if (set.maxChain == 0) {
+                set.maxChain = 1;
+            }
         }
 
         // copy into entry
         FW_ASSERT(entryToUse);
+        // add to the list of entries to send on the next run
+        if (not entryToUse->updated) {
+            entryToUse->nextDirty = 0;
+            if (set.dirtyTail) {
+                set.dirtyTail->nextDirty = entryToUse;
+            } else {
+                set.dirtyHead = entryToUse;
+            }
+            set.dirtyTail = entryToUse;
+            set.numDirty++;
+        }
         entryToUse->used = true;
         entryToUse->id = id;
         entryToUse->updated = true;
@@ -28,29 +28,116 @@ namespace Svc {
         }
 
         // lock mutex long enough to modify active telemetry buffer
-        // so the data can be read without worrying about updates
+        // so the data can be read without worrying about updates.
+        // The new active buffer was emptied when it was last sent.
         this->lock();
         this->m_activeBuffer = 1 - this->m_activeBuffer;
-        // set activeBuffer to not updated
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
-        }
         this->unLock();
 
-        // go through each entry and send a packet if it has been updated
-
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            TlmEntry* p_entry = &this->m_tlmEntries[1-this->m_activeBuffer].buckets[entry];
-            if ((p_entry->updated) && (p_entry->used)) {
-                this->m_tlmPacket.setId(p_entry->id);
-                this->m_tlmPacket.setTimeTag(p_entry->lastUpdate);
-                this->m_tlmPacket.setTlmBuffer(p_entry->buffer);
-                this->m_comBuffer.resetSer();
-                Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
-                FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
-                p_entry->updated = false;
-                this->PktSend_out(0,this->m_comBuffer,0);
+        TlmSet& set = this->m_tlmEntries[1-this->m_activeBuffer];
+
+        // in packetized mode, copy updated values into the packets first
+        if (this->m_packetList) {
+            this->updatePackets(set);
+            this->sendPackets();
+        }
+
+        // go through each updated entry and send a packet
+
+        for (TlmEntry* p_entry = set.dirtyHead; p_entry; p_entry = p_entry->nextDirty) {
+            FW_ASSERT(p_entry->updated);
+            p_entry->updated = false;
+            // already sent in a packet
+            if (p_entry->packetSlot != -1) {
+                continue;
+            }
+            this->m_tlmPacket.setId(p_entry->id);
+            this->m_tlmPacket.setTimeTag(p_entry->lastUpdate);
+            this->m_tlmPacket.setTlmBuffer(p_entry->buffer);
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            this->PktSend_out(0,this->m_comBuffer,0);
+        }
+        set.dirtyHead = 0;
+        set.dirtyTail = 0;
+        set.numDirty = 0;
+
+        this->writeTableTlm();
+    }
+
+    void TlmChanImpl::writeTableTlm(void) {
+        // Both buffers end up with the same channels; report the fuller one
+        const TlmSet& set0 = this->m_tlmEntries[0];
+        const TlmSet& set1 = this->m_tlmEntries[1];
+        // channels in the perfect hash table each hold an entry of its storage
+        const U32 tableEntries = this->m_hashTable ? this->m_hashTable->numIds : 0;
+        this->tlmWrite_TlmChanBucketsUsed(tableEntries + ((set0.free > set1.free) ? set0.free : set1.free));
+        this->tlmWrite_TlmChanSlotsUsed((set0.slotsUsed > set1.slotsUsed) ? set0.slotsUsed : set1.slotsUsed);
+        this->tlmWrite_TlmChanMaxChain((set0.maxChain > set1.maxChain) ? set0.maxChain : set1.maxChain);
+    }
+
+    void TlmChanImpl::resolvePacketSlot(TlmEntry* entry) {
+        entry->packetSlot = -1;
+        for (NATIVE_UINT_TYPE slot = 0; slot < this->m_numPacketSlots; slot++) {
+            if (this->m_packetSlots[slot].id == entry->id) {
+                entry->packetSlot = slot;
+                break;
+            }
+        }
+        entry->packetResolved = true;
+    }
+
+    void TlmChanImpl::updatePackets(TlmSet& set) {
+
+        for (TlmEntry* p_entry = set.dirtyHead; p_entry; p_entry = p_entry->nextDirty) {
+            // look up the packets for the channel once per buffer
+            if (not p_entry->packetResolved) {
+                this->resolvePacketSlot(p_entry);
+            }
+            // a channel may be carried in more than one packet
+            for (NATIVE_INT_TYPE slot = p_entry->packetSlot; slot != -1; slot = this->m_packetSlots[slot].next) {
+                const TlmPacketSlot& packetSlot = this->m_packetSlots[slot];
+                TlmPacketImage& image = this->m_packets[packetSlot.packet];
+                // a value of the wrong size, e.g. from a string channel, would
+                // shift the values after it, so leave it out of the packet
+                if (p_entry->buffer.getBuffLength() != packetSlot.size) {
+                    this->log_WARNING_HI_TlmChanPacketSizeMismatch(
+                            p_entry->id,
+                            p_entry->buffer.getBuffLength(),
+                            this->m_packetList->packets[packetSlot.packet].id,
+                            packetSlot.size);
+                    continue;
+                }
+                memcpy(&image.values[packetSlot.offset],p_entry->buffer.getBuffAddr(),packetSlot.size);
+                if ((not image.updated) || (p_entry->lastUpdate > image.timeTag)) {
+                    image.timeTag = p_entry->lastUpdate;
+                }
+                image.updated = true;
+            }
+        }
+    }
+
+    void TlmChanImpl::sendPackets(void) {
+
+        for (NATIVE_UINT_TYPE packet = 0; packet < this->m_packetList->numPackets; packet++) {
+            TlmPacketImage& image = this->m_packets[packet];
+            // only send packets with a channel updated this cycle
+            if (not image.updated) {
+                continue;
             }
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_comBuffer.serialize(
+                    static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM));
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(this->m_packetList->packets[packet].id);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(image.timeTag);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            stat = this->m_comBuffer.serialize(image.values,image.size,true);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            image.updated = false;
+            this->PktSend_out(0,this->m_comBuffer,0);
         }
     }
 
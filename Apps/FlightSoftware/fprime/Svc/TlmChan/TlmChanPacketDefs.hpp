@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief Packet definition table types for packetized telemetry
+ *
+ * A deployment that wants packetized telemetry defines a constant table of
+ * packets, each listing the channels it carries and their serialized sizes,
+ * and hands it to TlmChanImpl::setPacketList(). The same table must be known
+ * to the ground system, since the channel IDs and time tags are not sent
+ * with each value. Only channels with a fixed serialized size can be
+ * carried in a packet; a value of another size is left out with a warning.
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef TLMCHANPACKETDEFS_HPP_
+#define TLMCHANPACKETDEFS_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Fw/Cfg/Config.hpp>
+
+namespace Svc {
+
+    //! A channel carried in a packet
+    struct TlmChanPacketChannel {
+        FwChanIdType id; //!< channel ID
+        NATIVE_UINT_TYPE size; //!< serialized size of the channel value
+    };
+
+    //! A packet definition. Values are packed in the order listed.
+    struct TlmChanPacketDef {
+        FwTlmPacketizeIdType id; //!< packet ID sent in place of the channel IDs
+        const TlmChanPacketChannel* channels; //!< channels in the packet
+        NATIVE_UINT_TYPE numChannels; //!< number of channels in the packet
+    };
+
+    //! The set of packets for a deployment
+    struct TlmChanPacketList {
+        const TlmChanPacketDef* packets; //!< packet definitions
+        NATIVE_UINT_TYPE numPackets; //!< number of packet definitions
+    };
+
+}
+
+#endif /* TLMCHANPACKETDEFS_HPP_ */
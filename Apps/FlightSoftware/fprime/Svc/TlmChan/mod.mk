@@ -20,6 +20,8 @@ SRC =      	TlmChanComponentAi.xml \
            	TlmChanImplTask.cpp 
 
 HDR = 		TlmChanImpl.hpp \
-			TlmChanImplCfg.hpp
+			TlmChanImplCfg.hpp \
+			TlmChanPacketDefs.hpp \
+			TlmChanHashTable.hpp
 
 SUBDIRS = test
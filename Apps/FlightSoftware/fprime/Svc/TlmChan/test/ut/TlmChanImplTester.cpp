@@ -24,15 +24,24 @@ namespace Svc {
 
     void TlmChanImplTester::from_PktSend_handler(NATIVE_INT_TYPE portNum, Fw::ComBuffer &data, U32 context) {
         this->m_bufferRecv = true;
-        this->m_rcvdBuffer[this->m_numBuffs] = data;
-        this->m_numBuffs++;
+        this->m_pktCalls++;
+        this->m_pktBytes += data.getBuffLength();
+        // the benchmark sends more buffers than are kept
+        if (this->m_numBuffs < FW_NUM_ARRAY_ELEMENTS(this->m_rcvdBuffer)) {
+            this->m_rcvdBuffer[this->m_numBuffs] = data;
+            this->m_numBuffs++;
+        }
     }
 
     TlmChanImplTester::TlmChanImplTester(Svc::TlmChanImpl& inst) :
         TlmChanGTestBase("testerbase",100),
             m_impl(inst),
             m_numBuffs(0),
-            m_bufferRecv(false) {
+            m_bufferRecv(false),
+            m_pktCalls(0),
+            m_pktBytes(0) {
+        this->m_packetList.packets = this->m_packetDefs;
+        this->m_packetList.numPackets = 0;
     }
 
     TlmChanImplTester::~TlmChanImplTester() {
@@ -70,6 +79,10 @@ namespace Svc {
             FwPacketDescriptorType desc;
             stat = this->m_rcvdBuffer[packet].deserialize(desc);
             ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            // packets of values are checked by checkPacket()
+            if (desc == (FwPacketDescriptorType)Fw::ComPacket::FW_PACKET_PACKETIZED_TLM) {
+                continue;
+            }
             ASSERT_EQ(desc,(FwPacketDescriptorType)Fw::ComPacket::FW_PACKET_TELEM);
             // next piece should be event ID
             FwEventIdType sentId;
@@ -211,6 +224,372 @@ namespace Svc {
 
     }
 
+    void TlmChanImplTester::checkPacket(FwTlmPacketizeIdType id, const U32* vals, NATIVE_UINT_TYPE numVals) {
+        Fw::SerializeStatus stat;
+        bool packetFound = false;
+
+        for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
+            this->m_rcvdBuffer[packet].resetDeser();
+            FwPacketDescriptorType desc;
+            stat = this->m_rcvdBuffer[packet].deserialize(desc);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            if (desc != (FwPacketDescriptorType)Fw::ComPacket::FW_PACKET_PACKETIZED_TLM) {
+                continue;
+            }
+            FwTlmPacketizeIdType sentId;
+            stat = this->m_rcvdBuffer[packet].deserialize(sentId);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            if (sentId != id) {
+                continue;
+            }
+            // each packet should be sent only once per cycle
+            ASSERT_FALSE(packetFound);
+            packetFound = true;
+            // one time tag for the packet
+            Fw::Time timeTag;
+            Fw::Time recTimeTag(TB_NONE,0,0);
+            stat = this->m_rcvdBuffer[packet].deserialize(recTimeTag);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+            ASSERT_TRUE(timeTag == recTimeTag);
+            // values follow in definition order without IDs
+            for (NATIVE_UINT_TYPE val = 0; val < numVals; val++) {
+                U32 readVal;
+                stat = this->m_rcvdBuffer[packet].deserialize(readVal);
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,stat);
+                ASSERT_EQ(vals[val],readVal);
+            }
+            ASSERT_EQ(this->m_rcvdBuffer[packet].getBuffLeft(),(NATIVE_UINT_TYPE)0);
+        }
+
+        ASSERT_TRUE(packetFound);
+    }
+
+    void TlmChanImplTester::runPacketized(void) {
+
+        // Packet 10 carries 0x100-0x102, packet 11 shares 0x102 with it.
+        // 0x300 is not in a packet.
+        const FwChanIdType chans[] = {0x100,0x101,0x102,0x102,0x200};
+        for (NATIVE_UINT_TYPE n = 0; n < FW_NUM_ARRAY_ELEMENTS(chans); n++) {
+            this->m_packetChans[n].id = chans[n];
+            this->m_packetChans[n].size = sizeof(U32);
+        }
+        this->m_packetDefs[0].id = 10;
+        this->m_packetDefs[0].channels = &this->m_packetChans[0];
+        this->m_packetDefs[0].numChannels = 3;
+        this->m_packetDefs[1].id = 11;
+        this->m_packetDefs[1].channels = &this->m_packetChans[3];
+        this->m_packetDefs[1].numChannels = 2;
+        this->m_packetList.numPackets = 2;
+        this->m_impl.setPacketList(this->m_packetList);
+
+        // Values not yet written are sent as zero
+        this->clearBuffs();
+        this->sendBuff(0x100,1,0);
+        this->sendBuff(0x102,2,0);
+        this->sendBuff(0x300,3,0);
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)3,this->m_numBuffs);
+        const U32 packet10[] = {1,0,2};
+        this->checkPacket(10,packet10,FW_NUM_ARRAY_ELEMENTS(packet10));
+        const U32 packet11[] = {2,0};
+        this->checkPacket(11,packet11,FW_NUM_ARRAY_ELEMENTS(packet11));
+        this->checkBuff(0x300,3,0);
+
+        // Only packets with an updated channel are sent, with the
+        // last values of the channels that were not updated
+        this->clearBuffs();
+        this->sendBuff(0x101,5,0);
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)1,this->m_numBuffs);
+        const U32 packet10b[] = {1,5,2};
+        this->checkPacket(10,packet10b,FW_NUM_ARRAY_ELEMENTS(packet10b));
+
+        // Nothing updated, nothing sent
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+        ASSERT_EQ((NATIVE_UINT_TYPE)0,this->m_numBuffs);
+
+        // A value of the wrong size is left out of its packet with a warning
+        Fw::TlmBuffer buff;
+        Fw::Time timeTag;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U16>(9)));
+        this->invoke_to_TlmRecv(0,0x101,timeTag,buff);
+        this->sendBuff(0x100,7,0);
+        this->clearBuffs();
+        this->clearEvents();
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)1,this->m_numBuffs);
+        const U32 packet10c[] = {7,5,2};
+        this->checkPacket(10,packet10c,FW_NUM_ARRAY_ELEMENTS(packet10c));
+        ASSERT_EVENTS_SIZE(1);
+        ASSERT_EVENTS_TlmChanPacketSizeMismatch_SIZE(1);
+        ASSERT_EVENTS_TlmChanPacketSizeMismatch(0,0x101,sizeof(U16),10,sizeof(U32));
+
+    }
+
+    void TlmChanImplTester::runDirtyList(void) {
+
+        // A channel written twice is sent once with the last value
+        this->clearBuffs();
+        this->sendBuff(5,1,0);
+        this->sendBuff(7,2,0);
+        this->sendBuff(5,3,0);
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)2,this->m_numBuffs);
+        this->checkBuff(5,3,0);
+        this->checkBuff(7,2,0);
+        ASSERT_EQ((NATIVE_UINT_TYPE)0,this->m_impl.m_tlmEntries[1-this->m_impl.m_activeBuffer].numDirty);
+
+        // Nothing updated, nothing sent, from either buffer
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+        ASSERT_FALSE(this->doRun(false));
+
+        // Only the updated channel is sent
+        this->clearBuffs();
+        this->sendBuff(7,4,0);
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)1,this->m_numBuffs);
+        this->checkBuff(7,4,0);
+
+    }
+
+    void TlmChanImplTester::runHashTableTlm(void) {
+
+        FwChanIdType IDs[] = {
+                // From Ref ComponentReport.txt
+                0x1000,0x1001,0x1002,0x1003,0x1004,0x1005,0x1100,0x1101,0x1102,0x1103,0x300,0x301,0x400,0x401,0x402,0x100,0x101,0x102,0x103,0x104,0x105
+        };
+
+        // expected occupancy from the hash function
+        NATIVE_UINT_TYPE chain[TLMCHAN_NUM_TLM_HASH_SLOTS] = {0};
+        NATIVE_UINT_TYPE slotsUsed = 0;
+        NATIVE_UINT_TYPE maxChain = 0;
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            NATIVE_UINT_TYPE slot = this->m_impl.doHash(IDs[n]);
+            if (chain[slot]++ == 0) {
+                slotsUsed++;
+            }
+            if (chain[slot] > maxChain) {
+                maxChain = chain[slot];
+            }
+        }
+
+        this->clearBuffs();
+        this->clearTlm();
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->sendBuff(IDs[n],n,0);
+        }
+        this->doRun(true);
+
+        ASSERT_TLM_SIZE(3);
+        ASSERT_TLM_TlmChanBucketsUsed_SIZE(1);
+        ASSERT_TLM_TlmChanBucketsUsed(0,FW_NUM_ARRAY_ELEMENTS(IDs));
+        ASSERT_TLM_TlmChanSlotsUsed_SIZE(1);
+        ASSERT_TLM_TlmChanSlotsUsed(0,slotsUsed);
+        ASSERT_TLM_TlmChanMaxChain_SIZE(1);
+        ASSERT_TLM_TlmChanMaxChain(0,maxChain);
+
+        // Statistics are only written when they change
+        this->clearTlm();
+        this->clearBuffs();
+        this->sendBuff(IDs[0],1,0);
+        this->doRun(true);
+        ASSERT_TLM_SIZE(0);
+
+    }
+
+    void TlmChanImplTester::runPerfectHash(void) {
+
+        FwChanIdType IDs[] = {
+                // From Ref ComponentReport.txt
+                0x1000,0x1001,0x1002,0x1003,0x1004,0x1005,0x1100,0x1101,0x1102,0x1103,0x300,0x301,0x400,0x401,0x402,0x100,0x101,0x102,0x103,0x104,0x105
+        };
+
+        // Table for the IDs above as generated by the topology autocoder
+        // (Autocoders/Python/src/fprime_ac/utils/TlmChanHash.py)
+        static const FwChanIdType tableIds[] = {
+                0x105,0x103,0x400,0x1101,0x1000,0x1102,0x101,0x1103,0x401,0x102,0x1100,0x104,0x300,0x402,0x100,0x1003,0x301,0x1001,0x1002,0x1005,0x1004
+        };
+        static const U16 tableSeeds[] = {2,2,24,48,1577,5};
+        static TlmChanEntry tableEntries[2*FW_NUM_ARRAY_ELEMENTS(tableIds)];
+        static const TlmChanHashTable table = {
+                tableIds,FW_NUM_ARRAY_ELEMENTS(tableIds),tableSeeds,FW_NUM_ARRAY_ELEMENTS(tableSeeds),tableEntries
+        };
+
+        // every channel must have its own slot
+        ASSERT_EQ(FW_NUM_ARRAY_ELEMENTS(IDs),table.numIds);
+        bool slotUsed[FW_NUM_ARRAY_ELEMENTS(tableIds)] = {false};
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            NATIVE_INT_TYPE slot = tlmChanHashLookup(table,IDs[n]);
+            ASSERT_NE(-1,slot) << "Channel " << IDs[n] << " is missing from the hash table";
+            ASSERT_FALSE(slotUsed[slot]);
+            slotUsed[slot] = true;
+        }
+        // channels not in the table are not found
+        ASSERT_EQ(-1,tlmChanHashLookup(table,0x2000));
+
+        this->m_impl.setHashTable(table);
+
+        // channels in the table read back empty until written
+        Fw::Time timeTag;
+        Fw::TlmBuffer buff;
+        this->invoke_to_TlmGet(0,IDs[0],timeTag,buff);
+        ASSERT_EQ((NATIVE_UINT_TYPE)0,buff.getBuffLength());
+
+        this->clearBuffs();
+        this->clearTlm();
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->sendBuff(IDs[n],n,0);
+        }
+        this->doRun(true);
+
+        // table channels fill the table exactly and never use the hash slots
+        ASSERT_EQ(FW_NUM_ARRAY_ELEMENTS(IDs),this->m_numBuffs);
+        for (NATIVE_UINT_TYPE n=0; n < FW_NUM_ARRAY_ELEMENTS(IDs); n++) {
+            this->checkBuff(IDs[n],n,0);
+        }
+        ASSERT_TLM_TlmChanBucketsUsed(0,FW_NUM_ARRAY_ELEMENTS(IDs));
+        ASSERT_TLM_TlmChanSlotsUsed(0,0);
+        ASSERT_TLM_TlmChanMaxChain(0,1);
+
+        // a channel missing from the table still goes through the hash slots
+        this->clearBuffs();
+        this->clearTlm();
+        this->sendBuff(0x2000,100,0);
+        this->sendBuff(IDs[3],200,0);
+        this->doRun(true);
+        ASSERT_EQ((NATIVE_UINT_TYPE)2,this->m_numBuffs);
+        this->checkBuff(0x2000,100,0);
+        this->checkBuff(IDs[3],200,0);
+        ASSERT_TLM_TlmChanBucketsUsed(0,FW_NUM_ARRAY_ELEMENTS(IDs)+1);
+        ASSERT_TLM_TlmChanSlotsUsed(0,1);
+
+    }
+
+    void TlmChanImplTester::runLargePerfectHash(void) {
+
+        // 80 channels, more than the TLMCHAN_HASH_BUCKETS default, as
+        // generated by the topology autocoder for IDs 0x100-0x127 and
+        // 0x200-0x227 (Autocoders/Python/src/fprime_ac/utils/TlmChanHash.py)
+        static const FwChanIdType tableIds[] = {
+                0x20d,0x218,0x108,0x10f,0x217,0x109,0x210,0x21f,0x116,0x213,
+                0x202,0x11a,0x205,0x21e,0x226,0x113,0x102,0x11b,0x105,0x211,
+                0x114,0x127,0x214,0x216,0x11e,0x209,0x20f,0x10b,0x219,0x204,
+                0x121,0x201,0x220,0x222,0x122,0x206,0x100,0x111,0x20b,0x203,
+                0x123,0x11c,0x117,0x20e,0x212,0x200,0x118,0x101,0x20a,0x20c,
+                0x110,0x10a,0x11d,0x120,0x119,0x221,0x107,0x106,0x21d,0x10e,
+                0x112,0x224,0x104,0x124,0x103,0x126,0x21c,0x225,0x227,0x21a,
+                0x115,0x207,0x125,0x208,0x223,0x10d,0x11f,0x21b,0x10c,0x215
+        };
+        static const U16 tableSeeds[] = {1,22,103,12,150,1,5,172,33,11,170,505,621,11,1,4504,6,459,31,3430};
+        static TlmChanEntry tableEntries[2*FW_NUM_ARRAY_ELEMENTS(tableIds)];
+        static const TlmChanHashTable table = {
+                tableIds,FW_NUM_ARRAY_ELEMENTS(tableIds),tableSeeds,FW_NUM_ARRAY_ELEMENTS(tableSeeds),tableEntries
+        };
+        ASSERT_EQ(static_cast<NATIVE_UINT_TYPE>(LARGE_TABLE_CHANNELS),table.numIds);
+        ASSERT_GT(table.numIds,static_cast<NATIVE_UINT_TYPE>(TLMCHAN_HASH_BUCKETS));
+
+        this->m_impl.setHashTable(table);
+
+        // the table's storage holds every channel; no buckets are used
+        for (NATIVE_UINT_TYPE cycle = 0; cycle < 2; cycle++) {
+            this->clearBuffs();
+            this->clearTlm();
+            for (NATIVE_UINT_TYPE n=0; n < table.numIds; n++) {
+                this->sendBuff(tableIds[n],n+cycle,0);
+            }
+            this->doRun(true);
+            ASSERT_EQ(table.numIds,this->m_numBuffs);
+            for (NATIVE_UINT_TYPE n=0; n < table.numIds; n++) {
+                this->checkBuff(tableIds[n],n+cycle,0);
+            }
+            ASSERT_TLM_TlmChanBucketsUsed(0,table.numIds);
+            ASSERT_TLM_TlmChanSlotsUsed(0,0);
+        }
+
+    }
+
+    void TlmChanImplTester::runPacketBenchmark(NATIVE_UINT_TYPE numChans, bool packetized) {
+
+        static const NATIVE_UINT_TYPE CYCLES = 100;
+        const char* mode = packetized ? "packetized" : "channelized";
+
+        // pack as many U32 channels as fit after the packet header
+        const NATIVE_UINT_TYPE header =
+                sizeof(FwPacketDescriptorType) + sizeof(FwTlmPacketizeIdType) + Fw::Time::SERIALIZED_SIZE;
+        const NATIVE_UINT_TYPE perPacket = (FW_COM_BUFFER_MAX_SIZE - header) / sizeof(U32);
+        const NATIVE_UINT_TYPE numPackets = (numChans + perPacket - 1) / perPacket;
+
+        // the table sizes in TlmChanImplCfg.hpp bound the benchmark; name
+        // the overrides that would fit this size instead of failing
+        const bool bucketsFit = (numChans <= static_cast<NATIVE_UINT_TYPE>(TLMCHAN_HASH_BUCKETS));
+        const bool slotsFit = not packetized || (numChans <= static_cast<NATIVE_UINT_TYPE>(TLMCHAN_MAX_PACKET_CHANNELS));
+        const bool packetsFit = not packetized || (numPackets <= static_cast<NATIVE_UINT_TYPE>(TLMCHAN_MAX_PACKETS));
+        if (not (bucketsFit && slotsFit && packetsFit)) {
+            printf("%4u channels %-11s: skipped, rebuild with",numChans,mode);
+            if (not bucketsFit) {
+                printf(" -DTLMCHAN_HASH_BUCKETS=%u",numChans);
+            }
+            if (not slotsFit) {
+                printf(" -DTLMCHAN_MAX_PACKET_CHANNELS=%u",numChans);
+            }
+            if (not packetsFit) {
+                printf(" -DTLMCHAN_MAX_PACKETS=%u",numPackets);
+            }
+            printf("\n");
+            return;
+        }
+
+        if (packetized) {
+            for (NATIVE_UINT_TYPE n = 0; n < numChans; n++) {
+                this->m_packetChans[n].id = n;
+                this->m_packetChans[n].size = sizeof(U32);
+            }
+            for (NATIVE_UINT_TYPE packet = 0; packet < numPackets; packet++) {
+                this->m_packetDefs[packet].id = packet;
+                this->m_packetDefs[packet].channels = &this->m_packetChans[packet*perPacket];
+                this->m_packetDefs[packet].numChannels =
+                        (packet == numPackets - 1) ? numChans - packet*perPacket : perPacket;
+            }
+            this->m_packetList.numPackets = numPackets;
+            this->m_impl.setPacketList(this->m_packetList);
+        }
+
+        Fw::TlmBuffer buff;
+        Fw::Time timeTag;
+        Os::IntervalTimer timer;
+        U32 totalUsec = 0;
+
+        for (NATIVE_UINT_TYPE cycle = 0; cycle < CYCLES; cycle++) {
+            // update every channel each cycle
+            for (NATIVE_UINT_TYPE n = 0; n < numChans; n++) {
+                buff.resetSer();
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(cycle + n)));
+                this->invoke_to_TlmRecv(0,n,timeTag,buff);
+            }
+            this->clearBuffs();
+            this->m_pktCalls = 0;
+            this->m_pktBytes = 0;
+            this->invoke_to_Run(0,0);
+            timer.start();
+            this->m_impl.doDispatch();
+            timer.stop();
+            totalUsec += timer.getDiffUsec();
+        }
+
+        if (packetized) {
+            ASSERT_EQ(numPackets,this->m_pktCalls);
+        } else {
+            ASSERT_EQ(numChans,this->m_pktCalls);
+        }
+
+        printf("%4u channels %-11s: %4u port calls, %6u bytes, %6.1f us per cycle\n",
+                numChans,mode,this->m_pktCalls,this->m_pktBytes,
+                static_cast<F64>(totalUsec)/CYCLES);
+
+    }
+
     void TlmChanImplTester::runOffNominal(void) {
 
         // Ask for a packet that isn't written yet
@@ -232,7 +611,7 @@ namespace Svc {
 
     void TlmChanImplTester::clearBuffs(void) {
         this->m_numBuffs = 0;
-        for (NATIVE_INT_TYPE n = 0; n < TLMCHAN_HASH_BUCKETS; n++) {
+        for (NATIVE_UINT_TYPE n = 0; n < FW_NUM_ARRAY_ELEMENTS(this->m_rcvdBuffer); n++) {
             this->m_rcvdBuffer[n].resetSer();
         }
     }
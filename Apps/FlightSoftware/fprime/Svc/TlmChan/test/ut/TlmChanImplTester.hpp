@@ -24,6 +24,12 @@ namespace Svc {
             void runMultiChannel(void);
             void runOffNominal(void);
             void runTooManyChannels(void);
+            void runPacketized(void);
+            void runDirtyList(void);
+            void runHashTableTlm(void);
+            void runPerfectHash(void);
+            void runLargePerfectHash(void);
+            void runPacketBenchmark(NATIVE_UINT_TYPE numChans, bool packetized);
 
         private:
             Svc::TlmChanImpl& m_impl;
@@ -34,11 +40,25 @@ namespace Svc {
             void sendBuff(FwChanIdType id, U32 val, NATIVE_INT_TYPE instance);
             bool doRun(bool check);
             void checkBuff(FwChanIdType id, U32 val, NATIVE_INT_TYPE instance);
+            void checkPacket(FwTlmPacketizeIdType id, const U32* vals, NATIVE_UINT_TYPE numVals);
+
+            // packet definitions handed to the component
+            TlmChanPacketChannel m_packetChans[TLMCHAN_HASH_BUCKETS];
+            TlmChanPacketDef m_packetDefs[TLMCHAN_MAX_PACKETS];
+            TlmChanPacketList m_packetList;
+
+            // channels in the table used by runLargePerfectHash()
+            enum {
+                LARGE_TABLE_CHANNELS = 80
+            };
 
             // Keep a history
             NATIVE_UINT_TYPE m_numBuffs;
-            Fw::ComBuffer m_rcvdBuffer[TLMCHAN_HASH_BUCKETS];
+            Fw::ComBuffer m_rcvdBuffer[LARGE_TABLE_CHANNELS + TLMCHAN_HASH_BUCKETS + TLMCHAN_MAX_PACKETS];
             bool m_bufferRecv;
+            // port calls and bytes sent, including buffers not kept in the history
+            NATIVE_UINT_TYPE m_pktCalls;
+            NATIVE_UINT_TYPE m_pktBytes;
             void clearBuffs(void);
 
             // dump functions
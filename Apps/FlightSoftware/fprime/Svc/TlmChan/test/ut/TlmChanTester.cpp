@@ -22,6 +22,10 @@ void connectPorts(Svc::TlmChanImpl& impl, Svc::TlmChanImplTester& tester) {
     tester.connect_to_TlmGet(0,impl.get_TlmGet_InputPort(0));
     tester.connect_to_Run(0,impl.get_Run_InputPort(0));
     impl.set_PktSend_OutputPort(0,tester.get_from_PktSend(0));
+    impl.set_Tlm_OutputPort(0,tester.get_from_Tlm(0));
+    impl.set_Time_OutputPort(0,tester.get_from_Time(0));
+    impl.set_Log_OutputPort(0,tester.get_from_Log(0));
+    impl.set_LogText_OutputPort(0,tester.get_from_LogText(0));
 
 #if FW_PORT_TRACING
     //Fw::PortBase::setTrace(true);
@@ -115,6 +119,143 @@ TEST(TlmChanTest,TooManyChannels) {
 
 }
 
+TEST(TlmChanTest,DirtyListTest) {
+
+    TEST_CASE(107.1.4,"Updated channel list");
+    COMMENT("Write channels several times per cycle and verify each is sent once per cycle.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runDirtyList();
+
+}
+
+TEST(TlmChanTest,HashTableTlmTest) {
+
+    TEST_CASE(107.1.5,"Hash table telemetry");
+    COMMENT("Verify the bucket, slot and chain length telemetry against the hash of the channel IDs.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runHashTableTlm();
+
+}
+
+TEST(TlmChanTest,PerfectHashTest) {
+
+    TEST_CASE(107.1.6,"Perfect hash table lookup");
+    COMMENT("Verify every channel has a slot in a generated table and is stored without chaining.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runPerfectHash();
+
+}
+
+TEST(TlmChanTest,LargePerfectHashTest) {
+
+    TEST_CASE(107.1.7,"Perfect hash table larger than the buckets");
+    COMMENT("Verify a generated table with more channels than buckets stores every channel.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runLargePerfectHash();
+
+}
+
+TEST(TlmChanTest,PacketizedTest) {
+
+    TEST_CASE(107.1.3,"Packetized telemetry");
+    COMMENT("Write channels in a packet definition and verify they are sent as packets of values.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runPacketized();
+
+}
+
+TEST(TlmChanTest,PacketBenchmark) {
+
+    COMMENT("Compare port calls, bytes and time per cycle for channelized and packetized telemetry.");
+
+    // sizes above the table sizes in TlmChanImplCfg.hpp are skipped
+    const NATIVE_UINT_TYPE numChans[] = {50,200,1000};
+
+    for (NATIVE_UINT_TYPE size = 0; size < FW_NUM_ARRAY_ELEMENTS(numChans); size++) {
+        for (NATIVE_UINT_TYPE mode = 0; mode < 2; mode++) {
+
+            // large table sizes don't fit on the stack
+            Svc::TlmChanImpl* impl = new Svc::TlmChanImpl("TlmChanImpl");
+
+            impl->init(10,0);
+
+            Svc::TlmChanImplTester* tester = new Svc::TlmChanImplTester(*impl);
+
+            tester->init();
+
+            // connect ports
+            connectPorts(*impl,*tester);
+
+            // run test
+            tester->runPacketBenchmark(numChans[size],(mode == 1));
+
+            delete tester;
+            delete impl;
+        }
+    }
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,36 @@
+// ======================================================================
+// \title  IdHash.hpp
+// \brief  Hash function for component table IDs
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_ID_HASH_HPP
+#define UTILS_ID_HASH_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Utils {
+
+  //! Hash an ID such as an opcode, event ID or parameter ID for a
+  //! table lookup. IDs are often allocated in dense blocks, so the
+  //! low bits alone would cluster. The multiply spreads every bit of
+  //! the ID into the high bits, and the fold brings them back down.
+  //! Mask the result to the size of a power-of-two table.
+  //!
+  //! \return The hash value
+  //!
+  inline U32 hashId(
+      const U32 id //!< The ID
+  ) {
+    const U32 hash = id * 0x9E3779B1U;
+    return hash ^ (hash >> 16);
+  }
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+// ====================================================================== 
+// \title  CRC32.cpp
+// \brief  cpp file for the word-at-a-time CRC32 implementation of Hash
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+// 
+// ====================================================================== 
+
+#include <Utils/Hash/Hash.hpp>
+
+namespace Utils {
+
+    Hash :: 
+        Hash()
+    {
+        this->init();
+    }
+
+    Hash ::
+        ~Hash()
+    {
+    }
+
+    void Hash :: 
+        hash(const void *const data, const NATIVE_INT_TYPE len, HashBuffer& buffer)
+    {
+        FW_ASSERT(data);
+        FW_ASSERT(len >= 0, len);
+        const HASH_HANDLE_TYPE local_hash_handle = CRC32Engine::update(
+            CRC32Engine::INITIAL_VALUE,
+            data,
+            static_cast<NATIVE_UINT_TYPE>(len)
+        );
+        HashBuffer bufferOut;
+        // For CRC32 we need to return the one's compliment of the result:
+        Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
+        FW_ASSERT( Fw::FW_SERIALIZE_OK == status );
+        buffer = bufferOut;
+    }
+    
+    void Hash :: 
+        init(void)
+    {
+        this->hash_handle = CRC32Engine::INITIAL_VALUE;
+    }
+
+    void Hash :: 
+        update(const void *const data, NATIVE_INT_TYPE len)
+    {
+        FW_ASSERT(data);
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = CRC32Engine::update(
+            this->hash_handle,
+            data,
+            static_cast<NATIVE_UINT_TYPE>(len)
+        );
+    }
+    
+    void Hash :: 
+        final(HashBuffer& buffer)
+    {
+        HashBuffer bufferOut;
+        // For CRC32 we need to return the one's compliment of the result:
+        Fw::SerializeStatus status = bufferOut.serialize(~(this->hash_handle));
+        FW_ASSERT( Fw::FW_SERIALIZE_OK == status );
+        buffer = bufferOut;
+    }
+
+}
@@ -0,0 +1,240 @@
+// ======================================================================
+// \title  CRC32Engine.cpp
+// \brief  cpp file for the word-at-a-time CRC32 engine
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/crc32/CRC32Engine.hpp>
+#include <Utils/Hash/crc32/CRC32Tables.hpp>
+#include <Fw/Types/Assert.hpp>
+
+// Select a hardware kernel at build time. The portable slicing-by-8
+// kernel is always compiled as it handles the unaligned head and tail.
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+#define CRC32_ENGINE_PCLMUL 1
+#include <wmmintrin.h>
+#include <smmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+#define CRC32_ENGINE_ARMV8 1
+#include <arm_acle.h>
+#include <string.h>
+#endif
+
+namespace Utils {
+
+  namespace {
+
+    // ----------------------------------------------------------------------
+    // Portable slicing-by-8 kernel
+    // ----------------------------------------------------------------------
+
+    // Words are assembled byte by byte so the kernel is independent of
+    // both alignment and host endianness. Compilers fold this into a
+    // single load on little-endian targets.
+    inline U32 loadLe32(const U8* const p) {
+      return static_cast<U32>(p[0])
+          | (static_cast<U32>(p[1]) << 8)
+          | (static_cast<U32>(p[2]) << 16)
+          | (static_cast<U32>(p[3]) << 24);
+    }
+
+    U32 updateSlicing8(U32 crc, const U8* p, NATIVE_UINT_TYPE len) {
+
+      while (len >= 8) {
+        const U32 one = crc ^ loadLe32(p);
+        const U32 two = loadLe32(p + 4);
+        crc = CRC32_TABLES[7][one & 0xFF]
+            ^ CRC32_TABLES[6][(one >> 8) & 0xFF]
+            ^ CRC32_TABLES[5][(one >> 16) & 0xFF]
+            ^ CRC32_TABLES[4][one >> 24]
+            ^ CRC32_TABLES[3][two & 0xFF]
+            ^ CRC32_TABLES[2][(two >> 8) & 0xFF]
+            ^ CRC32_TABLES[1][(two >> 16) & 0xFF]
+            ^ CRC32_TABLES[0][two >> 24];
+        p += 8;
+        len -= 8;
+      }
+
+      while (len > 0) {
+        crc = (crc >> 8) ^ CRC32_TABLES[0][(crc ^ *p) & 0xFF];
+        p++;
+        len--;
+      }
+
+      return crc;
+    }
+
+#if CRC32_ENGINE_PCLMUL
+
+    // ----------------------------------------------------------------------
+    // Carry-less multiply folding kernel
+    //
+    // Folds 64 bytes per iteration and finishes with a Barrett reduction,
+    // following "Fast CRC Computation for Generic Polynomials Using
+    // PCLMULQDQ Instruction" (Intel, 2009). The constants are the
+    // bit-reflected fold constants for polynomial 0x04C11DB7.
+    // ----------------------------------------------------------------------
+
+    enum {
+      PCLMUL_MIN_LENGTH = 64, //!< Smallest input worth folding
+      PCLMUL_BLOCK_MASK = 15 //!< Folding consumes 16-byte blocks
+    };
+
+    U32 updatePclmul(U32 crc, const U8* p, NATIVE_UINT_TYPE len) {
+
+      // len is at least 64 and a multiple of 16
+      const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+      const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+      const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+      const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+      const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+      __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00));
+      __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10));
+      __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20));
+      __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30));
+      __m128i x5;
+
+      x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+      p += 64;
+      len -= 64;
+
+      // Fold four 128-bit lanes in parallel
+      while (len >= 64) {
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30)));
+
+        p += 64;
+        len -= 64;
+      }
+
+      // Fold the four lanes into one
+      x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+      x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+      x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+      // Fold any remaining 16-byte blocks
+      while (len >= 16) {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        p += 16;
+        len -= 16;
+      }
+
+      // Fold 128 bits to 64 bits
+      x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+      x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+      x2 = _mm_srli_si128(x1, 4);
+      x1 = _mm_and_si128(x1, mask32);
+      x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+      x1 = _mm_xor_si128(x1, x2);
+
+      // Barrett reduction to 32 bits
+      x2 = _mm_and_si128(x1, mask32);
+      x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+      x2 = _mm_and_si128(x2, mask32);
+      x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+      x1 = _mm_xor_si128(x1, x2);
+
+      return static_cast<U32>(_mm_extract_epi32(x1, 1));
+    }
+
+#elif CRC32_ENGINE_ARMV8
+
+    // ----------------------------------------------------------------------
+    // ARMv8 CRC32 extension kernel
+    // ----------------------------------------------------------------------
+
+    U32 updateArmv8(U32 crc, const U8* p, NATIVE_UINT_TYPE len) {
+
+      while (len >= 8) {
+        U64 word;
+        (void) memcpy(&word, p, sizeof(word));
+        crc = __crc32d(crc, word);
+        p += 8;
+        len -= 8;
+      }
+
+      while (len > 0) {
+        crc = __crc32b(crc, *p);
+        p++;
+        len--;
+      }
+
+      return crc;
+    }
+
+#endif
+
+  }
+
+  U32 CRC32Engine ::
+    update(U32 crc, const void* const data, const NATIVE_UINT_TYPE len)
+  {
+    FW_ASSERT(data);
+    const U8* p = static_cast<const U8*>(data);
+    NATIVE_UINT_TYPE remaining = len;
+#if CRC32_ENGINE_PCLMUL
+    if (remaining >= PCLMUL_MIN_LENGTH) {
+      const NATIVE_UINT_TYPE chunk = remaining & ~static_cast<NATIVE_UINT_TYPE>(PCLMUL_BLOCK_MASK);
+      crc = updatePclmul(crc, p, chunk);
+      p += chunk;
+      remaining -= chunk;
+    }
+#elif CRC32_ENGINE_ARMV8
+    return updateArmv8(crc, p, remaining);
+#endif
+    return updateSlicing8(crc, p, remaining);
+  }
+
+  U32 CRC32Engine ::
+    updateByte(const U32 crc, const U8 byte)
+  {
+    return (crc >> 8) ^ CRC32_TABLES[0][(crc ^ byte) & 0xFF];
+  }
+
+  const char* CRC32Engine ::
+    getImplementationString(void)
+  {
+#if CRC32_ENGINE_PCLMUL
+    return "pclmul";
+#elif CRC32_ENGINE_ARMV8
+    return "armv8-crc";
+#else
+    return "slicing-by-8";
+#endif
+  }
+
+}
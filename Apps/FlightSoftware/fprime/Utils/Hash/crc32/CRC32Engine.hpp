@@ -0,0 +1,68 @@
+// ======================================================================
+// \title  CRC32Engine.hpp
+// \brief  hpp file for the word-at-a-time CRC32 engine
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_CRC32_ENGINE_HPP
+#define UTILS_CRC32_ENGINE_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Utils {
+
+  //! \class CRC32Engine
+  //! \brief Table-driven CRC-32 (IEEE 802.3, reflected) kernel
+  //!
+  //! The engine computes the same CRC as update_crc_32() in libcrc, but
+  //! consumes eight bytes per step using the slicing-by-8 algorithm.
+  //! When the compiler targets a CPU with carry-less multiply
+  //! (-mpclmul -msse4.1) or the ARMv8 CRC32 extension (-march=armv8-a+crc),
+  //! a hardware path is selected at build time instead. All paths produce
+  //! bit-identical results.
+  //!
+  //! The engine operates on the raw CRC register: callers start from
+  //! INITIAL_VALUE and take the one's complement of the final register
+  //! to obtain the CRC-32 value.
+  //!
+  class CRC32Engine {
+
+    public:
+
+      enum {
+        INITIAL_VALUE = 0xFFFFFFFFU //!< Initial CRC register value
+      };
+
+      //! Update a CRC register with new data
+      //!
+      //! \return The updated CRC register
+      //!
+      static U32 update(
+          U32 crc, //!< The current CRC register
+          const void* const data, //!< Pointer to start of data
+          const NATIVE_UINT_TYPE len //!< Length of the data
+      );
+
+      //! Update a CRC register with a single byte
+      //!
+      //! \return The updated CRC register
+      //!
+      static U32 updateByte(
+          const U32 crc, //!< The current CRC register
+          const U8 byte //!< The byte to add
+      );
+
+      //! Get a string naming the kernel selected at build time
+      //!
+      static const char* getImplementationString(void);
+
+  };
+
+}
+
+#endif
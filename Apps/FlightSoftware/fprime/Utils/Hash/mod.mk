@@ -13,11 +13,18 @@
 
 # There are some standard files that are included for reference
 
-SRC = libcrc/CRC32.cpp \
+SRC = crc32/CRC32.cpp \
+      crc32/CRC32Engine.cpp \
       libcrc/lib_crc.c \
       HashBufferCommon.cpp \
       HashCommon.cpp
 
-HDR = libcrc/CRC32.hpp \
+HDR = crc32/CRC32.hpp \
+      crc32/CRC32Engine.hpp \
+      crc32/CRC32Tables.hpp \
+      libcrc/CRC32.hpp \
       Hash.hpp \
-      HashBuffer.hpp
+      HashBuffer.hpp \
+      IdHash.hpp
+
+SUBDIRS = test
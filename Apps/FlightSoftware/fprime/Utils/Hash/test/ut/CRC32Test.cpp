@@ -0,0 +1,168 @@
+// ======================================================================
+// \title  CRC32Test.cpp
+// \brief  Equivalence and throughput tests for the CRC32 hash backend
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/Hash.hpp>
+#include <Utils/Hash/crc32/CRC32Engine.hpp>
+#include <Os/IntervalTimer.hpp>
+
+extern "C" {
+#include <Utils/Hash/libcrc/lib_crc.h>
+}
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  enum {
+    MAX_DATA_SIZE = 4096, //!< Largest buffer used by the equivalence tests
+    RANDOM_ITERATIONS = 2000 //!< Randomized equivalence iterations
+  };
+
+  U8 s_data[MAX_DATA_SIZE + 16];
+
+  void fillRandom(U8* const data, const NATIVE_UINT_TYPE size) {
+    for (NATIVE_UINT_TYPE i = 0; i < size; i++) {
+      data[i] = static_cast<U8>(rand());
+    }
+  }
+
+  //! The reference: the byte-wise libcrc path used before the new backend
+  U32 referenceUpdate(U32 crc, const U8* const data, const NATIVE_UINT_TYPE size) {
+    for (NATIVE_UINT_TYPE i = 0; i < size; i++) {
+      crc = static_cast<U32>(update_crc_32(crc, static_cast<char>(data[i])));
+    }
+    return crc;
+  }
+
+  U32 hashToU32(Utils::HashBuffer& buffer) {
+    U32 value = 0;
+    buffer.resetDeser();
+    const Fw::SerializeStatus status = buffer.deserialize(value);
+    EXPECT_EQ(Fw::FW_SERIALIZE_OK, status);
+    return value;
+  }
+
+  //! Throughput of one kernel in MB/s
+  F64 measure(
+      const char* const name,
+      const bool reference,
+      const U8* const data,
+      const NATIVE_UINT_TYPE size,
+      const NATIVE_UINT_TYPE iterations
+  ) {
+    Os::IntervalTimer timer;
+    U32 crc = Utils::CRC32Engine::INITIAL_VALUE;
+    timer.start();
+    for (NATIVE_UINT_TYPE iter = 0; iter < iterations; iter++) {
+      if (reference) {
+        crc = referenceUpdate(crc, data, size);
+      } else {
+        crc = Utils::CRC32Engine::update(crc, data, size);
+      }
+    }
+    timer.stop();
+    U32 usec = timer.getDiffUsec();
+    if (usec == 0) {
+      usec = 1;
+    }
+    const F64 mbps = (static_cast<F64>(size) * iterations) / usec;
+    printf("  %-14s %6u bytes x %6u: %8u us, %9.1f MB/s (crc 0x%08X)\n",
+        name, size, iterations, usec, mbps, ~crc);
+    return mbps;
+  }
+
+}
+
+TEST(CRC32Test, KnownAnswer) {
+  // Standard CRC-32 check value
+  const char* const check = "123456789";
+  Utils::HashBuffer buffer;
+  Utils::Hash::hash(check, 9, buffer);
+  ASSERT_EQ(0xCBF43926U, hashToU32(buffer));
+}
+
+TEST(CRC32Test, EveryLengthAndOffset) {
+  printf("Testing CRC32 kernel: %s\n", Utils::CRC32Engine::getImplementationString());
+  fillRandom(s_data, sizeof(s_data));
+  // All offsets within a 16-byte window and all lengths up to a few
+  // folding blocks exercise the head, body and tail of every kernel
+  for (NATIVE_UINT_TYPE offset = 0; offset < 16; offset++) {
+    for (NATIVE_UINT_TYPE size = 0; size <= 300; size++) {
+      const U32 expected = referenceUpdate(0xFFFFFFFFU, &s_data[offset], size);
+      const U32 actual = Utils::CRC32Engine::update(0xFFFFFFFFU, &s_data[offset], size);
+      ASSERT_EQ(expected, actual) << "offset " << offset << " size " << size;
+    }
+  }
+}
+
+TEST(CRC32Test, RandomizedIncremental) {
+  for (NATIVE_UINT_TYPE iter = 0; iter < RANDOM_ITERATIONS; iter++) {
+    const NATIVE_UINT_TYPE size = static_cast<NATIVE_UINT_TYPE>(rand()) % MAX_DATA_SIZE;
+    const NATIVE_UINT_TYPE offset = static_cast<NATIVE_UINT_TYPE>(rand()) % 16;
+    fillRandom(&s_data[offset], size);
+
+    // Expected value from the legacy byte-wise computation
+    const U32 expected = ~referenceUpdate(0xFFFFFFFFU, &s_data[offset], size);
+
+    // One-shot hash
+    Utils::HashBuffer oneShot;
+    Utils::Hash::hash(&s_data[offset], size, oneShot);
+    ASSERT_EQ(expected, hashToU32(oneShot));
+
+    // Incremental hash with random split points
+    Utils::Hash hash;
+    hash.init();
+    NATIVE_UINT_TYPE done = 0;
+    while (done < size) {
+      NATIVE_UINT_TYPE chunk = 1 + static_cast<NATIVE_UINT_TYPE>(rand()) % 200;
+      if (chunk > size - done) {
+        chunk = size - done;
+      }
+      hash.update(&s_data[offset + done], chunk);
+      done += chunk;
+    }
+    Utils::HashBuffer incremental;
+    hash.final(incremental);
+    ASSERT_EQ(expected, hashToU32(incremental));
+  }
+}
+
+TEST(CRC32Test, ByteUpdate) {
+  fillRandom(s_data, 256);
+  U32 crc = 0xFFFFFFFFU;
+  for (NATIVE_UINT_TYPE i = 0; i < 256; i++) {
+    crc = Utils::CRC32Engine::updateByte(crc, s_data[i]);
+  }
+  ASSERT_EQ(referenceUpdate(0xFFFFFFFFU, s_data, 256), crc);
+}
+
+TEST(CRC32Test, Throughput) {
+  const NATIVE_UINT_TYPE sizes[] = { 64, 512, MAX_DATA_SIZE };
+  fillRandom(s_data, sizeof(s_data));
+  printf("CRC32 throughput (%s):\n", Utils::CRC32Engine::getImplementationString());
+  for (NATIVE_UINT_TYPE i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    // Roughly 16 MB of data per kernel and size
+    const NATIVE_UINT_TYPE iterations = (16 * 1024 * 1024) / sizes[i];
+    const F64 reference = measure("libcrc", true, s_data, sizes[i], iterations);
+    const F64 engine = measure("engine", false, s_data, sizes[i], iterations);
+    printf("  speedup: %.1fx\n", engine / reference);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  srand(0);
+  return RUN_ALL_TESTS();
+}
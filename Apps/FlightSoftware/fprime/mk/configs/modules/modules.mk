@@ -44,6 +44,7 @@ SVC_MODULES := \
 	Svc/CmdSequencer \
 	Svc/Seq \
 	Svc/GndIf \
+	Svc/Deframer \
 	Svc/ActiveRateGroup \
 	Svc/RateGroupDriver \
 	Svc/Sched \
@@ -87,6 +88,8 @@ LINUX_DRV_MODULES := \
 	Drv/GpioDriverPorts
 
 CUBEROVER_DRV_MODULES := \
+	Drv/DataTypes \
+	Drv/BlockDriver \
 	Drv/FreeRtosSerialDriver \
 	Drv/SerialDriverPorts
 
@@ -204,6 +207,7 @@ acdev_MODULES := \
 CubeRover_MODULES := \
 	CubeRover/Top \
 	CubeRover/CubeRoverPorts \
+	CubeRover/SimSerialDriver \
 	$(FW_MODULES) \
 	$(OS_MODULES) \
 	$(SVC_MODULES) \